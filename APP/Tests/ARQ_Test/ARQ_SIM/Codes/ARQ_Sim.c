@@ -0,0 +1,255 @@
+/**
+ * @file ARQ_Sim.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host test of the ARQ transport (Services/ARQ) , see ../README.md.
+ *         Two links (A sends , B receives) run over a simulated full-duplex UART line that corrupts bytes at random.
+ *         ARQ.c , CRC.c and COBS.c are built without changes , SysTick_GetTicks is the simulated time.
+ *         One JSON line is printed , the exit code is 1 if the data is not delivered intact and in order.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/************************************************************************/
+/*                            Inclusion                                 */
+/************************************************************************/
+/*
+* LIB
+*/
+#include "Std_Types.h"
+
+/*
+* Include MCAL layer files
+*/
+#include "SysTick_Interface.h"
+
+/*
+* Include Services layer files
+*/
+#include "ARQ.h"
+
+#define SIM_MAX_BYTES        200000UL
+#define SIM_LINE_BYTES       2000000UL   /**< bytes kept by one direction of the line */
+#define SIM_TIMEOUT_US       120000000.0 /**< the run fails if the data is not delivered in 120 s */
+
+/************************************************************************/
+/*                            Options                                   */
+/************************************************************************/
+static u32    Sim_u32Baud = 115200;
+static double Sim_Ber = 0.0;           /**< probability that a byte is corrupted (one bit flipped) */
+static u32    Sim_u32Bytes = 20000;
+static u32    Sim_u32LoopUs = 50;      /**< period of the super loop calling ARQ_MainFunction */
+static u32    Sim_u32Seed = 7;
+
+static void Sim_Usage(const char *name)
+{
+	fprintf(stderr, "usage: %s [--baud N] [--ber X] [--bytes N] [--loop-us N] [--seed N]\n", name);
+	exit(2);
+}
+
+static void Sim_ParseArgs(int argc, char **argv)
+{
+	int i;
+
+	for(i = 1; i < argc; i++)
+	{
+		if((0 == strcmp(argv[i], "--baud")) && (i + 1 < argc))
+		{
+			Sim_u32Baud = (u32)strtoul(argv[++i], NULL, 0);
+		}
+		else if((0 == strcmp(argv[i], "--ber")) && (i + 1 < argc))
+		{
+			Sim_Ber = atof(argv[++i]);
+		}
+		else if((0 == strcmp(argv[i], "--bytes")) && (i + 1 < argc))
+		{
+			Sim_u32Bytes = (u32)strtoul(argv[++i], NULL, 0);
+		}
+		else if((0 == strcmp(argv[i], "--loop-us")) && (i + 1 < argc))
+		{
+			Sim_u32LoopUs = (u32)strtoul(argv[++i], NULL, 0);
+		}
+		else if((0 == strcmp(argv[i], "--seed")) && (i + 1 < argc))
+		{
+			Sim_u32Seed = (u32)strtoul(argv[++i], NULL, 0);
+		}
+		else
+		{
+			Sim_Usage(argv[0]);
+		}
+	}
+	if((0 == Sim_u32Baud) || (0 == Sim_u32Bytes) || (Sim_u32Bytes > SIM_MAX_BYTES) || (0 == Sim_u32LoopUs)
+	   || (Sim_Ber < 0.0) || (Sim_Ber > 1.0))
+	{
+		Sim_Usage(argv[0]);
+	}
+}
+
+/************************************************************************/
+/*                            Time                                      */
+/************************************************************************/
+static double Sim_NowUs = 0.0;
+
+u16 SysTick_GetTicks(void)
+{
+	return (u16)(u32)(Sim_NowUs / 1000.0);
+}
+
+/************************************************************************/
+/*                            Line                                      */
+/************************************************************************/
+/**
+ * @brief one direction of the line : a byte is received one frame time after the end of the previous one.
+ */
+typedef struct
+{
+	u8     Data[SIM_LINE_BYTES];
+	double ArrivalUs[SIM_LINE_BYTES];
+	u32    Head;
+	u32    Tail;
+	double FreeUs;      /**< end of the byte on the line */
+	u32    Corrupted;
+}Sim_Line_t;
+
+static Sim_Line_t Sim_LineAB;
+static Sim_Line_t Sim_LineBA;
+static double Sim_ByteUs;
+
+static void Sim_LineSend(Sim_Line_t *line, u8 data)
+{
+	double start = (line->FreeUs > Sim_NowUs) ? line->FreeUs : Sim_NowUs;
+
+	if(line->Head >= SIM_LINE_BYTES)
+	{
+		fprintf(stderr, "line full\n");
+		exit(1);
+	}
+	line->FreeUs = start + Sim_ByteUs;
+	if((double)rand() / RAND_MAX < Sim_Ber)
+	{
+		data ^= (u8)(1 << (rand() % 8));
+		line->Corrupted++;
+	}
+	line->Data[line->Head] = data;
+	line->ArrivalUs[line->Head] = line->FreeUs;
+	line->Head++;
+}
+
+static Std_Status_t Sim_LineReceive(Sim_Line_t *line, u8 *pData)
+{
+	if((line->Tail < line->Head) && (line->ArrivalUs[line->Tail] <= Sim_NowUs))
+	{
+		*pData = line->Data[line->Tail++];
+		return STD_DONE;
+	}
+	return STD_PENDING;
+}
+
+static void         Sim_SendA(u8 data)        { Sim_LineSend(&Sim_LineAB, data); }
+static void         Sim_SendB(u8 data)        { Sim_LineSend(&Sim_LineBA, data); }
+static Std_Status_t Sim_ReceiveA(u8 *pData)   { return Sim_LineReceive(&Sim_LineBA, pData); }
+static Std_Status_t Sim_ReceiveB(u8 *pData)   { return Sim_LineReceive(&Sim_LineAB, pData); }
+
+/************************************************************************/
+/*                            Data                                      */
+/************************************************************************/
+static u8  Sim_arrSource[SIM_MAX_BYTES];
+static u32 Sim_u32Delivered = 0;
+static u32 Sim_u32Mismatches = 0;
+static u32 Sim_u32DeliveredToA = 0;
+
+static void Sim_DeliverA(const u8 data[], u8 len)
+{
+	(void)data;
+	Sim_u32DeliveredToA += len;
+}
+
+static void Sim_DeliverB(const u8 data[], u8 len)
+{
+	if((Sim_u32Delivered + len > Sim_u32Bytes) || (0 != memcmp(data, &Sim_arrSource[Sim_u32Delivered], len)))
+	{
+		Sim_u32Mismatches++;
+	}
+	Sim_u32Delivered += len;
+}
+
+/************************************************************************/
+/*                            Main                                      */
+/************************************************************************/
+int main(int argc, char **argv)
+{
+	static const ARQ_Config_t configA = {Sim_SendA, Sim_ReceiveA, Sim_DeliverA};
+	static const ARQ_Config_t configB = {Sim_SendB, Sim_ReceiveB, Sim_DeliverB};
+	static ARQ_Link_t linkA;
+	static ARQ_Link_t linkB;
+	const ARQ_Stats_t *statsA;
+	const ARQ_Stats_t *statsB;
+	u32 sent = 0;
+	u32 i;
+	double seconds;
+	double goodput;
+	u8 ok;
+
+	Sim_ParseArgs(argc, argv);
+	Sim_ByteUs = 10.0 * 1000000.0 / Sim_u32Baud;    // 8N1
+	srand(Sim_u32Seed);
+	for(i = 0; i < Sim_u32Bytes; i++)
+	{
+		Sim_arrSource[i] = (u8)rand();
+	}
+
+	if((STD_OK != ARQ_Init(&linkA, &configA)) || (STD_OK != ARQ_Init(&linkB, &configB)))
+	{
+		fprintf(stderr, "ARQ_Init\n");
+		return 1;
+	}
+
+	while((Sim_u32Delivered < Sim_u32Bytes) && (Sim_NowUs < SIM_TIMEOUT_US))
+	{
+		while(sent < Sim_u32Bytes)
+		{
+			u8 len = (Sim_u32Bytes - sent > ARQ_MAX_PAYLOAD) ? ARQ_MAX_PAYLOAD : (u8)(Sim_u32Bytes - sent);
+
+			// pfSendByte is a busy wait on the target : the sender cannot queue more than the UART sends
+			if(Sim_LineAB.FreeUs > Sim_NowUs + Sim_ByteUs)
+			{
+				break;
+			}
+			if(STD_OK != ARQ_Send(&linkA, &Sim_arrSource[sent], len))
+			{
+				break;
+			}
+			sent += len;
+		}
+		ARQ_MainFunction(&linkA);
+		ARQ_MainFunction(&linkB);
+		Sim_NowUs += Sim_u32LoopUs;
+		if((STD_ACTIVE != ARQ_GetStatus(&linkA)) || (STD_ACTIVE != ARQ_GetStatus(&linkB)))
+		{
+			fprintf(stderr, "link down\n");
+			break;
+		}
+	}
+
+	statsA = ARQ_GetStats(&linkA);
+	statsB = ARQ_GetStats(&linkB);
+	seconds = Sim_NowUs / 1000000.0;
+	goodput = Sim_u32Delivered * 10.0 / seconds;
+	ok = (Sim_u32Delivered == Sim_u32Bytes) && (0 == Sim_u32Mismatches) && (0 == Sim_u32DeliveredToA)
+	     && (statsB->PayloadBytesDelivered == Sim_u32Bytes);
+
+	printf("{\"baud\":%lu,\"ber\":%g,\"window\":%u,\"payload\":%u,\"bytes\":%lu,\"delivered\":%lu,\"mismatches\":%lu,"
+	       "\"time_s\":%.3f,\"goodput_pct\":%.1f,\"corrupted\":%lu,\"data_frames\":%u,\"retransmissions\":%u,"
+	       "\"bad_frames_a\":%u,\"bad_frames_b\":%u,\"line_bytes_a\":%lu,\"line_bytes_b\":%lu,\"ok\":%u}\n",
+	       (unsigned long)Sim_u32Baud, Sim_Ber, ARQ_WINDOW_SIZE, ARQ_MAX_PAYLOAD, (unsigned long)Sim_u32Bytes,
+	       (unsigned long)Sim_u32Delivered, (unsigned long)Sim_u32Mismatches,
+	       seconds, 100.0 * goodput / Sim_u32Baud, (unsigned long)(Sim_LineAB.Corrupted + Sim_LineBA.Corrupted),
+	       statsA->DataFramesSent, statsA->Retransmissions, statsA->BadFrames, statsB->BadFrames,
+	       (unsigned long)statsA->LineBytesSent, (unsigned long)statsB->LineBytesSent, ok);
+	return ok ? 0 : 1;
+}
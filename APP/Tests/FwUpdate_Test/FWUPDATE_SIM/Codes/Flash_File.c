@@ -0,0 +1,171 @@
+/**
+ * @file Flash_File.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the file backed flash model of the firmware update test.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+* LIB
+*/
+#include "Std_Types.h"
+
+/*
+* the module under test
+*/
+#include "FwUpdate.h"
+#include "FwUpdate_Lcfg.h"
+
+/*
+* the simulated time
+*/
+#include "Sim_USART.h"
+
+/*
+* own files
+*/
+#include "Flash_File.h"
+
+/************************************************************************/
+/*                            Variables                                 */
+/************************************************************************/
+static FILE *Flash_pFile = NULL_PTR;
+static u32 Flash_u32StagingSize = 0;
+static u64 Flash_u64PageWriteCycles = 0;
+static u8 *Flash_pWritten = NULL_PTR;          /**< one flag per page */
+static Flash_FileStats_t Flash_Stats;
+
+/************************************************************************/
+/*                            Helpers                                   */
+/************************************************************************/
+/**
+ * @brief Writes one page of the file (the mark page included).
+ */
+static Std_Error_t Flash_WriteRaw(u32 offset, const u8 page[])
+{
+	if((0 != fseek(Flash_pFile, (long)offset, SEEK_SET)) || (1 != fwrite(page, FWUPDATE_PAGE_SIZE, 1, Flash_pFile)))
+	{
+		return STD_NOK;
+	}
+	fflush(Flash_pFile);
+	// the AVR backend disables the interrupts during the write : the ACK must come after it
+	if(STD_FALSE == Sim_TxIdle())
+	{
+		Flash_Stats.WritesAfterReply++;
+	}
+	// the CPU waits for the flash
+	Sim_Work(Flash_u64PageWriteCycles);
+	return STD_OK;
+}
+
+/**
+ * @brief Writes the mark page.
+ */
+static Std_Error_t Flash_WriteMark(const u8 mark[], u8 len)
+{
+	u8 page[FWUPDATE_PAGE_SIZE];
+
+	memset(page, 0xFF, sizeof(page));
+	memcpy(page, mark, len);
+	return Flash_WriteRaw(Flash_u32StagingSize, page);
+}
+
+/************************************************************************/
+/*                            Backend                                   */
+/************************************************************************/
+static Std_Error_t Flash_Begin(u32 imageSize)
+{
+	(void)imageSize;
+	Flash_Stats.Begins++;
+	return Flash_WriteMark((const u8*)"", 0);
+}
+
+static Std_Error_t Flash_WritePage(u32 offset, const u8 page[])
+{
+	u32 index = offset / FWUPDATE_PAGE_SIZE;
+
+	if((0 != (offset % FWUPDATE_PAGE_SIZE)) || ((offset + FWUPDATE_PAGE_SIZE) > Flash_u32StagingSize))
+	{
+		Flash_Stats.BadWrites++;
+		return STD_INVALID_ARG;
+	}
+	Flash_Stats.PageWrites++;
+	if(0 != Flash_pWritten[index])
+	{
+		Flash_Stats.Rewrites++;
+	}
+	Flash_pWritten[index] = 1;
+	return Flash_WriteRaw(offset, page);
+}
+
+static Std_Error_t Flash_Commit(u32 imageSize, u16 imageCrc)
+{
+	u8 mark[10] = {'F', 'W', 'U', 'P',
+	               (u8)imageSize, (u8)(imageSize >> 8), (u8)(imageSize >> 16), (u8)(imageSize >> 24),
+	               (u8)imageCrc, (u8)(imageCrc >> 8)};
+
+	Flash_Stats.Commits++;
+	return Flash_WriteMark(mark, sizeof(mark));
+}
+
+static FwUpdate_Flash_t Flash_Backend = {0, Flash_Begin, Flash_WritePage, Flash_Commit};
+
+/************************************************************************/
+/*                            PUPLIC Functions                          */
+/************************************************************************/
+const FwUpdate_Flash_t* Flash_FileOpen(const char *path, u32 stagingSize, u32 pageWriteUs, u32 fcpu)
+{
+	u8 erased[FWUPDATE_PAGE_SIZE];
+	u32 offset;
+
+	Flash_pFile = fopen(path, "w+b");
+	Flash_pWritten = calloc(stagingSize / FWUPDATE_PAGE_SIZE, 1);
+	if((NULL_PTR == Flash_pFile) || (NULL_PTR == Flash_pWritten))
+	{
+		return NULL_PTR;
+	}
+	memset(erased, 0xFF, sizeof(erased));
+	for(offset=0; offset<=stagingSize; offset+=FWUPDATE_PAGE_SIZE)
+	{
+		fwrite(erased, sizeof(erased), 1, Flash_pFile);
+	}
+	fflush(Flash_pFile);
+	memset(&Flash_Stats, 0, sizeof(Flash_Stats));
+	Flash_u32StagingSize = stagingSize;
+	Flash_u64PageWriteCycles = ((u64)fcpu * pageWriteUs) / 1000000UL;
+	Flash_Backend.Size = stagingSize;
+
+	return &Flash_Backend;
+}
+
+void Flash_FileClose(void)
+{
+	if(NULL_PTR != Flash_pFile)
+	{
+		fclose(Flash_pFile);
+		Flash_pFile = NULL_PTR;
+	}
+	free(Flash_pWritten);
+	Flash_pWritten = NULL_PTR;
+}
+
+Std_Error_t Flash_FileRead(u32 offset, u8 buffer[], u32 len)
+{
+	if((0 != fseek(Flash_pFile, (long)offset, SEEK_SET)) || (len != fread(buffer, 1, len, Flash_pFile)))
+	{
+		return STD_NOK;
+	}
+	return STD_OK;
+}
+
+const Flash_FileStats_t* Flash_FileGetStats(void)
+{
+	return &Flash_Stats;
+}
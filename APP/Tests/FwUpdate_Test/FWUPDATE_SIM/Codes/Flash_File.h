@@ -0,0 +1,76 @@
+/**
+ * @file Flash_File.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  File backed flash model of the firmware update test : a FwUpdate_Flash_t backend for the host.
+ *         The file is the staging area followed by the mark page , like FwUpdate_FlashAvr.c :
+ *           - every page write is checked (page aligned , inside the staging area) and takes the time of the flash
+ *           - the commit writes the mark "FWUP" + size + CRC in the last page
+ *         so the test can check the staged image and the mark after the transfer.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef FLASH_FILE_H_
+#define FLASH_FILE_H_
+
+#include "Std_Types.h"
+#include "FwUpdate.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief the counters of the flash model.
+ */
+typedef struct
+{
+	u32 PageWrites;
+	u32 Rewrites;      /**< pages written more than once */
+	u32 BadWrites;     /**< writes not aligned or out of the staging area (refused) */
+	u32 Begins;
+	u32 Commits;
+	u32 WritesAfterReply;  /**< pages written while a reply of the receiver was on the line : the sender may send during the write */
+}Flash_FileStats_t;
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Creates the flash file erased (0xFF) and returns the backend.
+ *
+ * @param path the file.
+ * @param stagingSize bytes of the staging area (multiple of FWUPDATE_PAGE_SIZE).
+ * @param pageWriteUs time of the erase and the write of one page (the CPU waits).
+ * @param fcpu the CPU frequency of the model.
+ * @return const FwUpdate_Flash_t* the backend , NULL_PTR if the file can not be created.
+ */
+const FwUpdate_Flash_t* Flash_FileOpen(const char *path, u32 stagingSize, u32 pageWriteUs, u32 fcpu);
+
+/**
+ * @brief Closes the file.
+ */
+void Flash_FileClose(void);
+
+/**
+ * @brief Reads bytes of the flash file.
+ *
+ * @return Std_Error_t STD_OK , STD_NOK if the file is shorter.
+ */
+Std_Error_t Flash_FileRead(u32 offset, u8 buffer[], u32 len);
+
+/**
+ * @brief Gets the counters.
+ */
+const Flash_FileStats_t* Flash_FileGetStats(void);
+
+
+#endif /* FLASH_FILE_H_ */
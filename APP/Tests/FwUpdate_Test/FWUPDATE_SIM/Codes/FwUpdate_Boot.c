@@ -0,0 +1,315 @@
+/**
+ * @file FwUpdate_Boot.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host test of the ATmega32 backend and boot loader of the firmware update (FwUpdate_FlashAvr.c) , see ../README.md.
+ *         FwUpdate_FlashAvr.c is built without changes on a model of the 32 KB flash and of SPM (Codes/host/avr) :
+ *           - an erase sets the page to 0xFF , a write can only clear bits (a page written without its erase is wrong)
+ *           - a write out of the application and staging areas (the boot section) is refused and counted
+ *           - a power cut can be set on the Nth erase or write : the erase is done , the write is not
+ *         A packed image (FwUpdate_Pack.py) is staged and committed through the backend ,
+ *         then FwUpdate_AvrBoot is checked : the copy , a power cut at every SPM operation of the copy ,
+ *         a damaged staging area , a bad size and the resets without a mark.
+ *         One JSON line is printed , the exit code is 1 if a check fails.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+
+/************************************************************************/
+/*                            Inclusion                                 */
+/************************************************************************/
+/*
+* LIB
+*/
+#include "Std_Types.h"
+#include "Utils_interrupt.h"
+
+/*
+* Include Services layer files
+*/
+#include "FwUpdate.h"
+#include "FwUpdate_Lcfg.h"
+#include "FwUpdate_FlashAvr.h"
+
+#include <avr/boot.h>
+
+#define SIM_FLASH_SIZE       0x8000
+#define SIM_BOOT_START       0x7000   /**< the boot section : never written by the backend */
+#define SIM_OLD_APP(i)       ((u8)((i) * 7 + 3))
+
+/************************************************************************/
+/*                            Flash model                               */
+/************************************************************************/
+volatile u8 Sim_SREG = 0;
+
+static u8 Sim_arrFlash[SIM_FLASH_SIZE];
+static u8 Sim_arrPageBuffer[SPM_PAGESIZE];
+static u32 Sim_u32SpmOps;          /**< erases and writes */
+static u32 Sim_u32BadOps;          /**< unaligned or in the boot section */
+static u32 Sim_u32CutAt;           /**< 0 : no power cut , N : the power is cut at the Nth erase or write */
+static jmp_buf Sim_PowerCut;
+
+static u32 Check_u32Failed = 0;
+static u32 Check_u32Passed = 0;
+
+u8 Sim_FlashRead(u16 address)
+{
+	return Sim_arrFlash[address % SIM_FLASH_SIZE];
+}
+
+static u8 Sim_SpmOperation(u16 address)
+{
+	Sim_u32SpmOps++;
+	if((0 != (address % SPM_PAGESIZE)) || (address >= SIM_BOOT_START))
+	{
+		Sim_u32BadOps++;
+		return 0;
+	}
+	return 1;
+}
+
+void Sim_SpmErase(u16 address)
+{
+	if(Sim_SpmOperation(address))
+	{
+		memset(&Sim_arrFlash[address], 0xFF, SPM_PAGESIZE);
+	}
+	if(Sim_u32CutAt == Sim_u32SpmOps)
+	{
+		longjmp(Sim_PowerCut, 1);
+	}
+}
+
+void Sim_SpmFill(u16 address, u16 word)
+{
+	Sim_arrPageBuffer[address % SPM_PAGESIZE] = (u8)word;
+	Sim_arrPageBuffer[(address + 1) % SPM_PAGESIZE] = (u8)(word >> 8);
+}
+
+void Sim_SpmWrite(u16 address)
+{
+	u16 i;
+
+	if(Sim_u32CutAt == Sim_u32SpmOps + 1)
+	{
+		Sim_u32SpmOps++;
+		longjmp(Sim_PowerCut, 1);
+	}
+	if(Sim_SpmOperation(address))
+	{
+		for(i = 0; i < SPM_PAGESIZE; i++)
+		{
+			Sim_arrFlash[address + i] &= Sim_arrPageBuffer[i];
+		}
+	}
+	memset(Sim_arrPageBuffer, 0xFF, SPM_PAGESIZE);
+}
+
+/* the old application , the staging area and the boot section erased */
+static void Sim_FlashReset(void)
+{
+	u32 i;
+
+	for(i = 0; i < SIM_FLASH_SIZE; i++)
+	{
+		Sim_arrFlash[i] = (i < FWUPDATE_AVR_STAGING_START) ? SIM_OLD_APP(i) : 0xFF;
+	}
+	memset(Sim_arrPageBuffer, 0xFF, SPM_PAGESIZE);
+	Sim_u32SpmOps = 0;
+	Sim_u32BadOps = 0;
+	Sim_u32CutAt = 0;
+}
+
+/* a reset : FwUpdate_AvrBoot runs , cut is the SPM operation where the power is cut (0 : none) */
+static Std_Status_t Sim_Boot(u32 cut, u8 *cutHappened)
+{
+	volatile Std_Status_t status = STD_PENDING;
+
+	Sim_u32SpmOps = 0;
+	Sim_u32CutAt = cut;
+	*cutHappened = 0;
+	if(0 == setjmp(Sim_PowerCut))
+	{
+		status = FwUpdate_AvrBoot();
+	}
+	else
+	{
+		*cutHappened = 1;
+	}
+	Sim_u32CutAt = 0;
+	return status;
+}
+
+/************************************************************************/
+/*                            Helpers                                   */
+/************************************************************************/
+static void Check(Std_Bool_t ok, const char *name, const char *what)
+{
+	if(STD_TRUE == ok)
+	{
+		Check_u32Passed++;
+	}
+	else
+	{
+		Check_u32Failed++;
+		fprintf(stderr, "FAILED %s : %s\n", name, what);
+	}
+}
+
+#define CHECK(name, cond)      Check((cond) ? STD_TRUE : STD_FALSE, (name), #cond)
+
+static u8 Check_AppIsImage(const u8 image[], u32 size)
+{
+	return (0 == memcmp(Sim_arrFlash, image, size)) ? 1 : 0;
+}
+
+static u8 Check_AppIsOld(void)
+{
+	u32 i;
+
+	for(i = 0; i < FWUPDATE_AVR_STAGING_START; i++)
+	{
+		if(SIM_OLD_APP(i) != Sim_arrFlash[i])
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static u8 Check_MarkErased(void)
+{
+	u32 i;
+
+	for(i = 0; i < SPM_PAGESIZE; i++)
+	{
+		if(0xFF != Sim_arrFlash[FWUPDATE_AVR_MARK_ADDRESS + i])
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/* the update through the backend : the mark of the previous image is removed , the pages are staged , the image is committed */
+static u8 Check_Stage(const u8 image[], u32 size, u16 crc)
+{
+	u8 page[FWUPDATE_PAGE_SIZE];
+	u32 offset;
+
+	if(STD_OK != FwUpdate_FlashAvr.pfBegin(size))
+	{
+		return 0;
+	}
+	for(offset = 0; offset < size; offset += FWUPDATE_PAGE_SIZE)
+	{
+		memset(page, 0x1A, FWUPDATE_PAGE_SIZE);
+		memcpy(page, &image[offset], ((size - offset) < FWUPDATE_PAGE_SIZE) ? (size - offset) : FWUPDATE_PAGE_SIZE);
+		if(STD_OK != FwUpdate_FlashAvr.pfWritePage(offset, page))
+		{
+			return 0;
+		}
+	}
+	return (STD_OK == FwUpdate_FlashAvr.pfCommit(size, crc)) ? 1 : 0;
+}
+
+/************************************************************************/
+/*                            Main                                      */
+/************************************************************************/
+int main(int argc, char *argv[])
+{
+	static u8 arrFile[FWUPDATE_BLOCK_SIZE + SIM_FLASH_SIZE];
+	const u8 *image = &arrFile[FWUPDATE_BLOCK_SIZE];
+	FILE *f;
+	size_t len;
+	u32 size;
+	u16 crc;
+	u32 copyOps;
+	u32 cut;
+	u32 cutsRecovered = 0;
+	u8 cutHappened;
+	Std_Status_t status;
+
+	if((argc != 2) || (NULL == (f = fopen(argv[1], "rb"))))
+	{
+		fprintf(stderr, "usage: %s IMAGE.fwu\n", argv[0]);
+		return 2;
+	}
+	len = fread(arrFile, 1, sizeof(arrFile), f);
+	fclose(f);
+	size = (u32)arrFile[4] | ((u32)arrFile[5] << 8) | ((u32)arrFile[6] << 16) | ((u32)arrFile[7] << 24);
+	crc = (u16)(arrFile[8] | (arrFile[9] << 8));
+	if((len < FWUPDATE_BLOCK_SIZE + size) || (0 != memcmp(arrFile, FWUPDATE_HEADER_MAGIC, 4)))
+	{
+		fprintf(stderr, "%s : not a packed image\n", argv[1]);
+		return 2;
+	}
+
+	// no mark : the application starts , nothing is written
+	Sim_FlashReset();
+	status = Sim_Boot(0, &cutHappened);
+	CHECK("no mark", (STD_IDLE == status) && (0 == Sim_u32SpmOps) && Check_AppIsOld());
+
+	// the copy
+	CHECK("stage", Check_Stage(image, size, crc) && (0 == Sim_u32BadOps));
+	status = Sim_Boot(0, &cutHappened);
+	copyOps = Sim_u32SpmOps;
+	CHECK("copy", (STD_DONE == status) && Check_AppIsImage(image, size) && Check_MarkErased() && (0 == Sim_u32BadOps));
+	CHECK("copy : one erase and one write per page and for the mark", copyOps == 2 * ((size + SPM_PAGESIZE - 1) / SPM_PAGESIZE + 1));
+	status = Sim_Boot(0, &cutHappened);
+	CHECK("reset after the copy", (STD_IDLE == status) && (0 == Sim_u32SpmOps) && Check_AppIsImage(image, size));
+
+	// a power cut at every erase and write of the copy : the next reset copies the image again ,
+	// or starts the copied image if the cut hit the erase of the mark
+	for(cut = 1; cut <= copyOps; cut++)
+	{
+		u8 cutBefore;
+
+		Sim_FlashReset();
+		(void)Check_Stage(image, size, crc);
+		(void)Sim_Boot(cut, &cutBefore);
+		status = Sim_Boot(0, &cutHappened);
+		if(cutBefore && ((STD_DONE == status) || (STD_IDLE == status)) && Check_AppIsImage(image, size) && Check_MarkErased() && (0 == Sim_u32BadOps))
+		{
+			cutsRecovered++;
+		}
+		else
+		{
+			fprintf(stderr, "power cut at SPM operation %lu : status %d\n", (unsigned long)cut, (int)status);
+		}
+	}
+	CHECK("power cuts", copyOps == cutsRecovered);
+
+	// a staging area damaged after the commit : no copy , the mark is removed
+	Sim_FlashReset();
+	(void)Check_Stage(image, size, crc);
+	Sim_arrFlash[FWUPDATE_AVR_STAGING_START + size / 2] ^= 0x10;
+	status = Sim_Boot(0, &cutHappened);
+	CHECK("damaged staging", (STD_ERROR == status) && Check_AppIsOld() && Check_MarkErased());
+	status = Sim_Boot(0, &cutHappened);
+	CHECK("reset after the damaged staging", (STD_IDLE == status) && Check_AppIsOld());
+
+	// a mark with a size out of the staging area
+	Sim_FlashReset();
+	(void)Check_Stage(image, size, crc);
+	(void)FwUpdate_FlashAvr.pfCommit(FWUPDATE_AVR_STAGING_SIZE, crc);
+	status = Sim_Boot(0, &cutHappened);
+	CHECK("bad size", (STD_ERROR == status) && Check_AppIsOld() && Check_MarkErased());
+
+	// a new update removes the mark before its first page
+	Sim_FlashReset();
+	(void)Check_Stage(image, size, crc);
+	(void)FwUpdate_FlashAvr.pfBegin(size);
+	CHECK("begin removes the mark", Check_MarkErased() && (STD_IDLE == Sim_Boot(0, &cutHappened)));
+
+	printf("{\"image_bytes\":%lu,\"copy_spm_ops\":%lu,\"power_cuts_recovered\":%lu,\"passed\":%lu,\"failed\":%lu}\n",
+	       (unsigned long)size, (unsigned long)copyOps, (unsigned long)cutsRecovered,
+	       (unsigned long)Check_u32Passed, (unsigned long)Check_u32Failed);
+	return (0 == Check_u32Failed) ? 0 : 1;
+}
@@ -0,0 +1,386 @@
+/**
+ * @file FwUpdate_Sender.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host test of the firmware update receiver (Services/FwUpdate) , see ../README.md.
+ *         UART.c , FwUpdate.c and CRC.c are built without changes against the USART model of the UART benchmark
+ *         and the pages go to a file backed flash model (Flash_File.c).
+ *         An XMODEM-CRC sender sends a packed image (FwUpdate_Pack.py) on the RX line of the model ,
+ *         it can corrupt blocks , lose ACKs or change the image , then the staged image and the mark are checked.
+ *         One JSON line is printed , the exit code is 1 if the result is not the expected one.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/************************************************************************/
+/*                            Inclusion                                 */
+/************************************************************************/
+/*
+* LIB
+*/
+#include "Std_Types.h"
+#include "Utils_interrupt.h"
+
+/*
+* Include MCAL layer files
+*/
+#include "UART_interface.h"
+#include "SysTick_Interface.h"
+
+/*
+* Include Services layer files
+*/
+#include "CRC.h"
+#include "FwUpdate.h"
+#include "FwUpdate_Lcfg.h"
+
+/*
+* the simulated USART and flash
+*/
+#include "Sim_USART.h"
+#include "Flash_File.h"
+
+/************************************************************************/
+/*                            Configuration                             */
+/************************************************************************/
+#define SENDER_MAX_FILE          (64UL * 1024UL)
+#define SENDER_PACKET_SIZE       (3 + FWUPDATE_BLOCK_SIZE + 2)
+#define SENDER_REPLY_TIMEOUT_MS  12000    /**< more than FWUPDATE_BLOCK_TIMEOUT_MS */
+#define SENDER_RESEND_MS         100      /**< wait before a block is sent again after a lost ACK */
+#define SENDER_MAX_TRIES         16
+#define SENDER_PAD               0x1A
+
+typedef struct
+{
+	u32 Fcpu;
+	u8  Baud;             /**< BAUD_xxx */
+	u32 LoopUs;           /**< period of the main loop of the receiver */
+	u32 PageWriteUs;      /**< erase + write of one flash page */
+	u32 StagingSize;
+	u32 CorruptEvery;     /**< the first try of every Nth block is corrupted (0 : never) */
+	u32 LoseAckEvery;     /**< the ACK of every Nth block is lost (0 : never) */
+	Std_Bool_t Tamper;    /**< one byte of the image is changed with a good block CRC : the image CRC fails */
+	const char *Image;
+	const char *Flash;
+	const char *Expect;   /**< the expected error (none , verify , too_big , header ...) */
+}Sender_Config_t;
+
+static const u32 Sender_arrBaudValues[TOTAL_BAUD_RATE] = {2400, 4800, 9600, 14400, 19200, 28800};
+static const char *Sender_arrErrors[] = {"none", "no_sender", "retries", "sequence", "header", "too_big", "flash", "verify", "cancelled"};
+
+static Sender_Config_t Sender_Config = {8000000UL, BAUD_9600, 200, 9000, 0x3780, 0, 0, STD_FALSE, NULL_PTR, "build/flash.bin", "none"};
+
+static u8  Sender_arrFile[SENDER_MAX_FILE];
+static u32 Sender_u32FileLen;
+static u8  Sender_arrPacket[SENDER_PACKET_SIZE];   /**< stays valid while the model sends it */
+static u32 Sender_u32TxSeen = 0;                   /**< bytes of the receiver already read */
+
+/************************************************************************/
+/*                            SysTick of the host                       */
+/************************************************************************/
+/**
+ * @brief the ticks (ms) of the timeouts come from the simulated time.
+ */
+u16 SysTick_GetTicks(void)
+{
+	return (u16)Sim_GetMillis();
+}
+
+/************************************************************************/
+/*                            Helpers                                   */
+/************************************************************************/
+/**
+ * @brief One turn of the super loop of the receiver.
+ */
+static Std_Status_t Sender_Loop(void)
+{
+	Std_Status_t status = FwUpdate_MainFunction();
+
+	Sim_Work(((u64)Sender_Config.Fcpu * Sender_Config.LoopUs) / 1000000UL);
+	return status;
+}
+
+/**
+ * @brief Runs the receiver until it sends a byte or the timeout.
+ *
+ * @return int the byte , -1 on timeout.
+ */
+static int Sender_WaitReply(u32 timeoutMs)
+{
+	u32 start = Sim_GetMillis();
+	u32 len;
+	const u8 *line;
+
+	while((Sim_GetMillis() - start) < timeoutMs)
+	{
+		Sender_Loop();
+		line = Sim_TxCapture(&len);
+		if(len > Sender_u32TxSeen)
+		{
+			Sender_u32TxSeen++;
+			return line[Sender_u32TxSeen - 1];
+		}
+	}
+	return -1;
+}
+
+/**
+ * @brief Sends bytes on the RX line of the receiver and runs the receiver until the last one arrives.
+ */
+static void Sender_Send(const u8 data[], u32 len)
+{
+	Sim_RxFeed(data, len, 0);
+	while(STD_FALSE == Sim_RxFeedDone())
+	{
+		Sender_Loop();
+	}
+}
+
+/**
+ * @brief Builds the XMODEM-CRC packet of a block (the last block is padded).
+ */
+static void Sender_BuildPacket(u32 block, Std_Bool_t corrupt)
+{
+	u32 offset = block * FWUPDATE_BLOCK_SIZE;
+	u32 len = (Sender_u32FileLen - offset < FWUPDATE_BLOCK_SIZE) ? (Sender_u32FileLen - offset) : FWUPDATE_BLOCK_SIZE;
+	u16 crc = 0;
+	u32 i;
+
+	Sender_arrPacket[0] = 0x01;
+	Sender_arrPacket[1] = (u8)(block + 1);
+	Sender_arrPacket[2] = (u8)~(block + 1);
+	memcpy(&Sender_arrPacket[3], &Sender_arrFile[offset], len);
+	memset(&Sender_arrPacket[3 + len], SENDER_PAD, FWUPDATE_BLOCK_SIZE - len);
+	for(i=0; i<FWUPDATE_BLOCK_SIZE; i++)
+	{
+		crc = CRC16_Update(crc, Sender_arrPacket[3 + i]);
+	}
+	Sender_arrPacket[3 + FWUPDATE_BLOCK_SIZE] = (u8)(crc >> 8);
+	Sender_arrPacket[4 + FWUPDATE_BLOCK_SIZE] = (u8)crc;
+	if(STD_TRUE == corrupt)
+	{
+		// a bit error on the line : the block CRC fails
+		Sender_arrPacket[3 + (block % FWUPDATE_BLOCK_SIZE)] ^= 0x10;
+	}
+}
+
+/************************************************************************/
+/*                            Sender                                    */
+/************************************************************************/
+typedef struct
+{
+	u32 Blocks;
+	u32 Resent;
+	u32 LostAcks;
+	Std_Bool_t Cancelled;
+}Sender_Result_t;
+
+/**
+ * @brief XMODEM-CRC sender : waits for 'C' , sends the blocks and the EOT.
+ */
+static void Sender_Run(Sender_Result_t *res)
+{
+	u32 blocks = (Sender_u32FileLen + FWUPDATE_BLOCK_SIZE - 1) / FWUPDATE_BLOCK_SIZE;
+	u32 block, tries;
+	int reply;
+	u8 eot = 0x04;
+
+	memset(res, 0, sizeof(*res));
+	do
+	{
+		reply = Sender_WaitReply(SENDER_REPLY_TIMEOUT_MS);
+	}while((-1 != reply) && ('C' != reply));
+	if(-1 == reply)
+	{
+		return;
+	}
+
+	for(block=0; block<blocks; block++)
+	{
+		for(tries=0; tries<SENDER_MAX_TRIES; tries++)
+		{
+			Sender_BuildPacket(block, ((0 != Sender_Config.CorruptEvery) && (0 == tries) &&
+			                           (0 == ((block + 1) % Sender_Config.CorruptEvery))) ? STD_TRUE : STD_FALSE);
+			Sender_Send(Sender_arrPacket, SENDER_PACKET_SIZE);
+			res->Blocks++;
+			reply = Sender_WaitReply(SENDER_REPLY_TIMEOUT_MS);
+			if((0x06 == reply) && (0 != Sender_Config.LoseAckEvery) && (0 == tries) && (0 == ((block + 1) % Sender_Config.LoseAckEvery)))
+			{
+				// the ACK is lost : the sender times out and sends the block again
+				res->LostAcks++;
+				Sender_WaitReply(SENDER_RESEND_MS);
+				reply = -1;
+			}
+			if(0x06 == reply)
+			{
+				break;
+			}
+			if(0x18 == reply)
+			{
+				res->Cancelled = STD_TRUE;
+				return;
+			}
+			res->Resent++;
+		}
+		if(SENDER_MAX_TRIES == tries)
+		{
+			return;
+		}
+	}
+
+	Sender_Send(&eot, 1);
+	reply = Sender_WaitReply(SENDER_REPLY_TIMEOUT_MS);
+	if(0x18 == reply)
+	{
+		res->Cancelled = STD_TRUE;
+	}
+	// the receiver finishes its last call
+	Sender_Loop();
+}
+
+/**
+ * @brief Checks the staged image and the mark against the packed file.
+ */
+static Std_Bool_t Sender_CheckFlash(void)
+{
+	static u8 flash[SENDER_MAX_FILE];
+	u32 imageLen = Sender_u32FileLen - FWUPDATE_BLOCK_SIZE;
+	u8 mark[10];
+
+	if((STD_OK != Flash_FileRead(0, flash, imageLen)) || (STD_OK != Flash_FileRead(Sender_Config.StagingSize, mark, sizeof(mark))))
+	{
+		return STD_FALSE;
+	}
+	return ((0 == memcmp(flash, &Sender_arrFile[FWUPDATE_BLOCK_SIZE], imageLen)) &&
+	        (0 == memcmp(mark, Sender_arrFile, sizeof(mark)))) ? STD_TRUE : STD_FALSE;
+}
+
+/************************************************************************/
+/*                            Main                                      */
+/************************************************************************/
+static void Sender_Usage(const char *name)
+{
+	fprintf(stderr, "usage: %s image.fwu [--baud 2400..28800] [--fcpu hz] [--loop-us us] [--page-write-us us] [--staging bytes]\n"
+	                "          [--corrupt N] [--lose-ack N] [--tamper] [--flash file] [--expect none|verify|too_big|...]\n", name);
+}
+
+static Std_Bool_t Sender_ParseArgs(int argc, char *argv[])
+{
+	int i;
+	u8 baud;
+
+	for(i=1; i<argc; i++)
+	{
+		if((0 == strcmp(argv[i], "--baud")) && (i + 1 < argc))
+		{
+			for(baud=0; (baud < TOTAL_BAUD_RATE) && (Sender_arrBaudValues[baud] != strtoul(argv[i + 1], NULL_PTR, 10)); baud++);
+			if(TOTAL_BAUD_RATE == baud)
+			{
+				return STD_FALSE;
+			}
+			Sender_Config.Baud = baud;
+			i++;
+		}
+		else if((0 == strcmp(argv[i], "--fcpu")) && (i + 1 < argc))          { Sender_Config.Fcpu = strtoul(argv[++i], NULL_PTR, 10); }
+		else if((0 == strcmp(argv[i], "--loop-us")) && (i + 1 < argc))       { Sender_Config.LoopUs = strtoul(argv[++i], NULL_PTR, 10); }
+		else if((0 == strcmp(argv[i], "--page-write-us")) && (i + 1 < argc)) { Sender_Config.PageWriteUs = strtoul(argv[++i], NULL_PTR, 10); }
+		else if((0 == strcmp(argv[i], "--staging")) && (i + 1 < argc))       { Sender_Config.StagingSize = strtoul(argv[++i], NULL_PTR, 0); }
+		else if((0 == strcmp(argv[i], "--corrupt")) && (i + 1 < argc))       { Sender_Config.CorruptEvery = strtoul(argv[++i], NULL_PTR, 10); }
+		else if((0 == strcmp(argv[i], "--lose-ack")) && (i + 1 < argc))      { Sender_Config.LoseAckEvery = strtoul(argv[++i], NULL_PTR, 10); }
+		else if((0 == strcmp(argv[i], "--flash")) && (i + 1 < argc))         { Sender_Config.Flash = argv[++i]; }
+		else if((0 == strcmp(argv[i], "--expect")) && (i + 1 < argc))        { Sender_Config.Expect = argv[++i]; }
+		else if(0 == strcmp(argv[i], "--tamper"))                            { Sender_Config.Tamper = STD_TRUE; }
+		else if('-' != argv[i][0])                                           { Sender_Config.Image = argv[i]; }
+		else                                                                 { return STD_FALSE; }
+	}
+	return (NULL_PTR != Sender_Config.Image) ? STD_TRUE : STD_FALSE;
+}
+
+int main(int argc, char *argv[])
+{
+	const FwUpdate_Flash_t *flash;
+	Sender_Result_t res;
+	FwUpdate_Info_t info;
+	Std_Status_t status;
+	Std_Bool_t flashOk, ok;
+	FILE *file;
+	u32 start;
+	double seconds, lineBytesPerS;
+
+	if(STD_FALSE == Sender_ParseArgs(argc, argv))
+	{
+		Sender_Usage(argv[0]);
+		return 2;
+	}
+	file = fopen(Sender_Config.Image, "rb");
+	if(NULL_PTR == file)
+	{
+		perror(Sender_Config.Image);
+		return 2;
+	}
+	Sender_u32FileLen = (u32)fread(Sender_arrFile, 1, SENDER_MAX_FILE, file);
+	fclose(file);
+	if(Sender_u32FileLen <= FWUPDATE_BLOCK_SIZE)
+	{
+		fprintf(stderr, "%s: no image after the header\n", Sender_Config.Image);
+		return 2;
+	}
+	if(STD_TRUE == Sender_Config.Tamper)
+	{
+		Sender_arrFile[FWUPDATE_BLOCK_SIZE + (Sender_u32FileLen - FWUPDATE_BLOCK_SIZE) / 2] ^= 0x01;
+	}
+
+	Sim_Init(Sender_Config.Fcpu, Sender_arrBaudValues[Sender_Config.Baud], 4, 45);
+	flash = Flash_FileOpen(Sender_Config.Flash, Sender_Config.StagingSize, Sender_Config.PageWriteUs, Sender_Config.Fcpu);
+	if(NULL_PTR == flash)
+	{
+		perror(Sender_Config.Flash);
+		return 2;
+	}
+	UART_RX_SetCallBack(NULL_PTR);
+	UART_Init();
+	UART_SetBaudRate(Sender_Config.Baud);
+	sei();
+	if(STD_OK != FwUpdate_Start(flash))
+	{
+		fprintf(stderr, "FwUpdate_Start failed\n");
+		return 2;
+	}
+
+	start = Sim_GetMillis();
+	Sender_Run(&res);
+	seconds = (Sim_GetMillis() - start) / 1000.0;
+	status = FwUpdate_MainFunction();
+	FwUpdate_GetInfo(&info);
+	flashOk = Sender_CheckFlash();
+	Flash_FileClose();
+
+	ok = ((0 == strcmp(Sender_Config.Expect, Sender_arrErrors[info.Error])) && (0 == Flash_FileGetStats()->WritesAfterReply)) ? STD_TRUE : STD_FALSE;
+	if(FWUPDATE_ERR_NONE == info.Error)
+	{
+		ok = ((STD_TRUE == ok) && (STD_DONE == status) && (STD_TRUE == flashOk)) ? STD_TRUE : STD_FALSE;
+	}
+	else
+	{
+		// a failed update must not leave a mark
+		ok = ((STD_TRUE == ok) && (STD_ERROR == status) && (0 == Flash_FileGetStats()->Commits)) ? STD_TRUE : STD_FALSE;
+	}
+	lineBytesPerS = Sender_arrBaudValues[Sender_Config.Baud] / (double)Sim_FrameBits();
+
+	printf("{\"baud\":%lu,\"image_bytes\":%lu,\"staging_bytes\":%lu,\"seconds\":%.3f,\"image_bytes_per_s\":%.1f,\"line_efficiency\":%.3f,"
+	       "\"blocks_sent\":%lu,\"resent\":%lu,\"lost_acks\":%lu,\"naks\":%u,\"duplicates\":%u,\"page_writes\":%lu,\"page_rewrites\":%lu,\"writes_after_reply\":%lu,"
+	       "\"error\":\"%s\",\"flash_matches\":%s,\"ok\":%s}\n",
+	       (unsigned long)Sender_arrBaudValues[Sender_Config.Baud], (unsigned long)info.ImageSize, (unsigned long)Sender_Config.StagingSize,
+	       seconds, (seconds > 0) ? info.Received / seconds : 0.0, (seconds > 0) ? (info.Received / seconds) / lineBytesPerS : 0.0,
+	       (unsigned long)res.Blocks, (unsigned long)res.Resent, (unsigned long)res.LostAcks, info.Naks, info.Duplicates,
+	       (unsigned long)Flash_FileGetStats()->PageWrites, (unsigned long)Flash_FileGetStats()->Rewrites,
+	       (unsigned long)Flash_FileGetStats()->WritesAfterReply,
+	       Sender_arrErrors[info.Error], (STD_TRUE == flashOk) ? "true" : "false", (STD_TRUE == ok) ? "true" : "false");
+
+	return (STD_TRUE == ok) ? 0 : 1;
+}
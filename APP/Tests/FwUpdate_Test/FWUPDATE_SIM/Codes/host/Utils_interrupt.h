@@ -0,0 +1,24 @@
+/**
+ * @file Utils_interrupt.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host replacement of LIB/Utils_interrupt.h for the boot loader test : SREG is a variable.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UTILS_INTERRUPT_H_
+#define UTILS_INTERRUPT_H_
+
+#include "Std_Types.h"
+
+/* ================================== SREG ================================== */
+extern volatile u8 Sim_SREG;
+
+/* ================================== critical section ================================== */
+#define CRITICAL_SREG                     Sim_SREG
+#define Critical_Enter(sregCopy)          do{ (sregCopy)=Sim_SREG; Sim_SREG &= (u8)~0x80; }while(0)
+#define Critical_Exit(sregCopy)           do{ Sim_SREG=(sregCopy); }while(0)
+
+#endif /* UTILS_INTERRUPT_H_ */
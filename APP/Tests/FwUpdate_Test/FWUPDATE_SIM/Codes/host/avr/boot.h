@@ -0,0 +1,30 @@
+/**
+ * @file boot.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host replacement of <avr/boot.h> for the boot loader test : the SPM calls go to the flash model of FwUpdate_Boot.c.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef SIM_AVR_BOOT_H_
+#define SIM_AVR_BOOT_H_
+
+#include "Std_Types.h"
+
+#define BOOTLOADER_SECTION
+#define SPM_PAGESIZE          128
+
+void Sim_SpmErase(u16 address);
+void Sim_SpmFill(u16 address, u16 word);
+void Sim_SpmWrite(u16 address);
+
+#define eeprom_busy_wait()       do{ }while(0)
+#define boot_spm_busy_wait()     do{ }while(0)
+#define boot_rww_enable()        do{ }while(0)
+#define boot_page_erase(a)       Sim_SpmErase(a)
+#define boot_page_fill(a, w)     Sim_SpmFill((a), (w))
+#define boot_page_write(a)       Sim_SpmWrite(a)
+
+#endif /* SIM_AVR_BOOT_H_ */
@@ -0,0 +1,20 @@
+/**
+ * @file pgmspace.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host replacement of <avr/pgmspace.h> for the boot loader test : pgm_read_byte reads the flash model by address.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef SIM_AVR_PGMSPACE_H_
+#define SIM_AVR_PGMSPACE_H_
+
+#include "Std_Types.h"
+
+u8 Sim_FlashRead(u16 address);
+
+#define pgm_read_byte(a)     Sim_FlashRead((u16)(a))
+
+#endif /* SIM_AVR_PGMSPACE_H_ */
@@ -0,0 +1,249 @@
+/**
+ * @file LCD_Sim.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host test of the LCD driver (HAL/04-LCD) on HD44780 models , see ../README.md.
+ *         LCD_Prog.c is built without changes , every LCD of LCD_Sim_Lcfg.c gets a controller model
+ *         on its pins (Sim_HD44780.c) : the LCDs with an RW pin are driven by their busy flag , the others by delays.
+ *         The init , LCD_Printf , LCD_BackSpace and Create_Character are checked on the memories of the model ,
+ *         then full refreshes (2 lines of 16 characters) are timed.
+ *         One JSON line is printed per LCD , the exit code is 1 if a check fails.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/************************************************************************/
+/*                            Inclusion                                 */
+/************************************************************************/
+/*
+* LIB
+*/
+#include "Std_Types.h"
+
+/*
+* Include MCAL layer files
+*/
+#include "DIO_Interface.h"
+
+/*
+* Include HAL layer files
+*/
+#include "LCD_Interface.h"
+#include "LCD_Lcfg.h"
+#include "LCD_Private.h"
+
+#include "Sim_HD44780.h"
+
+/* the driver before the busy flag (1 ms after each EN edge and 1 ms after each character) measured on this model :
+   172.8 ms per refresh of 32 characters with the 2 LCD_SetCursor , 50 DIO cycles per call at 8 MHz */
+#define SIM_LEGACY_CHAR_US     5398.8
+#define SIM_REFRESH_CHARS      32
+#define SIM_LINE_CHARS         16       /**< characters written to a line by the refreshes */
+
+/************************************************************************/
+/*                            Options                                   */
+/************************************************************************/
+static u32 Sim_u32Fcpu = 8000000;
+static u32 Sim_u32DioCycles = 50;
+static u16 Sim_u16Refreshes = 20;
+static s16 Sim_s16StuckLcd = -1;
+static s16 Sim_s16FloatLcd = -1;
+
+static void Sim_Usage(const char *name)
+{
+	fprintf(stderr,
+		"usage: %s [--fcpu HZ] [--dio-cycles N] [--exec-scale X] [--refreshes N] [--stuck-busy ID] [--float-db7 ID]\n", name);
+	exit(2);
+}
+
+static void Sim_ParseArgs(int argc, char **argv)
+{
+	int i;
+
+	for(i = 1; i < argc; i++)
+	{
+		if((0 == strcmp(argv[i], "--fcpu")) && (i + 1 < argc))
+		{
+			Sim_u32Fcpu = (u32)strtoul(argv[++i], NULL, 0);
+		}
+		else if((0 == strcmp(argv[i], "--dio-cycles")) && (i + 1 < argc))
+		{
+			Sim_u32DioCycles = (u32)strtoul(argv[++i], NULL, 0);
+		}
+		else if((0 == strcmp(argv[i], "--exec-scale")) && (i + 1 < argc))
+		{
+			Sim_ExecScale = atof(argv[++i]);
+		}
+		else if((0 == strcmp(argv[i], "--refreshes")) && (i + 1 < argc))
+		{
+			Sim_u16Refreshes = (u16)strtoul(argv[++i], NULL, 0);
+		}
+		else if((0 == strcmp(argv[i], "--stuck-busy")) && (i + 1 < argc))
+		{
+			Sim_s16StuckLcd = (s16)strtol(argv[++i], NULL, 0);
+		}
+		else if((0 == strcmp(argv[i], "--float-db7")) && (i + 1 < argc))
+		{
+			Sim_s16FloatLcd = (s16)strtol(argv[++i], NULL, 0);
+		}
+		else
+		{
+			Sim_Usage(argv[0]);
+		}
+	}
+	if((0 == Sim_u32Fcpu) || (0 == Sim_u16Refreshes) || (Sim_ExecScale <= 0.0))
+	{
+		Sim_Usage(argv[0]);
+	}
+	Sim_DioNs = (u32)((u64)Sim_u32DioCycles * 1000000000ULL / Sim_u32Fcpu);
+}
+
+/************************************************************************/
+/*                            Checks                                    */
+/************************************************************************/
+static u8 Sim_u8Failed = 0;
+
+/* the LCD must not lose a write : with a busy flag always , with the delays if the LCD is not slower than the datasheet */
+static u8 Sim_ExpectNoLostWrite(u8 id)
+{
+	u8 busyFlag = (STD_TRUE == LCD_arrOfLCD[id].LCD_RW_Used) && (Sim_s16StuckLcd != id) && (Sim_s16FloatLcd != id);
+	return busyFlag || (Sim_ExecScale * 37.0 <= 40.0);
+}
+
+/* a failed check of an LCD driven by delays slower than them is expected : it is printed , the exit code stays 0 */
+static void Sim_Check(u8 id, u8 ok, const char *what)
+{
+	if(!ok)
+	{
+		if(Sim_ExpectNoLostWrite(id))
+		{
+			fprintf(stderr, "LCD %u : %s\n", id, what);
+			Sim_u8Failed = 1;
+		}
+		else
+		{
+			fprintf(stderr, "LCD %u : %s (expected : fixed delays on a slow LCD)\n", id, what);
+		}
+	}
+}
+
+static u8 Sim_DdramIs(const Sim_Lcd_t *lcd, u8 address, const char *text)
+{
+	return (0 == memcmp(&lcd->Ddram[address], text, strlen(text))) ? 1 : 0;
+}
+
+/************************************************************************/
+/*                            Main                                      */
+/************************************************************************/
+int main(int argc, char **argv)
+{
+	static u8 arrPattern[8] = {0x0E, 0x11, 0x11, 0x1F, 0x1B, 0x1B, 0x1F, 0x00};
+	u8 arrLine1[32];
+	u8 arrLine2[32];
+	u64 arrInitNs[copy_LCD_Quantity];
+	u64 start;
+	u8 id;
+	u16 r;
+
+	Sim_ParseArgs(argc, argv);
+
+	for(id = 0; id < copy_LCD_Quantity; id++)
+	{
+		Sim_LcdAttach(LCD_arrOfLCD[id].LCD_RS_Pin,
+		              (STD_TRUE == LCD_arrOfLCD[id].LCD_RW_Used) ? LCD_arrOfLCD[id].LCD_RW_Pin : SIM_PIN_NONE, LCD_arrOfLCD[id].LCD_EN_Pin,
+		              LCD_arrOfLCD[id].LCD_pins, (LCD_arrOfLCD[id].LCD_Mode == LCD_8BIT_MODE) ? 8 : 4);
+		if(Sim_s16StuckLcd == id)
+		{
+			Sim_arrLcd[id].StuckBusy = 1;
+		}
+		if(Sim_s16FloatLcd == id)
+		{
+			Sim_arrLcd[id].FloatDb7 = 1;
+		}
+	}
+	// Dio_Init : every LCD pin is an output
+	for(id = 0; id < copy_LCD_Quantity; id++)
+	{
+		u8 i;
+		Dio_SetPinDirection(LCD_arrOfLCD[id].LCD_RS_Pin, DIO_PIN_DIRECTION_OUTPUT);
+		Dio_SetPinDirection(LCD_arrOfLCD[id].LCD_EN_Pin, DIO_PIN_DIRECTION_OUTPUT);
+		if(STD_TRUE == LCD_arrOfLCD[id].LCD_RW_Used)
+		{
+			Dio_SetPinDirection(LCD_arrOfLCD[id].LCD_RW_Pin, DIO_PIN_DIRECTION_OUTPUT);
+		}
+		for(i = 0; i < Sim_arrLcd[id].DataCount; i++)
+		{
+			Dio_SetPinDirection(LCD_arrOfLCD[id].LCD_pins[i], DIO_PIN_DIRECTION_OUTPUT);
+		}
+	}
+	Sim_TimeNs = 0;    // power on
+
+	for(id = 0; id < copy_LCD_Quantity; id++)
+	{
+		const Sim_Lcd_t *lcd = &Sim_arrLcd[id];
+
+		start = Sim_TimeNs;
+		LCD_init(id);
+		arrInitNs[id] = Sim_TimeNs - start;
+		Sim_Check(id, (LCD_arrOfLCD[id].LCD_Mode == LCD_8BIT_MODE) == lcd->Bits8, "interface mode after LCD_init");
+		Sim_Check(id, (LCD_arrOfLCD[id].LCD_LINE == LCD_2lineMode) == lcd->Lines2, "lines after LCD_init");
+		Sim_Check(id, lcd->Display && !lcd->Cursor && !lcd->Blink, "display on , cursor off after LCD_init");
+		Sim_Check(id, lcd->Increment && !lcd->Shift && (0 == lcd->Ac), "entry mode after LCD_init");
+
+		LCD_Printf(id, "T=%3d C", 25);
+		Sim_Check(id, Sim_DdramIs(lcd, 0x00, "T= 25 C") && (7 == lcd->Ac), "LCD_Printf");
+		LCD_BackSpace(id);
+		Sim_Check(id, Sim_DdramIs(lcd, 0x00, "T= 25  ") && (6 == lcd->Ac), "LCD_BackSpace");
+		Create_Character(id, arrPattern, 1);
+		Sim_Check(id, (0 == memcmp(&lcd->Cgram[8], arrPattern, 8)) && !lcd->AcInCgram && (0 == lcd->Ac), "Create_Character");
+		LCD_voidSetOption(id, LCD_ClearDisplay);
+		Sim_Check(id, Sim_DdramIs(lcd, 0x00, "        ") && (0 == lcd->Ac), "LCD_ClearDisplay");
+	}
+
+	for(id = 0; id < copy_LCD_Quantity; id++)
+	{
+		const Sim_Lcd_t *lcd = &Sim_arrLcd[id];
+		u64 refreshNs;
+		double charUs;
+
+		start = Sim_TimeNs;
+		for(r = 0; r < Sim_u16Refreshes; r++)
+		{
+			snprintf((char*)arrLine1, SIM_LINE_CHARS + 1, "Refresh %5u #%u", r, id);
+			snprintf((char*)arrLine2, SIM_LINE_CHARS + 1, "%08lX%8s", (unsigned long)(u32)(r * 2654435761UL), "busy?");
+			LCD_SetCursor(id, 1, 1);
+			LCD_WriteStr(id, arrLine1);
+			LCD_SetCursor(id, 2, 1);
+			LCD_WriteStr(id, arrLine2);
+		}
+		refreshNs = (Sim_TimeNs - start) / Sim_u16Refreshes;
+		charUs = (double)refreshNs / 1000.0 / SIM_REFRESH_CHARS;
+		Sim_Check(id, Sim_DdramIs(lcd, 0x00, (char*)arrLine1) && Sim_DdramIs(lcd, 0x40, (char*)arrLine2), "content after the refreshes");
+
+		Sim_Check(id, 0 == lcd->LostWrites, "writes lost while the LCD was busy");
+		Sim_Check(id, 0 == lcd->EarlyWrites, "writes before the 40 ms of the power on");
+		Sim_Check(id, 0 == lcd->TimingErrors, "EN pulse shorter than the datasheet");
+		Sim_Check(id, 0 == lcd->Contentions, "data pins driven by the MCU and the LCD");
+		if(Sim_ExecScale <= 1.0)
+		{
+			Sim_Check(id, SIM_LEGACY_CHAR_US / charUs > 10.0, "less than 10 times the legacy character rate");
+		}
+
+		printf("{\"lcd\":%u,\"wait\":\"%s\",\"dio_ns\":%lu,\"exec_scale\":%.2f,\"init_us\":%.1f,"
+		       "\"refresh_us\":%.1f,\"char_us\":%.2f,\"chars_per_s\":%.0f,\"speedup_vs_legacy\":%.1f,"
+		       "\"busy_reads\":%lu,\"idle_reads\":%lu,\"lost_writes\":%lu,\"timing_errors\":%lu,\"contentions\":%lu}\n",
+		       id,
+		       (STD_TRUE != LCD_arrOfLCD[id].LCD_RW_Used) ? "delays" :
+		       (lcd->StuckBusy ? "busy_flag_stuck" : (lcd->FloatDb7 ? "busy_flag_floating" : "busy_flag")),
+		       (unsigned long)Sim_DioNs, Sim_ExecScale, arrInitNs[id] / 1000.0,
+		       refreshNs / 1000.0, charUs, 1000000.0 / charUs, SIM_LEGACY_CHAR_US / charUs,
+		       (unsigned long)lcd->BusyReads, (unsigned long)lcd->IdleReads, (unsigned long)lcd->LostWrites,
+		       (unsigned long)lcd->TimingErrors, (unsigned long)lcd->Contentions);
+	}
+	return Sim_u8Failed;
+}
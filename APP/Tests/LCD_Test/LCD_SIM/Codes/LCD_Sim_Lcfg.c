@@ -0,0 +1,51 @@
+/**
+ * @file LCD_Sim_Lcfg.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com)
+ * @brief  The LCDs of HAL/04-LCD/LCD_Lcfg.c for the LCD simulator , with the RW example of LCD 0 enabled :
+ *          - LCD 0 : RW on PB5 , driven by its busy flag
+ *          - LCD 1 : RW tied to GND , driven by the fixed delays
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+* LIB
+*/
+#include "Std_Types.h"
+
+/*
+* Include MCAL layer files
+*/
+#include "DIO_Interface.h"
+
+/*
+* Include own files
+*/
+#include "LCD_interface.h"
+#include "LCD_lcfg.h"
+#include "LCD_private.h"
+
+const LCD_CONFIG_t  LCD_arrOfLCD[copy_LCD_Quantity]=
+{
+	 {
+	     .LCD_Mode=LCD_4BIT_MODE,
+	     .LCD_LINE=LCD_2lineMode,
+	     .LCD_DOTS=LCD_5x7Dots,
+	     .LCD_RS_Pin=PB0,
+	     .LCD_EN_Pin=PB1,
+	     .LCD_RW_Used=STD_TRUE,
+	     .LCD_RW_Pin=PB5,
+	     .LCD_pins={PC0,PC1,PC2,PC3}
+     },
+     {
+	     .LCD_Mode=LCD_4BIT_MODE,
+	     .LCD_LINE=LCD_2lineMode,
+	     .LCD_DOTS=LCD_5x7Dots,
+	     .LCD_RS_Pin=PB2,
+	     .LCD_EN_Pin=PB3,
+	     .LCD_pins={PC4,PC5,PC6,PC7}
+     }
+};
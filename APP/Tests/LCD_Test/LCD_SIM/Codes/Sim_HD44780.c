@@ -0,0 +1,341 @@
+/**
+ * @file Sim_HD44780.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host model of the DIO pins and of HD44780 controllers for the LCD simulator (see Sim_HD44780.h).
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <string.h>
+
+#include "Std_Types.h"
+#include "DIO_Interface.h"
+#include "SysTick_Interface.h"
+#include "Sim_HD44780.h"
+
+/* datasheet times (fosc = 270 kHz) */
+#define SIM_POWER_ON_NS      40000000ULL
+#define SIM_EXEC_NS          37000ULL
+#define SIM_CLEAR_NS         1520000ULL
+#define SIM_EN_HIGH_MIN_NS   450ULL
+#define SIM_EN_CYCLE_MIN_NS  1000ULL
+
+u64 Sim_TimeNs = 0;
+u32 Sim_DioNs = 6250;
+double Sim_ExecScale = 1.0;
+Sim_Lcd_t Sim_arrLcd[SIM_LCD_MAX];
+u8 Sim_LcdCount = 0;
+
+static u8 Sim_arrPinLevel[DIO_TOTAL_PINS];   /* PORT bit */
+static u8 Sim_arrPinOutput[DIO_TOTAL_PINS];  /* DDR bit */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              HD44780 model                                   */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static u8 Sim_LcdIsBusy(const Sim_Lcd_t *lcd)
+{
+	return (lcd->StuckBusy || (Sim_TimeNs < lcd->BusyUntilNs)) ? 1 : 0;
+}
+
+static void Sim_LcdBusyFor(Sim_Lcd_t *lcd, u64 ns)
+{
+	lcd->BusyUntilNs = Sim_TimeNs + (u64)((double)ns * Sim_ExecScale);
+}
+
+static void Sim_LcdMoveAc(Sim_Lcd_t *lcd, u8 increment)
+{
+	if(lcd->AcInCgram)
+	{
+		lcd->Ac = (u8)((increment ? lcd->Ac + 1 : lcd->Ac - 1) & 0x3F);
+	}
+	else
+	{
+		lcd->Ac = (u8)((increment ? lcd->Ac + 1 : lcd->Ac - 1) & 0x7F);
+	}
+}
+
+static void Sim_LcdExecute(Sim_Lcd_t *lcd, u8 value, u8 rs)
+{
+	if(Sim_TimeNs < SIM_POWER_ON_NS)
+	{
+		lcd->EarlyWrites++;
+	}
+	if(Sim_TimeNs < lcd->BusyUntilNs)
+	{
+		lcd->LostWrites++;
+		return;
+	}
+	if(rs)
+	{
+		if(lcd->AcInCgram)
+		{
+			lcd->Cgram[lcd->Ac] = value;
+		}
+		else
+		{
+			lcd->Ddram[lcd->Ac] = value;
+		}
+		Sim_LcdMoveAc(lcd, lcd->Increment);
+		lcd->DataWrites++;
+		Sim_LcdBusyFor(lcd, SIM_EXEC_NS);
+		return;
+	}
+
+	lcd->Instructions++;
+	if(value & 0x80)                 /* set DDRAM address */
+	{
+		lcd->Ac = value & 0x7F;
+		lcd->AcInCgram = 0;
+	}
+	else if(value & 0x40)            /* set CGRAM address */
+	{
+		lcd->Ac = value & 0x3F;
+		lcd->AcInCgram = 1;
+	}
+	else if(value & 0x20)            /* function set */
+	{
+		lcd->Bits8 = (value >> 4) & 1;
+		lcd->Lines2 = (value >> 3) & 1;
+		lcd->WriteNibble = 0;
+		lcd->ReadNibble = 0;
+	}
+	else if(value & 0x10)            /* cursor or display shift */
+	{
+		if(0 == (value & 0x08))
+		{
+			Sim_LcdMoveAc(lcd, (value >> 2) & 1);
+		}
+	}
+	else if(value & 0x08)            /* display on/off control */
+	{
+		lcd->Display = (value >> 2) & 1;
+		lcd->Cursor = (value >> 1) & 1;
+		lcd->Blink = value & 1;
+	}
+	else if(value & 0x04)            /* entry mode set */
+	{
+		lcd->Increment = (value >> 1) & 1;
+		lcd->Shift = value & 1;
+	}
+	else if(value & 0x02)            /* return home */
+	{
+		lcd->Ac = 0;
+		lcd->AcInCgram = 0;
+		Sim_LcdBusyFor(lcd, SIM_CLEAR_NS);
+		return;
+	}
+	else if(value & 0x01)            /* clear display */
+	{
+		memset(lcd->Ddram, ' ', sizeof(lcd->Ddram));
+		lcd->Ac = 0;
+		lcd->AcInCgram = 0;
+		lcd->Increment = 1;
+		Sim_LcdBusyFor(lcd, SIM_CLEAR_NS);
+		return;
+	}
+	Sim_LcdBusyFor(lcd, SIM_EXEC_NS);
+}
+
+static u8 Sim_LcdBus(const Sim_Lcd_t *lcd)
+{
+	u8 i;
+	u8 value = 0;
+
+	for(i = 0; i < lcd->DataCount; i++)
+	{
+		value |= (u8)(Sim_arrPinLevel[lcd->DataPins[i]] << i);
+	}
+	return value;
+}
+
+static void Sim_LcdCheckContention(Sim_Lcd_t *lcd)
+{
+	u8 i;
+
+	if(lcd->Driving)
+	{
+		for(i = 0; i < lcd->DataCount; i++)
+		{
+			if(Sim_arrPinOutput[lcd->DataPins[i]])
+			{
+				lcd->Contentions++;
+				return;
+			}
+		}
+	}
+}
+
+/* called after every change of a pin : the edges of EN */
+static void Sim_LcdUpdate(Sim_Lcd_t *lcd)
+{
+	u8 en = Sim_arrPinLevel[lcd->EnPin];
+	u8 rw = (SIM_PIN_NONE != lcd->RwPin) ? Sim_arrPinLevel[lcd->RwPin] : 0;
+	u8 value;
+	u8 bus;
+
+	Sim_LcdCheckContention(lcd);
+	if(en == lcd->En)
+	{
+		return;
+	}
+	lcd->En = en;
+	if(en)
+	{
+		if((0 != lcd->LastRiseNs) && (Sim_TimeNs - lcd->LastRiseNs < SIM_EN_CYCLE_MIN_NS))
+		{
+			lcd->TimingErrors++;
+		}
+		lcd->LastRiseNs = Sim_TimeNs;
+		lcd->EnRiseNs = Sim_TimeNs;
+		if(rw && (0 == Sim_arrPinLevel[lcd->RsPin]))
+		{
+			value = (u8)((Sim_LcdIsBusy(lcd) ? 0x80 : 0x00) | lcd->Ac);
+			if((4 == lcd->DataCount) && !lcd->Bits8)
+			{
+				value = lcd->ReadNibble ? (value & 0x0F) : (value >> 4);
+			}
+			else if(4 == lcd->DataCount)
+			{
+				value = value >> 4;
+			}
+			if(!lcd->ReadNibble || (8 == lcd->DataCount) || lcd->Bits8)
+			{
+				if(Sim_LcdIsBusy(lcd))
+				{
+					lcd->BusyReads++;
+				}
+				else
+				{
+					lcd->IdleReads++;
+				}
+			}
+			lcd->DriveValue = value;
+			lcd->Driving = 1;
+			Sim_LcdCheckContention(lcd);
+		}
+		return;
+	}
+
+	/* falling edge */
+	if(Sim_TimeNs - lcd->EnRiseNs < SIM_EN_HIGH_MIN_NS)
+	{
+		lcd->TimingErrors++;
+	}
+	if(lcd->Driving)
+	{
+		lcd->Driving = 0;
+		if((4 == lcd->DataCount) && !lcd->Bits8)
+		{
+			lcd->ReadNibble ^= 1;
+		}
+		return;
+	}
+	if(rw)
+	{
+		return;
+	}
+	bus = Sim_LcdBus(lcd);
+	if(lcd->Bits8)
+	{
+		/* in 4-bit wiring DB0..DB3 are not connected (pulled down here) */
+		Sim_LcdExecute(lcd, (4 == lcd->DataCount) ? (u8)(bus << 4) : bus, Sim_arrPinLevel[lcd->RsPin]);
+	}
+	else if(0 == lcd->WriteNibble)
+	{
+		lcd->HighNibble = (u8)(bus << 4);
+		lcd->WriteNibble = 1;
+	}
+	else
+	{
+		lcd->WriteNibble = 0;
+		Sim_LcdExecute(lcd, lcd->HighNibble | (bus & 0x0F), Sim_arrPinLevel[lcd->RsPin]);
+	}
+}
+
+static void Sim_PinsChanged(void)
+{
+	u8 i;
+
+	for(i = 0; i < Sim_LcdCount; i++)
+	{
+		Sim_LcdUpdate(&Sim_arrLcd[i]);
+	}
+}
+
+u8 Sim_LcdAttach(u8 rsPin, u8 rwPin, u8 enPin, const u8 dataPins[], u8 dataCount)
+{
+	Sim_Lcd_t *lcd = &Sim_arrLcd[Sim_LcdCount];
+
+	memset(lcd, 0, sizeof(*lcd));
+	lcd->RsPin = rsPin;
+	lcd->RwPin = rwPin;
+	lcd->EnPin = enPin;
+	memcpy(lcd->DataPins, dataPins, dataCount);
+	lcd->DataCount = dataCount;
+	lcd->Bits8 = 1;
+	lcd->Increment = 1;
+	memset(lcd->Ddram, ' ', sizeof(lcd->Ddram));
+	return Sim_LcdCount++;
+}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                        DIO and delays of the driver                          */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+void Dio_SetPinDirection(const DIO_PIN_t pin, const DIO_PIN_DIRECTION_t direction)
+{
+	Sim_TimeNs += Sim_DioNs;
+	Sim_arrPinOutput[pin] = (DIO_PIN_DIRECTION_OUTPUT == direction) ? 1 : 0;
+	Sim_arrPinLevel[pin] = (DIO_PIN_DIRECTION_INPUT_PULLUP == direction) ? 1 : 0;
+	Sim_PinsChanged();
+}
+
+void Dio_WritePin(const DIO_PIN_t pin, const DIO_VOLTAGE_LEVEL_t volt)
+{
+	Sim_TimeNs += Sim_DioNs;
+	Sim_arrPinLevel[pin] = (DIO_VOLT_HIGH == volt) ? 1 : 0;
+	Sim_PinsChanged();
+}
+
+DIO_VOLTAGE_LEVEL_t Dio_ReadPin(const DIO_PIN_t pin)
+{
+	u8 i;
+	u8 j;
+
+	Sim_TimeNs += Sim_DioNs;
+	if(0 == Sim_arrPinOutput[pin])
+	{
+		for(i = 0; i < Sim_LcdCount; i++)
+		{
+			for(j = 0; (j < Sim_arrLcd[i].DataCount) && Sim_arrLcd[i].Driving; j++)
+			{
+				if((Sim_arrLcd[i].DataPins[j] == pin) && !(Sim_arrLcd[i].FloatDb7 && (j == Sim_arrLcd[i].DataCount - 1)))
+				{
+					return ((Sim_arrLcd[i].DriveValue >> j) & 1) ? DIO_VOLT_HIGH : DIO_VOLT_LOW;
+				}
+			}
+		}
+	}
+	/* an undriven input : 1 with the pull-up of the MCU , a floating pin is taken as 0 (the worst case of DB7 : ready) */
+	return Sim_arrPinLevel[pin] ? DIO_VOLT_HIGH : DIO_VOLT_LOW;
+}
+
+void _delay_us(double us)
+{
+	Sim_TimeNs += (u64)(us * 1000.0);
+}
+
+void _delay_ms(double ms)
+{
+	Sim_TimeNs += (u64)(ms * 1000000.0);
+}
+
+void SysTick_DelayMs(u16 ms)
+{
+	Sim_TimeNs += (u64)ms * 1000000ULL;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file Sim_HD44780.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host model of the DIO pins and of HD44780 controllers for the LCD simulator (see ../README.md).
+ *
+ * The DIO API (DIO_Interface.h) used by LCD_Prog.c is replaced : every call takes the time of the AVR function ,
+ * the delays (_delay_us , _delay_ms , SysTick_DelayMs) move the simulated time.
+ * Each controller watches its pins : a write is latched on the falling edge of EN , a read (RW=1) drives the data pins
+ * while EN is high with the busy flag on DB7. An instruction or a data written while the controller is busy is lost
+ * and counted , like an EN pulse shorter than the datasheet or a data pin driven by the MCU and the LCD together.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef SIM_HD44780_H_
+#define SIM_HD44780_H_
+
+#define SIM_LCD_MAX          4
+#define SIM_PIN_NONE         0xFF
+
+/**
+ * @brief one HD44780 controller and its counters.
+ */
+typedef struct
+{
+	/* wiring */
+	u8 RsPin;
+	u8 RwPin;                 /**< SIM_PIN_NONE : RW tied to GND */
+	u8 EnPin;
+	u8 DataPins[8];           /**< DB4..DB7 (4 pins) or DB0..DB7 (8 pins) */
+	u8 DataCount;
+	/* controller */
+	u8 Bits8;                 /**< DL : 8-bit interface (power on state) */
+	u8 Lines2;                /**< N */
+	u8 Display;               /**< D */
+	u8 Cursor;                /**< C */
+	u8 Blink;                 /**< B */
+	u8 Increment;             /**< I/D */
+	u8 Shift;                 /**< S */
+	u8 Ac;                    /**< address counter */
+	u8 AcInCgram;             /**< the address counter points to the CGRAM */
+	u8 Ddram[128];
+	u8 Cgram[64];
+	u8 WriteNibble;           /**< 4-bit interface : 1 after the high nibble */
+	u8 ReadNibble;            /**< 4-bit interface : 1 after the high nibble of a read */
+	u8 HighNibble;
+	u8 En;
+	u8 Driving;               /**< the LCD drives the data pins (read with EN high) */
+	u8 DriveValue;            /**< the bits of DataPins driven */
+	u8 StuckBusy;             /**< a broken LCD : the busy flag never goes low */
+	u8 FloatDb7;              /**< DB7 does not reach the MCU : the pin floats during the reads */
+	u64 BusyUntilNs;
+	u64 EnRiseNs;
+	u64 LastRiseNs;
+	/* counters */
+	u32 Instructions;
+	u32 DataWrites;
+	u32 BusyReads;            /**< reads of the busy flag that found the LCD busy */
+	u32 IdleReads;            /**< reads of the busy flag that found the LCD ready */
+	u32 LostWrites;           /**< writes while busy (lost) */
+	u32 EarlyWrites;          /**< writes less than 40 ms after the power on */
+	u32 TimingErrors;         /**< EN high < 450 ns or EN cycle < 1 us */
+	u32 Contentions;          /**< a data pin driven by the MCU while the LCD drives it */
+}Sim_Lcd_t;
+
+extern u64 Sim_TimeNs;        /**< the simulated time since the power on */
+extern u32 Sim_DioNs;         /**< the time of one DIO call */
+extern double Sim_ExecScale;  /**< execution times of the datasheet (270 kHz) * scale */
+extern Sim_Lcd_t Sim_arrLcd[SIM_LCD_MAX];
+extern u8 Sim_LcdCount;
+
+/**
+ * @brief Connects a controller to the pins at the power on (8-bit interface , a write before 40 ms is counted as early).
+ *
+ * @return u8 the index of the controller in Sim_arrLcd.
+ */
+u8 Sim_LcdAttach(u8 rsPin, u8 rwPin, u8 enPin, const u8 dataPins[], u8 dataCount);
+
+#endif /* SIM_HD44780_H_ */
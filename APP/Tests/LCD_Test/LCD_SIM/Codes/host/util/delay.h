@@ -0,0 +1,17 @@
+/**
+ * @file delay.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host replacement of util/delay.h for the LCD simulator : the delays move the simulated time (Sim_HD44780.c).
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef DELAY_H_
+#define DELAY_H_
+
+void _delay_us(double us);
+void _delay_ms(double ms);
+
+#endif /* DELAY_H_ */
@@ -0,0 +1,407 @@
+/**
+ * @file Modbus_Master.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host test of the Modbus RTU slave (Services/Modbus) against a scripted master (see ../README.md).
+ *         UART.c , Modbus.c and CRC.c are built without changes against the USART model of the UART benchmark ,
+ *         the master sends the requests of the script on the RX line of the model and checks the bytes of the TX line.
+ *         One line is printed per check , the exit code is 1 if a check fails.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/************************************************************************/
+/*                            Inclusion                                 */
+/************************************************************************/
+/*
+* LIB
+*/
+#include "Std_Types.h"
+#include "Utils_interrupt.h"
+
+/*
+* Include MCAL layer files
+*/
+#include "UART_interface.h"
+#include "SysTick_Interface.h"
+
+/*
+* Include Services layer files
+*/
+#include "CRC.h"
+#include "Modbus.h"
+#include "Modbus_Lcfg.h"
+
+/*
+* the simulated USART
+*/
+#include "Sim_USART.h"
+
+/************************************************************************/
+/*                            Configuration                             */
+/************************************************************************/
+#define MASTER_LINE_SIZE        256
+#define MASTER_MAX_BYTES        260      /**< a request or a response with its CRC */
+#define MASTER_TIMEOUT_MS       200      /**< no response after this time : "expect none" */
+#define MASTER_END_SILENCE_MS   10       /**< silence of the TX line that ends a response */
+
+typedef struct
+{
+	u32 Fcpu;
+	u8  Baud;            /**< BAUD_xxx */
+	u32 LoopUs;          /**< period of the main loop of the slave */
+	const char *Script;
+}Master_Config_t;
+
+static const u32 Master_arrBaudValues[TOTAL_BAUD_RATE] = {2400, 4800, 9600, 14400, 19200, 28800};
+
+static Master_Config_t Master_Config = {8000000UL, BAUD_9600, 200, "master.txt"};
+
+static u8  Master_arrRequest[MASTER_MAX_BYTES];    /**< stays valid while the model sends it */
+static u32 Master_u32GapChars = 0;                 /**< silence between two characters of a request (in characters) */
+static u32 Master_u32TxSeen = 0;                   /**< bytes of the TX line already checked */
+static u32 Master_u32Checks = 0;
+static u32 Master_u32Failed = 0;
+
+/************************************************************************/
+/*                            SysTick of the host                       */
+/************************************************************************/
+/**
+ * @brief the ticks (ms) of the silence detection come from the simulated time.
+ */
+u16 SysTick_GetTicks(void)
+{
+	return (u16)Sim_GetMillis();
+}
+
+/************************************************************************/
+/*                            Helpers                                   */
+/************************************************************************/
+/**
+ * @brief One turn of the super loop of the slave.
+ */
+static void Master_Loop(void)
+{
+	Modbus_MainFunction();
+	Sim_Work(((u64)Master_Config.Fcpu * Master_Config.LoopUs) / 1000000UL);
+}
+
+/**
+ * @brief Parses the hex bytes of a script line ("01 03 00 0A").
+ *
+ * @return u32 the number of bytes.
+ */
+static u32 Master_ParseBytes(char *args, u8 bytes[], u32 capacity)
+{
+	u32 len = 0;
+	char *token = strtok(args, " \t\r\n");
+
+	while((NULL_PTR != token) && (len < capacity))
+	{
+		bytes[len] = (u8)strtoul(token, NULL_PTR, 16);
+		len++;
+		token = strtok(NULL_PTR, " \t\r\n");
+	}
+	return len;
+}
+
+/**
+ * @brief Appends the CRC-16/MODBUS (low byte first).
+ */
+static u32 Master_AppendCrc(u8 bytes[], u32 len)
+{
+	u16 crc = CRC16Modbus_Calculate(bytes, (u16)len);
+
+	bytes[len] = (u8)crc;
+	bytes[len + 1] = (u8)(crc >> 8);
+	return len + 2;
+}
+
+/**
+ * @brief Sends a request on the RX line of the slave and runs the slave until the last byte is received.
+ */
+static void Master_Send(u32 len)
+{
+	Sim_RxFeed(Master_arrRequest, len, Master_u32GapChars * Sim_FrameCycles());
+	while(STD_FALSE == Sim_RxFeedDone())
+	{
+		Master_Loop();
+	}
+}
+
+/**
+ * @brief Runs the slave until its response ends (or the timeout) and gets the new bytes of the TX line.
+ *
+ * @return u32 the number of bytes of the response (0 : no response).
+ */
+static u32 Master_Receive(const u8 **pResponse)
+{
+	u32 start = Sim_GetMillis();
+	u32 lastChange = start;
+	u32 len, seen = Master_u32TxSeen;
+	const u8 *line;
+
+	while(1)
+	{
+		Master_Loop();
+		line = Sim_TxCapture(&len);
+		if(len != seen)
+		{
+			seen = len;
+			lastChange = Sim_GetMillis();
+		}
+		if((seen != Master_u32TxSeen) && (STD_TRUE == Sim_TxIdle()) && ((Sim_GetMillis() - lastChange) >= MASTER_END_SILENCE_MS))
+		{
+			break;
+		}
+		if((seen == Master_u32TxSeen) && ((Sim_GetMillis() - start) >= MASTER_TIMEOUT_MS))
+		{
+			break;
+		}
+	}
+	*pResponse = &line[Master_u32TxSeen];
+	len = seen - Master_u32TxSeen;
+	Master_u32TxSeen = seen;
+	return len;
+}
+
+/**
+ * @brief Prints the result of a check.
+ */
+static void Master_Report(u32 lineNumber, Std_Bool_t ok, const char *what)
+{
+	Master_u32Checks++;
+	if(STD_TRUE == ok)
+	{
+		printf("line %lu: ok %s\n", (unsigned long)lineNumber, what);
+	}
+	else
+	{
+		Master_u32Failed++;
+		printf("line %lu: FAIL %s\n", (unsigned long)lineNumber, what);
+	}
+}
+
+/**
+ * @brief Prints bytes in hex after a label.
+ */
+static void Master_PrintBytes(const char *label, const u8 bytes[], u32 len)
+{
+	u32 i;
+
+	printf("    %s:", label);
+	for(i=0; i<len; i++)
+	{
+		printf(" %02X", bytes[i]);
+	}
+	printf("%s\n", (0 == len) ? " (none)" : "");
+}
+
+/**
+ * @brief Gets a counter of the slave by its name.
+ */
+static Std_Bool_t Master_GetStat(const char *name, u16 *pValue)
+{
+	Modbus_Stats_t stats;
+
+	Modbus_GetStats(&stats);
+	if(0 == strcmp(name, "frames"))            { *pValue = stats.Frames; }
+	else if(0 == strcmp(name, "crc_errors"))   { *pValue = stats.CrcErrors; }
+	else if(0 == strcmp(name, "exceptions"))   { *pValue = stats.Exceptions; }
+	else if(0 == strcmp(name, "broadcasts"))   { *pValue = stats.Broadcasts; }
+	else if(0 == strcmp(name, "overflows"))    { *pValue = stats.Overflows; }
+	else if(0 == strcmp(name, "dropped"))      { *pValue = stats.DroppedBytes; }
+	else                                       { return STD_FALSE; }
+	return STD_TRUE;
+}
+
+/************************************************************************/
+/*                            Script                                    */
+/************************************************************************/
+/**
+ * @brief Runs one line of the script.
+ *
+ * @return Std_Bool_t STD_FALSE if the line is not a known command.
+ */
+static Std_Bool_t Master_RunLine(u32 lineNumber, char *line)
+{
+	u8 expected[MASTER_MAX_BYTES];
+	const u8 *response;
+	u32 len, responseLen;
+	unsigned long index;
+	int value;
+	char name[32];
+	char *command = strtok(line, " \t\r\n");
+	char *args = strtok(NULL_PTR, "\r\n");
+	char what[64];
+
+	if((NULL_PTR == command) || ('#' == command[0]))
+	{
+		return STD_TRUE;
+	}
+	if(NULL_PTR == args)
+	{
+		args = "";
+	}
+
+	if(0 == strcmp(command, "send"))                /* send <hex bytes> : the CRC is appended */
+	{
+		len = Master_ParseBytes(args, Master_arrRequest, MASTER_MAX_BYTES - 2);
+		Master_Send(Master_AppendCrc(Master_arrRequest, len));
+	}
+	else if(0 == strcmp(command, "raw"))            /* raw <hex bytes> : sent as they are (wrong CRC , broken frame) */
+	{
+		len = Master_ParseBytes(args, Master_arrRequest, MASTER_MAX_BYTES);
+		Master_Send(len);
+	}
+	else if(0 == strcmp(command, "gap"))            /* gap <characters> : silence between the characters of the next requests */
+	{
+		Master_u32GapChars = strtoul(args, NULL_PTR, 10);
+	}
+	else if(0 == strcmp(command, "expect"))         /* expect <hex bytes> | none : the response , the CRC is appended */
+	{
+		responseLen = Master_Receive(&response);
+		if(0 == strncmp(args, "none", 4))
+		{
+			len = 0;
+		}
+		else
+		{
+			len = Master_AppendCrc(expected, Master_ParseBytes(args, expected, MASTER_MAX_BYTES - 2));
+		}
+		Master_Report(lineNumber, ((len == responseLen) && (0 == memcmp(expected, response, len))) ? STD_TRUE : STD_FALSE, "expect");
+		if((len != responseLen) || (0 != memcmp(expected, response, len)))
+		{
+			Master_PrintBytes("expected", expected, len);
+			Master_PrintBytes("received", response, responseLen);
+		}
+	}
+	else if(0 == strcmp(command, "set_input"))      /* set_input <index> <value> : written by the application */
+	{
+		if(2 != sscanf(args, "%lu %i", &index, &value) || (index >= MODBUS_INPUT_COUNT))
+		{
+			return STD_FALSE;
+		}
+		Modbus_arrInputRegisters[index] = (u16)value;
+	}
+	else if(0 == strcmp(command, "check_holding"))  /* check_holding <index> <value> : written by the master */
+	{
+		if(2 != sscanf(args, "%lu %i", &index, &value) || (index >= MODBUS_HOLDING_COUNT))
+		{
+			return STD_FALSE;
+		}
+		snprintf(what, sizeof(what), "holding[%lu] = 0x%04X (0x%04X)", index, Modbus_arrHoldingRegisters[index], (u16)value);
+		Master_Report(lineNumber, (Modbus_arrHoldingRegisters[index] == (u16)value) ? STD_TRUE : STD_FALSE, what);
+	}
+	else if(0 == strcmp(command, "check_stats"))    /* check_stats <counter> <value> */
+	{
+		u16 counter;
+
+		if((2 != sscanf(args, "%31s %i", name, &value)) || (STD_FALSE == Master_GetStat(name, &counter)))
+		{
+			return STD_FALSE;
+		}
+		snprintf(what, sizeof(what), "%s = %u (%u)", name, counter, (u16)value);
+		Master_Report(lineNumber, (counter == (u16)value) ? STD_TRUE : STD_FALSE, what);
+	}
+	else
+	{
+		return STD_FALSE;
+	}
+	return STD_TRUE;
+}
+
+/************************************************************************/
+/*                            Main                                      */
+/************************************************************************/
+static void Master_Usage(const char *name)
+{
+	fprintf(stderr, "usage: %s [script] [--baud 2400|4800|9600|14400|19200|28800] [--fcpu hz] [--loop-us us]\n", name);
+}
+
+static Std_Bool_t Master_ParseArgs(int argc, char *argv[])
+{
+	int i;
+	u8 baud;
+
+	for(i=1; i<argc; i++)
+	{
+		if((0 == strcmp(argv[i], "--baud")) && (i + 1 < argc))
+		{
+			for(baud=0; (baud < TOTAL_BAUD_RATE) && (Master_arrBaudValues[baud] != strtoul(argv[i + 1], NULL_PTR, 10)); baud++);
+			if(TOTAL_BAUD_RATE == baud)
+			{
+				return STD_FALSE;
+			}
+			Master_Config.Baud = baud;
+			i++;
+		}
+		else if((0 == strcmp(argv[i], "--fcpu")) && (i + 1 < argc))
+		{
+			Master_Config.Fcpu = strtoul(argv[++i], NULL_PTR, 10);
+		}
+		else if((0 == strcmp(argv[i], "--loop-us")) && (i + 1 < argc))
+		{
+			Master_Config.LoopUs = strtoul(argv[++i], NULL_PTR, 10);
+		}
+		else if('-' != argv[i][0])
+		{
+			Master_Config.Script = argv[i];
+		}
+		else
+		{
+			return STD_FALSE;
+		}
+	}
+	return STD_TRUE;
+}
+
+int main(int argc, char *argv[])
+{
+	char line[MASTER_LINE_SIZE];
+	u32 lineNumber = 0;
+	FILE *script;
+
+	if(STD_FALSE == Master_ParseArgs(argc, argv))
+	{
+		Master_Usage(argv[0]);
+		return 2;
+	}
+	script = fopen(Master_Config.Script, "r");
+	if(NULL_PTR == script)
+	{
+		perror(Master_Config.Script);
+		return 2;
+	}
+
+	Sim_Init(Master_Config.Fcpu, Master_arrBaudValues[Master_Config.Baud], 4, 45);
+	UART_Init();
+	UART_SetBaudRate(Master_Config.Baud);
+	sei();
+	if(STD_OK != Modbus_Init())
+	{
+		fprintf(stderr, "Modbus_Init failed\n");
+		return 2;
+	}
+
+	while(NULL_PTR != fgets(line, sizeof(line), script))
+	{
+		lineNumber++;
+		if(STD_FALSE == Master_RunLine(lineNumber, line))
+		{
+			fprintf(stderr, "%s:%lu: wrong line\n", Master_Config.Script, (unsigned long)lineNumber);
+			fclose(script);
+			return 2;
+		}
+		fflush(stdout);
+	}
+	fclose(script);
+
+	printf("%lu checks , %lu failed\n", (unsigned long)Master_u32Checks, (unsigned long)Master_u32Failed);
+	return (0 == Master_u32Failed) ? 0 : 1;
+}
@@ -0,0 +1,452 @@
+/**
+ * @file SW_UART_Sim.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host checks of the software UART (MCAL/06-SW_UART) , see ../README.md.
+ *         SW_UART_Prog.c and SW_UART_Lcfg.c are built without changes , the registers are variables (host/MemMap.h)
+ *         and every timer tick calls the ISR. The channels of SW_UART_Lcfg.c are wired like this :
+ *           - channel 0 : TX PA0 looped back to RX PA1
+ *           - channel 1 : RX PA2 driven by a sender with a baud rate error
+ *         A failed check is printed , the exit code is 1 if a check fails.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/************************************************************************/
+/*                            Inclusion                                 */
+/************************************************************************/
+/*
+* LIB
+*/
+#include "Std_Types.h"
+#include "MemMap.h"
+#include "Utils_interrupt.h"
+
+/*
+* Include MCAL layer files
+*/
+#include "MCU_config.h"
+#include "SW_UART_Interface.h"
+#include "SW_UART_Lcfg.h"
+
+/************************************************************************/
+/*                            Configuration                             */
+/************************************************************************/
+#define SIM_TX_CHANNEL         0        /**< TX PA0 , RX PA1 */
+#define SIM_RX_CHANNEL         1        /**< RX PA2 */
+#define SIM_TX_PIN_MASK        0x01
+#define SIM_LOOP_PIN_MASK      0x02
+#define SIM_SENDER_PIN_MASK    0x04
+#define SIM_APP_PIN_MASK       0x80     /**< a pin of PORTA written by the application */
+#define SIM_TIMSK_OCIE0        0x02
+#define SIM_TIMSK_OTHER        0x04     /**< TOIE1 , owned by another driver */
+#define SIM_FRAME_TICKS        30       /**< 10 bits of 3 ticks */
+#define SIM_MAX_BYTES          64
+
+#if (SW_UART_CHANNELS != 2)
+#error "the checks use the 2 channels of SW_UART_Lcfg.c"
+#endif
+
+void __vector_10(void);
+
+/************************************************************************/
+/*                            Registers and ticks                       */
+/************************************************************************/
+volatile u8 Sim_arrOfReg[0x60];
+volatile u8 Sim_SREG = 0;
+
+static u8  Sim_u8Pending = 0;           /**< OCF0 : a compare match not served yet */
+static u8  Sim_u8TickInCritical = 0;    /**< raise a compare match in the next critical section */
+static u32 Sim_u32IsrCalls = 0;
+static u32 Sim_u32Ticks = 0;
+
+/* sender of channel 1 : level of the line at the time t (in ticks) */
+static u8     Sim_arrSenderBytes[SIM_MAX_BYTES];
+static u8     Sim_u8SenderLen = 0;
+static u8     Sim_u8SenderBadStop = 0xFF; /**< index of the byte sent with a low stop bit */
+static double Sim_SenderBitTicks = 3.0;
+static double Sim_SenderStart = 0.0;
+
+void Sim_OnCriticalEnter(void)
+{
+	if(0 != Sim_u8TickInCritical)
+	{
+		Sim_u8TickInCritical = 0;
+		Sim_u8Pending = 1;
+	}
+}
+
+void Sim_Poll(void)
+{
+	if((0 != Sim_u8Pending) && (0 != (Sim_SREG & 0x80)) && (0 != (TIMSK & SIM_TIMSK_OCIE0)))
+	{
+		Sim_u8Pending = 0;
+		Sim_u32IsrCalls++;
+		Sim_SREG &= (u8)~0x80;   // the ISR runs with the I-bit cleared
+		__vector_10();
+		Sim_SREG |= 0x80;
+	}
+}
+
+static u8 Sim_SenderLevel(double t)
+{
+	double bit = (t - Sim_SenderStart) / Sim_SenderBitTicks;
+	u32 index;
+	u8 byteIndex, bitInFrame;
+
+	if((bit < 0.0) || (bit >= 10.0 * Sim_u8SenderLen))
+	{
+		return 1;
+	}
+	index = (u32)floor(bit);
+	byteIndex = (u8)(index / 10);
+	bitInFrame = (u8)(index % 10);
+	if(0 == bitInFrame)
+	{
+		return 0;
+	}
+	if(9 == bitInFrame)
+	{
+		return (byteIndex == Sim_u8SenderBadStop) ? 0 : 1;
+	}
+	return (Sim_arrSenderBytes[byteIndex] >> (bitInFrame - 1)) & 1;
+}
+
+/**
+ * @brief One compare match of Timer0 : the pins are updated from the lines then the ISR runs if it is enabled.
+ */
+static void Sim_Tick(void)
+{
+	u8 pins = 0xFF & (u8)~(SIM_LOOP_PIN_MASK | SIM_SENDER_PIN_MASK);
+
+	if(PORTA & SIM_TX_PIN_MASK)
+	{
+		pins |= SIM_LOOP_PIN_MASK;
+	}
+	if(Sim_SenderLevel((double)Sim_u32Ticks))
+	{
+		pins |= SIM_SENDER_PIN_MASK;
+	}
+	PINA = pins;
+	Sim_u32Ticks++;
+	if(0 != (TCCR0 & 0x07))
+	{
+		Sim_u8Pending = 1;
+	}
+	Sim_Poll();
+}
+
+static void Sim_Ticks(u32 count)
+{
+	while(count--)
+	{
+		Sim_Tick();
+	}
+}
+
+/************************************************************************/
+/*                            Helpers                                   */
+/************************************************************************/
+static u32 Sim_u32Failed = 0;
+static u32 Sim_u32Passed = 0;
+
+static void Check(Std_Bool_t ok, const char *name, const char *what)
+{
+	if(STD_TRUE == ok)
+	{
+		Sim_u32Passed++;
+	}
+	else
+	{
+		Sim_u32Failed++;
+		fprintf(stderr, "FAILED %s : %s\n", name, what);
+	}
+}
+
+#define CHECK(name, cond)      Check((cond) ? STD_TRUE : STD_FALSE, (name), #cond)
+
+/**
+ * @brief Resets the registers and the lines , initializes the software UART and enables the global interrupt.
+ */
+static void Sim_Start(void)
+{
+	memset((void*)Sim_arrOfReg, 0, sizeof(Sim_arrOfReg));
+	Sim_SREG = 0;
+	Sim_u8Pending = 0;
+	Sim_u8TickInCritical = 0;
+	Sim_u32IsrCalls = 0;
+	Sim_u8SenderLen = 0;
+	Sim_u8SenderBadStop = 0xFF;
+	PINA = 0xFF;
+	SW_UART_Init();
+	sei();
+}
+
+static void Sim_SenderSend(const u8 data[], u8 len, double errorPercent, double phase)
+{
+	memcpy(Sim_arrSenderBytes, data, len);
+	Sim_u8SenderLen = len;
+	Sim_SenderBitTicks = 3.0 * (1.0 + errorPercent / 100.0);
+	Sim_SenderStart = (double)Sim_u32Ticks + phase;
+}
+
+static u32 Sim_SenderTicks(void)
+{
+	return (u32)ceil(Sim_SenderBitTicks * 10.0 * Sim_u8SenderLen) + 2 * SIM_FRAME_TICKS;
+}
+
+static u8 Sim_ReadAll(u8 channel, u8 out[], u8 size)
+{
+	u8 n = 0;
+	u8 data;
+
+	while((n < size) && (STD_DONE == SW_UART_ReceiveBytePeriodicCheck(channel, &data)))
+	{
+		out[n++] = data;
+	}
+	return n;
+}
+
+static void Sim_Pattern(u8 data[], u8 len, u8 seed)
+{
+	u8 i;
+
+	for(i = 0; i < len; i++)
+	{
+		data[i] = (u8)(seed + i * 37 + (i >> 2) * 11);
+	}
+	data[0] = 0x00;
+	if(len > 1)
+	{
+		data[1] = 0xFF;
+	}
+}
+
+/************************************************************************/
+/*                            Cases                                     */
+/************************************************************************/
+static void Case_Timer(void)
+{
+	static const u16 arrPrescaler[] = {0, 1, 8, 64, 256, 1024};
+	double tickHz;
+	u8 cs;
+
+	Sim_Start();
+	cs = TCCR0 & 0x07;
+	CHECK("timer_ctc", (TCCR0 & 0x48) == 0x08);
+	CHECK("timer_prescaler", (cs >= 1) && (cs <= 5));
+	tickHz = (double)F_CPU / ((double)arrPrescaler[cs] * (OCR0 + 1.0));
+	CHECK("timer_rate", fabs(tickHz / (3.0 * SW_UART_BAUD_RATE) - 1.0) < 0.02);
+	printf("tick %.0f Hz for %u baud (%+.2f %%)\n", tickHz, (unsigned)SW_UART_BAUD_RATE,
+	       100.0 * (tickHz / (3.0 * SW_UART_BAUD_RATE) - 1.0));
+}
+
+static void Case_TxWaveform(void)
+{
+	u8 arrLevel[SIM_FRAME_TICKS + 3];
+	u8 ok = 1;
+	u8 t, expected;
+	const u8 data = 0x4B;
+
+	Sim_Start();
+	CHECK("tx_idle_high", 0 != (PORTA & SIM_TX_PIN_MASK));
+	SW_UART_SendByteNoBlock(SIM_TX_CHANNEL, data);
+	CHECK("tx_busy", STD_PENDING == SW_UART_SendBytePeriodicCheck(SIM_TX_CHANNEL, 0));
+	for(t = 0; t < sizeof(arrLevel); t++)
+	{
+		Sim_Tick();
+		arrLevel[t] = (PORTA & SIM_TX_PIN_MASK) ? 1 : 0;
+	}
+	// the start bit goes out on the first tick , every bit lasts 3 ticks
+	for(t = 0; t < sizeof(arrLevel); t++)
+	{
+		u8 bit = t / 3;
+		expected = (0 == bit) ? 0 : ((bit <= 8) ? ((data >> (bit - 1)) & 1) : 1);
+		if(arrLevel[t] != expected)
+		{
+			ok = 0;
+		}
+	}
+	CHECK("tx_waveform", ok);
+	CHECK("tx_free_after_stop", STD_DONE == SW_UART_SendBytePeriodicCheck(SIM_TX_CHANNEL, data));
+}
+
+static void Case_Loopback(void)
+{
+	u8 arrData[40];
+	u8 arrRx[sizeof(arrData) + 1];
+	u8 sent = 0;
+	u8 got = 0;
+	u32 t;
+
+	Sim_Start();
+	Sim_Pattern(arrData, sizeof(arrData), 3);
+	for(t = 0; (t < 100UL * SIM_FRAME_TICKS) && (got < sizeof(arrData)); t++)
+	{
+		if((sent < sizeof(arrData)) && (STD_DONE == SW_UART_SendBytePeriodicCheck(SIM_TX_CHANNEL, arrData[sent])))
+		{
+			sent++;
+		}
+		got += Sim_ReadAll(SIM_TX_CHANNEL, &arrRx[got], sizeof(arrRx) - got);
+		Sim_Tick();
+	}
+	Sim_Ticks(2 * SIM_FRAME_TICKS);
+	got += Sim_ReadAll(SIM_TX_CHANNEL, &arrRx[got], sizeof(arrRx) - got);
+	CHECK("loopback_count", sizeof(arrData) == got);
+	CHECK("loopback_data", 0 == memcmp(arrRx, arrData, sizeof(arrData)));
+	CHECK("loopback_back_to_back", t <= sizeof(arrData) * SIM_FRAME_TICKS + 10);
+	CHECK("loopback_no_frame_error", 0 == SW_UART_GetFrameErrors(SIM_TX_CHANNEL));
+	CHECK("loopback_no_overrun", 0 == SW_UART_GetOverruns(SIM_TX_CHANNEL));
+	CHECK("loopback_other_channel_silent", 0 == Sim_ReadAll(SIM_RX_CHANNEL, arrRx, sizeof(arrRx)));
+}
+
+/**
+ * @brief Receives one burst on channel 1 , returns 1 if every byte is received intact.
+ */
+static u8 Sim_ReceiveWithError(double errorPercent, double phase)
+{
+	u8 arrData[6];
+	u8 arrRx[sizeof(arrData) + 4];
+	u8 got;
+
+	Sim_Start();
+	Sim_Ticks(5);
+	Sim_Pattern(arrData, sizeof(arrData), (u8)(errorPercent * 10.0));
+	Sim_SenderSend(arrData, sizeof(arrData), errorPercent, phase);
+	Sim_Ticks(Sim_SenderTicks());
+	got = Sim_ReadAll(SIM_RX_CHANNEL, arrRx, sizeof(arrRx));
+	return (sizeof(arrData) == got) && (0 == memcmp(arrRx, arrData, sizeof(arrData)))
+	       && (0 == SW_UART_GetFrameErrors(SIM_RX_CHANNEL));
+}
+
+/**
+ * @brief Finds the largest baud rate error of the sender received without error at every phase of the ticks.
+ */
+static double Sim_Tolerance(double sign)
+{
+	double error, phase;
+	double last = 0.0;
+
+	for(error = 0.0; error <= 10.0; error += 0.25)
+	{
+		for(phase = 0.0; phase < 1.0; phase += 0.125)
+		{
+			if(0 == Sim_ReceiveWithError(sign * error, phase))
+			{
+				return last;
+			}
+		}
+		last = error;
+	}
+	return last;
+}
+
+static void Case_BaudError(void)
+{
+	double fast = Sim_Tolerance(-1.0);
+	double slow = Sim_Tolerance(1.0);
+
+	printf("RX tolerance : sender %.2f %% faster , %.2f %% slower\n", fast, slow);
+	CHECK("rx_tolerance_fast", fast >= 3.0);
+	CHECK("rx_tolerance_slow", slow >= 3.0);
+	CHECK("rx_fails_at_8_percent", (0 == Sim_ReceiveWithError(8.0, 0.5)) || (0 == Sim_ReceiveWithError(-8.0, 0.5)));
+}
+
+static void Case_FrameError(void)
+{
+	u8 arrData[2] = {0x00, 0x5A};
+	u8 arrRx[8];
+	u8 got;
+
+	Sim_Start();
+	Sim_Ticks(5);
+	Sim_SenderSend(arrData, 1, 0.0, 0.5);
+	Sim_u8SenderBadStop = 0;
+	Sim_Ticks(Sim_SenderTicks());
+	CHECK("frame_error_counted", 1 == SW_UART_GetFrameErrors(SIM_RX_CHANNEL));
+	Sim_ReadAll(SIM_RX_CHANNEL, arrRx, sizeof(arrRx));
+	Sim_u8SenderBadStop = 0xFF;
+	Sim_SenderSend(&arrData[1], 1, 0.0, 0.5);
+	Sim_Ticks(Sim_SenderTicks());
+	got = Sim_ReadAll(SIM_RX_CHANNEL, arrRx, sizeof(arrRx));
+	CHECK("frame_error_next_byte", (1 == got) && (0x5A == arrRx[0]));
+}
+
+static void Case_Overrun(void)
+{
+	u8 arrData[SW_UART_RX_BUFFER_SIZE + 2];
+	u8 arrRx[sizeof(arrData)];
+	u8 got;
+
+	Sim_Start();
+	Sim_Ticks(5);
+	Sim_Pattern(arrData, sizeof(arrData), 7);
+	Sim_SenderSend(arrData, sizeof(arrData), 0.0, 0.5);
+	Sim_Ticks(Sim_SenderTicks());
+	got = Sim_ReadAll(SIM_RX_CHANNEL, arrRx, sizeof(arrRx));
+	// one slot of the ring buffer stays empty
+	CHECK("overrun_kept", (SW_UART_RX_BUFFER_SIZE - 1) == got);
+	CHECK("overrun_oldest_kept", 0 == memcmp(arrRx, arrData, SW_UART_RX_BUFFER_SIZE - 1));
+	CHECK("overrun_counted", (sizeof(arrData) - (SW_UART_RX_BUFFER_SIZE - 1)) == SW_UART_GetOverruns(SIM_RX_CHANNEL));
+}
+
+static void Case_SharedRegisters(void)
+{
+	memset((void*)Sim_arrOfReg, 0, sizeof(Sim_arrOfReg));
+	Sim_SREG = 0x80;
+	TIMSK = SIM_TIMSK_OTHER;
+	PORTA = SIM_APP_PIN_MASK;
+	SW_UART_Init();
+	CHECK("timsk_init_keeps_other", (SIM_TIMSK_OTHER | SIM_TIMSK_OCIE0) == TIMSK);
+	CHECK("port_init_keeps_other", (SIM_APP_PIN_MASK | SIM_TX_PIN_MASK) == PORTA);
+	SW_UART_SendByteNoBlock(SIM_TX_CHANNEL, 0x00);
+	CHECK("timsk_send_keeps_other", (SIM_TIMSK_OTHER | SIM_TIMSK_OCIE0) == TIMSK);
+	Sim_Ticks(SIM_FRAME_TICKS);
+	CHECK("port_frame_keeps_other", (SIM_APP_PIN_MASK | SIM_TX_PIN_MASK) == PORTA);
+	SW_UART_DeInit();
+	CHECK("timsk_deinit_keeps_other", SIM_TIMSK_OTHER == TIMSK);
+	SW_UART_SendByteNoBlock(SIM_TX_CHANNEL, 0x00);
+	CHECK("timsk_send_after_deinit", SIM_TIMSK_OTHER == TIMSK);
+	CHECK("sreg_restored", 0x80 == Sim_SREG);
+}
+
+static void Case_TickInCritical(void)
+{
+	u8 arrRx[4];
+	u32 calls;
+
+	Sim_Start();
+	Sim_Ticks(3);
+	calls = Sim_u32IsrCalls;
+	// the compare match comes while the frame is written : the ISR must run after it , on a whole frame
+	Sim_u8TickInCritical = 1;
+	SW_UART_SendByteNoBlock(SIM_TX_CHANNEL, 0xC3);
+	CHECK("critical_tick_served_on_exit", calls + 1 == Sim_u32IsrCalls);
+	CHECK("critical_start_bit_out", 0 == (PORTA & SIM_TX_PIN_MASK));
+	Sim_Ticks(SIM_FRAME_TICKS + 6);
+	CHECK("critical_frame", (1 == Sim_ReadAll(SIM_TX_CHANNEL, arrRx, sizeof(arrRx))) && (0xC3 == arrRx[0]));
+}
+
+/************************************************************************/
+/*                            Main                                      */
+/************************************************************************/
+int main(void)
+{
+	Case_Timer();
+	Case_TxWaveform();
+	Case_Loopback();
+	Case_BaudError();
+	Case_FrameError();
+	Case_Overrun();
+	Case_SharedRegisters();
+	Case_TickInCritical();
+
+	printf("%lu checks passed , %lu failed\n", (unsigned long)Sim_u32Passed, (unsigned long)Sim_u32Failed);
+	return (0 == Sim_u32Failed) ? 0 : 1;
+}
@@ -0,0 +1,35 @@
+/**
+ * @file MemMap.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host replacement of LIB/MemMap.h for the software UART test :
+ *         the registers used by SW_UART_Prog.c are the slots of Sim_arrOfReg (same addresses as the ATmega32).
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef MEMMAP_H_
+#define MEMMAP_H_
+
+#include "Std_Types.h"
+
+extern volatile u8 Sim_arrOfReg[0x60];
+
+/* ================================== DIO ================================== */
+#define   PORTA        (Sim_arrOfReg[0x3B])
+#define   PINA         (Sim_arrOfReg[0x39])
+#define   PORTB        (Sim_arrOfReg[0x38])
+#define   PINB         (Sim_arrOfReg[0x36])
+#define   PORTC        (Sim_arrOfReg[0x35])
+#define   PINC         (Sim_arrOfReg[0x33])
+#define   PORTD        (Sim_arrOfReg[0x32])
+#define   PIND         (Sim_arrOfReg[0x30])
+
+/* ================================== Timer0 ================================== */
+#define   TCCR0        (Sim_arrOfReg[0x53])
+#define   TCNT0        (Sim_arrOfReg[0x52])
+#define   OCR0         (Sim_arrOfReg[0x5C])
+#define   TIMSK        (Sim_arrOfReg[0x59])
+
+#endif /* MEMMAP_H_ */
@@ -0,0 +1,40 @@
+/**
+ * @file Utils_interrupt.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host replacement of LIB/Utils_interrupt.h for the software UART test :
+ *         the ISR is a plain function called by SW_UART_Sim.c on every timer tick and SREG is a variable.
+ *         Critical_Enter calls Sim_OnCriticalEnter so the test can raise a tick inside the critical section ,
+ *         Critical_Exit runs the pending tick like the hardware does when the I-bit is set again.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UTILS_INTERRUPT_H_
+#define UTILS_INTERRUPT_H_
+
+#include "Std_Types.h"
+
+/* ================================== vectors ================================== */
+#define       TIMER0_COMP_VECT    __vector_10	  // Timer/Counter0 Compare Match
+
+/* ================================== SREG ================================== */
+extern volatile u8 Sim_SREG;
+void Sim_OnCriticalEnter(void);
+void Sim_Poll(void);
+
+#define sei()   do{ Sim_SREG |= (u8)0x80; Sim_Poll(); }while(0)
+#define cli()   (Sim_SREG &= (u8)~0x80)
+
+/* ================================== critical section ================================== */
+#define CRITICAL_SREG                     Sim_SREG
+#define Critical_Enter(sregCopy)          do{ (sregCopy)=Sim_SREG; Sim_SREG &= (u8)~0x80; Sim_OnCriticalEnter(); }while(0)
+#define Critical_Exit(sregCopy)           do{ Sim_SREG=(sregCopy); Sim_Poll(); }while(0)
+
+/* ================================== ISR Macro Like Function ================================== */
+#define ISR(vector,...)            \
+void vector (void);                \
+void vector (void)
+
+#endif /* UTILS_INTERRUPT_H_ */
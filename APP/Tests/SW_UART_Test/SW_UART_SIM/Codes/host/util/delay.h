@@ -0,0 +1,14 @@
+/**
+ * @file delay.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host replacement of util/delay.h for the software UART test (included by MCU_config.h , not used).
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef DELAY_H_
+#define DELAY_H_
+
+#endif /* DELAY_H_ */
@@ -0,0 +1,1005 @@
+/**
+ * @file Std_Lib_Checks.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host checks of the LIB containers , Std_Printf and UART_Stack.c , their user shared with an ISR (see ../README.md).
+ *         The files are built without changes , every case checks the return codes , the data and the counters.
+ *         A simulated ISR can run at any point where the target can take an interrupt (host/Utils_interrupt.h).
+ *         A failed check is printed , the exit code is 1 if a check fails.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/************************************************************************/
+/*                            Inclusion                                 */
+/************************************************************************/
+/*
+* LIB
+*/
+#include "Std_Types.h"
+#include "Utils_interrupt.h"
+#include "Std_Buffer.h"
+#include "Std_Stack.h"
+#include "Std_Queue.h"
+#include "Std_Pool.h"
+#include "Std_Pool_Lcfg.h"
+#include "Std_Lib.h"
+
+/*
+* Include Services layer files
+*/
+#include "UART_Stack.h"
+
+/************************************************************************/
+/*                            Configuration                             */
+/************************************************************************/
+#define CHECK_STACK_CAPACITY   5
+#define CHECK_RANDOM_STEPS     2000
+#define CHECK_RANDOM_SEED      7
+#define CHECK_POLICY_CAPACITY  4
+#define CHECK_POLICY_EXTRA     2        /**< the pushes on the full buffer */
+#define CHECK_ISR_BYTE         0xAA     /**< the byte pushed by the simulated ISR */
+#define CHECK_NO_WINDOW        0xFF     /**< the ISR never runs , the interrupt windows are only counted */
+#define CHECK_PRINTF_OUT_SIZE  64       /**< the characters kept by the Std_Printf sink */
+
+/**
+ * @brief an element with padding , copied as a whole by the typed macros and by ElementSize bytes by the generic API.
+ */
+typedef struct
+{
+	u16 Id;
+	u8  Tag;
+}Check_Event_t;
+
+volatile u8 Sim_SREG = 0x80;
+
+static Ptr_VoidFuncVoid_t Sim_pfIsr = NULL_PTR;
+static u8 Sim_u8IsrWindow;
+static u8 Sim_u8Windows;
+static u8 Sim_u8IsrCalls;
+
+static u32 Check_u32Failed = 0;
+static u32 Check_u32Passed = 0;
+
+static char Check_arrPrintfOut[CHECK_PRINTF_OUT_SIZE];
+static u16 Check_u16PrintfLen;
+
+STD_STACK_DEFINE(Check_Events, Check_Event_t, CHECK_STACK_CAPACITY, STD_OVERFLOW_DROP_NEWEST, NULL_PTR);
+STD_STACK_DEFINE(Check_Ring, u16, CHECK_STACK_CAPACITY, STD_OVERFLOW_OVERWRITE_OLDEST, NULL_PTR);
+
+/************************************************************************/
+/*                            Helpers                                   */
+/************************************************************************/
+static void Check(Std_Bool_t ok, const char *name, const char *what)
+{
+	if(STD_TRUE == ok)
+	{
+		Check_u32Passed++;
+	}
+	else
+	{
+		Check_u32Failed++;
+		fprintf(stderr, "FAILED %s : %s\n", name, what);
+	}
+}
+
+#define CHECK(name, cond)      Check((cond) ? STD_TRUE : STD_FALSE, (name), #cond)
+
+/************************************************************************/
+/*                            Simulated ISR                             */
+/************************************************************************/
+/**
+ * @brief Called at every point where the target can take an interrupt.
+ *        The armed ISR runs once , in the window number Sim_u8IsrWindow (1 : the first window after Sim_ArmIsr).
+ */
+void Sim_Interrupt(void)
+{
+	Ptr_VoidFuncVoid_t pfIsr;
+
+	if((NULL_PTR == Sim_pfIsr) || (0 == (Sim_SREG & 0x80)))
+	{
+		return;
+	}
+	Sim_u8Windows++;
+	if(Sim_u8Windows == Sim_u8IsrWindow)
+	{
+		pfIsr = Sim_pfIsr;
+		Sim_pfIsr = NULL_PTR;
+		Sim_SREG &= (u8)~0x80;
+		pfIsr();
+		Sim_SREG |= 0x80;
+		Sim_u8IsrCalls++;
+	}
+}
+
+static void Sim_ArmIsr(Ptr_VoidFuncVoid_t pfIsr, u8 window)
+{
+	Sim_pfIsr = pfIsr;
+	Sim_u8IsrWindow = window;
+	Sim_u8Windows = 0;
+	Sim_u8IsrCalls = 0;
+}
+
+static void Sim_DisarmIsr(void)
+{
+	Sim_pfIsr = NULL_PTR;
+}
+
+static Check_Event_t Check_Event(u16 id)
+{
+	Check_Event_t event;
+
+	memset(&event, 0, sizeof(event));
+	event.Id = id;
+	event.Tag = (u8)(id * 3u);
+	return event;
+}
+
+/************************************************************************/
+/*                            Std_Stack                                 */
+/************************************************************************/
+/**
+ * @brief STD_STACK_PUSH / POP / PEEK on a stack created by STD_STACK_DEFINE : LIFO order , full and empty.
+ */
+static void Check_StackTyped(void)
+{
+	Check_Event_t event;
+	Std_Bool_t ok = STD_TRUE;
+	u16 i;
+
+	CHECK("stack_typed_empty", STD_STACK_IS_EMPTY(Check_Events) && (0 == STD_STACK_COUNT(Check_Events)));
+	event = Check_Event(0xBEEF);
+	CHECK("stack_typed_pop_empty", STD_BUFFER_EMPTY == STD_STACK_POP(Check_Events, &event));
+	CHECK("stack_typed_pop_empty_keeps_value", 0xBEEF == event.Id);
+	CHECK("stack_typed_peek_empty", STD_BUFFER_EMPTY == STD_STACK_PEEK(Check_Events, &event));
+
+	for(i = 0; i < CHECK_STACK_CAPACITY; i++)
+	{
+		ok &= (STD_OK == STD_STACK_PUSH(Check_Events, Check_Event(100 + i))) ? STD_TRUE : STD_FALSE;
+	}
+	CHECK("stack_typed_push", STD_TRUE == ok);
+	CHECK("stack_typed_full", STD_STACK_IS_FULL(Check_Events) && (CHECK_STACK_CAPACITY == STD_STACK_COUNT(Check_Events)));
+	CHECK("stack_typed_push_full", STD_BUFFER_FULL == STD_STACK_PUSH(Check_Events, Check_Event(999)));
+	CHECK("stack_typed_count_after_full", CHECK_STACK_CAPACITY == Std_StackGetCount(&Check_Events));
+
+	CHECK("stack_typed_peek", (STD_OK == STD_STACK_PEEK(Check_Events, &event)) && (104 == event.Id) && ((u8)(104 * 3u) == event.Tag));
+	CHECK("stack_typed_peek_keeps", CHECK_STACK_CAPACITY == STD_STACK_COUNT(Check_Events));
+
+	ok = STD_TRUE;
+	for(i = CHECK_STACK_CAPACITY; i > 0; i--)
+	{
+		ok &= ((STD_OK == STD_STACK_POP(Check_Events, &event)) && ((99 + i) == event.Id)) ? STD_TRUE : STD_FALSE;
+	}
+	CHECK("stack_typed_pop_lifo", STD_TRUE == ok);
+	CHECK("stack_typed_empty_again", STD_BUFFER_EMPTY == STD_STACK_POP(Check_Events, &event));
+
+	/* the generic API works on a stack created by STD_STACK_DEFINE */
+	event = Check_Event(7);
+	CHECK("stack_mixed_generic_push", STD_OK == Std_StackPush(&Check_Events, &event));
+	CHECK("stack_mixed_typed_push", STD_OK == STD_STACK_PUSH(Check_Events, Check_Event(8)));
+	CHECK("stack_mixed_generic_pop", (STD_OK == Std_StackPop(&Check_Events, &event)) && (8 == event.Id));
+	CHECK("stack_mixed_typed_pop", (STD_OK == STD_STACK_POP(Check_Events, &event)) && (7 == event.Id) && (21 == event.Tag));
+	STD_STACK_PUSH(Check_Events, Check_Event(9));
+	STD_STACK_CLEAR(Check_Events);
+	CHECK("stack_typed_clear", STD_STACK_IS_EMPTY(Check_Events));
+}
+
+/**
+ * @brief Std_StackInit / Push / Pop / Peek on a caller buffer , with the argument checks.
+ */
+static void Check_StackGeneric(void)
+{
+	Std_Stack_t stack;
+	u32 arrBuffer[3];
+	u32 value = 0;
+	u32 i;
+	Std_Bool_t ok = STD_TRUE;
+
+	CHECK("stack_init_null_stack", STD_NULL_POINTER == Std_StackInit(NULL_PTR, arrBuffer, 4, 3, STD_OVERFLOW_DROP_NEWEST, NULL_PTR));
+	CHECK("stack_init_null_buffer", STD_NULL_POINTER == Std_StackInit(&stack, NULL_PTR, 4, 3, STD_OVERFLOW_DROP_NEWEST, NULL_PTR));
+	CHECK("stack_init_zero_size", STD_INVALID_ARG == Std_StackInit(&stack, arrBuffer, 0, 3, STD_OVERFLOW_DROP_NEWEST, NULL_PTR));
+	CHECK("stack_init_zero_capacity", STD_INVALID_ARG == Std_StackInit(&stack, arrBuffer, 4, 0, STD_OVERFLOW_DROP_NEWEST, NULL_PTR));
+	CHECK("stack_init_bad_policy", STD_INVALID_ARG == Std_StackInit(&stack, arrBuffer, 4, 3, (Std_OverflowPolicy_t)(STD_OVERFLOW_REJECT + 1), NULL_PTR));
+	CHECK("stack_init", STD_OK == Std_StackInit(&stack, arrBuffer, sizeof(u32), 3, STD_OVERFLOW_DROP_NEWEST, NULL_PTR));
+
+	CHECK("stack_push_null", STD_NULL_POINTER == Std_StackPush(&stack, NULL_PTR));
+	CHECK("stack_push_null_stack", STD_NULL_POINTER == Std_StackPush(NULL_PTR, &value));
+	CHECK("stack_pop_null", STD_NULL_POINTER == Std_StackPop(&stack, NULL_PTR));
+	CHECK("stack_pop_empty", STD_BUFFER_EMPTY == Std_StackPop(&stack, &value));
+	CHECK("stack_count_null", 0 == Std_StackGetCount(NULL_PTR));
+
+	for(i = 0; i < 3; i++)
+	{
+		value = 0x11223300UL + i;
+		ok &= (STD_OK == Std_StackPush(&stack, &value)) ? STD_TRUE : STD_FALSE;
+	}
+	CHECK("stack_push", STD_TRUE == ok);
+	value = 0xFFFFFFFFUL;
+	CHECK("stack_push_full", STD_BUFFER_FULL == Std_StackPush(&stack, &value));
+	CHECK("stack_peek", (STD_OK == Std_StackPeek(&stack, &value)) && (0x11223302UL == value) && (3 == Std_StackGetCount(&stack)));
+	CHECK("stack_pop", (STD_OK == Std_StackPop(&stack, &value)) && (0x11223302UL == value));
+	CHECK("stack_pop_2", (STD_OK == Std_StackPop(&stack, &value)) && (0x11223301UL == value));
+	CHECK("stack_pop_3", (STD_OK == Std_StackPop(&stack, &value)) && (0x11223300UL == value));
+	CHECK("stack_pop_empty_end", STD_BUFFER_EMPTY == Std_StackPop(&stack, &value));
+
+	/* a block comes back as it was pushed , one bound check for all of it */
+	{
+		u32 arrIn[2] = {0xA1, 0xA2};
+		u32 arrOut[3] = {0, 0, 0};
+
+		CHECK("stack_pushn", STD_OK == Std_StackPushN(&stack, arrIn, 2));
+		CHECK("stack_pushn_full", (STD_BUFFER_FULL == Std_StackPushN(&stack, arrIn, 2)) && (2 == Std_StackGetCount(&stack)));
+		CHECK("stack_pushn_too_big", STD_INVALID_ARG == Std_StackPushN(&stack, arrIn, 4));
+		CHECK("stack_popn_short", (STD_BUFFER_EMPTY == Std_StackPopN(&stack, arrOut, 3)) && (2 == Std_StackGetCount(&stack)));
+		CHECK("stack_popn", (STD_OK == Std_StackPopN(&stack, arrOut, 2)) && (0xA1 == arrOut[0]) && (0xA2 == arrOut[1]));
+	}
+}
+
+/**
+ * @brief Pushes and pops at random on a stack whose ring wraps (OVERWRITE_OLDEST) and compares it with a plain array.
+ *        The typed macros , the generic API and the block functions are mixed on the same stack.
+ */
+static void Check_StackWrapAround(void)
+{
+	u16 arrModel[CHECK_STACK_CAPACITY];
+	u16 arrBlock[CHECK_STACK_CAPACITY];
+	u8 modelCount = 0;
+	u16 next = 1;
+	u16 value;
+	u32 step;
+	u8 n;
+	u8 k;
+	u32 wraps = 0;
+	u8 lastHead = Check_Ring.Head;
+	Std_Bool_t ok = STD_TRUE;
+
+	srand(CHECK_RANDOM_SEED);
+	for(step = 0; (step < CHECK_RANDOM_STEPS) && (STD_TRUE == ok); step++)
+	{
+		switch(rand() % 6)
+		{
+		case 0:
+		case 1:
+			/* one element , typed or generic */
+			value = next++;
+			if(0 == (step & 1))
+			{
+				ok = (STD_OK == STD_STACK_PUSH(Check_Ring, value)) ? ok : STD_FALSE;
+			}
+			else
+			{
+				ok = (STD_OK == Std_StackPush(&Check_Ring, &value)) ? ok : STD_FALSE;
+			}
+			if(CHECK_STACK_CAPACITY == modelCount)
+			{
+				memmove(&arrModel[0], &arrModel[1], (CHECK_STACK_CAPACITY - 1) * sizeof(u16));
+				modelCount--;
+			}
+			arrModel[modelCount++] = value;
+			break;
+		case 2:
+			/* a block */
+			n = (u8)(1 + (rand() % CHECK_STACK_CAPACITY));
+			for(k = 0; k < n; k++)
+			{
+				arrBlock[k] = next++;
+			}
+			ok = (STD_OK == Std_StackPushN(&Check_Ring, arrBlock, n)) ? ok : STD_FALSE;
+			for(k = 0; k < n; k++)
+			{
+				if(CHECK_STACK_CAPACITY == modelCount)
+				{
+					memmove(&arrModel[0], &arrModel[1], (CHECK_STACK_CAPACITY - 1) * sizeof(u16));
+					modelCount--;
+				}
+				arrModel[modelCount++] = arrBlock[k];
+			}
+			break;
+		case 3:
+		case 4:
+			/* one element , typed or generic */
+			if(0 == (step & 1))
+			{
+				Std_Error_t error = STD_STACK_POP(Check_Ring, &value);
+
+				ok = (0 == modelCount) ? ((STD_BUFFER_EMPTY == error) ? ok : STD_FALSE)
+				                       : (((STD_OK == error) && (arrModel[--modelCount] == value)) ? ok : STD_FALSE);
+			}
+			else
+			{
+				Std_Error_t error = Std_StackPop(&Check_Ring, &value);
+
+				ok = (0 == modelCount) ? ((STD_BUFFER_EMPTY == error) ? ok : STD_FALSE)
+				                       : (((STD_OK == error) && (arrModel[--modelCount] == value)) ? ok : STD_FALSE);
+			}
+			break;
+		default:
+			/* a block , in the order it was pushed */
+			n = (u8)(1 + (rand() % CHECK_STACK_CAPACITY));
+			if(n > modelCount)
+			{
+				ok = (STD_BUFFER_EMPTY == Std_StackPopN(&Check_Ring, arrBlock, n)) ? ok : STD_FALSE;
+			}
+			else
+			{
+				ok = (STD_OK == Std_StackPopN(&Check_Ring, arrBlock, n)) ? ok : STD_FALSE;
+				modelCount -= n;
+				ok = (0 == memcmp(arrBlock, &arrModel[modelCount], n * sizeof(u16))) ? ok : STD_FALSE;
+			}
+			break;
+		}
+		if(Check_Ring.Head < lastHead)
+		{
+			wraps++;
+		}
+		lastHead = Check_Ring.Head;
+		ok = (modelCount == STD_STACK_COUNT(Check_Ring)) ? ok : STD_FALSE;
+		if((0 != modelCount) && (STD_TRUE == ok))
+		{
+			ok = ((STD_OK == STD_STACK_PEEK(Check_Ring, &value)) && (arrModel[modelCount - 1] == value)) ? STD_TRUE : STD_FALSE;
+		}
+	}
+	if(STD_TRUE != ok)
+	{
+		fprintf(stderr, "stack_wrap_around : mismatch at step %lu\n", (unsigned long)step);
+	}
+	CHECK("stack_wrap_around_model", STD_TRUE == ok);
+	CHECK("stack_wrap_around_wraps", wraps > 100);
+}
+
+/**
+ * @brief Std_StackClear with an ISR push before or after it : the stack is empty or holds only the ISR element.
+ */
+static Std_Stack_t Check_ClearStack;
+
+static void Check_IsrPushClearStack(void)
+{
+	u8 data = CHECK_ISR_BYTE;
+
+	Std_StackPush(&Check_ClearStack, &data);
+}
+
+static void Check_StackClear(void)
+{
+	u8 arrBuffer[4];
+	u8 arrData[3] = {1, 2, 3};
+	u8 data = 0;
+	u8 windows;
+	u8 window;
+	Std_Bool_t ok = STD_TRUE;
+
+	Std_StackInit(&Check_ClearStack, arrBuffer, 1, sizeof(arrBuffer), STD_OVERFLOW_DROP_NEWEST, NULL_PTR);
+	Std_StackPushN(&Check_ClearStack, arrData, 3);
+	Sim_ArmIsr(Check_IsrPushClearStack, CHECK_NO_WINDOW);
+	Std_StackClear(&Check_ClearStack);
+	windows = Sim_u8Windows;
+	Sim_DisarmIsr();
+	CHECK("stack_clear_in_critical_section", 2 == windows);
+	CHECK("stack_clear_empty", 0 == Std_StackGetCount(&Check_ClearStack));
+	CHECK("stack_clear_keeps_stats", 3 == Check_ClearStack.Stats.Pushed);
+
+	for(window = 1; window <= windows; window++)
+	{
+		Std_StackClear(&Check_ClearStack);
+		Std_StackPushN(&Check_ClearStack, arrData, 3);
+		Sim_ArmIsr(Check_IsrPushClearStack, window);
+		Std_StackClear(&Check_ClearStack);
+		Sim_DisarmIsr();
+		if(1 == window)
+		{
+			/* the ISR push came before the clear */
+			ok = (0 == Std_StackGetCount(&Check_ClearStack)) ? ok : STD_FALSE;
+		}
+		else
+		{
+			ok = ((1 == Std_StackGetCount(&Check_ClearStack)) && (STD_OK == Std_StackPop(&Check_ClearStack, &data)) &&
+			      (CHECK_ISR_BYTE == data)) ? ok : STD_FALSE;
+		}
+	}
+	CHECK("stack_clear_isr_push", STD_TRUE == ok);
+}
+
+/************************************************************************/
+/*                            Overflow policies                         */
+/************************************************************************/
+/**
+ * @brief one stack or queue seen through its typed macros or through its generic functions ,
+ *        so the same case runs on the 12 combinations (stack / queue , 3 policies , typed / generic).
+ */
+typedef struct
+{
+	const char *Name;
+	Std_Bool_t IsQueue;
+	Std_OverflowPolicy_t Policy;
+	void (*pfInit)(Std_OverflowPolicy_t policy);   /**< NULL_PTR : created by STD_*_DEFINE with Policy */
+	Std_Error_t (*pfPush)(u8 value);
+	Std_Error_t (*pfPop)(u8 *pValue);
+	Std_Error_t (*pfPushN)(const u8 values[], u8 count);
+	Std_Error_t (*pfGetStats)(Std_BufferStats_t *stats);
+	void (*pfResetStats)(void);
+}Check_Buffer_t;
+
+static u8 Check_u8OverflowCalls;
+
+static void Check_OnOverflow(void)
+{
+	Check_u8OverflowCalls++;
+}
+
+/* the wrappers of a typed instance : STD_STACK_PUSH / STD_QUEUE_PUSH ... */
+#define CHECK_TYPED_BUFFER(name, KIND, Kind, policy)                                                 \
+	KIND##_DEFINE(name, u8, CHECK_POLICY_CAPACITY, (policy), Check_OnOverflow);                      \
+	static Std_Error_t name##_Push(u8 value) { return KIND##_PUSH(name, value); }                    \
+	static Std_Error_t name##_Pop(u8 *pValue) { return KIND##_POP(name, pValue); }                   \
+	static Std_Error_t name##_PushN(const u8 values[], u8 count) { return Std_##Kind##PushN(&name, values, count); } \
+	static Std_Error_t name##_GetStats(Std_BufferStats_t *stats) { return Std_##Kind##GetStats(&name, stats); } \
+	static void name##_ResetStats(void) { Std_##Kind##ResetStats(&name); }
+
+/* the wrappers of a generic instance : Std_StackInit / Std_StackPush ... */
+#define CHECK_GENERIC_BUFFER(name, Kind)                                                             \
+	static Std_##Kind##_t name;                                                                      \
+	static u8 name##_arrBuffer[CHECK_POLICY_CAPACITY];                                               \
+	static void name##_Init(Std_OverflowPolicy_t policy)                                            \
+	{ Std_##Kind##Init(&name, name##_arrBuffer, 1, CHECK_POLICY_CAPACITY, policy, Check_OnOverflow); } \
+	static Std_Error_t name##_Push(u8 value) { return Std_##Kind##Push(&name, &value); }             \
+	static Std_Error_t name##_Pop(u8 *pValue) { return Std_##Kind##Pop(&name, pValue); }             \
+	static Std_Error_t name##_PushN(const u8 values[], u8 count) { return Std_##Kind##PushN(&name, values, count); } \
+	static Std_Error_t name##_GetStats(Std_BufferStats_t *stats) { return Std_##Kind##GetStats(&name, stats); } \
+	static void name##_ResetStats(void) { Std_##Kind##ResetStats(&name); }
+
+#define CHECK_BUFFER_OPS(name)      name##_Push, name##_Pop, name##_PushN, name##_GetStats, name##_ResetStats
+
+CHECK_TYPED_BUFFER(Check_StackDrop, STD_STACK, Stack, STD_OVERFLOW_DROP_NEWEST)
+CHECK_TYPED_BUFFER(Check_StackOverwrite, STD_STACK, Stack, STD_OVERFLOW_OVERWRITE_OLDEST)
+CHECK_TYPED_BUFFER(Check_StackReject, STD_STACK, Stack, STD_OVERFLOW_REJECT)
+CHECK_TYPED_BUFFER(Check_QueueDrop, STD_QUEUE, Queue, STD_OVERFLOW_DROP_NEWEST)
+CHECK_TYPED_BUFFER(Check_QueueOverwrite, STD_QUEUE, Queue, STD_OVERFLOW_OVERWRITE_OLDEST)
+CHECK_TYPED_BUFFER(Check_QueueReject, STD_QUEUE, Queue, STD_OVERFLOW_REJECT)
+CHECK_GENERIC_BUFFER(Check_Stack, Stack)
+CHECK_GENERIC_BUFFER(Check_Queue, Queue)
+
+static const Check_Buffer_t Check_arrBuffers[] =
+{
+	{"stack_typed_drop_newest",        STD_FALSE, STD_OVERFLOW_DROP_NEWEST,      NULL_PTR,           CHECK_BUFFER_OPS(Check_StackDrop)},
+	{"stack_typed_overwrite_oldest",   STD_FALSE, STD_OVERFLOW_OVERWRITE_OLDEST, NULL_PTR,           CHECK_BUFFER_OPS(Check_StackOverwrite)},
+	{"stack_typed_reject",             STD_FALSE, STD_OVERFLOW_REJECT,           NULL_PTR,           CHECK_BUFFER_OPS(Check_StackReject)},
+	{"stack_generic_drop_newest",      STD_FALSE, STD_OVERFLOW_DROP_NEWEST,      Check_Stack_Init,   CHECK_BUFFER_OPS(Check_Stack)},
+	{"stack_generic_overwrite_oldest", STD_FALSE, STD_OVERFLOW_OVERWRITE_OLDEST, Check_Stack_Init,   CHECK_BUFFER_OPS(Check_Stack)},
+	{"stack_generic_reject",           STD_FALSE, STD_OVERFLOW_REJECT,           Check_Stack_Init,   CHECK_BUFFER_OPS(Check_Stack)},
+	{"queue_typed_drop_newest",        STD_TRUE,  STD_OVERFLOW_DROP_NEWEST,      NULL_PTR,           CHECK_BUFFER_OPS(Check_QueueDrop)},
+	{"queue_typed_overwrite_oldest",   STD_TRUE,  STD_OVERFLOW_OVERWRITE_OLDEST, NULL_PTR,           CHECK_BUFFER_OPS(Check_QueueOverwrite)},
+	{"queue_typed_reject",             STD_TRUE,  STD_OVERFLOW_REJECT,           NULL_PTR,           CHECK_BUFFER_OPS(Check_QueueReject)},
+	{"queue_generic_drop_newest",      STD_TRUE,  STD_OVERFLOW_DROP_NEWEST,      Check_Queue_Init,   CHECK_BUFFER_OPS(Check_Queue)},
+	{"queue_generic_overwrite_oldest", STD_TRUE,  STD_OVERFLOW_OVERWRITE_OLDEST, Check_Queue_Init,   CHECK_BUFFER_OPS(Check_Queue)},
+	{"queue_generic_reject",           STD_TRUE,  STD_OVERFLOW_REJECT,           Check_Queue_Init,   CHECK_BUFFER_OPS(Check_Queue)},
+};
+
+/**
+ * @brief Pops everything , returns the number of elements (the stack gives the newest first , the queue the oldest).
+ */
+static u8 Check_BufferDrain(const Check_Buffer_t *buffer, u8 values[])
+{
+	u8 count = 0;
+
+	while((count < CHECK_POLICY_CAPACITY + 1) && (STD_OK == buffer->pfPop(&values[count])))
+	{
+		count++;
+	}
+	return count;
+}
+
+/**
+ * @brief Compares the counters with the expected ones.
+ */
+static Std_Bool_t Check_Stats(const Check_Buffer_t *buffer, u32 pushed, u32 popped, u16 drops, u16 overwrites, u8 peak)
+{
+	Std_BufferStats_t stats;
+
+	return ((STD_OK == buffer->pfGetStats(&stats)) && (pushed == stats.Pushed) && (popped == stats.Popped) &&
+	        (drops == stats.Drops) && (overwrites == stats.Overwrites) && (peak == stats.Peak)) ? STD_TRUE : STD_FALSE;
+}
+
+#define CHECK_BUFFER(buffer, what, cond)                                                             \
+	do{ char arrName[64]; snprintf(arrName, sizeof(arrName), "%s_%s", (buffer)->Name, (what));       \
+	    Check((cond) ? STD_TRUE : STD_FALSE, arrName, #cond); }while(0)
+
+/**
+ * @brief Pushes 2 elements more than the capacity one by one , then a block that does not fit ,
+ *        and checks the return codes , the elements kept , the call back and the counters.
+ */
+static void Check_Policy(const Check_Buffer_t *buffer)
+{
+	Std_Bool_t overwrite = (STD_OVERFLOW_OVERWRITE_OLDEST == buffer->Policy) ? STD_TRUE : STD_FALSE;
+	u8 callbacks = (STD_OVERFLOW_REJECT == buffer->Policy) ? CHECK_POLICY_EXTRA : 0;
+	u8 arrBlock[3] = {101, 102, 103};
+	u8 arrOut[CHECK_POLICY_CAPACITY + 1];
+	u8 arrExpect[CHECK_POLICY_CAPACITY];
+	u8 first = (STD_TRUE == overwrite) ? (1 + CHECK_POLICY_EXTRA) : 1;
+	u8 count;
+	u8 i;
+	Std_Bool_t ok = STD_TRUE;
+
+	if(NULL_PTR != buffer->pfInit)
+	{
+		buffer->pfInit(buffer->Policy);
+	}
+	Check_u8OverflowCalls = 0;
+
+	/* one by one : values 1 .. capacity + 2 */
+	for(i = 1; i <= CHECK_POLICY_CAPACITY + CHECK_POLICY_EXTRA; i++)
+	{
+		Std_Error_t expect = ((i <= CHECK_POLICY_CAPACITY) || (STD_TRUE == overwrite)) ? STD_OK : STD_BUFFER_FULL;
+
+		ok = (expect == buffer->pfPush(i)) ? ok : STD_FALSE;
+	}
+	CHECK_BUFFER(buffer, "push_status", STD_TRUE == ok);
+	CHECK_BUFFER(buffer, "callback", callbacks == Check_u8OverflowCalls);
+	CHECK_BUFFER(buffer, "stats_full", (STD_TRUE == overwrite)
+	             ? Check_Stats(buffer, CHECK_POLICY_CAPACITY + CHECK_POLICY_EXTRA, 0, 0, CHECK_POLICY_EXTRA, CHECK_POLICY_CAPACITY)
+	             : Check_Stats(buffer, CHECK_POLICY_CAPACITY, 0, CHECK_POLICY_EXTRA, 0, CHECK_POLICY_CAPACITY));
+
+	/* DROP_NEWEST and REJECT keep 1 .. capacity , OVERWRITE_OLDEST keeps the newest ones */
+	for(i = 0; i < CHECK_POLICY_CAPACITY; i++)
+	{
+		arrExpect[i] = (STD_TRUE == buffer->IsQueue) ? (u8)(first + i) : (u8)(first + CHECK_POLICY_CAPACITY - 1 - i);
+	}
+	count = Check_BufferDrain(buffer, arrOut);
+	CHECK_BUFFER(buffer, "kept", (CHECK_POLICY_CAPACITY == count) && (0 == memcmp(arrOut, arrExpect, CHECK_POLICY_CAPACITY)));
+	CHECK_BUFFER(buffer, "stats_popped", (STD_TRUE == overwrite)
+	             ? Check_Stats(buffer, CHECK_POLICY_CAPACITY + CHECK_POLICY_EXTRA, CHECK_POLICY_CAPACITY, 0, CHECK_POLICY_EXTRA, CHECK_POLICY_CAPACITY)
+	             : Check_Stats(buffer, CHECK_POLICY_CAPACITY, CHECK_POLICY_CAPACITY, CHECK_POLICY_EXTRA, 0, CHECK_POLICY_CAPACITY));
+
+	/* the peak restarts from the current number of elements */
+	buffer->pfPush(51);
+	buffer->pfPush(52);
+	buffer->pfResetStats();
+	CHECK_BUFFER(buffer, "reset_stats", Check_Stats(buffer, 0, 0, 0, 0, 2));
+
+	/* a block of 3 with room for 2 : all of it or none */
+	Check_u8OverflowCalls = 0;
+	if(STD_TRUE == overwrite)
+	{
+		CHECK_BUFFER(buffer, "pushn_over", STD_OK == buffer->pfPushN(arrBlock, sizeof(arrBlock)));
+		CHECK_BUFFER(buffer, "pushn_stats", Check_Stats(buffer, sizeof(arrBlock), 0, 0, 1, CHECK_POLICY_CAPACITY));
+		count = Check_BufferDrain(buffer, arrOut);
+		if(STD_TRUE == buffer->IsQueue)
+		{
+			CHECK_BUFFER(buffer, "pushn_kept", (CHECK_POLICY_CAPACITY == count) && (52 == arrOut[0]) && (0 == memcmp(&arrOut[1], arrBlock, 3)));
+		}
+		else
+		{
+			CHECK_BUFFER(buffer, "pushn_kept", (CHECK_POLICY_CAPACITY == count) && (103 == arrOut[0]) && (102 == arrOut[1]) &&
+			             (101 == arrOut[2]) && (52 == arrOut[3]));
+		}
+	}
+	else
+	{
+		CHECK_BUFFER(buffer, "pushn_over", STD_BUFFER_FULL == buffer->pfPushN(arrBlock, sizeof(arrBlock)));
+		CHECK_BUFFER(buffer, "pushn_stats", Check_Stats(buffer, 0, 0, sizeof(arrBlock), 0, 2));
+		CHECK_BUFFER(buffer, "pushn_callback", callbacks / CHECK_POLICY_EXTRA == Check_u8OverflowCalls);
+		count = Check_BufferDrain(buffer, arrOut);
+		CHECK_BUFFER(buffer, "pushn_kept", 2 == count);
+	}
+}
+
+/**
+ * @brief STD_OVERFLOW_REJECT without a call back only counts the drops.
+ */
+static void Check_PolicyRejectNoCallback(void)
+{
+	Std_Stack_t stack;
+	Std_Queue_t queue;
+	u8 arrBuffer[2];
+	u8 value = 1;
+	Std_BufferStats_t stats;
+
+	Std_StackInit(&stack, arrBuffer, 1, sizeof(arrBuffer), STD_OVERFLOW_REJECT, NULL_PTR);
+	Std_StackPush(&stack, &value);
+	Std_StackPush(&stack, &value);
+	CHECK("stack_reject_no_callback", STD_BUFFER_FULL == Std_StackPush(&stack, &value));
+	CHECK("stack_reject_no_callback_drops", (STD_OK == Std_StackGetStats(&stack, &stats)) && (1 == stats.Drops));
+
+	Std_QueueInit(&queue, arrBuffer, 1, sizeof(arrBuffer), STD_OVERFLOW_REJECT, NULL_PTR);
+	Std_QueuePush(&queue, &value);
+	Std_QueuePush(&queue, &value);
+	CHECK("queue_reject_no_callback", STD_BUFFER_FULL == Std_QueuePush(&queue, &value));
+	CHECK("queue_reject_no_callback_drops", (STD_OK == Std_QueueGetStats(&queue, &stats)) && (1 == stats.Drops));
+}
+
+static void Check_Policies(void)
+{
+	u8 i;
+
+	for(i = 0; i < sizeof(Check_arrBuffers) / sizeof(Check_arrBuffers[0]); i++)
+	{
+		Check_Policy(&Check_arrBuffers[i]);
+	}
+	Check_PolicyRejectNoCallback();
+}
+
+/************************************************************************/
+/*                            Std_Pool                                  */
+/************************************************************************/
+extern Std_Pool_t * const Std_Pool_arrClasses[STD_POOL_CLASS_COUNT];
+
+/**
+ * @brief Returns the class of a block of Std_PoolAlloc , STD_POOL_CLASS_COUNT if it is in none.
+ */
+static u8 Check_PoolClassOf(const void *block)
+{
+	const Std_Pool_t *pool;
+	u8 i;
+
+	for(i = 0; i < STD_POOL_CLASS_COUNT; i++)
+	{
+		pool = Std_Pool_arrClasses[i];
+		if(((const u8*)block >= pool->Blocks) && ((const u8*)block < &pool->Blocks[(u16)pool->BlockCount * pool->BlockSize]))
+		{
+			return i;
+		}
+	}
+	return STD_POOL_CLASS_COUNT;
+}
+
+static Std_Bool_t Check_PoolClassStats(u8 classIndex, u8 used, u8 peak, u16 fails)
+{
+	Std_PoolStats_t stats;
+
+	return ((STD_OK == Std_PoolGetClassStats(classIndex, &stats)) && (used == stats.Used) && (peak == stats.Peak) &&
+	        (fails == stats.Fails)) ? STD_TRUE : STD_FALSE;
+}
+
+/**
+ * @brief Std_PoolInit / AllocBlock / FreeBlock on a caller buffer : exhaustion , reuse , bad pointers , double free.
+ */
+static void Check_PoolBlocks(void)
+{
+	Std_Pool_t pool;
+	Std_Pool_t other;
+	u8 arrBuffer[1 + STD_POOL_BUFFER_SIZE(10, 3)];   /**< the pool starts at arrBuffer[1] : arrBuffer[0] is before it */
+	u8 *buffer = &arrBuffer[1];
+	u8 arrOther[STD_POOL_BUFFER_SIZE(10, 1)];
+	u8 *arrBlock[3];
+	u8 *block;
+	Std_PoolStats_t stats;
+	u8 i;
+
+	CHECK("pool_init_null", STD_NULL_POINTER == Std_PoolInit(NULL_PTR, buffer, 10, 3));
+	CHECK("pool_init_null_buffer", STD_NULL_POINTER == Std_PoolInit(&pool, NULL_PTR, 10, 3));
+	CHECK("pool_init_zero_size", STD_INVALID_ARG == Std_PoolInit(&pool, buffer, 0, 3));
+	CHECK("pool_init_zero_count", STD_INVALID_ARG == Std_PoolInit(&pool, buffer, 10, 0));
+	CHECK("pool_init_255_blocks", STD_INVALID_ARG == Std_PoolInit(&pool, buffer, 10, STD_POOL_NONE));
+	/* the map is cleared by the init , whatever the buffer held */
+	memset(arrBuffer, 0xFF, sizeof(arrBuffer));
+	CHECK("pool_init", STD_OK == Std_PoolInit(&pool, buffer, 10, 3));
+	Std_PoolInit(&other, arrOther, 10, 1);
+
+	for(i = 0; i < 3; i++)
+	{
+		arrBlock[i] = (u8*)Std_PoolAllocBlock(&pool);
+		if(NULL_PTR != arrBlock[i])
+		{
+			memset(arrBlock[i], 0x10 + i, 10);
+		}
+	}
+	CHECK("pool_alloc_all", (NULL_PTR != arrBlock[0]) && (NULL_PTR != arrBlock[1]) && (NULL_PTR != arrBlock[2]));
+	CHECK("pool_alloc_distinct", (arrBlock[1] - arrBlock[0] == 10) && (arrBlock[2] - arrBlock[1] == 10));
+	CHECK("pool_alloc_empty", NULL_PTR == Std_PoolAllocBlock(&pool));
+	CHECK("pool_alloc_null", NULL_PTR == Std_PoolAllocBlock(NULL_PTR));
+	CHECK("pool_stats_full", (STD_OK == Std_PoolGetStats(&pool, &stats)) && (3 == stats.Used) && (3 == stats.Peak) &&
+	      (1 == stats.Fails) && (10 == stats.BlockSize) && (3 == stats.BlockCount));
+	CHECK("pool_blocks_kept", (0x10 == arrBlock[0][9]) && (0x11 == arrBlock[1][9]) && (0x12 == arrBlock[2][9]));
+
+	/* bad pointers : nothing changes */
+	CHECK("pool_free_null", STD_NULL_POINTER == Std_PoolFreeBlock(&pool, NULL_PTR));
+	CHECK("pool_free_null_pool", STD_NULL_POINTER == Std_PoolFreeBlock(NULL_PTR, arrBlock[0]));
+	CHECK("pool_free_inside_block", STD_INVALID_ARG == Std_PoolFreeBlock(&pool, arrBlock[1] + 3));
+	CHECK("pool_free_before", STD_OUT_OF_RANGE == Std_PoolFreeBlock(&pool, &arrBuffer[0]));
+	CHECK("pool_free_map", STD_OUT_OF_RANGE == Std_PoolFreeBlock(&pool, &buffer[30]));
+	CHECK("pool_free_other_pool", STD_OUT_OF_RANGE == Std_PoolFreeBlock(&other, arrBlock[0]));
+	CHECK("pool_bad_free_keeps_used", (STD_OK == Std_PoolGetStats(&pool, &stats)) && (3 == stats.Used));
+
+	/* the freed block is given again , a double free is refused and the block is not given twice */
+	CHECK("pool_free", STD_OK == Std_PoolFreeBlock(&pool, arrBlock[1]));
+	CHECK("pool_double_free", STD_NOT_EXIST == Std_PoolFreeBlock(&pool, arrBlock[1]));
+	CHECK("pool_double_free_keeps_used", (STD_OK == Std_PoolGetStats(&pool, &stats)) && (2 == stats.Used));
+	block = (u8*)Std_PoolAllocBlock(&pool);
+	CHECK("pool_reuse", arrBlock[1] == block);
+	CHECK("pool_no_block_twice", NULL_PTR == Std_PoolAllocBlock(&pool));
+	CHECK("pool_free_all", (STD_OK == Std_PoolFreeBlock(&pool, arrBlock[0])) && (STD_OK == Std_PoolFreeBlock(&pool, arrBlock[1])) &&
+	      (STD_OK == Std_PoolFreeBlock(&pool, arrBlock[2])));
+	CHECK("pool_stats_empty", (STD_OK == Std_PoolGetStats(&pool, &stats)) && (0 == stats.Used) && (3 == stats.Peak) && (2 == stats.Fails));
+
+	/* a block never allocated is not free-able either */
+	Std_PoolInit(&pool, buffer, 10, 3);
+	block = (u8*)Std_PoolAllocBlock(&pool);
+	CHECK("pool_free_never_allocated", STD_NOT_EXIST == Std_PoolFreeBlock(&pool, &buffer[20]));
+	CHECK("pool_free_first", STD_OK == Std_PoolFreeBlock(&pool, block));
+}
+
+/**
+ * @brief Std_PoolAlloc / Std_PoolFree on the size classes of Std_Pool_Lcfg.h.
+ */
+static void Check_PoolClasses(void)
+{
+	u8 *arrBlock[STD_POOL_CLASS0_COUNT + STD_POOL_CLASS1_COUNT + STD_POOL_CLASS2_COUNT];
+	u8 local = 0;
+	u8 *block;
+	u8 count = 0;
+	u8 i;
+	Std_Bool_t ok = STD_TRUE;
+
+	/* the smallest class that fits */
+	block = (u8*)Std_PoolAlloc(1);
+	CHECK("pool_class_1_byte", 0 == Check_PoolClassOf(block));
+	Std_PoolFree(block);
+	block = (u8*)Std_PoolAlloc(STD_POOL_CLASS0_SIZE);
+	CHECK("pool_class_0_max", 0 == Check_PoolClassOf(block));
+	Std_PoolFree(block);
+	block = (u8*)Std_PoolAlloc(STD_POOL_CLASS0_SIZE + 1);
+	CHECK("pool_class_1_min", 1 == Check_PoolClassOf(block));
+	Std_PoolFree(block);
+	block = (u8*)Std_PoolAlloc(STD_POOL_CLASS2_SIZE);
+	CHECK("pool_class_2_max", 2 == Check_PoolClassOf(block));
+	Std_PoolFree(block);
+	CHECK("pool_class_too_big", NULL_PTR == Std_PoolAlloc(STD_POOL_CLASS2_SIZE + 1));
+	CHECK("pool_class_stats_start", Check_PoolClassStats(0, 0, 1, 0) && Check_PoolClassStats(1, 0, 1, 0) && Check_PoolClassStats(2, 0, 1, 0));
+
+	/* small requests fill class 0 , then go to the bigger classes , then fail */
+	for(block = (u8*)Std_PoolAlloc(1); NULL_PTR != block; block = (u8*)Std_PoolAlloc(1))
+	{
+		arrBlock[count] = block;
+		memset(block, count, Std_Pool_arrClasses[Check_PoolClassOf(block)]->BlockSize);
+		count++;
+	}
+	CHECK("pool_class_exhausted", sizeof(arrBlock) / sizeof(arrBlock[0]) == count);
+	for(i = 0; i < count; i++)
+	{
+		ok = (Check_PoolClassOf(arrBlock[i]) == ((i < STD_POOL_CLASS0_COUNT) ? 0 : (i < STD_POOL_CLASS0_COUNT + STD_POOL_CLASS1_COUNT) ? 1 : 2)) ? ok : STD_FALSE;
+		ok = ((i == arrBlock[i][0]) && (i == arrBlock[i][Std_Pool_arrClasses[Check_PoolClassOf(arrBlock[i])]->BlockSize - 1])) ? ok : STD_FALSE;
+	}
+	CHECK("pool_class_order_and_data", STD_TRUE == ok);
+	/* a fail is counted by every empty class that fits : 1 + 1 + 1 for the last request , plus the earlier fallbacks */
+	CHECK("pool_class_stats_full", Check_PoolClassStats(0, STD_POOL_CLASS0_COUNT, STD_POOL_CLASS0_COUNT, STD_POOL_CLASS1_COUNT + STD_POOL_CLASS2_COUNT + 1) &&
+	      Check_PoolClassStats(1, STD_POOL_CLASS1_COUNT, STD_POOL_CLASS1_COUNT, STD_POOL_CLASS2_COUNT + 1) &&
+	      Check_PoolClassStats(2, STD_POOL_CLASS2_COUNT, STD_POOL_CLASS2_COUNT, 1));
+	/* only class 2 fits a block of STD_POOL_CLASS1_SIZE + 1 : it counts one more fail */
+	CHECK("pool_class_big_fails", NULL_PTR == Std_PoolAlloc(STD_POOL_CLASS1_SIZE + 1));
+
+	/* bad pointers and double free through the classes */
+	CHECK("pool_class_free_null", STD_OK == Std_PoolFree(NULL_PTR));
+	CHECK("pool_class_free_local", STD_OUT_OF_RANGE == Std_PoolFree(&local));
+	CHECK("pool_class_free_inside", STD_INVALID_ARG == Std_PoolFree(arrBlock[STD_POOL_CLASS0_COUNT] + 1));
+	CHECK("pool_class_free", STD_OK == Std_PoolFree(arrBlock[0]));
+	CHECK("pool_class_double_free", STD_NOT_EXIST == Std_PoolFree(arrBlock[0]));
+	CHECK("pool_class_stats_after_double_free", Check_PoolClassStats(0, STD_POOL_CLASS0_COUNT - 1, STD_POOL_CLASS0_COUNT, STD_POOL_CLASS1_COUNT + STD_POOL_CLASS2_COUNT + 1));
+	block = (u8*)Std_PoolAlloc(1);
+	CHECK("pool_class_reuse", (arrBlock[0] == block) && (NULL_PTR == Std_PoolAlloc(1)));
+
+	ok = STD_TRUE;
+	for(i = 0; i < count; i++)
+	{
+		ok = (STD_OK == Std_PoolFree(arrBlock[i])) ? ok : STD_FALSE;
+	}
+	CHECK("pool_class_free_all", STD_TRUE == ok);
+	CHECK("pool_class_stats_end", Check_PoolClassStats(0, 0, STD_POOL_CLASS0_COUNT, STD_POOL_CLASS1_COUNT + STD_POOL_CLASS2_COUNT + 2) &&
+	      Check_PoolClassStats(1, 0, STD_POOL_CLASS1_COUNT, STD_POOL_CLASS2_COUNT + 2) && Check_PoolClassStats(2, 0, STD_POOL_CLASS2_COUNT, 3));
+	CHECK("pool_class_stats_bad_index", STD_OUT_OF_RANGE == Std_PoolGetClassStats(STD_POOL_CLASS_COUNT, NULL_PTR));
+}
+
+/************************************************************************/
+/*                            Std_Printf                                */
+/************************************************************************/
+static void Check_PrintfSink(u8 data)
+{
+	if(Check_u16PrintfLen < (CHECK_PRINTF_OUT_SIZE - 1))
+	{
+		Check_arrPrintfOut[Check_u16PrintfLen] = (char)data;
+	}
+	Check_u16PrintfLen++;
+}
+
+/**
+ * @brief The sink got the expected characters and Std_Printf returned their number.
+ */
+static Std_Bool_t Check_PrintfIs(const char *expected, u16 written)
+{
+	u16 len = (Check_u16PrintfLen < (CHECK_PRINTF_OUT_SIZE - 1)) ? Check_u16PrintfLen : (CHECK_PRINTF_OUT_SIZE - 1);
+
+	Check_arrPrintfOut[len] = NULL_CHAR;
+	if((written != Check_u16PrintfLen) || (strlen(expected) != Check_u16PrintfLen) || (0 != strcmp(expected, Check_arrPrintfOut)))
+	{
+		fprintf(stderr, "Std_Printf wrote \"%s\" (%u) , expected \"%s\"\n", Check_arrPrintfOut, (unsigned)written, expected);
+		return STD_FALSE;
+	}
+	return STD_TRUE;
+}
+
+#define CHECK_PRINTF(name, expected, ...)                                                            \
+	do                                                                                               \
+	{                                                                                                \
+		Check_u16PrintfLen = 0;                                                                      \
+		CHECK(name, Check_PrintfIs((expected), Std_Printf(Check_PrintfSink, __VA_ARGS__)));          \
+	} while(0)
+
+/**
+ * @brief The conversions , the flags , the width and the 'l' modifier of Std_Printf , the 16-bit and 32-bit limits.
+ *        The int values stay in the 16-bit range of the AVR.
+ */
+static void Check_Printf(void)
+{
+	CHECK_PRINTF("printf_literal", "T=ok\r\n", "T=ok\r\n");
+	CHECK_PRINTF("printf_empty", "", "");
+	CHECK_PRINTF("printf_conversions", "a=5 b=-12 c=ff d=FF e=0", "a=%d b=%i c=%x d=%X e=%u", 5, -12, 0xFF, 0xFF, 0u);
+	CHECK_PRINTF("printf_width", "[   42][42   ][00042][-0042][  -42]", "[%5d][%-5d][%05d][%05d][%5d]", 42, 42, 42, -42, -42);
+	CHECK_PRINTF("printf_left_wins", "[42   ][-7  ]", "[%-05d][%0-4d]", 42, -7);
+	CHECK_PRINTF("printf_width_small", "123456|     65535", "%3lu|%10u", (u32)123456, 65535u);
+	CHECK_PRINTF("printf_16bit_limits", "65535 -32768 32767 0", "%u %d %d %x", 65535u, -32768, 32767, 0u);
+	CHECK_PRINTF("printf_32bit_limits", "4294967295 -2147483648 2147483647 deadbeef DEADBEEF", "%lu %ld %ld %lx %lX",
+	             (u32)4294967295u, (s32)(-2147483647 - 1), (s32)2147483647, (u32)0xDEADBEEF, (u32)0xDEADBEEF);
+	CHECK_PRINTF("printf_32bit_split", "65535 65536 -65536 10000", "%lu %lu %ld %lx", (u32)65535, (u32)65536, (s32)-65536, (u32)0x10000);
+	CHECK_PRINTF("printf_long_zero_pad", "0001A|00000000", "%05lX|%08lx", (u32)26, (u32)0);
+	CHECK_PRINTF("printf_strings", "x|  hi|hi  |abcd|(null)", "%c|%4s|%-4s|%2s|%s", 'x', "hi", "hi", "abcd", (const char *)NULL_PTR);
+	CHECK_PRINTF("printf_percent", "100% %q", "100%% %q");
+	CHECK_PRINTF("printf_percent_at_end", "ab", "ab%");
+	CHECK_PRINTF("printf_example", "T= 23.5 C id=1A2B\r\n", "T=%3d.%u C id=%04X\r\n", 235 / 10, 235 % 10, 0x1A2B);
+}
+
+/************************************************************************/
+/*                            UART_Stack                                */
+/************************************************************************/
+static void Check_IsrPush(void)
+{
+	Push(CHECK_ISR_BYTE);
+}
+
+/**
+ * @brief Pops everything (bottom first) , returns the number of bytes.
+ */
+static u8 Check_UartStackDrain(u8 data[])
+{
+	u8 count = Stack_GetCount();
+
+	if((0 != count) && (DONE != PopN(data, count)))
+	{
+		return 0xFF;
+	}
+	return count;
+}
+
+/**
+ * @brief PopN with an ISR push in every interrupt window : the popped block and the bytes left are one of the
+ *        two orders a real interleaving can give (the ISR byte popped as the new top , or left on the stack).
+ */
+static void Check_UartStackPopN(void)
+{
+	u8 arrBase[6] = {10, 11, 12, 13, 14, 15};
+	u8 arrOut[STACK_SIZE];
+	u8 arrLeft[STACK_SIZE];
+	u8 arrExpect[STACK_SIZE];
+	Std_BufferStats_t before, after;
+	u8 windows, window, left;
+	u8 len = 3;
+	Std_Bool_t ok = STD_TRUE;
+	Std_Bool_t okStats = STD_TRUE;
+
+	Check_UartStackDrain(arrLeft);
+	CHECK("uart_stack_pushn", DONE == PushN(arrBase, sizeof(arrBase)));
+	Sim_ArmIsr(Check_IsrPush, CHECK_NO_WINDOW);
+	CHECK("uart_stack_popn", (DONE == PopN(arrOut, len)) && (0 == memcmp(arrOut, &arrBase[sizeof(arrBase) - len], len)));
+	windows = Sim_u8Windows;
+	Sim_DisarmIsr();
+
+	for(window = 1; window <= windows; window++)
+	{
+		Check_UartStackDrain(arrLeft);
+		PushN(arrBase, sizeof(arrBase));
+		Stack_GetStats(&before);
+		Sim_ArmIsr(Check_IsrPush, window);
+		ok = (DONE == PopN(arrOut, len)) ? ok : STD_FALSE;
+		Sim_DisarmIsr();
+		Stack_GetStats(&after);
+
+		/* the ISR byte was the top when the block was removed */
+		memcpy(arrExpect, &arrBase[sizeof(arrBase) - len + 1], len - 1);
+		arrExpect[len - 1] = CHECK_ISR_BYTE;
+		if(0 == memcmp(arrOut, arrExpect, len))
+		{
+			left = Check_UartStackDrain(arrLeft);
+			ok = ((sizeof(arrBase) - len + 1) == left) && (0 == memcmp(arrLeft, arrBase, left)) ? ok : STD_FALSE;
+		}
+		else
+		{
+			/* the ISR byte came after the removal */
+			left = Check_UartStackDrain(arrLeft);
+			ok = (0 == memcmp(arrOut, &arrBase[sizeof(arrBase) - len], len)) && ((sizeof(arrBase) - len + 1) == left) &&
+			     (0 == memcmp(arrLeft, arrBase, left - 1)) && (CHECK_ISR_BYTE == arrLeft[left - 1]) ? ok : STD_FALSE;
+		}
+		ok = (1 == Sim_u8IsrCalls) ? ok : STD_FALSE;
+		okStats = ((after.Pushed - before.Pushed) == 1) && ((after.Popped - before.Popped) == len) &&
+		          (after.Drops == before.Drops) && (after.Overwrites == before.Overwrites) ? okStats : STD_FALSE;
+		if(STD_TRUE != ok)
+		{
+			fprintf(stderr, "uart_stack_popn_isr : window %u\n", window);
+			break;
+		}
+	}
+	CHECK("uart_stack_popn_isr_windows", windows >= 4);
+	CHECK("uart_stack_popn_isr_data", STD_TRUE == ok);
+	CHECK("uart_stack_popn_isr_counters", STD_TRUE == okStats);
+}
+
+/**
+ * @brief PushN with an ISR push in every interrupt window : the ISR byte is below or above the whole block.
+ */
+static void Check_UartStackPushN(void)
+{
+	u8 arrBase[2] = {20, 21};
+	u8 arrBlock[4] = {30, 31, 32, 33};
+	u8 arrLeft[STACK_SIZE];
+	u8 arrBelow[STACK_SIZE];
+	u8 arrAbove[STACK_SIZE];
+	Std_BufferStats_t before, after;
+	u8 windows, window, left;
+	Std_Bool_t ok = STD_TRUE;
+	Std_Bool_t okStats = STD_TRUE;
+
+	/* base , ISR byte , block  or  base , block , ISR byte */
+	memcpy(arrBelow, arrBase, sizeof(arrBase));
+	arrBelow[sizeof(arrBase)] = CHECK_ISR_BYTE;
+	memcpy(&arrBelow[sizeof(arrBase) + 1], arrBlock, sizeof(arrBlock));
+	memcpy(arrAbove, arrBase, sizeof(arrBase));
+	memcpy(&arrAbove[sizeof(arrBase)], arrBlock, sizeof(arrBlock));
+	arrAbove[sizeof(arrBase) + sizeof(arrBlock)] = CHECK_ISR_BYTE;
+
+	Check_UartStackDrain(arrLeft);
+	PushN(arrBase, sizeof(arrBase));
+	Sim_ArmIsr(Check_IsrPush, CHECK_NO_WINDOW);
+	PushN(arrBlock, sizeof(arrBlock));
+	windows = Sim_u8Windows;
+	Sim_DisarmIsr();
+
+	for(window = 1; window <= windows; window++)
+	{
+		Check_UartStackDrain(arrLeft);
+		PushN(arrBase, sizeof(arrBase));
+		Stack_GetStats(&before);
+		Sim_ArmIsr(Check_IsrPush, window);
+		ok = (DONE == PushN(arrBlock, sizeof(arrBlock))) ? ok : STD_FALSE;
+		Sim_DisarmIsr();
+		Stack_GetStats(&after);
+		left = Check_UartStackDrain(arrLeft);
+		ok = (sizeof(arrBase) + sizeof(arrBlock) + 1 == left) &&
+		     ((0 == memcmp(arrLeft, arrBelow, left)) || (0 == memcmp(arrLeft, arrAbove, left))) ? ok : STD_FALSE;
+		okStats = ((after.Pushed - before.Pushed) == sizeof(arrBlock) + 1) && (after.Drops == before.Drops) &&
+		          (after.Peak >= sizeof(arrBase) + sizeof(arrBlock) + 1) ? okStats : STD_FALSE;
+	}
+	CHECK("uart_stack_pushn_isr_windows", windows >= 2);
+	CHECK("uart_stack_pushn_isr_data", STD_TRUE == ok);
+	CHECK("uart_stack_pushn_isr_counters", STD_TRUE == okStats);
+}
+
+/************************************************************************/
+/*                            main                                      */
+/************************************************************************/
+int main(void)
+{
+	Check_StackTyped();
+	Check_StackGeneric();
+	Check_StackWrapAround();
+	Check_StackClear();
+	Check_Policies();
+	Check_PoolBlocks();
+	Check_PoolClasses();
+	Check_Printf();
+	Check_UartStackPopN();
+	Check_UartStackPushN();
+
+	printf("{\"passed\":%lu,\"failed\":%lu}\n", (unsigned long)Check_u32Passed, (unsigned long)Check_u32Failed);
+	return (0 == Check_u32Failed) ? 0 : 1;
+}
@@ -0,0 +1,30 @@
+/**
+ * @file Utils_interrupt.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host replacement of LIB/Utils_interrupt.h for the LIB checks : SREG is a variable.
+ *         Sim_Interrupt is called where the target can take an interrupt around a critical section :
+ *         just before Critical_Enter disables the interrupts and just after Critical_Exit enables them again.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UTILS_INTERRUPT_H_
+#define UTILS_INTERRUPT_H_
+
+#include "Std_Types.h"
+
+/* ================================== SREG ================================== */
+extern volatile u8 Sim_SREG;
+void Sim_Interrupt(void);
+
+#define sei()   (Sim_SREG |= (u8)0x80)
+#define cli()   (Sim_SREG &= (u8)~0x80)
+
+/* ================================== critical section ================================== */
+#define CRITICAL_SREG                     Sim_SREG
+#define Critical_Enter(sregCopy)          do{ Sim_Interrupt(); (sregCopy)=Sim_SREG; Sim_SREG &= (u8)~0x80; }while(0)
+#define Critical_Exit(sregCopy)           do{ Sim_SREG=(sregCopy); Sim_Interrupt(); }while(0)
+
+#endif /* UTILS_INTERRUPT_H_ */
@@ -0,0 +1,621 @@
+/**
+ * @file Sim_USART.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the host model of the ATmega32 USART used by the UART benchmark.
+ *
+ *         Access of a register : the macros of host/MemMap.h return a 16-bit slot loaded with the value of the register ,
+ *         the driver reads or writes it and the access is committed at the next access (or at Sim_Poll , Sim_Idle , Sim_Work) :
+ *           - UDR   : the slot is loaded with 0x100 | the first byte of the RX FIFO , a write stores a value below 0x100 ,
+ *                     so an unchanged slot is a read (the byte is removed from the FIFO) and a value below 0x100 is a write.
+ *           - UCSRA : writing 1 to TXC clears it , U2X and MPCM are stored.
+ *           - UCSRC : URSEL (bit 7) set writes UCSRC (the frame) , URSEL clear writes UBRRH.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * LIB files
+ */
+#include "Std_Types.h"
+#include "Utils_interrupt.h"
+
+/*
+ * the module files
+ */
+#include "Sim_USART.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PRIVATE Macros                                  */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define SIM_TX_CAPTURE_SIZE    4096
+#define SIM_RX_FIFO_SIZE       2
+#define SIM_NO_EVENT           (~(u64)0)
+#define SIM_SREG_I             0x80
+
+/* UCSRA */
+#define SIM_UCSRA_MPCM         0x01
+#define SIM_UCSRA_U2X          0x02
+#define SIM_UCSRA_DOR          0x08
+#define SIM_UCSRA_UDRE         0x20
+#define SIM_UCSRA_TXC          0x40
+#define SIM_UCSRA_RXC          0x80
+/* UCSRB */
+#define SIM_UCSRB_UCSZ2        0x04
+#define SIM_UCSRB_TXEN         0x08
+#define SIM_UCSRB_RXEN         0x10
+#define SIM_UCSRB_UDRIE        0x20
+#define SIM_UCSRB_TXCIE        0x40
+#define SIM_UCSRB_RXCIE        0x80
+/* UCSRC */
+#define SIM_UCSRC_UCSZ         0x06
+#define SIM_UCSRC_USBS         0x08
+#define SIM_UCSRC_UPM1         0x20
+#define SIM_UCSRC_URSEL        0x80
+
+#define SIM_UDR_READ_MARK      0x100
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                     Static Private Global Vaiables                           */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+volatile u8 Sim_SREG = 0;
+
+static u32 Sim_u32Fcpu;
+static u32 Sim_u32Baud;
+static u8  Sim_u8AccessCycles;
+static u8  Sim_u8IsrCycles;
+static u64 Sim_u64Now;
+static u32 Sim_u32FrameCycles;
+static u8  Sim_u8FrameBits;
+static Std_Bool_t Sim_InIsr;
+
+/* registers */
+static u8 Sim_u8Ucsra;                 /**< U2X and MPCM , the flags are calculated */
+static u8 Sim_u8Ucsrb;
+static u8 Sim_u8Ucsrc;
+static u8 Sim_u8Ubrrh;
+static u8 Sim_u8Ubrrl;
+static volatile u16 Sim_arrSlots[SIM_REG_COUNT];
+static u16 Sim_arrSlotLoaded[SIM_REG_COUNT];
+static Std_Bool_t Sim_AccessPending;
+static Sim_Reg_t  Sim_PendingReg;
+
+/* transmitter */
+static Std_Bool_t Sim_TxDataFull;      /**< UDR holds a byte (UDRE clear) */
+static u8  Sim_u8TxData;
+static Std_Bool_t Sim_TxShifting;
+static u8  Sim_u8TxShift;
+static u64 Sim_u64TxEnd;               /**< end of the frame in the shift register */
+static Std_Bool_t Sim_Txc;
+static u8  Sim_arrTxCapture[SIM_TX_CAPTURE_SIZE];
+static u32 Sim_u32TxCaptured;          /**< bytes sent since Sim_Init */
+
+/* receiver */
+static u8  Sim_arrRxFifo[SIM_RX_FIFO_SIZE];
+static u8  Sim_u8RxCount;
+static Std_Bool_t Sim_Dor;
+static const u8 *Sim_pRxSource;
+static u32 Sim_u32RxSourceLen;
+static u32 Sim_u32RxSourceIdx;
+static u32 Sim_u32RxGap;
+static u64 Sim_u64RxNext;              /**< end of the next frame on the RX pin */
+
+static Sim_Stats_t Sim_Stats;
+static u64 Sim_u64StatsStart;          /**< time of Sim_ResetStats */
+
+/* the ISRs of UART.c */
+void USART_RXC_VECT(void);
+void USART_UDRE_VECT(void);
+void USART_TXC_VECT(void);
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                        Static Private Functions                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief Calculates the frame of UCSRC : start + data + parity + stop bits.
+ */
+static void Sim_UpdateFrame(void)
+{
+	u8 dataBits = (u8)(5 + ((Sim_u8Ucsrc & SIM_UCSRC_UCSZ) >> 1));
+
+	if(Sim_u8Ucsrb & SIM_UCSRB_UCSZ2)
+	{
+		dataBits = 9;
+	}
+	Sim_u8FrameBits = (u8)(1 + dataBits + ((Sim_u8Ucsrc & SIM_UCSRC_UPM1) ? 1 : 0) + ((Sim_u8Ucsrc & SIM_UCSRC_USBS) ? 2 : 1));
+	Sim_u32FrameCycles = (u32)(((u64)Sim_u8FrameBits * Sim_u32Fcpu + (Sim_u32Baud / 2)) / Sim_u32Baud);
+}
+
+/**
+ * @brief Gets the current value of UCSRA.
+ */
+static u8 Sim_GetUcsra(void)
+{
+	u8 value = Sim_u8Ucsra & (SIM_UCSRA_U2X | SIM_UCSRA_MPCM);
+
+	if(0 != Sim_u8RxCount)               { value |= SIM_UCSRA_RXC; }
+	if(STD_TRUE == Sim_Txc)              { value |= SIM_UCSRA_TXC; }
+	if(STD_FALSE == Sim_TxDataFull)      { value |= SIM_UCSRA_UDRE; }
+	if(STD_TRUE == Sim_Dor)              { value |= SIM_UCSRA_DOR; }
+
+	return value;
+}
+
+/**
+ * @brief Loads the byte of UDR in the shift register.
+ */
+static void Sim_TxStartFrame(u8 data)
+{
+	Sim_u8TxShift  = data;
+	Sim_TxShifting = STD_TRUE;
+	Sim_u64TxEnd   = Sim_u64Now + Sim_u32FrameCycles;
+}
+
+/**
+ * @brief Gets the time of the next event of the line.
+ */
+static u64 Sim_NextEvent(void)
+{
+	u64 next = SIM_NO_EVENT;
+
+	if(STD_TRUE == Sim_TxShifting)
+	{
+		next = Sim_u64TxEnd;
+	}
+	if((Sim_u32RxSourceIdx < Sim_u32RxSourceLen) && (Sim_u64RxNext < next))
+	{
+		next = Sim_u64RxNext;
+	}
+
+	return next;
+}
+
+/**
+ * @brief Moves the time to target and executes the events of the line on the way (the flags only , no interrupt).
+ */
+static void Sim_Advance(u64 target)
+{
+	u64 next;
+
+	while((next = Sim_NextEvent()) <= target)
+	{
+		Sim_u64Now = next;
+		if((STD_TRUE == Sim_TxShifting) && (Sim_u64TxEnd == next))
+		{
+			if(Sim_u32TxCaptured < SIM_TX_CAPTURE_SIZE)
+			{
+				Sim_arrTxCapture[Sim_u32TxCaptured] = Sim_u8TxShift;
+			}
+			Sim_u32TxCaptured++;
+			Sim_Stats.TxBytes++;
+			if(STD_TRUE == Sim_TxDataFull)
+			{
+				Sim_TxDataFull = STD_FALSE;
+				Sim_TxStartFrame(Sim_u8TxData);
+			}
+			else
+			{
+				Sim_TxShifting = STD_FALSE;
+				Sim_Txc = STD_TRUE;
+			}
+		}
+		else
+		{
+			if(Sim_u8Ucsrb & SIM_UCSRB_RXEN)
+			{
+				if(Sim_u8RxCount < SIM_RX_FIFO_SIZE)
+				{
+					Sim_arrRxFifo[Sim_u8RxCount] = Sim_pRxSource[Sim_u32RxSourceIdx];
+					Sim_u8RxCount++;
+				}
+				else
+				{
+					Sim_Dor = STD_TRUE;
+					Sim_Stats.RxOverruns++;
+				}
+			}
+			Sim_Stats.RxBytes++;
+			Sim_u32RxSourceIdx++;
+			Sim_u64RxNext += (u64)Sim_u32FrameCycles + Sim_u32RxGap;
+		}
+	}
+	Sim_u64Now = target;
+}
+
+/**
+ * @brief The CPU executes cycles of UART code (counted as busy , and as ISR time inside an ISR).
+ */
+static void Sim_Spend(u32 cycles)
+{
+	Sim_Advance(Sim_u64Now + cycles);
+	Sim_Stats.BusyCycles += cycles;
+	if(STD_TRUE == Sim_InIsr)
+	{
+		Sim_Stats.IsrCycles += cycles;
+	}
+}
+
+/**
+ * @brief Applies the last access of the driver to the registers.
+ */
+static void Sim_Commit(void)
+{
+	u16 value;
+
+	if(STD_FALSE == Sim_AccessPending)
+	{
+		return;
+	}
+	Sim_AccessPending = STD_FALSE;
+	value = Sim_arrSlots[Sim_PendingReg];
+
+	switch(Sim_PendingReg)
+	{
+	case SIM_REG_UDR:
+		if(value < SIM_UDR_READ_MARK)
+		{
+			if(0 == (Sim_u8Ucsrb & SIM_UCSRB_TXEN))
+			{
+				/* the transmitter is disabled , the byte is lost */
+			}
+			else if(STD_FALSE == Sim_TxShifting)
+			{
+				Sim_TxStartFrame((u8)value);
+			}
+			else if(STD_FALSE == Sim_TxDataFull)
+			{
+				Sim_TxDataFull = STD_TRUE;
+				Sim_u8TxData = (u8)value;
+			}
+			else
+			{
+				Sim_Stats.TxLost++;
+			}
+		}
+		else if(0 != Sim_u8RxCount)
+		{
+			Sim_arrRxFifo[0] = Sim_arrRxFifo[1];
+			Sim_u8RxCount--;
+			Sim_Dor = STD_FALSE;
+		}
+		break;
+
+	case SIM_REG_UCSRA:
+		if(value != Sim_arrSlotLoaded[SIM_REG_UCSRA])
+		{
+			if(value & SIM_UCSRA_TXC)
+			{
+				Sim_Txc = STD_FALSE;
+			}
+			Sim_u8Ucsra = (u8)(value & (SIM_UCSRA_U2X | SIM_UCSRA_MPCM));
+		}
+		break;
+
+	case SIM_REG_UCSRB:
+		Sim_u8Ucsrb = (u8)value;
+		if(0 == (Sim_u8Ucsrb & SIM_UCSRB_RXEN))
+		{
+			Sim_u8RxCount = 0;
+		}
+		Sim_UpdateFrame();
+		break;
+
+	case SIM_REG_UCSRC:
+		if(value != Sim_arrSlotLoaded[SIM_REG_UCSRC])
+		{
+			if(value & SIM_UCSRC_URSEL)
+			{
+				Sim_u8Ucsrc = (u8)value;
+				Sim_UpdateFrame();
+			}
+			else
+			{
+				Sim_u8Ubrrh = (u8)value;
+			}
+		}
+		break;
+
+	case SIM_REG_UBRRL:
+		Sim_u8Ubrrl = (u8)value;
+		break;
+
+	default:
+		break;
+	}
+}
+
+/**
+ * @brief Executes an ISR of UART.c with the global interrupt disabled.
+ */
+static void Sim_RunIsr(void (*pfVector)(void))
+{
+	u8 sregCopy = Sim_SREG;
+
+	Sim_InIsr = STD_TRUE;
+	Sim_SREG &= (u8)~SIM_SREG_I;
+	Sim_Stats.IsrCalls++;
+	Sim_Spend(Sim_u8IsrCycles);
+	pfVector();
+	Sim_Commit();
+	Sim_SREG = sregCopy;
+	Sim_InIsr = STD_FALSE;
+}
+
+/**
+ * @brief Executes the pending interrupts in the order of the vectors (RXC , UDRE , TXC).
+ */
+static void Sim_Dispatch(void)
+{
+	Std_Bool_t pending = STD_TRUE;
+
+	while((STD_TRUE == pending) && (STD_FALSE == Sim_InIsr) && (Sim_SREG & SIM_SREG_I))
+	{
+		if((0 != Sim_u8RxCount) && (Sim_u8Ucsrb & SIM_UCSRB_RXCIE))
+		{
+			Sim_RunIsr(USART_RXC_VECT);
+		}
+		else if((STD_FALSE == Sim_TxDataFull) && (Sim_u8Ucsrb & SIM_UCSRB_UDRIE))
+		{
+			Sim_RunIsr(USART_UDRE_VECT);
+		}
+		else if((STD_TRUE == Sim_Txc) && (Sim_u8Ucsrb & SIM_UCSRB_TXCIE))
+		{
+			/* TXC is cleared when its vector is executed */
+			Sim_Txc = STD_FALSE;
+			Sim_RunIsr(USART_TXC_VECT);
+		}
+		else
+		{
+			pending = STD_FALSE;
+		}
+	}
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Resets the USART , the time and the counters.
+ *
+ * @param fcpu the CPU frequency in Hz.
+ * @param baud the baud rate of the line (the UBRR written by UART_Init is not used).
+ * @param accessCycles the cycles of one register access (a poll of a flag costs one access).
+ * @param isrCycles the cycles of the entry and exit of an ISR (vector , prologue , epilogue , reti).
+ */
+void Sim_Init(u32 fcpu, u32 baud, u8 accessCycles, u8 isrCycles)
+{
+	u8 i;
+
+	Sim_u32Fcpu = fcpu;
+	Sim_u32Baud = baud;
+	Sim_u8AccessCycles = accessCycles;
+	Sim_u8IsrCycles = isrCycles;
+	Sim_u64Now = 0;
+	Sim_InIsr = STD_FALSE;
+	Sim_SREG = 0;
+
+	/* reset values of the ATmega32 : UDRE set , 8 data bits , 1 stop bit */
+	Sim_u8Ucsra = 0;
+	Sim_u8Ucsrb = 0;
+	Sim_u8Ucsrc = SIM_UCSRC_URSEL | SIM_UCSRC_UCSZ;
+	Sim_u8Ubrrh = 0;
+	Sim_u8Ubrrl = 0;
+	for(i=0; i<SIM_REG_COUNT; i++)
+	{
+		Sim_arrSlots[i] = 0;
+		Sim_arrSlotLoaded[i] = 0;
+	}
+	Sim_AccessPending = STD_FALSE;
+
+	Sim_TxDataFull = STD_FALSE;
+	Sim_TxShifting = STD_FALSE;
+	Sim_Txc = STD_FALSE;
+	Sim_u8RxCount = 0;
+	Sim_Dor = STD_FALSE;
+	Sim_pRxSource = NULL_PTR;
+	Sim_u32RxSourceLen = 0;
+	Sim_u32RxSourceIdx = 0;
+	Sim_u32TxCaptured = 0;
+
+	Sim_UpdateFrame();
+	Sim_ResetStats();
+}
+
+/**
+ * @brief Gets the slot of a register (used by host/MemMap.h for every access).
+ *        The previous access is committed , the time moves by one access and the pending interrupts are executed ,
+ *        then the slot is loaded with the current value of the register.
+ *
+ * @param reg the register.
+ * @return volatile u16* the slot read or written by the driver.
+ */
+volatile u16* Sim_RegAccess(Sim_Reg_t reg)
+{
+	u16 value = 0;
+
+	Sim_Commit();
+	Sim_Stats.RegAccesses++;
+	Sim_Spend(Sim_u8AccessCycles);
+	Sim_Dispatch();
+
+	switch(reg)
+	{
+	case SIM_REG_UDR:   value = (u16)(SIM_UDR_READ_MARK | Sim_arrRxFifo[0]); break;
+	case SIM_REG_UCSRA: value = Sim_GetUcsra();                              break;
+	case SIM_REG_UCSRB: value = Sim_u8Ucsrb;                                 break;
+	case SIM_REG_UCSRC: value = Sim_u8Ucsrc;                                 break;
+	case SIM_REG_UBRRL: value = Sim_u8Ubrrl;                                 break;
+	default:                                                                 break;
+	}
+	Sim_arrSlots[reg] = value;
+	Sim_arrSlotLoaded[reg] = value;
+	Sim_PendingReg = reg;
+	Sim_AccessPending = STD_TRUE;
+
+	return &Sim_arrSlots[reg];
+}
+
+/**
+ * @brief Commits the last register access and executes the pending interrupts (called by sei and Critical_Exit).
+ */
+void Sim_Poll(void)
+{
+	Sim_Commit();
+	Sim_Dispatch();
+}
+
+/**
+ * @brief The CPU sleeps until the next event of the line (used by host/Utils_Sleep.h).
+ *        If the global interrupt is disabled the CPU spins : the time is counted as busy.
+ */
+void Sim_Idle(void)
+{
+	u64 next;
+
+	Sim_Commit();
+	if((STD_TRUE == Sim_InIsr) || (0 == (Sim_SREG & SIM_SREG_I)))
+	{
+		Sim_Spend(Sim_u8AccessCycles);
+		return;
+	}
+
+	next = Sim_NextEvent();
+	if(SIM_NO_EVENT == next)
+	{
+		/* nothing will happen on the line , let the caller check its timeout */
+		next = Sim_u64Now + Sim_u32FrameCycles;
+	}
+	Sim_Advance(next);
+	Sim_Dispatch();
+}
+
+/**
+ * @brief The application does other work for a number of cycles (not counted as UART cycles) ,
+ *        the interrupts are executed when they happen.
+ *
+ * @param cycles the cycles of the work.
+ */
+void Sim_Work(u64 cycles)
+{
+	u64 end = Sim_u64Now + cycles;
+	u64 next;
+
+	Sim_Poll();
+	while(Sim_u64Now < end)
+	{
+		next = Sim_NextEvent();
+		Sim_Advance((next < end) ? next : end);
+		Sim_Dispatch();
+	}
+}
+
+/**
+ * @brief Sends bytes to the RX pin , the first byte is complete one frame after the call.
+ *
+ * @param data the bytes (must stay valid until they are received).
+ * @param len the number of bytes.
+ * @param gapCycles the idle time of the line between two frames.
+ */
+void Sim_RxFeed(const u8 data[], u32 len, u32 gapCycles)
+{
+	Sim_pRxSource = data;
+	Sim_u32RxSourceLen = len;
+	Sim_u32RxSourceIdx = 0;
+	Sim_u32RxGap = gapCycles;
+	Sim_u64RxNext = Sim_u64Now + Sim_u32FrameCycles;
+}
+
+/**
+ * @brief Gets the bytes sent on the line since Sim_Init (the capture keeps the first SIM_TX_CAPTURE_SIZE bytes).
+ *
+ * @param pLen the number of captured bytes.
+ * @return const u8* the captured bytes.
+ */
+const u8* Sim_TxCapture(u32 *pLen)
+{
+	*pLen = (Sim_u32TxCaptured < SIM_TX_CAPTURE_SIZE) ? Sim_u32TxCaptured : SIM_TX_CAPTURE_SIZE;
+
+	return Sim_arrTxCapture;
+}
+
+/**
+ * @brief Checks if the transmitter is idle (UDR and the shift register are empty).
+ */
+Std_Bool_t Sim_TxIdle(void)
+{
+	Sim_Commit();
+
+	return ((STD_FALSE == Sim_TxShifting) && (STD_FALSE == Sim_TxDataFull)) ? STD_TRUE : STD_FALSE;
+}
+
+/**
+ * @brief Checks if all the bytes of Sim_RxFeed arrived.
+ */
+Std_Bool_t Sim_RxFeedDone(void)
+{
+	return (Sim_u32RxSourceIdx >= Sim_u32RxSourceLen) ? STD_TRUE : STD_FALSE;
+}
+
+/**
+ * @brief Gets the counters of the run.
+ */
+const Sim_Stats_t* Sim_GetStats(void)
+{
+	Sim_Stats.Cycles = Sim_u64Now - Sim_u64StatsStart;
+
+	return &Sim_Stats;
+}
+
+/**
+ * @brief Resets the counters (ex: after UART_Init).
+ *        The time and the capture of the sent bytes are not reset.
+ */
+void Sim_ResetStats(void)
+{
+	Sim_u64StatsStart = Sim_u64Now;
+	Sim_Stats.Cycles = 0;
+	Sim_Stats.BusyCycles = 0;
+	Sim_Stats.IsrCycles = 0;
+	Sim_Stats.RegAccesses = 0;
+	Sim_Stats.IsrCalls = 0;
+	Sim_Stats.RxBytes = 0;
+	Sim_Stats.RxOverruns = 0;
+	Sim_Stats.TxLost = 0;
+	Sim_Stats.TxBytes = 0;
+}
+
+/**
+ * @brief Gets the cycles of one frame on the line (start + data + parity + stop bits of UCSRC).
+ */
+u32 Sim_FrameCycles(void)
+{
+	return Sim_u32FrameCycles;
+}
+
+/**
+ * @brief Gets the bits of one frame on the line.
+ */
+u8 Sim_FrameBits(void)
+{
+	return Sim_u8FrameBits;
+}
+
+/**
+ * @brief Gets the simulated time in ms (the SysTick of the benchmark).
+ */
+u32 Sim_GetMillis(void)
+{
+	return (u32)((Sim_u64Now * 1000) / Sim_u32Fcpu);
+}
@@ -0,0 +1,155 @@
+/**
+ * @file Sim_USART.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host model of the ATmega32 USART used by the UART benchmark (UART_Bench.c).
+ *         The registers of MemMap.h are replaced by Sim_RegAccess (host/MemMap.h) so UART.c is built without changes :
+ *         every access costs SIM access cycles , every interrupt costs SIM ISR cycles and the time of the line
+ *         (UDR + shift register on TX , 2 bytes FIFO on RX) follows the baud rate and the frame of UCSRC.
+ *         The cycles are a model : the register accesses , the waiting and the ISR entries are counted ,
+ *         the arithmetic of the driver between two accesses is not.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef SIM_USART_H_
+#define SIM_USART_H_
+
+#include "Std_Types.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief the simulated registers (UCSRC and UBRRH share the same address , URSEL selects the register).
+ */
+typedef enum
+{
+	SIM_REG_UDR,
+	SIM_REG_UCSRA,
+	SIM_REG_UCSRB,
+	SIM_REG_UCSRC,
+	SIM_REG_UBRRL,
+	SIM_REG_COUNT
+}Sim_Reg_t;
+
+/**
+ * @brief the counters of a run (reset by Sim_ResetStats).
+ */
+typedef struct
+{
+	u64 Cycles;        /**< simulated time */
+	u64 BusyCycles;    /**< cycles spent by the UART code : register accesses + ISR entries (the sleep is not counted) */
+	u64 IsrCycles;     /**< part of BusyCycles spent in the USART ISRs */
+	u32 RegAccesses;
+	u32 IsrCalls;
+	u32 TxBytes;       /**< bytes sent on the line */
+	u32 RxBytes;       /**< bytes arrived on the line */
+	u32 RxOverruns;    /**< bytes lost because the RX FIFO was full (DOR) */
+	u32 TxLost;        /**< bytes written to UDR while UDRE was clear */
+}Sim_Stats_t;
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Resets the USART , the time and the counters.
+ *
+ * @param fcpu the CPU frequency in Hz.
+ * @param baud the baud rate of the line (the UBRR written by UART_Init is not used).
+ * @param accessCycles the cycles of one register access (a poll of a flag costs one access).
+ * @param isrCycles the cycles of the entry and exit of an ISR (vector , prologue , epilogue , reti).
+ */
+void Sim_Init(u32 fcpu, u32 baud, u8 accessCycles, u8 isrCycles);
+
+/**
+ * @brief Gets the slot of a register (used by host/MemMap.h for every access).
+ *        The previous access is committed , the time moves by one access and the pending interrupts are executed ,
+ *        then the slot is loaded with the current value of the register.
+ *
+ * @param reg the register.
+ * @return volatile u16* the slot read or written by the driver.
+ */
+volatile u16* Sim_RegAccess(Sim_Reg_t reg);
+
+/**
+ * @brief Commits the last register access and executes the pending interrupts (called by sei and Critical_Exit).
+ */
+void Sim_Poll(void);
+
+/**
+ * @brief The CPU sleeps until the next event of the line (used by host/Utils_Sleep.h).
+ *        If the global interrupt is disabled the CPU spins : the time is counted as busy.
+ */
+void Sim_Idle(void);
+
+/**
+ * @brief The application does other work for a number of cycles (not counted as UART cycles) ,
+ *        the interrupts are executed when they happen.
+ *
+ * @param cycles the cycles of the work.
+ */
+void Sim_Work(u64 cycles);
+
+/**
+ * @brief Sends bytes to the RX pin , the first byte is complete one frame after the call.
+ *
+ * @param data the bytes (must stay valid until they are received).
+ * @param len the number of bytes.
+ * @param gapCycles the idle time of the line between two frames.
+ */
+void Sim_RxFeed(const u8 data[], u32 len, u32 gapCycles);
+
+/**
+ * @brief Gets the bytes sent on the line since Sim_Init (the capture keeps the first SIM_TX_CAPTURE_SIZE bytes).
+ *
+ * @param pLen the number of captured bytes.
+ * @return const u8* the captured bytes.
+ */
+const u8* Sim_TxCapture(u32 *pLen);
+
+/**
+ * @brief Checks if the transmitter is idle (UDR and the shift register are empty).
+ */
+Std_Bool_t Sim_TxIdle(void);
+
+/**
+ * @brief Checks if all the bytes of Sim_RxFeed arrived.
+ */
+Std_Bool_t Sim_RxFeedDone(void);
+
+/**
+ * @brief Gets the counters of the run.
+ */
+const Sim_Stats_t* Sim_GetStats(void);
+
+/**
+ * @brief Resets the counters (ex: after UART_Init).
+ */
+void Sim_ResetStats(void);
+
+/**
+ * @brief Gets the cycles of one frame on the line (start + data + parity + stop bits of UCSRC).
+ */
+u32 Sim_FrameCycles(void);
+
+/**
+ * @brief Gets the bits of one frame on the line.
+ */
+u8 Sim_FrameBits(void);
+
+/**
+ * @brief Gets the simulated time in ms (the SysTick of the benchmark).
+ */
+u32 Sim_GetMillis(void);
+
+
+#endif /* SIM_USART_H_ */
@@ -0,0 +1,638 @@
+/**
+ * @file UART_Bench.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host benchmark of the send and receive modes of UART_Services.c (see ../README.md).
+ *         UART.c , UART_Services.c and UART_TxChain.c are built without changes against the USART model of Sim_USART.c ,
+ *         every mode sends or receives the same payload and prints one line of results :
+ *           - payload bytes per second and use of the line
+ *           - CPU cycles per byte and share of the CPU spent in the UART code (the sleep is not counted)
+ *           - share of the time spent in the USART ISRs
+ *         The output is JSON lines (--format csv for a table) , the exit code is 1 if a mode loses or changes data.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+
+/************************************************************************/
+/*                            Inclusion                                 */
+/************************************************************************/
+/*
+* LIB
+*/
+#include "Std_Types.h"
+#include "Utils_interrupt.h"
+
+/*
+* Include MCAL layer files
+*/
+#include "UART_interface.h"
+#include "UART_Lcfg.h"
+#include "SysTick_Interface.h"
+
+/*
+* Include Services layer files
+*/
+#include "UART_Services.h"
+#include "UART_TxChain.h"
+#include "COBS.h"
+
+/*
+* the simulated USART
+*/
+#include "Sim_USART.h"
+
+/************************************************************************/
+/*                            Configuration                             */
+/************************************************************************/
+#define BENCH_MAX_BYTES        2048
+#define BENCH_RECORD_SIZE      32       /**< record of the ping-pong reception */
+#define BENCH_FRAME_TIMEOUT_MS 20       /**< timeout of the frame parser after the time of the frame */
+#define BENCH_HEAD_SIZE        4        /**< bytes of UART_ReceiveAsynch before the busy wait of recv_after_asynch */
+#define BENCH_GUARD_BYTE       0xA5
+#define BENCH_WATCHDOG_S       10       /**< a mode that hangs (a byte taken by a wrong ISR) fails after this time */
+
+typedef struct
+{
+	u32 Fcpu;
+	u32 Baud;
+	u32 Bytes;
+	u32 LoopUs;          /**< period of the main loop of the periodic check modes */
+	u8  AccessCycles;
+	u8  IsrCycles;
+	const char *Mode;    /**< NULL : all the modes */
+	Std_Bool_t Csv;
+}Bench_Config_t;
+
+typedef struct
+{
+	u32 PayloadBytes;
+	u32 LineBytes;       /**< bytes on the line (payload + length + check + delimiter) */
+	Std_Bool_t Ok;       /**< the data arrived complete and unchanged */
+}Bench_Result_t;
+
+typedef struct
+{
+	const char *Name;
+	void (*pfRun)(Bench_Result_t *res);
+	void (*pfWire)(const u8 buffer[], u16 len);   /**< sender of the input frame of a receive mode (NULL : the raw payload) */
+}Bench_Mode_t;
+
+static Bench_Config_t Bench_Config = {8000000UL, 9600UL, 256, 1000, 4, 45, NULL_PTR, STD_FALSE};
+
+static u8 Bench_arrPayload[BENCH_MAX_BYTES];
+static u8 Bench_arrWire[BENCH_MAX_BYTES + 32];     /**< encoded frame for the receive modes */
+static u32 Bench_u32WireLen;
+static u8 Bench_arrRx[BENCH_MAX_BYTES + 32];
+static u8 Bench_arrPing[BENCH_RECORD_SIZE];
+static u8 Bench_arrPong[BENCH_RECORD_SIZE];
+static u8 Bench_arrHead[BENCH_HEAD_SIZE + 1];      /**< + 1 guard byte */
+static volatile Std_Bool_t Bench_FrameDone;
+static volatile u8 Bench_u8DoneCalls;
+static const char *Bench_pRunningMode;
+static volatile u16 Bench_u16FrameLen;
+
+/************************************************************************/
+/*                            SysTick of the host                       */
+/************************************************************************/
+/**
+ * @brief the ticks (ms) used by the timeouts of UART_Services.c come from the simulated time.
+ */
+u16 SysTick_GetTicks(void)
+{
+	return (u16)Sim_GetMillis();
+}
+
+/************************************************************************/
+/*                            Helpers                                   */
+/************************************************************************/
+/**
+ * @brief Resets the USART model , initializes the UART and enables the global interrupt.
+ *        The call backs of the previous mode stay installed , like in an application that changes of mode.
+ */
+static void Bench_Start(void)
+{
+	Sim_Init(Bench_Config.Fcpu, Bench_Config.Baud, Bench_Config.AccessCycles, Bench_Config.IsrCycles);
+	UART_Init();
+	sei();
+	Sim_ResetStats();
+}
+
+/**
+ * @brief The CPU sleeps until the transmitter is idle (the end of the last frame is part of the transfer time).
+ */
+static void Bench_DrainTx(void)
+{
+	while(STD_FALSE == Sim_TxIdle())
+	{
+		Sim_Idle();
+	}
+}
+
+/**
+ * @brief The application loop of the periodic check modes does other work between two calls.
+ */
+static void Bench_LoopWork(void)
+{
+	Sim_Work(((u64)Bench_Config.Fcpu * Bench_Config.LoopUs) / 1000000UL);
+}
+
+/**
+ * @brief Checks that the line carried exactly the payload.
+ */
+static Std_Bool_t Bench_CheckTxPayload(void)
+{
+	u32 len;
+	const u8 *line = Sim_TxCapture(&len);
+
+	return ((len == Bench_Config.Bytes) && (0 == memcmp(line, Bench_arrPayload, len))) ? STD_TRUE : STD_FALSE;
+}
+
+/**
+ * @brief Runs a sender once to capture the bytes of its frame (the input of the matching receive mode).
+ */
+static void Bench_CaptureWire(void (*pfSend)(const u8 buffer[], u16 len))
+{
+	u32 len;
+	const u8 *line;
+
+	Bench_Start();
+	pfSend(Bench_arrPayload, (u16)Bench_Config.Bytes);
+	Bench_DrainTx();
+	line = Sim_TxCapture(&len);
+	memcpy(Bench_arrWire, line, len);
+	Bench_u32WireLen = len;
+}
+
+/************************************************************************/
+/*                            Send modes                                */
+/************************************************************************/
+static void Bench_SendBusyWait(Bench_Result_t *res)
+{
+	UART_SendBufferLenBusyWait(Bench_arrPayload, (u16)Bench_Config.Bytes);
+	Bench_DrainTx();
+	res->LineBytes = Sim_GetStats()->TxBytes;
+	res->Ok = Bench_CheckTxPayload();
+}
+
+static void Bench_SendAsynch(Bench_Result_t *res)
+{
+	UART_SendBufferLenAsynch(Bench_arrPayload, (u16)Bench_Config.Bytes);
+	while(Sim_GetStats()->TxBytes < Bench_Config.Bytes)
+	{
+		Sim_Idle();
+	}
+	Bench_DrainTx();
+	res->LineBytes = Sim_GetStats()->TxBytes;
+	res->Ok = Bench_CheckTxPayload();
+}
+
+static void Bench_SendPeriodicCheck(Bench_Result_t *res)
+{
+	while(STD_DONE != UART_SendBufferLenPeriodicCheck(Bench_arrPayload, (u16)Bench_Config.Bytes))
+	{
+		Bench_LoopWork();
+	}
+	Bench_DrainTx();
+	res->LineBytes = Sim_GetStats()->TxBytes;
+	res->Ok = Bench_CheckTxPayload();
+}
+
+static void Bench_SendBurst(Bench_Result_t *res)
+{
+	UART_BurstTx_t tx;
+
+	UART_BurstTxInit(&tx, Bench_arrPayload, (u16)Bench_Config.Bytes);
+	while(STD_DONE != UART_SendBurstPeriodicCheck(&tx))
+	{
+		Bench_LoopWork();
+	}
+	Bench_DrainTx();
+	res->LineBytes = Sim_GetStats()->TxBytes;
+	res->Ok = Bench_CheckTxPayload();
+}
+
+static void Bench_SendTxChain(Bench_Result_t *res)
+{
+	UART_TxDesc_t *desc = UART_TxDescAlloc();
+	UART_TxFrag_t frag;
+
+	frag.Data = Bench_arrPayload;
+	frag.Len  = (u16)Bench_Config.Bytes;
+	res->Ok = STD_FALSE;
+	if((NULL_PTR != desc) && (STD_OK == UART_TxDescSubmit(desc, &frag, 1, NULL_PTR)))
+	{
+		while(STD_FALSE == UART_TxChainIsIdle())
+		{
+			Sim_Idle();
+		}
+		Bench_DrainTx();
+		res->Ok = Bench_CheckTxPayload();
+	}
+	UART_TxDescFree(desc);
+	res->LineBytes = Sim_GetStats()->TxBytes;
+}
+
+static void Bench_SendCheckSum(Bench_Result_t *res)
+{
+	u32 len;
+	const u8 *line;
+
+	UART_SendBufferCheckSumBusyWait(Bench_arrPayload, (u16)Bench_Config.Bytes);
+	Bench_DrainTx();
+	line = Sim_TxCapture(&len);
+	res->LineBytes = Sim_GetStats()->TxBytes;
+	/* length (LSB first) + data + check */
+	res->Ok = ((len > (Bench_Config.Bytes + 2)) && (line[0] == (u8)Bench_Config.Bytes) && (line[1] == (u8)(Bench_Config.Bytes >> 8)) &&
+	           (0 == memcmp(&line[2], Bench_arrPayload, Bench_Config.Bytes))) ? STD_TRUE : STD_FALSE;
+}
+
+static void Bench_SendCOBS(Bench_Result_t *res)
+{
+	u32 len;
+	u16 decodedLen = 0;
+	const u8 *line;
+
+	UART_SendFrameCOBSBusyWait(Bench_arrPayload, (u16)Bench_Config.Bytes);
+	Bench_DrainTx();
+	line = Sim_TxCapture(&len);
+	res->LineBytes = Sim_GetStats()->TxBytes;
+	/* the frame ends with the 0x00 delimiter */
+	res->Ok = ((len > 1) && (STD_OK == COBS_Decode(line, (u16)(len - 1), Bench_arrRx, sizeof(Bench_arrRx), &decodedLen)) &&
+	           (decodedLen == Bench_Config.Bytes) && (0 == memcmp(Bench_arrRx, Bench_arrPayload, decodedLen))) ? STD_TRUE : STD_FALSE;
+}
+
+/************************************************************************/
+/*                            Receive modes                             */
+/************************************************************************/
+/**
+ * @brief Checks the received payload and the lost bytes.
+ */
+static Std_Bool_t Bench_CheckRxPayload(u32 len)
+{
+	return ((len == Bench_Config.Bytes) && (0 == memcmp(Bench_arrRx, Bench_arrPayload, len)) && (0 == Sim_GetStats()->RxOverruns)) ? STD_TRUE : STD_FALSE;
+}
+
+static void Bench_ReceiveBusyWait(Bench_Result_t *res)
+{
+	Sim_RxFeed(Bench_arrPayload, Bench_Config.Bytes, 0);
+	UART_ReceiveBufferLenBusyWait(Bench_arrRx, (u16)Bench_Config.Bytes);
+	res->LineBytes = Sim_GetStats()->RxBytes;
+	res->Ok = Bench_CheckRxPayload(Bench_Config.Bytes);
+}
+
+static void Bench_ReceiveAsynch(Bench_Result_t *res)
+{
+	Sim_RxFeed(Bench_arrPayload, Bench_Config.Bytes, 0);
+	UART_ReceiveBufferLenAsynch(Bench_arrRx, (u16)Bench_Config.Bytes);
+	while((STD_DONE != UART_ReceiveBufferLenAsynchStatus()) && (STD_FALSE == Sim_RxFeedDone()))
+	{
+		Sim_Idle();
+	}
+	Sim_Poll();
+	res->LineBytes = Sim_GetStats()->RxBytes;
+	res->Ok = (STD_DONE == UART_ReceiveBufferLenAsynchStatus()) ? Bench_CheckRxPayload(Bench_Config.Bytes) : STD_FALSE;
+}
+
+static void Bench_HeadCallBack(u8 buffer[], u16 len, Std_Error_t status)
+{
+	(void)buffer;
+	(void)len;
+	(void)status;
+	Bench_u8DoneCalls++;
+}
+
+/**
+ * @brief UART_ReceiveAsynch of the first bytes , then UART_ReceiveByteBusyWait of the others.
+ *        The call back of the finished reception stays installed : the RXC interrupt that wakes the busy wait up
+ *        must not call it (it would take the byte of the busy wait , write after the buffer and call pfDone again).
+ */
+static void Bench_ReceiveAfterAsynch(Bench_Result_t *res)
+{
+	u32 i;
+
+	Bench_u8DoneCalls = 0;
+	Bench_arrHead[BENCH_HEAD_SIZE] = BENCH_GUARD_BYTE;
+	Sim_RxFeed(Bench_arrPayload, Bench_Config.Bytes, 0);
+	UART_ReceiveAsynch(Bench_arrHead, BENCH_HEAD_SIZE, UART_RX_NO_TERMINATOR, Bench_HeadCallBack);
+	while(STD_TRUE == UART_ReceiveAsynchIsBusy())
+	{
+		Sim_Idle();
+	}
+	memcpy(Bench_arrRx, Bench_arrHead, BENCH_HEAD_SIZE);
+	for(i=BENCH_HEAD_SIZE; i<Bench_Config.Bytes; i++)
+	{
+		Bench_arrRx[i] = UART_ReceiveByteBusyWait();
+	}
+	Sim_Poll();
+	res->LineBytes = Sim_GetStats()->RxBytes;
+	res->Ok = ((1 == Bench_u8DoneCalls) && (BENCH_GUARD_BYTE == Bench_arrHead[BENCH_HEAD_SIZE])) ?
+	          Bench_CheckRxPayload(Bench_Config.Bytes) : STD_FALSE;
+}
+
+static void Bench_ReceivePeriodicCheck(Bench_Result_t *res)
+{
+	u32 len = 0;
+	u8 data;
+
+	Sim_RxFeed(Bench_arrPayload, Bench_Config.Bytes, 0);
+	while(len < Bench_Config.Bytes)
+	{
+		while((len < Bench_Config.Bytes) && (STD_DONE == UART_ReceiveBytePeriodicCheck(&data)))
+		{
+			Bench_arrRx[len] = data;
+			len++;
+		}
+		if(STD_TRUE == Sim_RxFeedDone() && (len < Bench_Config.Bytes) && (0 != Sim_GetStats()->RxOverruns))
+		{
+			/* bytes are lost , the rest never comes */
+			break;
+		}
+		Bench_LoopWork();
+	}
+	res->PayloadBytes = len;
+	res->LineBytes = Sim_GetStats()->RxBytes;
+	res->Ok = Bench_CheckRxPayload(len);
+}
+
+static void Bench_ReceiveCheckSum(Bench_Result_t *res)
+{
+	u16 len = 0;
+	Std_Error_t status;
+
+	Sim_RxFeed(Bench_arrWire, Bench_u32WireLen, 0);
+	status = UART_ReceiveBufferCheckSumBusyWait(Bench_arrRx, sizeof(Bench_arrRx), &len);
+	res->LineBytes = Sim_GetStats()->RxBytes;
+	res->Ok = (STD_OK == status) ? Bench_CheckRxPayload(len) : STD_FALSE;
+}
+
+static void Bench_FrameCallBack(const u8 data[], u16 len)
+{
+	(void)data;
+	Bench_u16FrameLen = len;
+	Bench_FrameDone = STD_TRUE;
+}
+
+static void Bench_ReceiveFrameParser(Bench_Result_t *res)
+{
+	UART_FrameParser_t parser;
+	/* the timeout starts at the length of the frame , it must be longer than the frame */
+	u32 timeoutMs = (u32)(((u64)Bench_u32WireLen * Sim_FrameCycles() * 1000) / Bench_Config.Fcpu) + BENCH_FRAME_TIMEOUT_MS;
+
+	Bench_FrameDone = STD_FALSE;
+	UART_FrameParserInit(&parser, 2, Bench_arrRx, sizeof(Bench_arrRx), (u16)((timeoutMs < 30000) ? timeoutMs : 30000), Bench_FrameCallBack);
+	Sim_RxFeed(Bench_arrWire, Bench_u32WireLen, 0);
+	UART_ReceiveFrameAsynch(&parser);
+	while((STD_FALSE == Bench_FrameDone) && (STD_FALSE == Sim_RxFeedDone()))
+	{
+		Sim_Idle();
+	}
+	Sim_Poll();
+	UART_ReceiveFrameAsynchStop();
+	res->LineBytes = Sim_GetStats()->RxBytes;
+	res->Ok = (STD_TRUE == Bench_FrameDone) ? Bench_CheckRxPayload(Bench_u16FrameLen) : STD_FALSE;
+}
+
+static void Bench_COBSCallBack(u8 buffer[], u16 len, Std_Error_t status)
+{
+	(void)buffer;
+	if(STD_OK == status)
+	{
+		Bench_u16FrameLen = len;
+		Bench_FrameDone = STD_TRUE;
+	}
+}
+
+static void Bench_ReceiveCOBSAsynch(Bench_Result_t *res)
+{
+	COBS_Decoder_t decoder;
+
+	Bench_FrameDone = STD_FALSE;
+	COBS_DecoderInit(&decoder, Bench_arrRx, sizeof(Bench_arrRx));
+	Sim_RxFeed(Bench_arrWire, Bench_u32WireLen, 0);
+	UART_ReceiveFrameCOBSAsynch(&decoder, Bench_COBSCallBack);
+	while((STD_FALSE == Bench_FrameDone) && (STD_FALSE == Sim_RxFeedDone()))
+	{
+		Sim_Idle();
+	}
+	Sim_Poll();
+	UART_ReceiveFrameCOBSAsynchStop();
+	res->LineBytes = Sim_GetStats()->RxBytes;
+	res->Ok = (STD_TRUE == Bench_FrameDone) ? Bench_CheckRxPayload(Bench_u16FrameLen) : STD_FALSE;
+}
+
+static void Bench_ReceivePingPong(Bench_Result_t *res)
+{
+	UART_PingPong_t pp;
+	u32 len = 0;
+	u8 *record;
+
+	Sim_RxFeed(Bench_arrPayload, Bench_Config.Bytes, 0);
+	UART_ReceivePingPongStart(&pp, Bench_arrPing, Bench_arrPong, BENCH_RECORD_SIZE, NULL_PTR);
+	while(len < Bench_Config.Bytes)
+	{
+		record = UART_PingPongGetRecord(&pp);
+		if(NULL_PTR != record)
+		{
+			memcpy(&Bench_arrRx[len], record, BENCH_RECORD_SIZE);
+			len += BENCH_RECORD_SIZE;
+			UART_PingPongRelease(&pp);
+		}
+		else if(STD_TRUE == Sim_RxFeedDone())
+		{
+			Sim_Poll();
+			if(STD_FALSE == pp.Ready)
+			{
+				break;
+			}
+		}
+		else
+		{
+			Sim_Idle();
+		}
+	}
+	UART_ReceivePingPongStop();
+	res->LineBytes = Sim_GetStats()->RxBytes;
+	res->Ok = ((0 == UART_PingPongGetDropped(&pp)) ? Bench_CheckRxPayload(len) : STD_FALSE);
+}
+
+/************************************************************************/
+/*                            Modes table                               */
+/************************************************************************/
+static void Bench_SendCheckSumWire(const u8 buffer[], u16 len)  { UART_SendBufferCheckSumBusyWait(buffer, len); }
+static void Bench_SendCOBSWire(const u8 buffer[], u16 len)      { UART_SendFrameCOBSBusyWait(buffer, len); }
+
+static const Bench_Mode_t Bench_arrModes[] =
+{
+	{"send_busywait",        Bench_SendBusyWait,        NULL_PTR},
+	{"send_asynch",          Bench_SendAsynch,          NULL_PTR},
+	{"send_periodic_check",  Bench_SendPeriodicCheck,   NULL_PTR},
+	{"send_burst",           Bench_SendBurst,           NULL_PTR},
+	{"send_txchain",         Bench_SendTxChain,         NULL_PTR},
+	{"send_checksum",        Bench_SendCheckSum,        NULL_PTR},
+	{"send_cobs",            Bench_SendCOBS,            NULL_PTR},
+	{"recv_busywait",        Bench_ReceiveBusyWait,     NULL_PTR},
+	{"recv_asynch",          Bench_ReceiveAsynch,       NULL_PTR},
+	{"recv_after_asynch",    Bench_ReceiveAfterAsynch,  NULL_PTR},
+	{"recv_periodic_check",  Bench_ReceivePeriodicCheck,NULL_PTR},
+	{"recv_checksum",        Bench_ReceiveCheckSum,     Bench_SendCheckSumWire},
+	{"recv_frame_parser",    Bench_ReceiveFrameParser,  Bench_SendCheckSumWire},
+	{"recv_cobs_asynch",     Bench_ReceiveCOBSAsynch,   Bench_SendCOBSWire},
+	{"recv_pingpong",        Bench_ReceivePingPong,     NULL_PTR},
+};
+
+#define BENCH_MODES_COUNT      (sizeof(Bench_arrModes)/sizeof(Bench_arrModes[0]))
+
+/************************************************************************/
+/*                            Report                                    */
+/************************************************************************/
+static void Bench_PrintHeader(void)
+{
+	if(STD_TRUE == Bench_Config.Csv)
+	{
+		printf("mode,wait_mode,fcpu,baud,frame_bits,payload_bytes,line_bytes,seconds,payload_bytes_per_s,line_utilization,"
+		       "cpu_cycles_per_byte,cpu_share,isr_share,isr_calls_per_byte,reg_accesses_per_byte,rx_overruns,tx_lost,ok\n");
+	}
+}
+
+static void Bench_Print(const char *name, const Bench_Result_t *res, const Sim_Stats_t *stats)
+{
+	double seconds = (double)stats->Cycles / Bench_Config.Fcpu;
+	double bytes = (res->PayloadBytes != 0) ? (double)res->PayloadBytes : 1.0;
+	double cycles = (stats->Cycles != 0) ? (double)stats->Cycles : 1.0;
+	const char *waitMode = (UART_WAIT_MODE == UART_WAIT_SLEEP_IDLE) ? "sleep_idle" : "spin";
+	const char *fmt = (STD_TRUE == Bench_Config.Csv) ?
+		"%s,%s,%lu,%lu,%u,%lu,%lu,%.6f,%.1f,%.3f,%.1f,%.4f,%.4f,%.3f,%.2f,%lu,%lu,%s\n" :
+		"{\"mode\":\"%s\",\"wait_mode\":\"%s\",\"fcpu\":%lu,\"baud\":%lu,\"frame_bits\":%u,\"payload_bytes\":%lu,\"line_bytes\":%lu,"
+		"\"seconds\":%.6f,\"payload_bytes_per_s\":%.1f,\"line_utilization\":%.3f,\"cpu_cycles_per_byte\":%.1f,\"cpu_share\":%.4f,"
+		"\"isr_share\":%.4f,\"isr_calls_per_byte\":%.3f,\"reg_accesses_per_byte\":%.2f,\"rx_overruns\":%lu,\"tx_lost\":%lu,\"ok\":%s}\n";
+
+	printf(fmt, name, waitMode, (unsigned long)Bench_Config.Fcpu, (unsigned long)Bench_Config.Baud, (unsigned)Sim_FrameBits(),
+	       (unsigned long)res->PayloadBytes, (unsigned long)res->LineBytes,
+	       seconds, res->PayloadBytes / seconds, ((double)res->LineBytes * Sim_FrameCycles()) / cycles,
+	       stats->BusyCycles / bytes, stats->BusyCycles / cycles, stats->IsrCycles / cycles,
+	       stats->IsrCalls / bytes, stats->RegAccesses / bytes,
+	       (unsigned long)stats->RxOverruns, (unsigned long)stats->TxLost, (STD_TRUE == res->Ok) ? "true" : "false");
+}
+
+/************************************************************************/
+/*                            main                                      */
+/************************************************************************/
+static void Bench_Usage(const char *prog)
+{
+	u32 i;
+
+	fprintf(stderr, "usage: %s [--fcpu HZ] [--baud BAUD] [--bytes N] [--loop-us US] [--access-cycles N] [--isr-cycles N] "
+	                "[--mode NAME] [--format json|csv]\nmodes:", prog);
+	for(i=0; i<BENCH_MODES_COUNT; i++)
+	{
+		fprintf(stderr, " %s", Bench_arrModes[i].Name);
+	}
+	fprintf(stderr, "\n");
+}
+
+static void Bench_Watchdog(int sig)
+{
+	static const char msg[] = "mode hangs (watchdog) : ";
+
+	(void)sig;
+	(void)!write(2, msg, sizeof(msg) - 1);
+	(void)!write(2, Bench_pRunningMode, strlen(Bench_pRunningMode));
+	(void)!write(2, "\n", 1);
+	_exit(1);
+}
+
+static Std_Bool_t Bench_ParseArgs(int argc, char *argv[])
+{
+	int i;
+
+	for(i=1; i<argc; i++)
+	{
+		const char *opt = argv[i];
+		const char *val = (i + 1 < argc) ? argv[i + 1] : NULL_PTR;
+
+		if(NULL_PTR == val)
+		{
+			return STD_FALSE;
+		}
+		if     (0 == strcmp(opt, "--fcpu"))          { Bench_Config.Fcpu = strtoul(val, NULL_PTR, 0); }
+		else if(0 == strcmp(opt, "--baud"))          { Bench_Config.Baud = strtoul(val, NULL_PTR, 0); }
+		else if(0 == strcmp(opt, "--bytes"))         { Bench_Config.Bytes = strtoul(val, NULL_PTR, 0); }
+		else if(0 == strcmp(opt, "--loop-us"))       { Bench_Config.LoopUs = strtoul(val, NULL_PTR, 0); }
+		else if(0 == strcmp(opt, "--access-cycles")) { Bench_Config.AccessCycles = (u8)strtoul(val, NULL_PTR, 0); }
+		else if(0 == strcmp(opt, "--isr-cycles"))    { Bench_Config.IsrCycles = (u8)strtoul(val, NULL_PTR, 0); }
+		else if(0 == strcmp(opt, "--mode"))          { Bench_Config.Mode = val; }
+		else if(0 == strcmp(opt, "--format"))        { Bench_Config.Csv = (0 == strcmp(val, "csv")) ? STD_TRUE : STD_FALSE; }
+		else                                         { return STD_FALSE; }
+		i++;
+	}
+
+	/* the ping-pong mode receives whole records */
+	Bench_Config.Bytes -= Bench_Config.Bytes % BENCH_RECORD_SIZE;
+	return ((0 != Bench_Config.Fcpu) && (0 != Bench_Config.Baud) && (0 != Bench_Config.Bytes) &&
+	        (Bench_Config.Bytes <= BENCH_MAX_BYTES) && (0 != Bench_Config.AccessCycles)) ? STD_TRUE : STD_FALSE;
+}
+
+int main(int argc, char *argv[])
+{
+	Bench_Result_t res;
+	u32 i;
+	u32 runs = 0;
+	Std_Bool_t allOk = STD_TRUE;
+
+	if(STD_FALSE == Bench_ParseArgs(argc, argv))
+	{
+		Bench_Usage(argv[0]);
+		return 2;
+	}
+
+	/* every byte value , the zeros make the COBS frame realistic */
+	for(i=0; i<Bench_Config.Bytes; i++)
+	{
+		Bench_arrPayload[i] = (u8)((i * 37u) + (i >> 8));
+	}
+
+	signal(SIGALRM, Bench_Watchdog);
+	Bench_PrintHeader();
+	for(i=0; i<BENCH_MODES_COUNT; i++)
+	{
+		const Bench_Mode_t *mode = &Bench_arrModes[i];
+
+		if((NULL_PTR != Bench_Config.Mode) && (0 != strcmp(Bench_Config.Mode, mode->Name)))
+		{
+			continue;
+		}
+		Bench_pRunningMode = mode->Name;
+		alarm(BENCH_WATCHDOG_S);
+		if(NULL_PTR != mode->pfWire)
+		{
+			Bench_CaptureWire(mode->pfWire);
+		}
+		Bench_Start();
+		res.PayloadBytes = Bench_Config.Bytes;
+		res.LineBytes = 0;
+		res.Ok = STD_FALSE;
+		mode->pfRun(&res);
+		alarm(0);
+		Bench_Print(mode->Name, &res, Sim_GetStats());
+		fflush(stdout);
+		if(STD_FALSE == res.Ok)
+		{
+			allOk = STD_FALSE;
+		}
+		runs++;
+	}
+
+	if(0 == runs)
+	{
+		Bench_Usage(argv[0]);
+		return 2;
+	}
+	return (STD_TRUE == allOk) ? 0 : 1;
+}
@@ -0,0 +1,454 @@
+/**
+ * @file UART_Checks.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host checks of UART.c and UART_Services.c on the USART model of Sim_USART.c (see ../README.md).
+ *         Every case starts a new USART , feeds or captures the line and checks the return codes , the data
+ *         and the time spent. A failed check is printed , the exit code is 1 if a check fails.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/************************************************************************/
+/*                            Inclusion                                 */
+/************************************************************************/
+/*
+* LIB
+*/
+#include "Std_Types.h"
+#include "Utils_interrupt.h"
+
+/*
+* Include MCAL layer files
+*/
+#include "UART_interface.h"
+#include "UART_Lcfg.h"
+#include "SysTick_Interface.h"
+
+/*
+* Include Services layer files
+*/
+#include "UART_Services.h"
+#include "COBS.h"
+
+/*
+* the simulated USART
+*/
+#include "Sim_USART.h"
+
+/************************************************************************/
+/*                            Configuration                             */
+/************************************************************************/
+#define CHECK_FCPU             8000000UL
+#define CHECK_BAUD             9600UL
+#define CHECK_ACCESS_CYCLES    4
+#define CHECK_ISR_CYCLES       45
+#define CHECK_TIMEOUT_MS       50       /**< timeout of the cases that must time out */
+#define CHECK_OK_MS            500      /**< timeout of the cases that must complete (64 frames take 80 ms) */
+#define CHECK_LATE_MS          2        /**< a timeout may return up to one tick + one frame after the deadline */
+#define CHECK_GUARD_BYTE       0xA5
+#define CHECK_RECORD_SIZE      8        /**< record of the ping-pong reception , Check_arrData holds 8 records */
+
+static u8 Check_arrData[64];
+static u8 Check_arrWire[128];
+static u32 Check_u32WireLen;
+static u8 Check_arrRx[128];
+static volatile u8 Check_u8DoneCalls;
+static u8 Check_arrPing[CHECK_RECORD_SIZE];
+static u8 Check_arrPong[CHECK_RECORD_SIZE];
+static UART_PingPong_t Check_PingPong;
+static volatile u8 Check_u8RecordCalls;
+static u32 Check_u32Failed = 0;
+static u32 Check_u32Passed = 0;
+
+/************************************************************************/
+/*                            SysTick of the host                       */
+/************************************************************************/
+/**
+ * @brief the ticks (ms) used by the timeouts come from the simulated time.
+ */
+u16 SysTick_GetTicks(void)
+{
+	return (u16)Sim_GetMillis();
+}
+
+/************************************************************************/
+/*                            Helpers                                   */
+/************************************************************************/
+static void Check(Std_Bool_t ok, const char *name, const char *what)
+{
+	if(STD_TRUE == ok)
+	{
+		Check_u32Passed++;
+	}
+	else
+	{
+		Check_u32Failed++;
+		fprintf(stderr, "FAILED %s : %s\n", name, what);
+	}
+}
+
+#define CHECK(name, cond)      Check((cond) ? STD_TRUE : STD_FALSE, (name), #cond)
+
+/**
+ * @brief Resets the USART model , initializes the UART and enables the global interrupt.
+ *        The call backs of the previous case stay installed.
+ */
+static void Check_Start(void)
+{
+	Sim_Init(CHECK_FCPU, CHECK_BAUD, CHECK_ACCESS_CYCLES, CHECK_ISR_CYCLES);
+	UART_Init();
+	sei();
+}
+
+/**
+ * @brief Sends bytes to the RX pin and waits until the RX ISR took the last one.
+ */
+static void Check_RxFeedWait(const u8 data[], u32 len)
+{
+	Sim_RxFeed(data, len, 0);
+	while(STD_FALSE == Sim_RxFeedDone())
+	{
+		Sim_Idle();
+	}
+	Sim_Poll();
+}
+
+/**
+ * @brief Sends a frame with a busy wait sender and keeps the bytes of the line (the input of a receive case).
+ */
+static void Check_CaptureWire(void (*pfSend)(const u8 buffer[], u16 len), u16 len)
+{
+	const u8 *line;
+
+	Check_Start();
+	pfSend(Check_arrData, len);
+	while(STD_FALSE == Sim_TxIdle())
+	{
+		Sim_Idle();
+	}
+	line = Sim_TxCapture(&Check_u32WireLen);
+	memcpy(Check_arrWire, line, Check_u32WireLen);
+	Check_Start();
+}
+
+static void Check_SendCheckSumWire(const u8 buffer[], u16 len)  { UART_SendBufferCheckSumBusyWait(buffer, len); }
+static void Check_SendCOBSWire(const u8 buffer[], u16 len)      { UART_SendFrameCOBSBusyWait(buffer, len); }
+
+static void Check_SendStringCheckSumWire(const u8 buffer[], u16 len)
+{
+	u8 str[64];
+
+	memcpy(str, buffer, len);
+	str[len] = NULL_CHAR;
+	UART_SendStringCheckSumBusyWait(str);
+}
+
+/**
+ * @brief Checks that a timeout returned at the deadline (not before , not much later).
+ */
+static Std_Bool_t Check_AtDeadline(u16 deadline)
+{
+	s16 late = (s16)(SysTick_GetTicks() - deadline);
+
+	return ((late >= 0) && (late <= CHECK_LATE_MS)) ? STD_TRUE : STD_FALSE;
+}
+
+/************************************************************************/
+/*                            Timeout cases                             */
+/************************************************************************/
+static void Check_SendTimeout(void)
+{
+	const u8 *line;
+	u32 len;
+	u16 deadline;
+
+	Check_Start();
+	CHECK("send_ok", STD_OK == UART_SendBufferLenTimeout(Check_arrData, 16, SysTick_GetTicks() + CHECK_OK_MS));
+	while(STD_FALSE == Sim_TxIdle())
+	{
+		Sim_Idle();
+	}
+	line = Sim_TxCapture(&len);
+	CHECK("send_ok", (16 == len) && (0 == memcmp(line, Check_arrData, 16)));
+
+	// 64 frames of 12 bits at 9600 baud take 80 ms
+	Check_Start();
+	deadline = SysTick_GetTicks() + CHECK_TIMEOUT_MS / 5;
+	CHECK("send_timeout", STD_TIMEOUT == UART_SendBufferLenTimeout(Check_arrData, sizeof(Check_arrData), deadline));
+	CHECK("send_timeout", STD_TRUE == Check_AtDeadline(deadline));
+	while(STD_FALSE == Sim_TxIdle())
+	{
+		Sim_Idle();
+	}
+	line = Sim_TxCapture(&len);
+	CHECK("send_timeout", (len < sizeof(Check_arrData)) && (0 == memcmp(line, Check_arrData, len)));
+	CHECK("send_timeout", 0 == Sim_GetStats()->TxLost);
+
+	Check_Start();
+	CHECK("send_string_ok", STD_OK == UART_SendStringTimeout((const u8*)"abc", SysTick_GetTicks() + CHECK_OK_MS));
+	while(STD_FALSE == Sim_TxIdle())
+	{
+		Sim_Idle();
+	}
+	line = Sim_TxCapture(&len);
+	CHECK("send_string_ok", (4 == len) && (0 == memcmp(line, "abc", 4)));
+}
+
+static void Check_DoneCallBack(u8 buffer[], u16 len, Std_Error_t status)
+{
+	(void)buffer;
+	(void)len;
+	(void)status;
+	Check_u8DoneCalls++;
+}
+
+static void Check_ReceiveTimeout(void)
+{
+	u16 len = 0xFFFF;
+	u16 deadline;
+	u8 data = 0;
+
+	Check_Start();
+	Sim_RxFeed(Check_arrData, 16, 0);
+	CHECK("recv_ok", STD_OK == UART_ReceiveBufferLenTimeout(Check_arrRx, 16, &len, SysTick_GetTicks() + CHECK_OK_MS));
+	CHECK("recv_ok", (16 == len) && (0 == memcmp(Check_arrRx, Check_arrData, 16)));
+
+	Check_Start();
+	Sim_RxFeed(Check_arrData, 8, 0);
+	deadline = SysTick_GetTicks() + CHECK_TIMEOUT_MS;
+	CHECK("recv_timeout", STD_TIMEOUT == UART_ReceiveBufferLenTimeout(Check_arrRx, 16, &len, deadline));
+	CHECK("recv_timeout", (8 == len) && (0 == memcmp(Check_arrRx, Check_arrData, 8)));
+	CHECK("recv_timeout", STD_TRUE == Check_AtDeadline(deadline));
+
+	// no byte at all , then a byte : the wake up interrupt of the timeout must be disabled again
+	Check_Start();
+	deadline = SysTick_GetTicks() + CHECK_TIMEOUT_MS;
+	CHECK("recv_byte_timeout", STD_TIMEOUT == UART_ReceiveByteTimeout(&data, deadline));
+	CHECK("recv_byte_timeout", STD_TRUE == Check_AtDeadline(deadline));
+	Sim_RxFeed(&Check_arrData[3], 1, 0);
+	CHECK("recv_byte_after_timeout", STD_OK == UART_ReceiveByteTimeout(&data, SysTick_GetTicks() + CHECK_OK_MS));
+	CHECK("recv_byte_after_timeout", Check_arrData[3] == data);
+
+	// the call back of a finished UART_ReceiveAsynch stays installed : the wake up of the timeout must not call it
+	Check_Start();
+	Check_u8DoneCalls = 0;
+	Check_arrRx[4] = CHECK_GUARD_BYTE;
+	Sim_RxFeed(Check_arrData, 16, 0);
+	UART_ReceiveAsynch(Check_arrRx, 4, UART_RX_NO_TERMINATOR, Check_DoneCallBack);
+	while(STD_TRUE == UART_ReceiveAsynchIsBusy())
+	{
+		Sim_Idle();
+	}
+	CHECK("recv_after_asynch", STD_OK == UART_ReceiveBufferLenTimeout(&Check_arrRx[5], 12, &len, SysTick_GetTicks() + CHECK_OK_MS));
+	CHECK("recv_after_asynch", (1 == Check_u8DoneCalls) && (CHECK_GUARD_BYTE == Check_arrRx[4]));
+	CHECK("recv_after_asynch", (0 == memcmp(Check_arrRx, Check_arrData, 4)) && (0 == memcmp(&Check_arrRx[5], &Check_arrData[4], 12)));
+}
+
+static void Check_ReceiveStringTimeout(void)
+{
+	static const u8 str[] = {'h', 'e', 'l', 'l', 'o', STRING_TERMINATOR, 'x'};
+	u16 len = 0xFFFF;
+	u16 deadline;
+
+	Check_Start();
+	Sim_RxFeed(str, sizeof(str), 0);
+	CHECK("recv_string_ok", STD_OK == UART_ReceiveStringTimeout(Check_arrRx, 16, &len, SysTick_GetTicks() + CHECK_OK_MS));
+	CHECK("recv_string_ok", (5 == len) && (0 == strcmp((const char*)Check_arrRx, "hello")));
+
+	// 4 characters and the NULL character , the terminator is not read
+	Check_Start();
+	Check_arrRx[5] = CHECK_GUARD_BYTE;
+	Sim_RxFeed(str, sizeof(str), 0);
+	CHECK("recv_string_full", STD_BUFFER_FULL == UART_ReceiveStringTimeout(Check_arrRx, 5, &len, SysTick_GetTicks() + CHECK_OK_MS));
+	CHECK("recv_string_full", (4 == len) && (0 == strcmp((const char*)Check_arrRx, "hell")) && (CHECK_GUARD_BYTE == Check_arrRx[5]));
+
+	Check_Start();
+	Sim_RxFeed(str, 3, 0);
+	deadline = SysTick_GetTicks() + CHECK_TIMEOUT_MS;
+	CHECK("recv_string_timeout", STD_TIMEOUT == UART_ReceiveStringTimeout(Check_arrRx, 16, &len, deadline));
+	CHECK("recv_string_timeout", (3 == len) && (0 == strcmp((const char*)Check_arrRx, "hel")));
+	CHECK("recv_string_timeout", STD_TRUE == Check_AtDeadline(deadline));
+
+	CHECK("recv_string_capacity_0", STD_INVALID_ARG == UART_ReceiveStringTimeout(Check_arrRx, 0, &len, SysTick_GetTicks() + CHECK_OK_MS));
+}
+
+static void Check_ReceiveCheckSumTimeout(void)
+{
+	u16 len = 0;
+	u16 deadline;
+
+	Check_CaptureWire(Check_SendCheckSumWire, 32);
+	Sim_RxFeed(Check_arrWire, Check_u32WireLen, 0);
+	CHECK("recv_checksum_ok", STD_OK == UART_ReceiveBufferCheckSumTimeout(Check_arrRx, sizeof(Check_arrRx), &len, SysTick_GetTicks() + CHECK_OK_MS));
+	CHECK("recv_checksum_ok", (32 == len) && (0 == memcmp(Check_arrRx, Check_arrData, 32)));
+
+	// a data byte changed on the line
+	Check_arrWire[5] ^= 0x10;
+	Sim_RxFeed(Check_arrWire, Check_u32WireLen, 0);
+	CHECK("recv_checksum_bad", STD_NOK == UART_ReceiveBufferCheckSumTimeout(Check_arrRx, sizeof(Check_arrRx), &len, SysTick_GetTicks() + CHECK_OK_MS));
+	Check_arrWire[5] ^= 0x10;
+
+	// the extra bytes are dropped , the frame is still read to its end
+	Check_Start();
+	Check_arrRx[16] = CHECK_GUARD_BYTE;
+	Sim_RxFeed(Check_arrWire, Check_u32WireLen, 0);
+	CHECK("recv_checksum_overflow", STD_BUFFER_OVERFLOW == UART_ReceiveBufferCheckSumTimeout(Check_arrRx, 16, &len, SysTick_GetTicks() + CHECK_OK_MS));
+	CHECK("recv_checksum_overflow", (32 == len) && (0 == memcmp(Check_arrRx, Check_arrData, 16)) && (CHECK_GUARD_BYTE == Check_arrRx[16]));
+	CHECK("recv_checksum_overflow", STD_TRUE == Sim_RxFeedDone());
+
+	// the last byte of the check is missing
+	Check_Start();
+	len = 0xFFFF;
+	Sim_RxFeed(Check_arrWire, Check_u32WireLen - 1, 0);
+	deadline = SysTick_GetTicks() + CHECK_TIMEOUT_MS;
+	CHECK("recv_checksum_timeout", STD_TIMEOUT == UART_ReceiveBufferCheckSumTimeout(Check_arrRx, sizeof(Check_arrRx), &len, deadline));
+	CHECK("recv_checksum_timeout", (0xFFFF == len) && (STD_TRUE == Check_AtDeadline(deadline)));
+
+	Check_CaptureWire(Check_SendStringCheckSumWire, 20);
+	Sim_RxFeed(Check_arrWire, Check_u32WireLen, 0);
+	CHECK("recv_string_checksum_ok", STD_OK == UART_ReceiveStringCheckSumTimeout(Check_arrRx, SysTick_GetTicks() + CHECK_OK_MS));
+	CHECK("recv_string_checksum_ok", 0 == memcmp(Check_arrRx, Check_arrData, 20));
+
+	Check_arrWire[Check_u32WireLen - 1] ^= 0x01;
+	Sim_RxFeed(Check_arrWire, Check_u32WireLen, 0);
+	CHECK("recv_string_checksum_bad", STD_NOK == UART_ReceiveStringCheckSumTimeout(Check_arrRx, SysTick_GetTicks() + CHECK_OK_MS));
+
+	Check_Start();
+	Sim_RxFeed(Check_arrWire, 10, 0);
+	deadline = SysTick_GetTicks() + CHECK_TIMEOUT_MS;
+	CHECK("recv_string_checksum_timeout", STD_TIMEOUT == UART_ReceiveStringCheckSumTimeout(Check_arrRx, deadline));
+	CHECK("recv_string_checksum_timeout", STD_TRUE == Check_AtDeadline(deadline));
+}
+
+static void Check_ReceiveCOBSTimeout(void)
+{
+	u16 len = 0;
+	u16 deadline;
+
+	Check_CaptureWire(Check_SendCOBSWire, 40);
+	Sim_RxFeed(Check_arrWire, Check_u32WireLen, 0);
+	CHECK("recv_cobs_ok", STD_OK == UART_ReceiveFrameCOBSTimeout(Check_arrRx, sizeof(Check_arrRx), &len, SysTick_GetTicks() + CHECK_OK_MS));
+	CHECK("recv_cobs_ok", (40 == len) && (0 == memcmp(Check_arrRx, Check_arrData, 40)));
+
+	Check_arrRx[16] = CHECK_GUARD_BYTE;
+	Sim_RxFeed(Check_arrWire, Check_u32WireLen, 0);
+	CHECK("recv_cobs_too_long", STD_NOT_VALID == UART_ReceiveFrameCOBSTimeout(Check_arrRx, 16, &len, SysTick_GetTicks() + CHECK_OK_MS));
+	CHECK("recv_cobs_too_long", CHECK_GUARD_BYTE == Check_arrRx[16]);
+
+	Check_Start();
+	Sim_RxFeed(Check_arrWire, Check_u32WireLen - 1, 0);
+	deadline = SysTick_GetTicks() + CHECK_TIMEOUT_MS;
+	CHECK("recv_cobs_timeout", STD_TIMEOUT == UART_ReceiveFrameCOBSTimeout(Check_arrRx, sizeof(Check_arrRx), &len, deadline));
+	CHECK("recv_cobs_timeout", STD_TRUE == Check_AtDeadline(deadline));
+}
+
+/**
+ * @brief Ready call back of the ping-pong reception : keeps the record and releases the buffer at once.
+ */
+static void Check_RecordCallBack(u8 record[], u16 len)
+{
+	if((CHECK_RECORD_SIZE == len) && (((Check_u8RecordCalls + 1u) * CHECK_RECORD_SIZE) <= sizeof(Check_arrRx)))
+	{
+		memcpy(&Check_arrRx[Check_u8RecordCalls * CHECK_RECORD_SIZE], record, len);
+	}
+	Check_u8RecordCalls++;
+	UART_PingPongRelease(&Check_PingPong);
+}
+
+/**
+ * @brief The ping-pong reception fed by the RX ISR : polled records , records dropped while the application
+ *        holds the other buffer (swap overrun) , the saturation of the drop counter , the ready call back and the stop.
+ */
+static void Check_PingPongReceive(void)
+{
+	u8 *record;
+
+	CHECK("pingpong_null", STD_NULL_POINTER == UART_ReceivePingPongStart(NULL_PTR, Check_arrPing, Check_arrPong, CHECK_RECORD_SIZE, NULL_PTR));
+	CHECK("pingpong_null", STD_NULL_POINTER == UART_ReceivePingPongStart(&Check_PingPong, Check_arrPing, NULL_PTR, CHECK_RECORD_SIZE, NULL_PTR));
+	CHECK("pingpong_size_0", STD_INVALID_ARG == UART_ReceivePingPongStart(&Check_PingPong, Check_arrPing, Check_arrPong, 0, NULL_PTR));
+
+	// polled : no record before its last byte , then the first buffer holds it
+	Check_Start();
+	CHECK("pingpong_start", STD_OK == UART_ReceivePingPongStart(&Check_PingPong, Check_arrPing, Check_arrPong, CHECK_RECORD_SIZE, NULL_PTR));
+	Check_RxFeedWait(Check_arrData, CHECK_RECORD_SIZE - 1);
+	CHECK("pingpong_partial", NULL_PTR == UART_PingPongGetRecord(&Check_PingPong));
+	Check_RxFeedWait(&Check_arrData[CHECK_RECORD_SIZE - 1], 1);
+	record = UART_PingPongGetRecord(&Check_PingPong);
+	CHECK("pingpong_record", (Check_arrPing == record) && (0 == memcmp(Check_arrPing, Check_arrData, CHECK_RECORD_SIZE)));
+	CHECK("pingpong_record", 0 == UART_PingPongGetDropped(&Check_PingPong));
+
+	// swap overrun : 2 records complete while the application holds the first one , they are dropped and the ISR never writes the held buffer
+	Check_RxFeedWait(&Check_arrData[CHECK_RECORD_SIZE], 2 * CHECK_RECORD_SIZE);
+	CHECK("pingpong_overrun_dropped", 2 == UART_PingPongGetDropped(&Check_PingPong));
+	CHECK("pingpong_overrun_held", (Check_arrPing == UART_PingPongGetRecord(&Check_PingPong)) && (0 == memcmp(Check_arrPing, Check_arrData, CHECK_RECORD_SIZE)));
+	UART_PingPongRelease(&Check_PingPong);
+	CHECK("pingpong_released", NULL_PTR == UART_PingPongGetRecord(&Check_PingPong));
+
+	// the next record after the release goes to the other buffer
+	Check_RxFeedWait(&Check_arrData[3 * CHECK_RECORD_SIZE], CHECK_RECORD_SIZE);
+	record = UART_PingPongGetRecord(&Check_PingPong);
+	CHECK("pingpong_after_overrun", (Check_arrPong == record) && (0 == memcmp(Check_arrPong, &Check_arrData[3 * CHECK_RECORD_SIZE], CHECK_RECORD_SIZE)));
+	CHECK("pingpong_after_overrun", 2 == UART_PingPongGetDropped(&Check_PingPong));
+	UART_PingPongRelease(&Check_PingPong);
+
+	// 1 record delivered and 3 dropped : the counter saturates
+	Check_PingPong.Dropped = 0xFFFE;
+	Check_RxFeedWait(&Check_arrData[4 * CHECK_RECORD_SIZE], 4 * CHECK_RECORD_SIZE);
+	CHECK("pingpong_dropped_saturates", 0xFFFF == UART_PingPongGetDropped(&Check_PingPong));
+	CHECK("pingpong_dropped_saturates", (Check_arrPing == UART_PingPongGetRecord(&Check_PingPong)) &&
+	      (0 == memcmp(Check_arrPing, &Check_arrData[4 * CHECK_RECORD_SIZE], CHECK_RECORD_SIZE)));
+
+	// ready call back releasing at once : every record of a back to back stream , in order
+	Check_Start();
+	Check_u8RecordCalls = 0;
+	CHECK("pingpong_callback", STD_OK == UART_ReceivePingPongStart(&Check_PingPong, Check_arrPing, Check_arrPong, CHECK_RECORD_SIZE, Check_RecordCallBack));
+	Check_RxFeedWait(Check_arrData, sizeof(Check_arrData));
+	CHECK("pingpong_callback", ((sizeof(Check_arrData) / CHECK_RECORD_SIZE) == Check_u8RecordCalls) &&
+	      (0 == memcmp(Check_arrRx, Check_arrData, sizeof(Check_arrData))));
+	CHECK("pingpong_callback", 0 == UART_PingPongGetDropped(&Check_PingPong));
+
+	// no record after the stop
+	UART_ReceivePingPongStop();
+	Check_RxFeedWait(Check_arrData, CHECK_RECORD_SIZE);
+	CHECK("pingpong_stop", (sizeof(Check_arrData) / CHECK_RECORD_SIZE) == Check_u8RecordCalls);
+}
+
+/************************************************************************/
+/*                            main                                      */
+/************************************************************************/
+int main(void)
+{
+	u32 i;
+
+	/* every byte value but the zeros of COBS every 7 bytes */
+	for(i=0; i<sizeof(Check_arrData); i++)
+	{
+		Check_arrData[i] = (0 == (i % 7)) ? 0 : (u8)((i * 37u) + 1);
+	}
+	/* the string frames may not contain the NULL character */
+	for(i=0; i<20; i++)
+	{
+		if(0 == Check_arrData[i])
+		{
+			Check_arrData[i] = 'z';
+		}
+	}
+
+	Check_SendTimeout();
+	Check_ReceiveTimeout();
+	Check_ReceiveStringTimeout();
+	Check_ReceiveCheckSumTimeout();
+	Check_ReceiveCOBSTimeout();
+	Check_PingPongReceive();
+
+	printf("{\"wait_mode\":\"%s\",\"passed\":%lu,\"failed\":%lu}\n",
+	       (UART_WAIT_MODE == UART_WAIT_SLEEP_IDLE) ? "sleep_idle" : "spin",
+	       (unsigned long)Check_u32Passed, (unsigned long)Check_u32Failed);
+	return (0 == Check_u32Failed) ? 0 : 1;
+}
@@ -0,0 +1,24 @@
+/**
+ * @file MemMap.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host replacement of LIB/MemMap.h for the UART benchmark : the USART registers are the slots of Sim_USART.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef MEMMAP_H_
+#define MEMMAP_H_
+
+#include "Sim_USART.h"
+
+/* ================================== USART ================================== */
+#define UDR     (*Sim_RegAccess(SIM_REG_UDR))
+#define UCSRA   (*Sim_RegAccess(SIM_REG_UCSRA))
+#define UCSRB   (*Sim_RegAccess(SIM_REG_UCSRB))
+#define UCSRC   (*Sim_RegAccess(SIM_REG_UCSRC))
+#define UBRRH   (*Sim_RegAccess(SIM_REG_UCSRC))   // same address as UCSRC (URSEL = 0)
+#define UBRRL   (*Sim_RegAccess(SIM_REG_UBRRL))
+
+#endif /* MEMMAP_H_ */
@@ -0,0 +1,2 @@
+/* UART.c and the Services include "UART_Interface.h" , the file of MCAL/05-UART is UART_interface.h (case sensitive host) */
+#include "UART_interface.h"
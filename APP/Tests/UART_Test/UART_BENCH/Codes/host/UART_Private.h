@@ -0,0 +1,2 @@
+/* UART.c includes "UART_Private.h" , the file of MCAL/05-UART is UART_private.h (case sensitive host) */
+#include "UART_private.h"
@@ -0,0 +1,27 @@
+/**
+ * @file Utils_Sleep.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host replacement of LIB/Utils_Sleep.h for the UART benchmark : the sleep moves the simulated time to the next event.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UTILS_SLEEP_H_
+#define UTILS_SLEEP_H_
+
+#include "Utils_interrupt.h"
+#include "Sim_USART.h"
+
+#define Sleep_SetIdleMode()
+
+#define Sleep_IdleWaitUntil(condition)                                           \
+	do{                                                                          \
+		while(!(condition))                                                      \
+		{                                                                        \
+			Sim_Idle();                                                          \
+		}                                                                        \
+	}while(0)
+
+#endif /* UTILS_SLEEP_H_ */
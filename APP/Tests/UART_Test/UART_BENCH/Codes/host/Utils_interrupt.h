@@ -0,0 +1,42 @@
+/**
+ * @file Utils_interrupt.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host replacement of LIB/Utils_interrupt.h for the UART benchmark :
+ *         the ISRs are plain functions called by Sim_USART and SREG is a variable.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UTILS_INTERRUPT_H_
+#define UTILS_INTERRUPT_H_
+
+#include "Std_Types.h"
+
+/* ================================== vectors ================================== */
+#define       USART_RXC_VECT      __vector_13	  // USART, Rx Complete
+#define       USART_UDRE_VECT     __vector_14	  // USART Data Register Empty
+#define       USART_TXC_VECT      __vector_15	  // USART, Tx Complete
+
+/* ================================== SREG ================================== */
+extern volatile u8 Sim_SREG;
+void Sim_Poll(void);
+
+#define sei()   do{ Sim_SREG |= (u8)0x80; Sim_Poll(); }while(0)
+#define cli()   (Sim_SREG &= (u8)~0x80)
+
+#define Global_Interrupt_Enable__asm()    sei()
+#define Global_Interrupt_Disable__asm()   cli()
+
+/* ================================== critical section ================================== */
+#define CRITICAL_SREG                     Sim_SREG
+#define Critical_Enter(sregCopy)          do{ (sregCopy)=Sim_SREG; Sim_SREG &= (u8)~0x80; }while(0)
+#define Critical_Exit(sregCopy)           do{ Sim_SREG=(sregCopy); Sim_Poll(); }while(0)
+
+/* ================================== ISR Macro Like Function ================================== */
+#define ISR(vector,...)            \
+void vector (void);                \
+void vector (void)
+
+#endif /* UTILS_INTERRUPT_H_ */
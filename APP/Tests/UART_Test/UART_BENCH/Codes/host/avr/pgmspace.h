@@ -0,0 +1,20 @@
+/**
+ * @file pgmspace.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Host replacement of avr/pgmspace.h for the UART benchmark : the flash tables are normal constants.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef PGMSPACE_H_
+#define PGMSPACE_H_
+
+#define PROGMEM
+#define PSTR(s)               (s)
+#define pgm_read_byte(addr)   (*(const unsigned char*)(addr))
+#define pgm_read_word(addr)   (*(const unsigned short*)(addr))
+#define pgm_read_ptr(addr)    (*(void* const*)(addr))
+
+#endif /* PGMSPACE_H_ */
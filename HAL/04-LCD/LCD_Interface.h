@@ -8,6 +8,7 @@
  *          - LCD_WriteCh
  *          - LCD_WriteStr
  *          - LCD_WriteNum
+ *          - LCD_Printf
  *          - LCD_WriteBin
  *          - LCD_WriteBinNoLeftZeros
  *          - LCD_WriteHex
@@ -22,6 +23,14 @@
 #ifndef LCD_INTERFACE_H_
 #define LCD_INTERFACE_H_
 
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define LCD_DELAY_BUSY    0 /**< option of LCD_DELAY_MODE in LCD_Lcfg.h */
+#define LCD_DELAY_SLEEP   1 /**< option of LCD_DELAY_MODE in LCD_Lcfg.h */
+
 /*------------------------------------------------------------------------------*/
 /*                                                                              */
 /*                                  TYPEDEFS                                    */
@@ -121,7 +130,9 @@ void LCD_BackSpace(u8 copy_u8_LCD_ID);
  * This function initializes the LCD based on the specified LCD ID.
  * LCD_Ldfg.c has an array of LCD_CONFIG_t structures that contains the configuration of each LCD.
  * lcd_init() must be called before any other LCD functions.
- * It sets the function set, display off control, clears the display, and sets the entry mode.
+ * It resets the interface (4-bit or 8-bit) by instructions as the datasheet says , then sets the function set,
+ * display off control, clears the display, and sets the entry mode.
+ * After the function set an LCD with an RW pin is driven by its busy flag , the others by the fixed delays of the datasheet.
  * @see	LCD_lcfg.c
  * @param copy_u8_LCD_ID The ID of the LCD.
  */
@@ -162,6 +173,20 @@ void LCD_WriteStr(u8 copy_u8_LCD_ID, u8 str[]);
  */
 void LCD_WriteNum(u8 copy_u8_LCD_ID, s64 num);
 
+/**
+ * @brief Writes formatted text to the LCD (printf like , see Std_Printf for the conversions).
+ * 
+ * The characters are written to the LCD as soon as they are formatted , no buffer is used.
+ * 
+ * @param copy_u8_LCD_ID The ID of the LCD.
+ * @param format The format string.
+ * @param ... The values of the conversions.
+ * 
+ * @example
+ * LCD_Printf(0, "T=%3d C", temp);
+ */
+void LCD_Printf(u8 copy_u8_LCD_ID, const char *format, ...);
+
 /**
  * @brief Writes a binary number to the LCD.
  * 
@@ -8,6 +8,7 @@
  *          - the pins of the LCD
  *          - the RS pin of the LCD
  *          - the EN pin of the LCD    
+ *          - the RW pin of the LCD (optional)
  * @version 0.1
  * @date 2024-03-14
  * 
@@ -44,6 +45,10 @@
 *  - the pins of the LCD
 *  - the RS pin of the LCD
 *  - the EN pin of the LCD
+*  - the RW pin of the LCD : the driver reads the busy flag (DB7) instead of waiting the worst case time of every instruction ,
+*                            set LCD_RW_Used to STD_TRUE and LCD_RW_Pin to the pin of RW ,
+*                            LCD_RW_Used left out (STD_FALSE) if RW is tied to GND (write only LCD).
+*                            The RW pin is an output in DIO_Lcfg.c , the data pins are switched to input by the driver.
 */
 const LCD_CONFIG_t  LCD_arrOfLCD[copy_LCD_Quantity]=
 {
@@ -53,6 +58,10 @@ const LCD_CONFIG_t  LCD_arrOfLCD[copy_LCD_Quantity]=
 	     .LCD_DOTS=LCD_5x7Dots,
 	     .LCD_RS_Pin=PB0,
 	     .LCD_EN_Pin=PB1,
+	     /* RW tied to GND on this board , with RW wired to a free output pin (e.g. PB5 , an output in DIO_Lcfg.c) :
+	     .LCD_RW_Used=STD_TRUE,
+	     .LCD_RW_Pin=PB5,
+	     */
 	     .LCD_pins={PC0,PC1,PC2,PC3}
      },
      {
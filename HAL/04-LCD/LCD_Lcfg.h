@@ -22,5 +22,23 @@
  */
 #define copy_LCD_Quantity     2
 
+/**
+ * @brief How the LCD driver waits for the LCD.
+ *
+ * - LCD_DELAY_BUSY  : _delay_ms , the CPU runs at full power during the delays.
+ * - LCD_DELAY_SLEEP : SysTick_DelayMs , the CPU sleeps in idle mode during the delays
+ *                     (call SysTick_Init and enable the global interrupt before LCD_init).
+ */
+#define LCD_DELAY_MODE        LCD_DELAY_SLEEP
+
+/**
+ * @brief The time (in us) the driver polls the busy flag of an LCD with an RW pin before it gives up.
+ *
+ * An LCD still busy after this time (RW or DB7 not wired , no LCD) is driven by the fixed delays
+ * until the next LCD_init of it. It must be more than the longest instruction (clear display : 1.52 ms).
+ * It is a minimum : the polls are counted as LCD_BusyPoll_time_us each , the DIO calls make them longer.
+ */
+#define LCD_BUSY_TIMEOUT_US   3000
+
 
 #endif /* LCD_LCFG_H_ */
\ No newline at end of file
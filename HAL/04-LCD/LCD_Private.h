@@ -21,11 +21,22 @@
 /*                                  MACROS                                      */
 /*                                                                              */
 /*------------------------------------------------------------------------------*/
-// Time Delay Constants
+// Time Delay Constants (HD44780 datasheet)
 #define LCD_poweron_time_ms       50 /**< Macro to define the time taken to power on the LCD. */
-#define LCD_Clear_Display_time_ms 2 /**< Macro to define the time taken to clear the display of the LCD. */
-#define LCD_Return_Home_time_ms   2 /**< Macro to define the time taken to return the cursor to the home position of the LCD. */
-#define LCD_CMD_Avg_time_ms       1 /**< Macro to define the time taken to set the entry mode of the LCD. */
+#define LCD_Clear_Display_time_ms 2 /**< Macro to define the time taken to clear the display of the LCD (1.52 ms). */
+#define LCD_Return_Home_time_ms   2 /**< Macro to define the time taken to return the cursor to the home position of the LCD (1.52 ms). */
+#define LCD_Reset_1st_time_ms     5 /**< wait after the 1st function set of the reset by instructions (4.1 ms). */
+#define LCD_Reset_Next_time_us  100 /**< wait after the next instructions of the reset (100 us , no busy flag yet : long enough for a slow LCD). */
+#define LCD_CMD_Exec_time_us     40 /**< execution time of the other instructions and of a data write (37 us). */
+#define LCD_EN_Pulse_time_us      1 /**< EN high time (PWEH >= 450 ns) and EN low time (tcycE >= 1 us). */
+#define LCD_BusyPoll_time_us      4 /**< min time of one read of the busy flag (2 EN pulses in 4-bit mode) , sets the count of the timeout. */
+
+// Delay function
+#if (LCD_DELAY_MODE==LCD_DELAY_SLEEP)
+#define LCD_DelayMs(ms)   SysTick_DelayMs(ms) /**< the CPU sleeps in idle mode during the delay (busy waits if SysTick_Init is not called). */
+#else
+#define LCD_DelayMs(ms)   _delay_ms(ms)       /**< the CPU busy waits during the delay. */
+#endif
 
 // Select LCD Function
 #define LCD_EntryModeSetInstruction         0b00000100 /**< the entry mode set instruction of the LCD. */
@@ -33,6 +44,8 @@
 #define LCD_CursorOrDisplayShiftInstruction 0b00010000 /**< the cursor or display shift instruction of the LCD. */
 #define LCD_FunctionSetInstruction          0b00100000 /**< the function set instruction of the LCD. */
 
+#define LCD_DataWrite     0xFF /**< the cmd of LCD_WaitExecution after a data write (same execution time as 0xFF). */
+
 #define LCD_DDRAM_Address 0x80 /**< Macro to define the DDRAM address of the LCD. */
 #define LCD_CGRAM_Address 0x40 /**< Macro to define the CGRAM address of the LCD. */
 
@@ -53,59 +66,17 @@ typedef struct
     LCD_DOTS_t LCD_DOTS;
     u8 LCD_RS_Pin;
     u8 LCD_EN_Pin;
+    Std_Bool_t LCD_RW_Used; /**< STD_TRUE if RW is wired to LCD_RW_Pin , STD_FALSE (the zero default) if RW is tied to GND */
+    u8 LCD_RW_Pin;  /**< used only if LCD_RW_Used is STD_TRUE */
     u8 LCD_pins[8];
 }LCD_CONFIG_t;
 
 /*------------------------------------------------------------------------------*/
 /*                                                                              */
-/*                                  Static Global Varibles                      */
+/*                               Configuration                                  */
 /*                                                                              */
 /*------------------------------------------------------------------------------*/
-
-/*
-* defualt is: Display off , Cursor off , Blink off 
-*/
-static u8 LCD_u8displayOnOffControlBuffer[copy_LCD_Quantity] ={0}; /**< static array (Act as "R/W" REG) to set the display on/off control of the LCD. */
-
 extern const LCD_CONFIG_t  LCD_arrOfLCD[copy_LCD_Quantity];
 
 
-/*-----------------------------------------------------------------------------*/
-/*                                                                             */
-/*                              PRIVATE Functions                              */
-/*                                                                             */
-/*-----------------------------------------------------------------------------*/
-
-/**
- * @brief Generates a pulse on the enable (EN) pin of the LCD.
- *
- * This function generates a pulse on the enable (EN) pin of the LCD to initiate data transfer or command execution.
- * It sets the EN pin to high voltage for a short duration, then sets it back to low voltage.
- *
- * @param copy_u8_LCD_ID The ID of the LCD module.
- */
-static void LCD_EN_Pulse(u8 copy_u8_LCD_ID);
-
-/**
- * @brief Writes a command to the LCD module.
- *
- * This function writes command to the LCD based on the specified LCD ID and command value.
- * It supports both 8-bit and 4-bit modes of operation.
- *
- * @param copy_u8_LCD_ID The ID of the LCD module.
- * @param cmd The command to be written.
- */
-static void LCD_WriteCMD(u8 copy_u8_LCD_ID, u8 cmd);
-
-/**
- * @brief Writes data to the LCD.
- * 
- * This function writes data to the LCD based on the specified LCD ID and data value.
- * It supports both 8-bit and 4-bit modes of operation.
- * 
- * @param copy_u8_LCD_ID The ID of the LCD.
- * @param data The data to be written to the LCD.
- */
-static void LCD_WriteData(u8 copy_u8_LCD_ID, u8 data);
-
 #endif /* LCD_PRIVATE_H_ */
\ No newline at end of file
@@ -26,6 +26,7 @@
 */
 #include "MCU_config.h"
 #include "DIO_Interface.h"
+#include "SysTick_Interface.h"
 
 /*
 * Include own files
@@ -35,12 +36,101 @@
 #include "LCD_private.h"
 
 
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  Static Global Varibles                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/*
+* defualt is: Display off , Cursor off , Blink off 
+*/
+static u8 LCD_u8displayOnOffControlBuffer[copy_LCD_Quantity] ={0}; /**< static array (Act as "R/W" REG) to set the display on/off control of the LCD. */
+
+static u8 LCD_u8PrintfID = 0; /**< the LCD written by the sink of LCD_Printf. */
+
+/*
+* STD_TRUE : the busy flag of the LCD is polled before each write ,
+* STD_FALSE : the driver waits the execution time after each write (no RW pin , before the function set of LCD_init , timeout).
+*/
+static Std_Bool_t LCD_boolBusyFlagUsed[copy_LCD_Quantity] ={STD_FALSE}; /**< the wait mode of each LCD. */
+
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
 /*                              PRIVATE Functions                              */
 /*                                                                             */
 /*-----------------------------------------------------------------------------*/
 
+/**
+ * @brief Generates a pulse on the enable (EN) pin of the LCD.
+ *
+ * This function generates a pulse on the enable (EN) pin of the LCD to initiate data transfer or command execution.
+ * It sets the EN pin to high voltage for a short duration, then sets it back to low voltage.
+ *
+ * @param copy_u8_LCD_ID The ID of the LCD module.
+ */
+static void LCD_EN_Pulse(u8 copy_u8_LCD_ID);
+
+/**
+ * @brief Writes the 4 or 8 data pins of the LCD and latches them by an enable pulse.
+ *
+ * In 4-bit mode the pins LCD_pins[0..3] take the bits 0..3 of value.
+ *
+ * @param copy_u8_LCD_ID The ID of the LCD module.
+ * @param value The bits of the data pins.
+ */
+static void LCD_WriteBus(u8 copy_u8_LCD_ID, u8 value);
+
+/**
+ * @brief Waits until the LCD can take a new instruction or data.
+ *
+ * With the busy flag : reads DB7 (RS=0 , RW=1) until it is 0 , the data pins are inputs during the read.
+ * An LCD still busy after LCD_BUSY_TIMEOUT_US is then driven by the fixed delays.
+ *
+ * @param copy_u8_LCD_ID The ID of the LCD module.
+ */
+static void LCD_WaitReady(u8 copy_u8_LCD_ID);
+
+/**
+ * @brief Waits the execution time of the instruction or data just written (LCD without busy flag).
+ *
+ * @param copy_u8_LCD_ID The ID of the LCD module.
+ * @param cmd The instruction just written (LCD_DataWrite for a data write).
+ */
+static void LCD_WaitExecution(u8 copy_u8_LCD_ID, u8 cmd);
+
+/**
+ * @brief Writes a command to the LCD module.
+ *
+ * This function writes command to the LCD based on the specified LCD ID and command value.
+ * It supports both 8-bit and 4-bit modes of operation.
+ * It waits for the LCD before the write (busy flag) or after it (execution time).
+ *
+ * @param copy_u8_LCD_ID The ID of the LCD module.
+ * @param cmd The command to be written.
+ */
+static void LCD_WriteCMD(u8 copy_u8_LCD_ID, u8 cmd);
+
+/**
+ * @brief Writes data to the LCD.
+ * 
+ * This function writes data to the LCD based on the specified LCD ID and data value.
+ * It supports both 8-bit and 4-bit modes of operation.
+ * It waits for the LCD before the write (busy flag) or after it (execution time).
+ * 
+ * @param copy_u8_LCD_ID The ID of the LCD.
+ * @param data The data to be written to the LCD.
+ */
+static void LCD_WriteData(u8 copy_u8_LCD_ID, u8 data);
+
+/**
+ * @brief The sink of LCD_Printf , writes a character to the LCD selected by LCD_u8PrintfID.
+ * 
+ * @param ch The character to write.
+ */
+static void LCD_PrintfSink(u8 ch);
+
+
 /**
  * @brief Generates a pulse on the enable (EN) pin of the LCD.
  *
@@ -52,9 +142,116 @@
 static void LCD_EN_Pulse(u8 copy_u8_LCD_ID)
 {
 	Dio_WritePin(LCD_arrOfLCD[copy_u8_LCD_ID].LCD_EN_Pin, DIO_VOLT_HIGH); /**< Set EN pin to high voltage */
-	_delay_ms(1); /**< Delay for 1 millisecond */
+	_delay_us(LCD_EN_Pulse_time_us); /**< EN high time , the LCD latches the data pins on the falling edge */
 	Dio_WritePin(LCD_arrOfLCD[copy_u8_LCD_ID].LCD_EN_Pin, DIO_VOLT_LOW); /**< Set EN pin to low voltage */
-	_delay_ms(1); /**< Delay for 1 millisecond */
+	_delay_us(LCD_EN_Pulse_time_us); /**< EN low time before the next pulse */
+}
+
+/**
+ * @brief Writes the 4 or 8 data pins of the LCD and latches them by an enable pulse.
+ *
+ * In 4-bit mode the pins LCD_pins[0..3] take the bits 0..3 of value.
+ *
+ * @param copy_u8_LCD_ID The ID of the LCD module.
+ * @param value The bits of the data pins.
+ */
+static void LCD_WriteBus(u8 copy_u8_LCD_ID, u8 value)
+{
+	u8 i;
+	u8 local_u8pinsCount = (LCD_arrOfLCD[copy_u8_LCD_ID].LCD_Mode == LCD_8BIT_MODE) ? 8 : 4;
+
+	for (i = 0; i < local_u8pinsCount; i++)
+	{
+		Dio_WritePin(LCD_arrOfLCD[copy_u8_LCD_ID].LCD_pins[i], get_bit(value, (i))); /**< Write each bit of value to the corresponding LCD pin */
+	}
+	LCD_EN_Pulse(copy_u8_LCD_ID); /**< Generate enable pulse */
+}
+
+/**
+ * @brief Waits until the LCD can take a new instruction or data.
+ *
+ * With the busy flag : reads DB7 (RS=0 , RW=1) until it is 0 , the data pins are inputs during the read.
+ * An LCD still busy after LCD_BUSY_TIMEOUT_US is then driven by the fixed delays.
+ *
+ * @param copy_u8_LCD_ID The ID of the LCD module.
+ */
+static void LCD_WaitReady(u8 copy_u8_LCD_ID)
+{
+	u8 i;
+	u8 local_u8pinsCount;
+	u16 local_u16polls = 0;
+	DIO_VOLTAGE_LEVEL_t local_busyFlag = DIO_VOLT_HIGH;
+	const LCD_CONFIG_t *local_pLCD = &LCD_arrOfLCD[copy_u8_LCD_ID];
+
+	if (STD_TRUE != LCD_boolBusyFlagUsed[copy_u8_LCD_ID])
+	{
+		return; /**< LCD_WaitExecution waits after the write */
+	}
+	local_u8pinsCount = (local_pLCD->LCD_Mode == LCD_8BIT_MODE) ? 8 : 4;
+
+	// the data pins are released before RW=1 : the LCD drives them during the read
+	// pull-ups : an undriven DB7 (not wired , no LCD) reads busy and ends in the timeout , not in a write too early
+	for (i = 0; i < local_u8pinsCount; i++)
+	{
+		Dio_SetPinDirection(local_pLCD->LCD_pins[i], DIO_PIN_DIRECTION_INPUT_PULLUP);
+	}
+	Dio_WritePin(local_pLCD->LCD_RS_Pin, DIO_VOLT_LOW); /**< RS=0 , RW=1 : read the busy flag and the address counter */
+	Dio_WritePin(local_pLCD->LCD_RW_Pin, DIO_VOLT_HIGH);
+
+	while ((DIO_VOLT_HIGH == local_busyFlag) && (local_u16polls < (LCD_BUSY_TIMEOUT_US / LCD_BusyPoll_time_us)))
+	{
+		Dio_WritePin(local_pLCD->LCD_EN_Pin, DIO_VOLT_HIGH);
+		_delay_us(LCD_EN_Pulse_time_us); /**< the LCD drives the data pins while EN is high (tDDR) */
+		local_busyFlag = Dio_ReadPin(local_pLCD->LCD_pins[local_u8pinsCount - 1]); /**< DB7 : the busy flag */
+		Dio_WritePin(local_pLCD->LCD_EN_Pin, DIO_VOLT_LOW);
+		_delay_us(LCD_EN_Pulse_time_us);
+		if (local_pLCD->LCD_Mode == LCD_4BIT_MODE)
+		{
+			LCD_EN_Pulse(copy_u8_LCD_ID); /**< the low nibble (address counter) is not used but it is read to end the transfer */
+		}
+		else
+		{
+			_delay_us(2 * LCD_EN_Pulse_time_us); /**< one poll takes LCD_BusyPoll_time_us in both modes (timeout) */
+		}
+		local_u16polls++;
+	}
+
+	// RW=0 before the data pins drive the bus again
+	Dio_WritePin(local_pLCD->LCD_RW_Pin, DIO_VOLT_LOW);
+	for (i = 0; i < local_u8pinsCount; i++)
+	{
+		Dio_SetPinDirection(local_pLCD->LCD_pins[i], DIO_PIN_DIRECTION_OUTPUT);
+	}
+	if (DIO_VOLT_HIGH == local_busyFlag)
+	{
+		LCD_boolBusyFlagUsed[copy_u8_LCD_ID] = STD_FALSE; /**< no answer : the fixed delays until the next LCD_init */
+	}
+}
+
+/**
+ * @brief Waits the execution time of the instruction or data just written (LCD without busy flag).
+ *
+ * @param copy_u8_LCD_ID The ID of the LCD module.
+ * @param cmd The instruction just written (LCD_DataWrite for a data write).
+ */
+static void LCD_WaitExecution(u8 copy_u8_LCD_ID, u8 cmd)
+{
+	if (STD_TRUE == LCD_boolBusyFlagUsed[copy_u8_LCD_ID])
+	{
+		return; /**< LCD_WaitReady waits before the next write */
+	}
+	if (cmd == 0x01)
+	{
+		LCD_DelayMs(LCD_Clear_Display_time_ms); /**< clear display */
+	}
+	else if ((cmd == 0x02) || (cmd == 0x03))
+	{
+		LCD_DelayMs(LCD_Return_Home_time_ms); /**< return home */
+	}
+	else
+	{
+		_delay_us(LCD_CMD_Exec_time_us); /**< all the other instructions and the data writes */
+	}
 }
 
 /**
@@ -62,70 +259,50 @@ static void LCD_EN_Pulse(u8 copy_u8_LCD_ID)
  *
  * This function writes command to the LCD based on the specified LCD ID and command value.
  * It supports both 8-bit and 4-bit modes of operation.
+ * It waits for the LCD before the write (busy flag) or after it (execution time).
  *
  * @param copy_u8_LCD_ID The ID of the LCD module.
  * @param cmd The command to be written.
  */
 static void LCD_WriteCMD(u8 copy_u8_LCD_ID, u8 cmd)
 {
-	u8 i;
+	LCD_WaitReady(copy_u8_LCD_ID);
 	Dio_WritePin(LCD_arrOfLCD[copy_u8_LCD_ID].LCD_RS_Pin, DIO_VOLT_LOW); /**< Set RS pin to low voltage */
 	if (LCD_arrOfLCD[copy_u8_LCD_ID].LCD_Mode == LCD_8BIT_MODE)
 	{
-		for (i = 0; i < 8; i++)
-		{
-			Dio_WritePin(LCD_arrOfLCD[copy_u8_LCD_ID].LCD_pins[i], get_bit(cmd, (i))); /**< Write each bit of cmd to the corresponding LCD pin */
-		}
-		LCD_EN_Pulse(copy_u8_LCD_ID); /**< Generate enable pulse */
+		LCD_WriteBus(copy_u8_LCD_ID, cmd); /**< Write cmd to the LCD pins */
 	}
 	else if (LCD_arrOfLCD[copy_u8_LCD_ID].LCD_Mode == LCD_4BIT_MODE)
 	{
-		for (i = 0; i < 4; i++)
-		{
-			Dio_WritePin(LCD_arrOfLCD[copy_u8_LCD_ID].LCD_pins[i], get_bit(cmd, (i + 4))); /**< Write the upper 4 bits of cmd to the corresponding LCD pin */
-		}
-		LCD_EN_Pulse(copy_u8_LCD_ID); /**< Generate enable pulse */
-		for (i = 0; i < 4; i++)
-		{
-			Dio_WritePin(LCD_arrOfLCD[copy_u8_LCD_ID].LCD_pins[i], get_bit(cmd, (i))); /**< Write the lower 4 bits of cmd to the corresponding LCD pin */
-		}
-		LCD_EN_Pulse(copy_u8_LCD_ID); /**< Generate enable pulse */
+		LCD_WriteBus(copy_u8_LCD_ID, cmd >> 4); /**< Write the upper 4 bits of cmd to the LCD pins */
+		LCD_WriteBus(copy_u8_LCD_ID, cmd); /**< Write the lower 4 bits of cmd to the LCD pins */
 	}
+	LCD_WaitExecution(copy_u8_LCD_ID, cmd);
 }
 /**
  * @brief Writes data to the LCD.
  * 
  * This function writes data to the LCD based on the specified LCD ID and data value.
  * It supports both 8-bit and 4-bit modes of operation.
+ * It waits for the LCD before the write (busy flag) or after it (execution time).
  * 
  * @param copy_u8_LCD_ID The ID of the LCD.
  * @param data The data to be written to the LCD.
  */
 static void LCD_WriteData(u8 copy_u8_LCD_ID, u8 data)
 {
-	u8 i;
+	LCD_WaitReady(copy_u8_LCD_ID);
 	Dio_WritePin(LCD_arrOfLCD[copy_u8_LCD_ID].LCD_RS_Pin,DIO_VOLT_HIGH); /**< Set the RS pin to high to indicate data mode */
 	if (LCD_arrOfLCD[copy_u8_LCD_ID].LCD_Mode==LCD_8BIT_MODE)
 	{
-		for (i = 0; i < 8; i++)
-		{
-			Dio_WritePin(LCD_arrOfLCD[copy_u8_LCD_ID].LCD_pins[i], get_bit(data, (i))); /**< Write each bit of the data to the corresponding LCD pin */
-		}
-		LCD_EN_Pulse(copy_u8_LCD_ID); /**< Generate an enable pulse to latch the data */
+		LCD_WriteBus(copy_u8_LCD_ID, data); /**< Write the data to the LCD pins */
 	}
 	else if (LCD_arrOfLCD[copy_u8_LCD_ID].LCD_Mode==LCD_4BIT_MODE)
 	{
-		for (i = 0; i < 4 ; i++)
-		{
-			Dio_WritePin(LCD_arrOfLCD[copy_u8_LCD_ID].LCD_pins[i], get_bit(data, (i+4))); /**< Write the upper 4 bits of the data to the corresponding LCD pins */
-		}
-		LCD_EN_Pulse(copy_u8_LCD_ID); /**< Generate an enable pulse to latch the upper 4 bits of the data */
-		for (i = 0; i < 4; i++)
-		{
-			Dio_WritePin(LCD_arrOfLCD[copy_u8_LCD_ID].LCD_pins[i], get_bit(data, (i))); /**< Write the lower 4 bits of the data to the corresponding LCD pins */
-		}
-		LCD_EN_Pulse(copy_u8_LCD_ID); /**< Generate an enable pulse to latch the lower 4 bits of the data */
+		LCD_WriteBus(copy_u8_LCD_ID, data >> 4); /**< Write the upper 4 bits of the data to the LCD pins */
+		LCD_WriteBus(copy_u8_LCD_ID, data); /**< Write the lower 4 bits of the data to the LCD pins */
 	}
+	LCD_WaitExecution(copy_u8_LCD_ID, LCD_DataWrite);
 }
 
 /*-----------------------------------------------------------------------------*/
@@ -157,13 +334,11 @@ void LCD_voidSetOption(u8 copy_u8_LCD_ID, LCD_Options_t Copy_Option)
 	if (Copy_Option>=LCD_DecrementedCursorShiftingOff && Copy_Option<=LCD_FixedCursorDisplayShiftedLeft)
 	{
 		LCD_WriteCMD(copy_u8_LCD_ID,LCD_EntryModeSetInstruction|Copy_Option); /**<Set the entry mode with the specified option.*/
-		_delay_ms(LCD_CMD_Avg_time_ms);
 	}
 	// Cursor or Display shift
 	else if (Copy_Option>=LCD_CursorShiftleft && Copy_Option<=LCD_EntireDisplayShiftRight)
 	{
 		LCD_WriteCMD(copy_u8_LCD_ID,LCD_CursorOrDisplayShiftInstruction|((Copy_Option-4)<<2)); /**<Shift the cursor or display with the specified option.*/
-		_delay_ms(LCD_CMD_Avg_time_ms);
 	}
 	else if (Copy_Option>=LCD_BlinkOff && Copy_Option<=LCD_DisplayOn)
 	{
@@ -171,17 +346,14 @@ void LCD_voidSetOption(u8 copy_u8_LCD_ID, LCD_Options_t Copy_Option)
 		LCD_u8displayOnOffControlBuffer[copy_u8_LCD_ID]|=LCD_DisplayOnOffControlInstruction;
 		write_bit(LCD_u8displayOnOffControlBuffer[copy_u8_LCD_ID],(Copy_Option/2),(Copy_Option%2));
 		LCD_WriteCMD(copy_u8_LCD_ID,LCD_u8displayOnOffControlBuffer[copy_u8_LCD_ID]); /**<Set the display on/off control with the specified option.*/
-		_delay_ms(LCD_CMD_Avg_time_ms);
 	}
 	else if (Copy_Option==LCD_ClearDisplay)
 	{
 		LCD_WriteCMD(copy_u8_LCD_ID,0x01); /**<Clear the display.*/
-		_delay_ms(LCD_Clear_Display_time_ms);
 	}
 	else if (Copy_Option==LCD_ReturnHome)
 	{
 		LCD_WriteCMD(copy_u8_LCD_ID,0x02); /**<Return the cursor to home position.*/
-		_delay_ms(LCD_Return_Home_time_ms);
 	}
 	else
 	{
@@ -197,11 +369,8 @@ void LCD_voidSetOption(u8 copy_u8_LCD_ID, LCD_Options_t Copy_Option)
 void LCD_BackSpace(u8 copy_u8_LCD_ID)
 {
 	LCD_WriteCMD(copy_u8_LCD_ID,0x10); /**<Shift the cursor to the left.*/
-	_delay_ms(LCD_CMD_Avg_time_ms);
 	LCD_WriteData(copy_u8_LCD_ID,' '); /**<Write a space character to the LCD.*/
-	_delay_ms(1);
 	LCD_WriteCMD(copy_u8_LCD_ID,0x10); /**<Shift the cursor to the left because the cursor incremented after write ' ' .*/
-	_delay_ms(LCD_CMD_Avg_time_ms);
 }
 
 /**
@@ -210,36 +379,56 @@ void LCD_BackSpace(u8 copy_u8_LCD_ID)
  * This function initializes the LCD based on the specified LCD ID.
  * LCD_Ldfg.c has an array of LCD_CONFIG_t structures that contains the configuration of each LCD.
  * lcd_init() must be called before any other LCD functions.
- * It sets the function set, display off control, clears the display, and sets the entry mode.
+ * It resets the interface (4-bit or 8-bit) by instructions as the datasheet says , then sets the function set,
+ * display off control, clears the display, and sets the entry mode.
+ * After the function set an LCD with an RW pin is driven by its busy flag , the others by the fixed delays of the datasheet.
  * @see	LCD_lcfg.c
  * @param copy_u8_LCD_ID The ID of the LCD.
  */
 void LCD_init(u8 copy_u8_LCD_ID)
 {
-	_delay_ms(LCD_poweron_time_ms);
+	// 8-bit function set (DB5 , DB4) on the pins of DB7..DB4
+	u8 local_u8reset = (LCD_arrOfLCD[copy_u8_LCD_ID].LCD_Mode==LCD_8BIT_MODE) ? 0x30 : 0x03;
+
+	LCD_boolBusyFlagUsed[copy_u8_LCD_ID]=STD_FALSE; /**<the busy flag can be read after the function set.*/
+	LCD_DelayMs(LCD_poweron_time_ms);
+
+	// reset by instructions : the LCD ends in 8-bit mode whatever its state (power on , 4-bit mode , half of a byte)
+	Dio_WritePin(LCD_arrOfLCD[copy_u8_LCD_ID].LCD_RS_Pin, DIO_VOLT_LOW);
+	if (STD_TRUE == LCD_arrOfLCD[copy_u8_LCD_ID].LCD_RW_Used)
+	{
+		Dio_WritePin(LCD_arrOfLCD[copy_u8_LCD_ID].LCD_RW_Pin, DIO_VOLT_LOW);
+	}
+	LCD_WriteBus(copy_u8_LCD_ID,local_u8reset);
+	LCD_DelayMs(LCD_Reset_1st_time_ms);
+	LCD_WriteBus(copy_u8_LCD_ID,local_u8reset);
+	_delay_us(LCD_Reset_Next_time_us);
+	LCD_WriteBus(copy_u8_LCD_ID,local_u8reset);
+	_delay_us(LCD_Reset_Next_time_us);
 	if (LCD_arrOfLCD[copy_u8_LCD_ID].LCD_Mode==LCD_4BIT_MODE)
 	{	
-		LCD_WriteCMD(copy_u8_LCD_ID,0x02);
-		_delay_ms(LCD_CMD_Avg_time_ms);
+		LCD_WriteBus(copy_u8_LCD_ID,0x02); /**<4-bit interface , from now every instruction is 2 nibbles.*/
+		_delay_us(LCD_Reset_Next_time_us);
 	}
 	// function set
 	// 0b0 0 1 DL N F X X - DL:Data length() , N:No of lines , F:Font
 	// DL=0 4-bit mode , DL=1 8-bit mode , N=0 1-line mode , N=1 2-line mode , F=0 5x7 dots , F=1 5x10 dots
 	u8 local_u8functionSet =LCD_FunctionSetInstruction| LCD_arrOfLCD[copy_u8_LCD_ID].LCD_Mode | LCD_arrOfLCD[copy_u8_LCD_ID].LCD_LINE | LCD_arrOfLCD[copy_u8_LCD_ID].LCD_DOTS;
 	LCD_WriteCMD(copy_u8_LCD_ID,local_u8functionSet); /**<Set the function set with the specified options.*/
-	_delay_ms(LCD_CMD_Avg_time_ms);
+	if (STD_TRUE == LCD_arrOfLCD[copy_u8_LCD_ID].LCD_RW_Used)
+	{
+		LCD_boolBusyFlagUsed[copy_u8_LCD_ID]=STD_TRUE; /**<the next instructions wait for the busy flag.*/
+	}
 
 	// display off control
 	// 0b0 0 0 0 1 D C B - D:Display , C:Cursor , B:Blink
 	// D=0 display off , D=1 display on , C=0 cursor off , C=1 cursor on , B=0 blink off , B=1 blink on
 	LCD_u8displayOnOffControlBuffer[copy_u8_LCD_ID]=LCD_DisplayOnOffControlInstruction|LCD_u8displayOnOffControlBuffer[copy_u8_LCD_ID]|0b00001100;
 	LCD_WriteCMD(copy_u8_LCD_ID,LCD_u8displayOnOffControlBuffer[copy_u8_LCD_ID]); /**<Set the display on/off control with the specified options.*/
-	_delay_ms(LCD_CMD_Avg_time_ms);
 
 	// clear display
 	// 0 0 0 0 0 0 0 1
 	LCD_WriteCMD(copy_u8_LCD_ID,0b00000001); /**<Clear the display.*/
-	_delay_ms(LCD_Clear_Display_time_ms);
 
 	// entry mode set
 	// 0 0 0 0 0 0 0 1
@@ -247,7 +436,6 @@ void LCD_init(u8 copy_u8_LCD_ID)
 	// I/D=1 increment , I/D=0 decrement , S=1 display shift , S=0 cursor move 
 	u8 local_u8EntryModeSet = LCD_EntryModeSetInstruction | LCD_IncrementedCursorShiftingOff;
 	LCD_WriteCMD(copy_u8_LCD_ID,local_u8EntryModeSet); /**<Set the entry mode with the specified options.*/
-	_delay_ms(LCD_CMD_Avg_time_ms);
 }
 
 /**
@@ -261,7 +449,6 @@ void LCD_init(u8 copy_u8_LCD_ID)
 void LCD_WriteCh(u8 copy_u8_LCD_ID,u8 ch)
 {
 	LCD_WriteData(copy_u8_LCD_ID,ch); /**<Write data to the LCD.*/
-	_delay_ms(1); /**<Delay for 1 millisecond.*/
 }
 
 /**
@@ -298,8 +485,8 @@ void LCD_WriteStr(u8 copy_u8_LCD_ID, u8 str[])
 void LCD_WriteNum(u8 copy_u8_LCD_ID, s64 num)
 {
 	u8 str[50]={0};
-	u8 temp,Sign_Flag=0;
-	u16 i,len;
+	u8 Sign_Flag=0;
+	u16 i;
 	if (num==0)
 	{
 		LCD_WriteCh(copy_u8_LCD_ID,'0') ;
@@ -324,10 +511,9 @@ void LCD_WriteNum(u8 copy_u8_LCD_ID, s64 num)
 			i++;
 		}
 		str[i]='\0';
-		len=i;
 		/*Swap*/
 		/*
-		Str_ReverseWithLen(str,len);
+		Str_ReverseWithLen(str,i);
 		LCD_WriteStr(copy_u8_LCD_ID,str);*/
 		for (u8 j=i; j>0 ; j--)
 		{
@@ -337,6 +523,38 @@ void LCD_WriteNum(u8 copy_u8_LCD_ID, s64 num)
 	}
 }
 
+/**
+ * @brief The sink of LCD_Printf , writes a character to the LCD selected by LCD_u8PrintfID.
+ * 
+ * @param ch The character to write.
+ */
+static void LCD_PrintfSink(u8 ch)
+{
+	LCD_WriteCh(LCD_u8PrintfID,ch);
+}
+
+/**
+ * @brief Writes formatted text to the LCD (printf like , see Std_Printf for the conversions).
+ * 
+ * The characters are written to the LCD as soon as they are formatted , no buffer is used.
+ * 
+ * @param copy_u8_LCD_ID The ID of the LCD.
+ * @param format The format string.
+ * @param ... The values of the conversions.
+ * 
+ * @example
+ * LCD_Printf(0, "T=%3d C", temp);
+ */
+void LCD_Printf(u8 copy_u8_LCD_ID, const char *format, ...)
+{
+	va_list args;
+
+	LCD_u8PrintfID=copy_u8_LCD_ID;
+	va_start(args, format);
+	Std_vPrintf(LCD_PrintfSink, format, args);
+	va_end(args);
+}
+
 /**
  * @brief Writes a binary number to the LCD.
  * 
@@ -449,22 +667,18 @@ void LCD_SetCursor(u8 copy_u8_LCD_ID,u8 line,u8 cell)
 	{
 		case 1    :
 				  LCD_WriteCMD(copy_u8_LCD_ID,LCD_DDRAM_Address+LCD_DDRAM_Address_1ndLine+(cell-1)); /**< Set the cursor position to the specified line and cell on the LCD. */
-				  _delay_ms(1); 
 		break;
 		
 		case 2    :
 				  LCD_WriteCMD(copy_u8_LCD_ID,LCD_DDRAM_Address+LCD_DDRAM_Address_2ndLine+(cell-1)); /**< Set the cursor position to the specified line and cell on the LCD. */
-				  _delay_ms(1); 
 		break;
 
 		case 3    :
 				  LCD_WriteCMD(copy_u8_LCD_ID,LCD_DDRAM_Address+LCD_DDRAM_Address_3rdLine+(cell-1)); /**< Set the cursor position to the specified line and cell on the LCD. */
-				  _delay_ms(1); 
 		break;
 
 		case 4    :
 				  LCD_WriteCMD(copy_u8_LCD_ID,LCD_DDRAM_Address+LCD_DDRAM_Address_4thLine+(cell-1)); /**< Set the cursor position to the specified line and cell on the LCD. */
-				  _delay_ms(1); 
 		break;
 		default   :
 				  /*	*/
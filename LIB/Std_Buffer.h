@@ -0,0 +1,50 @@
+/**
+ * @file Std_Buffer.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  The types shared by the fixed size buffers of LIB (Std_Stack , Std_Queue) :
+ *         the policy of a push on a full buffer and the counters of a buffer.
+ *
+ * The counters are updated by every push and pop , they are read with Std_StackGetStats / Std_QueueGetStats
+ * while the buffer is in use and give the numbers to size it :
+ *  - Peak near the capacity with Drops or Overwrites : the buffer is too small (or its reader too slow).
+ *  - Peak far below the capacity after a long run : the buffer can be smaller.
+ *  - Pushed and Popped over a period : the throughput.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef STD_BUFFER_H_
+#define STD_BUFFER_H_
+
+#include "Std_Types.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief what a push does when the buffer is full , chosen when the buffer is created.
+ */
+typedef enum
+{
+	STD_OVERFLOW_DROP_NEWEST,       /**< the new element is dropped , the push returns STD_BUFFER_FULL */
+	STD_OVERFLOW_OVERWRITE_OLDEST,  /**< the oldest element is replaced , the push returns STD_OK */
+	STD_OVERFLOW_REJECT             /**< the new element is dropped , the overflow call back is called and the push returns STD_BUFFER_FULL */
+}Std_OverflowPolicy_t;
+
+/**
+ * @brief the counters of a buffer.
+ */
+typedef struct
+{
+	u32 Pushed;       /**< elements stored since the start (with the ones that overwrote an older one) */
+	u32 Popped;       /**< elements read and removed since the start */
+	u16 Drops;        /**< elements not stored because the buffer was full (DROP_NEWEST , REJECT) */
+	u16 Overwrites;   /**< old elements lost because the buffer was full (OVERWRITE_OLDEST) */
+	u8  Peak;         /**< max number of elements in the buffer */
+}Std_BufferStats_t;
+
+#endif /* STD_BUFFER_H_ */
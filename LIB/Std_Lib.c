@@ -24,4 +24,212 @@ void Str_ReverseWithLen(u8 str[],u8 len)
 		str[i]=str[j];
 		str[j]=temp;
 	}
-}
\ No newline at end of file
+}
+
+
+/*
+ * flags of a conversion of Std_vPrintf
+ */
+#define PRINTF_FLAG_LEFT     0x01   /**< '-' : pad on the right */
+#define PRINTF_FLAG_ZERO     0x02   /**< '0' : pad with zeros */
+#define PRINTF_FLAG_LONG     0x04   /**< 'l' : 32-bit value */
+#define PRINTF_FLAG_UPPER    0x08   /**< 'X' : upper case hex digits */
+
+/**
+ * @brief Writes a number with its padding to the sink.
+ *
+ * @param sink the function that takes the output characters.
+ * @param value the absolute value of the number.
+ * @param negative 1 to write a '-' sign.
+ * @param base 10 or 16.
+ * @param width the minimum number of characters.
+ * @param flags PRINTF_FLAG_xxx.
+ * @return u16 the number of characters written.
+ */
+static u16 Std_PrintNumber(Ptr_VoidFuncU8_t sink, u32 value, u8 negative, u8 base, u8 width, u8 flags)
+{
+	u8 digits[10]; // 4294967295 has 10 digits
+	u8 count=0, len, digit;
+	u16 value16;
+	u16 written=0;
+
+	// the 16-bit division is ~4 times faster than the 32-bit one on the AVR , use it as soon as the value fits
+	while(value > 0xFFFF)
+	{
+		digit=(u8)(value % base);
+		value/=base;
+		digits[count++]=digit;
+	}
+	value16=(u16)value;
+	do
+	{
+		digit=(u8)(value16 % base);
+		value16/=base;
+		digits[count++]=digit;
+	}while(0 != value16);
+
+	len=count+negative;
+	if((0 != negative) && (flags & PRINTF_FLAG_ZERO))
+	{
+		sink('-');
+		written++;
+	}
+	if(0 == (flags & PRINTF_FLAG_LEFT))
+	{
+		for(; width>len; width--)
+		{
+			sink((flags & PRINTF_FLAG_ZERO) ? '0' : ' ');
+			written++;
+		}
+	}
+	if((0 != negative) && (0 == (flags & PRINTF_FLAG_ZERO)))
+	{
+		sink('-');
+		written++;
+	}
+	while(count > 0)
+	{
+		count--;
+		digit=digits[count];
+		sink((digit < 10) ? ('0'+digit) : (((flags & PRINTF_FLAG_UPPER) ? 'A' : 'a')+digit-10));
+		written++;
+	}
+	for(; width>len; width--)
+	{
+		sink(' ');
+		written++;
+	}
+	return written;
+}
+
+/**
+ * @brief Same as Std_Printf with the values in a va_list (to write wrappers like UART_Printf).
+ *
+ * @param sink the function that takes the output characters.
+ * @param format the format string.
+ * @param args the values of the conversions.
+ * @return u16 the number of characters passed to the sink.
+ */
+u16 Std_vPrintf(Ptr_VoidFuncU8_t sink, const char *format, va_list args)
+{
+	const char *str;
+	u16 written=0;
+	u8 flags, width, len;
+	s32 sValue;
+	u32 uValue;
+
+	for(; NULL_CHAR != *format; format++)
+	{
+		if('%' != *format)
+		{
+			sink(*format);
+			written++;
+			continue;
+		}
+
+		// flags , width and length modifier
+		format++;
+		flags=0;
+		width=0;
+		for(; ('-' == *format) || ('0' == *format); format++)
+		{
+			flags|=('-' == *format) ? PRINTF_FLAG_LEFT : PRINTF_FLAG_ZERO;
+		}
+		for(; (*format >= '0') && (*format <= '9'); format++)
+		{
+			width=(u8)(width*10+(*format-'0'));
+		}
+		if('l' == *format)
+		{
+			flags|=PRINTF_FLAG_LONG;
+			format++;
+		}
+		if(flags & PRINTF_FLAG_LEFT)
+		{
+			flags&=(u8)~PRINTF_FLAG_ZERO;
+		}
+
+		switch(*format)
+		{
+		case 'd':
+		case 'i':
+			sValue=(flags & PRINTF_FLAG_LONG) ? va_arg(args, s32) : (s32)va_arg(args, int);
+			uValue=(sValue < 0) ? (u32)0-(u32)sValue : (u32)sValue;
+			written+=Std_PrintNumber(sink, uValue, (sValue < 0) ? 1 : 0, 10, width, flags);
+			break;
+		case 'u':
+		case 'x':
+		case 'X':
+			uValue=(flags & PRINTF_FLAG_LONG) ? va_arg(args, u32) : (u32)va_arg(args, unsigned int);
+			if('X' == *format)
+			{
+				flags|=PRINTF_FLAG_UPPER;
+			}
+			written+=Std_PrintNumber(sink, uValue, 0, ('u' == *format) ? 10 : 16, width, flags);
+			break;
+		case 's':
+			str=va_arg(args, const char*);
+			if(NULL_PTR == str)
+			{
+				str="(null)";
+			}
+			for(len=0; (len < 255) && (NULL_CHAR != str[len]); len++);
+			if(0 == (flags & PRINTF_FLAG_LEFT))
+			{
+				for(; width>len; width--)
+				{
+					sink(' ');
+					written++;
+				}
+			}
+			for(; NULL_CHAR != *str; str++)
+			{
+				sink(*str);
+				written++;
+			}
+			for(; width>len; width--)
+			{
+				sink(' ');
+				written++;
+			}
+			break;
+		case 'c':
+			sink((u8)va_arg(args, int));
+			written++;
+			break;
+		case '%':
+			sink('%');
+			written++;
+			break;
+		case NULL_CHAR:
+			// '%' at the end of the format
+			return written;
+		default:
+			// unsupported conversion : written as it is
+			sink('%');
+			sink(*format);
+			written+=2;
+			break;
+		}
+	}
+	return written;
+}
+
+/**
+ * @brief Formatted output to a sink function , a small printf without heap , buffer or vfprintf.
+ *
+ * @param sink the function that takes the output characters.
+ * @param format the format string.
+ * @param ... the values of the conversions.
+ * @return u16 the number of characters passed to the sink.
+ */
+u16 Std_Printf(Ptr_VoidFuncU8_t sink, const char *format, ...)
+{
+	va_list args;
+	u16 written;
+
+	va_start(args, format);
+	written=Std_vPrintf(sink, format, args);
+	va_end(args);
+	return written;
+}
@@ -0,0 +1,247 @@
+/**
+ * @file Std_Pool.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the functions of the fixed block memory pools.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Std_Types.h"
+#include "Utils_interrupt.h"
+#include "Std_Pool.h"
+#include "Std_Pool_Lcfg.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                         Configuration (Std_Pool_Lcfg.c)                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+extern Std_Pool_t * const Std_Pool_arrClasses[STD_POOL_CLASS_COUNT];
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+/**
+ * @brief Initializes a pool on a buffer , all the blocks are free.
+ *
+ * @param pool the pool.
+ * @param buffer STD_POOL_BUFFER_SIZE(blockSize, blockCount) bytes : the blocks then the map of the allocated blocks.
+ * @param blockSize bytes of one block (1..65535).
+ * @param blockCount the number of blocks (1..254).
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER , STD_INVALID_ARG.
+ */
+Std_Error_t Std_PoolInit(Std_Pool_t *pool, void *buffer, u16 blockSize, u8 blockCount)
+{
+	u8 i;
+
+	if((NULL_PTR == pool) || (NULL_PTR == buffer))
+	{
+		return STD_NULL_POINTER;
+	}
+	if((0 == blockSize) || (0 == blockCount) || (STD_POOL_NONE == blockCount))
+	{
+		return STD_INVALID_ARG;
+	}
+	pool->Blocks = (u8*)buffer;
+	pool->UsedMap = &pool->Blocks[(u16)blockSize * blockCount];
+	for(i=0; i < STD_POOL_MAP_SIZE(blockCount); i++)
+	{
+		pool->UsedMap[i] = 0;
+	}
+	pool->BlockSize = blockSize;
+	pool->BlockCount = blockCount;
+	pool->Fresh = 0;
+	pool->FreeHead = STD_POOL_NONE;
+	pool->Used = 0;
+	pool->Peak = 0;
+	pool->Fails = 0;
+	return STD_OK;
+}
+
+/**
+ * @brief Takes a block of a pool (ISR safe , O(1)).
+ *
+ * @param pool the pool.
+ * @return void* the block (BlockSize bytes , not cleared) , NULL_PTR if the pool is empty.
+ */
+void* Std_PoolAllocBlock(Std_Pool_t *pool)
+{
+	u8 *block = NULL_PTR;
+	u8 sregCopy, index = 0;
+
+	if(NULL_PTR == pool)
+	{
+		return NULL_PTR;
+	}
+
+	Critical_Enter(sregCopy);
+	if(STD_POOL_NONE != pool->FreeHead)
+	{
+		// the freed blocks first , the first byte of a free block is the index of the next one
+		index = pool->FreeHead;
+		block = &pool->Blocks[(u16)index * pool->BlockSize];
+		pool->FreeHead = block[0];
+	}
+	else if(pool->Fresh < pool->BlockCount)
+	{
+		index = pool->Fresh;
+		block = &pool->Blocks[(u16)index * pool->BlockSize];
+		pool->Fresh++;
+	}
+	else
+	{
+		pool->Fails++;
+	}
+	if(NULL_PTR != block)
+	{
+		pool->UsedMap[index >> 3] |= (u8)(1 << (index & 7));
+		pool->Used++;
+		if(pool->Used > pool->Peak)
+		{
+			pool->Peak = pool->Used;
+		}
+	}
+	Critical_Exit(sregCopy);
+
+	return block;
+}
+
+/**
+ * @brief Gives a block back to its pool (ISR safe , O(1)).
+ *
+ * @param pool the pool.
+ * @param block a block given by Std_PoolAllocBlock of this pool.
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER ,
+ *         STD_OUT_OF_RANGE (not a block of this pool) , STD_INVALID_ARG (not the start of a block) ,
+ *         STD_NOT_EXIST (the block is not allocated : double free , the pool is not changed).
+ */
+Std_Error_t Std_PoolFreeBlock(Std_Pool_t *pool, void *block)
+{
+	Std_Error_t error = STD_OK;
+	u16 offset;
+	u8 sregCopy, index, mask;
+
+	if((NULL_PTR == pool) || (NULL_PTR == block))
+	{
+		return STD_NULL_POINTER;
+	}
+	if(((u8*)block < pool->Blocks) || ((u8*)block >= &pool->Blocks[(u16)pool->BlockCount * pool->BlockSize]))
+	{
+		return STD_OUT_OF_RANGE;
+	}
+	// the division is out of the critical section
+	offset = (u16)((u8*)block - pool->Blocks);
+	index = (u8)(offset / pool->BlockSize);
+	if(((u16)index * pool->BlockSize) != offset)
+	{
+		return STD_INVALID_ARG;
+	}
+
+	mask = (u8)(1 << (index & 7));
+
+	Critical_Enter(sregCopy);
+	if(0 == (pool->UsedMap[index >> 3] & mask))
+	{
+		// linking a free block twice would give it to two owners
+		error = STD_NOT_EXIST;
+	}
+	else
+	{
+		pool->UsedMap[index >> 3] &= (u8)~mask;
+		((u8*)block)[0] = pool->FreeHead;
+		pool->FreeHead = index;
+		pool->Used--;
+	}
+	Critical_Exit(sregCopy);
+
+	return error;
+}
+
+/**
+ * @brief Copies the counters of a pool.
+ *
+ * @param pool the pool.
+ * @param stats where the counters are copied.
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER.
+ */
+Std_Error_t Std_PoolGetStats(const Std_Pool_t *pool, Std_PoolStats_t *stats)
+{
+	u8 sregCopy;
+
+	if((NULL_PTR == pool) || (NULL_PTR == stats))
+	{
+		return STD_NULL_POINTER;
+	}
+	stats->BlockSize = pool->BlockSize;
+	stats->BlockCount = pool->BlockCount;
+	Critical_Enter(sregCopy);
+	stats->Used = pool->Used;
+	stats->Peak = pool->Peak;
+	stats->Fails = pool->Fails;
+	Critical_Exit(sregCopy);
+	return STD_OK;
+}
+
+/**
+ * @brief Takes a block of the smallest class of Std_Pool_Lcfg.h that fits size and has a free block (ISR safe).
+ *
+ * @param size the bytes needed.
+ * @return void* the block , NULL_PTR if no class can give one (every empty class that fits counts a fail).
+ */
+void* Std_PoolAlloc(u16 size)
+{
+	void *block = NULL_PTR;
+	u8 i;
+
+	for(i=0; (i < STD_POOL_CLASS_COUNT) && (NULL_PTR == block); i++)
+	{
+		if(size <= Std_Pool_arrClasses[i]->BlockSize)
+		{
+			block = Std_PoolAllocBlock(Std_Pool_arrClasses[i]);
+		}
+	}
+	return block;
+}
+
+/**
+ * @brief Gives a block of Std_PoolAlloc back to its class (ISR safe).
+ *
+ * @param block the block , NULL_PTR is ignored.
+ * @return Std_Error_t STD_OK , STD_OUT_OF_RANGE (not a block of the classes) , STD_INVALID_ARG (not the start of a block) ,
+ *         STD_NOT_EXIST (the block is not allocated : double free).
+ */
+Std_Error_t Std_PoolFree(void *block)
+{
+	Std_Error_t error = STD_OUT_OF_RANGE;
+	u8 i;
+
+	if(NULL_PTR == block)
+	{
+		return STD_OK;
+	}
+	for(i=0; (i < STD_POOL_CLASS_COUNT) && (STD_OUT_OF_RANGE == error); i++)
+	{
+		error = Std_PoolFreeBlock(Std_Pool_arrClasses[i], block);
+	}
+	return error;
+}
+
+/**
+ * @brief Copies the counters of a class of Std_Pool_Lcfg.h.
+ *
+ * @param classIndex 0 .. STD_POOL_CLASS_COUNT - 1 (the classes are sorted by block size).
+ * @param stats where the counters are copied.
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER , STD_OUT_OF_RANGE.
+ */
+Std_Error_t Std_PoolGetClassStats(u8 classIndex, Std_PoolStats_t *stats)
+{
+	if(classIndex >= STD_POOL_CLASS_COUNT)
+	{
+		return STD_OUT_OF_RANGE;
+	}
+	return Std_PoolGetStats(Std_Pool_arrClasses[classIndex], stats);
+}
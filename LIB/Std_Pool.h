@@ -0,0 +1,159 @@
+/**
+ * @file Std_Pool.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Fixed block memory pools : a deterministic replacement of malloc for the buffers that live only while
+ *         a frame or an event is in flight.
+ *
+ * A pool is an array of BlockCount blocks of BlockSize bytes :
+ *  - the free blocks are chained by their first byte (index of the next free block) ,
+ *  - the blocks never used are taken from the end of the array (Fresh) : a static pool needs no init ,
+ *  - an alloc and a free are O(1) and run in a critical section of a few instructions (they can be called by an ISR) ,
+ *  - there is no fragmentation : a block is always BlockSize bytes ,
+ *  - one bit per block (UsedMap , after the blocks) is set while the block is allocated : a double free is refused.
+ *
+ * The size classes of Std_Pool_Lcfg.h share the RAM of the buffers of all the modules :
+ * Std_PoolAlloc takes a block of the smallest class that fits and has a free block , Std_PoolFree finds its class.
+ *EX:
+ *	u8 *frame = Std_PoolAlloc(len);
+ *	if(NULL_PTR != frame) { fill , send , Std_PoolFree(frame) when the send is done }
+ *
+ * Std_PoolGetClassStats gives the peak of every class , a class that never reached its count can be made smaller.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef STD_POOL_H_
+#define STD_POOL_H_
+
+#include "Std_Types.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define STD_POOL_NONE     0xFF    /**< end of the free list , a pool has 1..254 blocks */
+
+/* bytes of the map of the allocated blocks and of the whole buffer of a pool (blocks then map) */
+#define STD_POOL_MAP_SIZE(blockCount)                  (((blockCount) + 7) / 8)
+#define STD_POOL_BUFFER_SIZE(blockSize, blockCount)    ((u16)(blockSize) * (blockCount) + STD_POOL_MAP_SIZE(blockCount))
+
+/**
+ * @brief Creates a static pool and its blocks (usable without Std_PoolInit).
+ *
+ * @param name the name of the instance (name##_arrBlocks is its storage).
+ * @param blockSize bytes of one block (1..65535).
+ * @param blockCount the number of blocks (1..254 , checked at compile time).
+ */
+#define STD_POOL_DEFINE(name, blockSize, blockCount)                                                 \
+	typedef u8 name##_CountCheck_t[(((blockCount) >= 1) && ((blockCount) < STD_POOL_NONE) && ((blockSize) >= 1)) ? 1 : -1]; \
+	static u8 name##_arrBlocks[STD_POOL_BUFFER_SIZE(blockSize, blockCount)];                         \
+	static Std_Pool_t name = {name##_arrBlocks, &name##_arrBlocks[(u16)(blockSize) * (blockCount)],  \
+	                          (u16)(blockSize), (u8)(blockCount), 0, STD_POOL_NONE, 0, 0, 0}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief one pool of blocks of the same size.
+ */
+typedef struct
+{
+	u8 *Blocks;        /**< BlockSize * BlockCount bytes */
+	u8 *UsedMap;       /**< one bit per block , set while the block is allocated */
+	u16 BlockSize;     /**< bytes of one block */
+	u8  BlockCount;    /**< number of blocks (1..254) */
+	u8  Fresh;         /**< the blocks from Fresh to the end were never allocated */
+	u8  FreeHead;      /**< the first freed block , STD_POOL_NONE if none */
+	u8  Used;          /**< blocks allocated now */
+	u8  Peak;          /**< max blocks allocated at the same time (high-water mark) */
+	u16 Fails;         /**< allocations asked when the pool was empty (Std_PoolAlloc may have used a bigger class) */
+}Std_Pool_t;
+
+/**
+ * @brief the counters of a pool.
+ */
+typedef struct
+{
+	u16 BlockSize;     /**< bytes of one block */
+	u8  BlockCount;    /**< number of blocks */
+	u8  Used;          /**< blocks allocated now */
+	u8  Peak;          /**< max blocks allocated at the same time */
+	u16 Fails;         /**< allocations refused */
+}Std_PoolStats_t;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+/**
+ * @brief Initializes a pool on a buffer , all the blocks are free.
+ *
+ * @param pool the pool.
+ * @param buffer STD_POOL_BUFFER_SIZE(blockSize, blockCount) bytes : the blocks then the map of the allocated blocks.
+ * @param blockSize bytes of one block (1..65535).
+ * @param blockCount the number of blocks (1..254).
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER , STD_INVALID_ARG.
+ */
+Std_Error_t Std_PoolInit(Std_Pool_t *pool, void *buffer, u16 blockSize, u8 blockCount);
+
+/**
+ * @brief Takes a block of a pool (ISR safe , O(1)).
+ *
+ * @param pool the pool.
+ * @return void* the block (BlockSize bytes , not cleared) , NULL_PTR if the pool is empty.
+ */
+void* Std_PoolAllocBlock(Std_Pool_t *pool);
+
+/**
+ * @brief Gives a block back to its pool (ISR safe , O(1)).
+ *
+ * @param pool the pool.
+ * @param block a block given by Std_PoolAllocBlock of this pool.
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER ,
+ *         STD_OUT_OF_RANGE (not a block of this pool) , STD_INVALID_ARG (not the start of a block) ,
+ *         STD_NOT_EXIST (the block is not allocated : double free , the pool is not changed).
+ */
+Std_Error_t Std_PoolFreeBlock(Std_Pool_t *pool, void *block);
+
+/**
+ * @brief Copies the counters of a pool.
+ *
+ * @param pool the pool.
+ * @param stats where the counters are copied.
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER.
+ */
+Std_Error_t Std_PoolGetStats(const Std_Pool_t *pool, Std_PoolStats_t *stats);
+
+/**
+ * @brief Takes a block of the smallest class of Std_Pool_Lcfg.h that fits size and has a free block (ISR safe).
+ *
+ * @param size the bytes needed.
+ * @return void* the block , NULL_PTR if no class can give one (every empty class that fits counts a fail).
+ */
+void* Std_PoolAlloc(u16 size);
+
+/**
+ * @brief Gives a block of Std_PoolAlloc back to its class (ISR safe).
+ *
+ * @param block the block , NULL_PTR is ignored.
+ * @return Std_Error_t STD_OK , STD_OUT_OF_RANGE (not a block of the classes) , STD_INVALID_ARG (not the start of a block) ,
+ *         STD_NOT_EXIST (the block is not allocated : double free).
+ */
+Std_Error_t Std_PoolFree(void *block);
+
+/**
+ * @brief Copies the counters of a class of Std_Pool_Lcfg.h.
+ *
+ * @param classIndex 0 .. STD_POOL_CLASS_COUNT - 1 (the classes are sorted by block size).
+ * @param stats where the counters are copied.
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER , STD_OUT_OF_RANGE.
+ */
+Std_Error_t Std_PoolGetClassStats(u8 classIndex, Std_PoolStats_t *stats);
+
+#endif /* STD_POOL_H_ */
@@ -0,0 +1,38 @@
+/**
+ * @file Std_Pool_Lcfg.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  this file contains the memory pools of the size classes of Std_PoolAlloc
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+* LIB
+*/
+#include "Std_Types.h"
+
+/*
+* Include own files
+*/
+#include "Std_Pool.h"
+#include "Std_Pool_Lcfg.h"
+
+/*
+* the pools of the classes
+*/
+STD_POOL_DEFINE(Std_Pool_Class0, STD_POOL_CLASS0_SIZE, STD_POOL_CLASS0_COUNT);
+STD_POOL_DEFINE(Std_Pool_Class1, STD_POOL_CLASS1_SIZE, STD_POOL_CLASS1_COUNT);
+STD_POOL_DEFINE(Std_Pool_Class2, STD_POOL_CLASS2_SIZE, STD_POOL_CLASS2_COUNT);
+
+/*
+*  sorted by block size : Std_PoolAlloc takes the first class that fits and has a free block.
+*/
+Std_Pool_t * const Std_Pool_arrClasses[STD_POOL_CLASS_COUNT] =
+{
+	&Std_Pool_Class0,
+	&Std_Pool_Class1,
+	&Std_Pool_Class2,
+};
@@ -0,0 +1,35 @@
+/**
+ * @file Std_Pool_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  this file contains the size classes of the memory pools of Std_PoolAlloc
+ *          - the number of classes
+ *          - the block size and the number of blocks of every class (the pools are in Std_Pool_Lcfg.c)
+ *         the RAM of the pools is the sum of size * count (+ 1 bit per block) , set the counts from the peaks of Std_PoolGetClassStats.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef STD_POOL_LCFG_H_
+#define STD_POOL_LCFG_H_
+
+#include "Std_Types.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                           Configuration Macros                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define STD_POOL_CLASS_COUNT     3      /**< number of entries of Std_Pool_arrClasses (Std_Pool_Lcfg.c) */
+
+/* the classes from the smallest block to the biggest : 128 + 128 + 128 = 384 bytes of RAM (+ 3 bytes of maps) */
+#define STD_POOL_CLASS0_SIZE     16     /**< events , short commands */
+#define STD_POOL_CLASS0_COUNT    8
+#define STD_POOL_CLASS1_SIZE     32     /**< UART frames , LCD lines */
+#define STD_POOL_CLASS1_COUNT    4
+#define STD_POOL_CLASS2_SIZE     64     /**< long frames */
+#define STD_POOL_CLASS2_COUNT    2
+
+
+#endif /* STD_POOL_LCFG_H_ */
@@ -0,0 +1,299 @@
+/**
+ * @file Std_Queue.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the generic functions of the fixed size queue.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Std_Types.h"
+#include "Utils_interrupt.h"
+#include "Std_Buffer.h"
+#include "Std_Queue.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                        Static Private Functions                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief Copies count elements between a flat block and the ring of the queue , from the element index (two parts at the end of the ring).
+ *
+ * @param toRing STD_TRUE : block -> ring , STD_FALSE : ring -> block.
+ */
+static void Std_QueueCopy(const Std_Queue_t *queue, u8 index, u8 *block, u8 count, Std_Bool_t toRing)
+{
+	u16 size = (u16)count * queue->ElementSize;
+	u16 offset = (u16)index * queue->ElementSize;
+	u16 end = (u16)queue->Capacity * queue->ElementSize;
+
+	while(0 != size)
+	{
+		if(STD_TRUE == toRing)
+		{
+			queue->Buffer[offset] = *block;
+		}
+		else
+		{
+			*block = queue->Buffer[offset];
+		}
+		block++;
+		offset++;
+		if(end == offset)
+		{
+			offset = 0;
+		}
+		size--;
+	}
+}
+
+/**
+ * @brief Returns the index of the ring count elements after index.
+ */
+static u8 Std_QueueIndexForward(const Std_Queue_t *queue, u8 index, u8 count)
+{
+	return ((u16)index + count >= queue->Capacity) ? (u8)(index + count - queue->Capacity) : (u8)(index + count);
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+/**
+ * @brief Initializes an empty queue on a buffer.
+ *
+ * @param queue the queue.
+ * @param buffer capacity * elementSize bytes , owned by the queue until it is not used anymore.
+ * @param elementSize bytes of one element (1..255).
+ * @param capacity max number of elements (1..255).
+ * @param policy what a push on a full queue does.
+ * @param pfOverflow the call back of STD_OVERFLOW_REJECT (NULL_PTR : none).
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER , STD_INVALID_ARG.
+ */
+Std_Error_t Std_QueueInit(Std_Queue_t *queue, void *buffer, u8 elementSize, u8 capacity, Std_OverflowPolicy_t policy, Ptr_VoidFuncVoid_t pfOverflow)
+{
+	if((NULL_PTR == queue) || (NULL_PTR == buffer))
+	{
+		return STD_NULL_POINTER;
+	}
+	if((0 == elementSize) || (0 == capacity) || (policy > STD_OVERFLOW_REJECT))
+	{
+		return STD_INVALID_ARG;
+	}
+	queue->Buffer = (u8*)buffer;
+	queue->ElementSize = elementSize;
+	queue->Capacity = capacity;
+	queue->Count = 0;
+	queue->Head = 0;
+	queue->Tail = 0;
+	queue->Policy = policy;
+	queue->pfOverflow = pfOverflow;
+	queue->Stats.Pushed = 0;
+	queue->Stats.Popped = 0;
+	queue->Stats.Drops = 0;
+	queue->Stats.Overwrites = 0;
+	queue->Stats.Peak = 0;
+	return STD_OK;
+}
+
+/**
+ * @brief Copies one element at the end of the queue.
+ *
+ * @param queue the queue.
+ * @param element ElementSize bytes.
+ * @return Std_Error_t STD_OK , STD_BUFFER_FULL (dropped as the policy says) , STD_NULL_POINTER.
+ */
+Std_Error_t Std_QueuePush(Std_Queue_t *queue, const void *element)
+{
+	return Std_QueuePushN(queue, element, 1);
+}
+
+/**
+ * @brief Copies the oldest element and removes it.
+ *
+ * @param queue the queue.
+ * @param element ElementSize bytes.
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY , STD_NULL_POINTER.
+ */
+Std_Error_t Std_QueuePop(Std_Queue_t *queue, void *element)
+{
+	return Std_QueuePopN(queue, element, 1);
+}
+
+/**
+ * @brief Copies the oldest element without removing it.
+ *
+ * @param queue the queue.
+ * @param element ElementSize bytes.
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY , STD_NULL_POINTER.
+ */
+Std_Error_t Std_QueuePeek(const Std_Queue_t *queue, void *element)
+{
+	if((NULL_PTR == queue) || (NULL_PTR == element))
+	{
+		return STD_NULL_POINTER;
+	}
+	if(0 == queue->Count)
+	{
+		return STD_BUFFER_EMPTY;
+	}
+	Std_QueueCopy(queue, queue->Tail, (u8*)element, 1, STD_FALSE);
+	return STD_OK;
+}
+
+/**
+ * @brief Copies a block of elements at the end of the queue with one bound check : all of them or none ,
+ *        with STD_OVERFLOW_OVERWRITE_OLDEST the oldest elements make room.
+ *
+ * @param queue the queue.
+ * @param elements count * ElementSize bytes.
+ * @param count the number of elements (1..Capacity).
+ * @return Std_Error_t STD_OK , STD_BUFFER_FULL (nothing is pushed) , STD_NULL_POINTER , STD_INVALID_ARG.
+ */
+Std_Error_t Std_QueuePushN(Std_Queue_t *queue, const void *elements, u8 count)
+{
+	u8 room;
+
+	if((NULL_PTR == queue) || (NULL_PTR == elements))
+	{
+		return STD_NULL_POINTER;
+	}
+	if((0 == count) || (count > queue->Capacity))
+	{
+		return STD_INVALID_ARG;
+	}
+	room = queue->Capacity - queue->Count;
+	if((count > room) && (STD_OVERFLOW_OVERWRITE_OLDEST != queue->Policy))
+	{
+		return Std_QueueOverflow(queue, count);
+	}
+
+	Std_QueueCopy(queue, queue->Head, (u8*)elements, count, STD_TRUE);
+	queue->Head = Std_QueueIndexForward(queue, queue->Head, count);
+	if(count > room)
+	{
+		// the oldest elements were replaced : the queue is full and starts at Head
+		queue->Stats.Overwrites += count - room;
+		queue->Count = queue->Capacity;
+		queue->Tail = queue->Head;
+	}
+	else
+	{
+		queue->Count += count;
+	}
+	queue->Stats.Pushed += count;
+	if(queue->Count > queue->Stats.Peak)
+	{
+		queue->Stats.Peak = queue->Count;
+	}
+	return STD_OK;
+}
+
+/**
+ * @brief Removes the count oldest elements with one bound check : all of them or none (elements[0] is the oldest).
+ *
+ * @param queue the queue.
+ * @param elements count * ElementSize bytes.
+ * @param count the number of elements.
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY (less than count elements , nothing is popped) , STD_NULL_POINTER.
+ */
+Std_Error_t Std_QueuePopN(Std_Queue_t *queue, void *elements, u8 count)
+{
+	if((NULL_PTR == queue) || (NULL_PTR == elements))
+	{
+		return STD_NULL_POINTER;
+	}
+	if(count > queue->Count)
+	{
+		return STD_BUFFER_EMPTY;
+	}
+	Std_QueueCopy(queue, queue->Tail, (u8*)elements, count, STD_FALSE);
+	queue->Tail = Std_QueueIndexForward(queue, queue->Tail, count);
+	queue->Count -= count;
+	queue->Stats.Popped += count;
+	return STD_OK;
+}
+
+/**
+ * @brief Applies the policy of a refused push : counts the dropped elements and calls the REJECT call back.
+ *        Used by STD_QUEUE_PUSH , not by the application.
+ *
+ * @return Std_Error_t STD_BUFFER_FULL.
+ */
+Std_Error_t Std_QueueOverflow(Std_Queue_t *queue, u8 count)
+{
+	queue->Stats.Drops += count;
+	if((STD_OVERFLOW_REJECT == queue->Policy) && (NULL_PTR != queue->pfOverflow))
+	{
+		queue->pfOverflow();
+	}
+	return STD_BUFFER_FULL;
+}
+
+/**
+ * @brief Returns the number of elements in the queue (0 for a NULL queue).
+ */
+u8 Std_QueueGetCount(const Std_Queue_t *queue)
+{
+	return (NULL_PTR == queue) ? 0 : queue->Count;
+}
+
+/**
+ * @brief Removes all the elements (the counters are kept).
+ */
+void Std_QueueClear(Std_Queue_t *queue)
+{
+	u8 sregCopy;
+
+	if(NULL_PTR != queue)
+	{
+		Critical_Enter(sregCopy);
+		queue->Count = 0;
+		queue->Tail = queue->Head;
+		Critical_Exit(sregCopy);
+	}
+}
+
+/**
+ * @brief Copies the counters in a critical section : the pushes and the pops of the ISRs go on.
+ *
+ * @param queue the queue.
+ * @param stats where the counters are copied.
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER.
+ */
+Std_Error_t Std_QueueGetStats(const Std_Queue_t *queue, Std_BufferStats_t *stats)
+{
+	u8 sregCopy;
+
+	if((NULL_PTR == queue) || (NULL_PTR == stats))
+	{
+		return STD_NULL_POINTER;
+	}
+	// the 32-bit counters are not read in one instruction
+	Critical_Enter(sregCopy);
+	*stats = queue->Stats;
+	Critical_Exit(sregCopy);
+	return STD_OK;
+}
+
+/**
+ * @brief Clears the counters , the peak restarts from the current number of elements.
+ */
+void Std_QueueResetStats(Std_Queue_t *queue)
+{
+	u8 sregCopy;
+
+	if(NULL_PTR != queue)
+	{
+		Critical_Enter(sregCopy);
+		queue->Stats.Pushed = 0;
+		queue->Stats.Popped = 0;
+		queue->Stats.Drops = 0;
+		queue->Stats.Overwrites = 0;
+		queue->Stats.Peak = queue->Count;
+		Critical_Exit(sregCopy);
+	}
+}
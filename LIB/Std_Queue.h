@@ -0,0 +1,207 @@
+/**
+ * @file Std_Queue.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Fixed size FIFO queue (ring) , every instance owns its storage , its element size , its capacity ,
+ *         its overflow policy (Std_Buffer.h) and its counters. Same use as Std_Stack.h.
+ *EX:
+ *	static void App_RxFull(void) { UART_SendByteBusyWait(0x13); }   // XOFF
+ *	STD_QUEUE_DEFINE(App_Rx, u8, 32, STD_OVERFLOW_REJECT, App_RxFull);
+ *
+ *	ISR     : STD_QUEUE_PUSH(App_Rx, UART_ReceiveByteNoBlock());
+ *	main    : Critical_Enter(sregCopy); status = STD_QUEUE_POP(App_Rx, &data); Critical_Exit(sregCopy);
+ *	monitor : Std_QueueGetStats(&App_Rx, &stats);
+ *
+ * @note the queue is not protected against the interrupts , a queue used by an ISR and the main loop needs a critical section.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef STD_QUEUE_H_
+#define STD_QUEUE_H_
+
+#include "Std_Types.h"
+#include "Std_Buffer.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief one queue , the elements go in at Head and out at Tail.
+ */
+typedef struct
+{
+	u8 *Buffer;                    /**< Capacity * ElementSize bytes */
+	u8  ElementSize;               /**< bytes of one element */
+	u8  Capacity;                  /**< max number of elements (1..255) */
+	u8  Count;                     /**< number of elements */
+	u8  Head;                      /**< index of the next push */
+	u8  Tail;                      /**< index of the next pop (the oldest element) */
+	Std_OverflowPolicy_t Policy;   /**< what a push on a full queue does */
+	Ptr_VoidFuncVoid_t pfOverflow; /**< called by a refused push with STD_OVERFLOW_REJECT (can be NULL_PTR) */
+	Std_BufferStats_t Stats;       /**< the counters */
+}Std_Queue_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief Creates a static queue and its storage.
+ *
+ * @param name the name of the instance (name##_arrBuffer is its storage).
+ * @param type the type of the elements.
+ * @param capacity the max number of elements (1..255 , checked at compile time).
+ * @param policy Std_OverflowPolicy_t.
+ * @param pfOverflow the call back of STD_OVERFLOW_REJECT (NULL_PTR : none).
+ */
+#define STD_QUEUE_DEFINE(name, type, capacity, policy, pfOverflow)                                   \
+	typedef u8 name##_CapacityCheck_t[(((capacity) >= 1) && ((capacity) <= 255)) ? 1 : -1];          \
+	static type name##_arrBuffer[(capacity)];                                                        \
+	static Std_Queue_t name = {(u8*)name##_arrBuffer, (u8)sizeof(type), (u8)(capacity), 0, 0, 0, (policy), (pfOverflow), {0, 0, 0, 0, 0}}
+
+/* the index after i in the ring of the queue */
+#define STD_QUEUE_NEXT(name, i)     ((u8)((((i) + 1) == (name).Capacity) ? 0 : ((i) + 1)))
+
+/* the counters of a push (the element is already written at Head) , a full queue loses its oldest element */
+#define STD_QUEUE_COMMIT_PUSH(name)                                                                  \
+	((name).Head = STD_QUEUE_NEXT(name, (name).Head)),                                               \
+	(((name).Count < (name).Capacity) ? (void)((name).Count++) :                                     \
+	 (void)(((name).Tail = STD_QUEUE_NEXT(name, (name).Tail)), (name).Stats.Overwrites++)),          \
+	((name).Stats.Pushed++),                                                                         \
+	(((name).Count > (name).Stats.Peak) ? (void)((name).Stats.Peak = (name).Count) : (void)0)
+
+/**
+ * @brief Pushes a value in a queue created by STD_QUEUE_DEFINE.
+ * @return Std_Error_t STD_OK , STD_BUFFER_FULL (the value is dropped as the policy says).
+ */
+#define STD_QUEUE_PUSH(name, value)                                                                  \
+	((((name).Count < (name).Capacity) || (STD_OVERFLOW_OVERWRITE_OLDEST == (name).Policy)) ?        \
+	 ((name##_arrBuffer[(name).Head] = (value)), STD_QUEUE_COMMIT_PUSH(name), STD_OK) :              \
+	 Std_QueueOverflow(&(name), 1))
+
+/**
+ * @brief Pops the oldest value of a queue created by STD_QUEUE_DEFINE.
+ * @param pValue where the value is written.
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY (*pValue is not written).
+ */
+#define STD_QUEUE_POP(name, pValue)                                                                  \
+	((0 != (name).Count) ?                                                                           \
+	 ((*(pValue) = name##_arrBuffer[(name).Tail]), ((name).Tail = STD_QUEUE_NEXT(name, (name).Tail)), \
+	  ((name).Count--), ((name).Stats.Popped++), STD_OK) :                                           \
+	 STD_BUFFER_EMPTY)
+
+/**
+ * @brief Reads the oldest value of a queue created by STD_QUEUE_DEFINE without removing it.
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY.
+ */
+#define STD_QUEUE_PEEK(name, pValue)                                                                 \
+	((0 != (name).Count) ? ((*(pValue) = name##_arrBuffer[(name).Tail]), STD_OK) : STD_BUFFER_EMPTY)
+
+#define STD_QUEUE_COUNT(name)       ((name).Count)
+#define STD_QUEUE_IS_EMPTY(name)    (0 == (name).Count)
+#define STD_QUEUE_IS_FULL(name)     ((name).Capacity == (name).Count)
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+/**
+ * @brief Initializes an empty queue on a buffer.
+ *
+ * @param queue the queue.
+ * @param buffer capacity * elementSize bytes , owned by the queue until it is not used anymore.
+ * @param elementSize bytes of one element (1..255).
+ * @param capacity max number of elements (1..255).
+ * @param policy what a push on a full queue does.
+ * @param pfOverflow the call back of STD_OVERFLOW_REJECT (NULL_PTR : none).
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER , STD_INVALID_ARG.
+ */
+Std_Error_t Std_QueueInit(Std_Queue_t *queue, void *buffer, u8 elementSize, u8 capacity, Std_OverflowPolicy_t policy, Ptr_VoidFuncVoid_t pfOverflow);
+
+/**
+ * @brief Copies one element at the end of the queue.
+ *
+ * @param queue the queue.
+ * @param element ElementSize bytes.
+ * @return Std_Error_t STD_OK , STD_BUFFER_FULL (dropped as the policy says) , STD_NULL_POINTER.
+ */
+Std_Error_t Std_QueuePush(Std_Queue_t *queue, const void *element);
+
+/**
+ * @brief Copies the oldest element and removes it.
+ *
+ * @param queue the queue.
+ * @param element ElementSize bytes.
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY , STD_NULL_POINTER.
+ */
+Std_Error_t Std_QueuePop(Std_Queue_t *queue, void *element);
+
+/**
+ * @brief Copies the oldest element without removing it.
+ *
+ * @param queue the queue.
+ * @param element ElementSize bytes.
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY , STD_NULL_POINTER.
+ */
+Std_Error_t Std_QueuePeek(const Std_Queue_t *queue, void *element);
+
+/**
+ * @brief Copies a block of elements at the end of the queue with one bound check : all of them or none ,
+ *        with STD_OVERFLOW_OVERWRITE_OLDEST the oldest elements make room.
+ *
+ * @param queue the queue.
+ * @param elements count * ElementSize bytes.
+ * @param count the number of elements (1..Capacity).
+ * @return Std_Error_t STD_OK , STD_BUFFER_FULL (nothing is pushed) , STD_NULL_POINTER , STD_INVALID_ARG.
+ */
+Std_Error_t Std_QueuePushN(Std_Queue_t *queue, const void *elements, u8 count);
+
+/**
+ * @brief Removes the count oldest elements with one bound check : all of them or none (elements[0] is the oldest).
+ *
+ * @param queue the queue.
+ * @param elements count * ElementSize bytes.
+ * @param count the number of elements.
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY (less than count elements , nothing is popped) , STD_NULL_POINTER.
+ */
+Std_Error_t Std_QueuePopN(Std_Queue_t *queue, void *elements, u8 count);
+
+/**
+ * @brief Applies the policy of a refused push : counts the dropped elements and calls the REJECT call back.
+ *        Used by STD_QUEUE_PUSH , not by the application.
+ *
+ * @return Std_Error_t STD_BUFFER_FULL.
+ */
+Std_Error_t Std_QueueOverflow(Std_Queue_t *queue, u8 count);
+
+/**
+ * @brief Returns the number of elements in the queue (0 for a NULL queue).
+ */
+u8 Std_QueueGetCount(const Std_Queue_t *queue);
+
+/**
+ * @brief Removes all the elements (the counters are kept).
+ */
+void Std_QueueClear(Std_Queue_t *queue);
+
+/**
+ * @brief Copies the counters in a critical section : the pushes and the pops of the ISRs go on.
+ *
+ * @param queue the queue.
+ * @param stats where the counters are copied.
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER.
+ */
+Std_Error_t Std_QueueGetStats(const Std_Queue_t *queue, Std_BufferStats_t *stats);
+
+/**
+ * @brief Clears the counters , the peak restarts from the current number of elements.
+ */
+void Std_QueueResetStats(Std_Queue_t *queue);
+
+#endif /* STD_QUEUE_H_ */
@@ -0,0 +1,365 @@
+/**
+ * @file Std_Stack.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the generic functions of the fixed size stack.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Std_Types.h"
+#include "Utils_interrupt.h"
+#include "Std_Buffer.h"
+#include "Std_Stack.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                        Static Private Functions                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief Copies count elements between a flat block and the ring of the stack , from the element index (two parts at the end of the ring).
+ *
+ * @param toRing STD_TRUE : block -> ring , STD_FALSE : ring -> block.
+ */
+static void Std_StackCopy(const Std_Stack_t *stack, u8 index, u8 *block, u8 count, Std_Bool_t toRing)
+{
+	u16 size = (u16)count * stack->ElementSize;
+	u16 offset = (u16)index * stack->ElementSize;
+	u16 end = (u16)stack->Capacity * stack->ElementSize;
+
+	while(0 != size)
+	{
+		if(STD_TRUE == toRing)
+		{
+			stack->Buffer[offset] = *block;
+		}
+		else
+		{
+			*block = stack->Buffer[offset];
+		}
+		block++;
+		offset++;
+		if(end == offset)
+		{
+			offset = 0;
+		}
+		size--;
+	}
+}
+
+/**
+ * @brief Returns the index of the ring count elements before index.
+ */
+static u8 Std_StackIndexBack(const Std_Stack_t *stack, u8 index, u8 count)
+{
+	return (index >= count) ? (u8)(index - count) : (u8)(index + stack->Capacity - count);
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+/**
+ * @brief Initializes an empty stack on a buffer.
+ *
+ * @param stack the stack.
+ * @param buffer capacity * elementSize bytes , owned by the stack until it is not used anymore.
+ * @param elementSize bytes of one element (1..255).
+ * @param capacity max number of elements (1..255).
+ * @param policy what a push on a full stack does.
+ * @param pfOverflow the call back of STD_OVERFLOW_REJECT (NULL_PTR : none).
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER , STD_INVALID_ARG.
+ */
+Std_Error_t Std_StackInit(Std_Stack_t *stack, void *buffer, u8 elementSize, u8 capacity, Std_OverflowPolicy_t policy, Ptr_VoidFuncVoid_t pfOverflow)
+{
+	if((NULL_PTR == stack) || (NULL_PTR == buffer))
+	{
+		return STD_NULL_POINTER;
+	}
+	if((0 == elementSize) || (0 == capacity) || (policy > STD_OVERFLOW_REJECT))
+	{
+		return STD_INVALID_ARG;
+	}
+	stack->Buffer = (u8*)buffer;
+	stack->ElementSize = elementSize;
+	stack->Capacity = capacity;
+	stack->Top = 0;
+	stack->Head = 0;
+	stack->Policy = policy;
+	stack->pfOverflow = pfOverflow;
+	stack->Stats.Pushed = 0;
+	stack->Stats.Popped = 0;
+	stack->Stats.Drops = 0;
+	stack->Stats.Overwrites = 0;
+	stack->Stats.Peak = 0;
+	return STD_OK;
+}
+
+/**
+ * @brief Copies one element on the top of the stack.
+ *
+ * @param stack the stack.
+ * @param element ElementSize bytes.
+ * @return Std_Error_t STD_OK , STD_BUFFER_FULL (dropped as the policy says) , STD_NULL_POINTER.
+ */
+Std_Error_t Std_StackPush(Std_Stack_t *stack, const void *element)
+{
+	return Std_StackPushN(stack, element, 1);
+}
+
+/**
+ * @brief Copies the top element and removes it.
+ *
+ * @param stack the stack.
+ * @param element ElementSize bytes.
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY , STD_NULL_POINTER.
+ */
+Std_Error_t Std_StackPop(Std_Stack_t *stack, void *element)
+{
+	return Std_StackPopN(stack, element, 1);
+}
+
+/**
+ * @brief Copies the top element without removing it.
+ *
+ * @param stack the stack.
+ * @param element ElementSize bytes.
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY , STD_NULL_POINTER.
+ */
+Std_Error_t Std_StackPeek(const Std_Stack_t *stack, void *element)
+{
+	return Std_StackPeekN(stack, element, 1);
+}
+
+/**
+ * @brief Copies a block of elements on the stack with one bound check : all of them or none.
+ *        elements[count - 1] becomes the top , with STD_OVERFLOW_OVERWRITE_OLDEST the oldest elements make room.
+ *
+ * @param stack the stack.
+ * @param elements count * ElementSize bytes.
+ * @param count the number of elements (1..Capacity).
+ * @return Std_Error_t STD_OK , STD_BUFFER_FULL (nothing is pushed) , STD_NULL_POINTER , STD_INVALID_ARG.
+ */
+Std_Error_t Std_StackPushN(Std_Stack_t *stack, const void *elements, u8 count)
+{
+	Std_Error_t error;
+	u8 index;
+
+	if(NULL_PTR == elements)
+	{
+		return STD_NULL_POINTER;
+	}
+	error = Std_StackReserveN(stack, count, &index);
+	if(STD_OK == error)
+	{
+		Std_StackWriteAt(stack, index, elements, count);
+	}
+	return error;
+}
+
+/**
+ * @brief Removes the count top elements with one bound check : all of them or none.
+ *        The block keeps the order of the stack (elements[count - 1] was the top) ,
+ *        the block of a Std_StackPushN is given back as it was pushed.
+ *
+ * @param stack the stack.
+ * @param elements count * ElementSize bytes.
+ * @param count the number of elements.
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY (less than count elements , nothing is popped) , STD_NULL_POINTER.
+ */
+Std_Error_t Std_StackPopN(Std_Stack_t *stack, void *elements, u8 count)
+{
+	Std_Error_t error = Std_StackPeekN(stack, elements, count);
+
+	if(STD_OK == error)
+	{
+		error = Std_StackRemoveN(stack, count);
+	}
+	return error;
+}
+
+/**
+ * @brief First half of Std_StackPushN : applies the policy , updates the counters and reserves count elements.
+ *        The caller writes them with Std_StackWriteAt (ex: out of a critical section).
+ *
+ * @param stack the stack.
+ * @param count the number of elements (1..Capacity).
+ * @param pIndex the index of the first reserved element.
+ * @return Std_Error_t STD_OK , STD_BUFFER_FULL (nothing is reserved) , STD_NULL_POINTER , STD_INVALID_ARG.
+ */
+Std_Error_t Std_StackReserveN(Std_Stack_t *stack, u8 count, u8 *pIndex)
+{
+	u8 room;
+
+	if((NULL_PTR == stack) || (NULL_PTR == pIndex))
+	{
+		return STD_NULL_POINTER;
+	}
+	if((0 == count) || (count > stack->Capacity))
+	{
+		return STD_INVALID_ARG;
+	}
+	room = stack->Capacity - stack->Top;
+	if(count > room)
+	{
+		if(STD_OVERFLOW_OVERWRITE_OLDEST != stack->Policy)
+		{
+			return Std_StackOverflow(stack, count);
+		}
+		// the oldest elements are at Head , they are replaced by the new ones
+		stack->Stats.Overwrites += count - room;
+		stack->Top = stack->Capacity;
+	}
+	else
+	{
+		stack->Top += count;
+	}
+
+	*pIndex = stack->Head;
+	stack->Head = ((u16)stack->Head + count >= stack->Capacity) ? (u8)(stack->Head + count - stack->Capacity) : (u8)(stack->Head + count);
+	stack->Stats.Pushed += count;
+	if(stack->Top > stack->Stats.Peak)
+	{
+		stack->Stats.Peak = stack->Top;
+	}
+	return STD_OK;
+}
+
+/**
+ * @brief Second half of Std_StackPushN : copies count elements from the index given by Std_StackReserveN (ring).
+ */
+void Std_StackWriteAt(Std_Stack_t *stack, u8 index, const void *elements, u8 count)
+{
+	if((NULL_PTR != stack) && (NULL_PTR != elements))
+	{
+		Std_StackCopy(stack, index, (u8*)elements, count, STD_TRUE);
+	}
+}
+
+/**
+ * @brief First half of Std_StackPopN : copies the count top elements without removing them.
+ *
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY , STD_NULL_POINTER.
+ */
+Std_Error_t Std_StackPeekN(const Std_Stack_t *stack, void *elements, u8 count)
+{
+	u8 head;
+
+	if((NULL_PTR == stack) || (NULL_PTR == elements))
+	{
+		return STD_NULL_POINTER;
+	}
+	head = stack->Head;
+	if(count > stack->Top)
+	{
+		return STD_BUFFER_EMPTY;
+	}
+	Std_StackCopy(stack, Std_StackIndexBack(stack, head, count), (u8*)elements, count, STD_FALSE);
+	return STD_OK;
+}
+
+/**
+ * @brief Second half of Std_StackPopN : removes the count top elements without copying them.
+ *
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY , STD_NULL_POINTER.
+ */
+Std_Error_t Std_StackRemoveN(Std_Stack_t *stack, u8 count)
+{
+	if(NULL_PTR == stack)
+	{
+		return STD_NULL_POINTER;
+	}
+	if(count > stack->Top)
+	{
+		return STD_BUFFER_EMPTY;
+	}
+	stack->Head = Std_StackIndexBack(stack, stack->Head, count);
+	stack->Top -= count;
+	stack->Stats.Popped += count;
+	return STD_OK;
+}
+
+/**
+ * @brief Applies the policy of a refused push : counts the dropped elements and calls the REJECT call back.
+ *        Used by STD_STACK_PUSH , not by the application.
+ *
+ * @return Std_Error_t STD_BUFFER_FULL.
+ */
+Std_Error_t Std_StackOverflow(Std_Stack_t *stack, u8 count)
+{
+	stack->Stats.Drops += count;
+	if((STD_OVERFLOW_REJECT == stack->Policy) && (NULL_PTR != stack->pfOverflow))
+	{
+		stack->pfOverflow();
+	}
+	return STD_BUFFER_FULL;
+}
+
+/**
+ * @brief Returns the number of elements in the stack (0 for a NULL stack).
+ */
+u8 Std_StackGetCount(const Std_Stack_t *stack)
+{
+	return (NULL_PTR == stack) ? 0 : stack->Top;
+}
+
+/**
+ * @brief Removes all the elements in a critical section (the counters are kept).
+ */
+void Std_StackClear(Std_Stack_t *stack)
+{
+	u8 sregCopy;
+
+	if(NULL_PTR != stack)
+	{
+		// a push of an ISR lands before or after the clear , not between Top and Head
+		Critical_Enter(sregCopy);
+		stack->Top = 0;
+		stack->Head = 0;
+		Critical_Exit(sregCopy);
+	}
+}
+
+/**
+ * @brief Copies the counters in a critical section : the pushes and the pops of the ISRs go on.
+ *
+ * @param stack the stack.
+ * @param stats where the counters are copied.
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER.
+ */
+Std_Error_t Std_StackGetStats(const Std_Stack_t *stack, Std_BufferStats_t *stats)
+{
+	u8 sregCopy;
+
+	if((NULL_PTR == stack) || (NULL_PTR == stats))
+	{
+		return STD_NULL_POINTER;
+	}
+	// the 32-bit counters are not read in one instruction
+	Critical_Enter(sregCopy);
+	*stats = stack->Stats;
+	Critical_Exit(sregCopy);
+	return STD_OK;
+}
+
+/**
+ * @brief Clears the counters , the peak restarts from the current number of elements.
+ */
+void Std_StackResetStats(Std_Stack_t *stack)
+{
+	u8 sregCopy;
+
+	if(NULL_PTR != stack)
+	{
+		Critical_Enter(sregCopy);
+		stack->Stats.Pushed = 0;
+		stack->Stats.Popped = 0;
+		stack->Stats.Drops = 0;
+		stack->Stats.Overwrites = 0;
+		stack->Stats.Peak = stack->Top;
+		Critical_Exit(sregCopy);
+	}
+}
@@ -0,0 +1,249 @@
+/**
+ * @file Std_Stack.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Fixed size LIFO stack , every instance owns its storage , its element size , its capacity ,
+ *         its overflow policy (Std_Buffer.h) and its counters.
+ *
+ * The elements are kept in a ring : Head is the index of the next push and the top is the element before it ,
+ * so with STD_OVERFLOW_OVERWRITE_OLDEST a push on a full stack replaces the bottom (the oldest element) in O(1).
+ *
+ * Two ways to use it :
+ *  - typed : STD_STACK_DEFINE creates the storage and the instance , STD_STACK_PUSH / STD_STACK_POP / STD_STACK_PEEK
+ *            work on the typed array : a push is a bound check , an index bump and a copy of the element (no call
+ *            except for a push on a full stack that is not overwritten).
+ *  - generic : Std_StackInit on any buffer , Std_StackPush / Std_StackPop copy ElementSize bytes
+ *            (for the code that gets the stack by pointer).
+ * Both can be mixed on a stack created by STD_STACK_DEFINE.
+ *EX:
+ *	STD_STACK_DEFINE(App_Events, App_Event_t, 8, STD_OVERFLOW_OVERWRITE_OLDEST, NULL_PTR);
+ *
+ *	STD_STACK_PUSH(App_Events, event);
+ *	while(STD_OK == STD_STACK_POP(App_Events, &event)) { handle event }
+ *
+ * @note the stack is not protected against the interrupts , a stack used by an ISR and the main loop needs a critical section
+ *       (see UART_Stack.c : Std_StackReserveN , Std_StackPeekN and Std_StackRemoveN keep the copies out of it).
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef STD_STACK_H_
+#define STD_STACK_H_
+
+#include "Std_Types.h"
+#include "Std_Buffer.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief one stack , Top is the number of elements (8-bit : read in one instruction).
+ */
+typedef struct
+{
+	u8 *Buffer;                    /**< Capacity * ElementSize bytes */
+	u8  ElementSize;               /**< bytes of one element */
+	u8  Capacity;                  /**< max number of elements (1..255) */
+	u8  Top;                       /**< number of elements */
+	u8  Head;                      /**< index of the next push , the top element is at Head - 1 (ring) */
+	Std_OverflowPolicy_t Policy;   /**< what a push on a full stack does */
+	Ptr_VoidFuncVoid_t pfOverflow; /**< called by a refused push with STD_OVERFLOW_REJECT (can be NULL_PTR) */
+	Std_BufferStats_t Stats;       /**< the counters */
+}Std_Stack_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief Creates a static stack and its storage.
+ *
+ * @param name the name of the instance (name##_arrBuffer is its storage).
+ * @param type the type of the elements.
+ * @param capacity the max number of elements (1..255 , checked at compile time).
+ * @param policy Std_OverflowPolicy_t.
+ * @param pfOverflow the call back of STD_OVERFLOW_REJECT (NULL_PTR : none).
+ */
+#define STD_STACK_DEFINE(name, type, capacity, policy, pfOverflow)                                   \
+	typedef u8 name##_CapacityCheck_t[(((capacity) >= 1) && ((capacity) <= 255)) ? 1 : -1];          \
+	static type name##_arrBuffer[(capacity)];                                                        \
+	static Std_Stack_t name = {(u8*)name##_arrBuffer, (u8)sizeof(type), (u8)(capacity), 0, 0, (policy), (pfOverflow), {0, 0, 0, 0, 0}}
+
+/* the index after / before i in the ring of the stack */
+#define STD_STACK_NEXT(name, i)     ((u8)((((i) + 1) == (name).Capacity) ? 0 : ((i) + 1)))
+#define STD_STACK_PREV(name, i)     ((u8)((0 == (i)) ? ((name).Capacity - 1) : ((i) - 1)))
+
+/* the counters of a push (the element is already written at Head) */
+#define STD_STACK_COMMIT_PUSH(name)                                                                  \
+	((name).Head = STD_STACK_NEXT(name, (name).Head)),                                               \
+	(((name).Top < (name).Capacity) ? (void)((name).Top++) : (void)((name).Stats.Overwrites++)),     \
+	((name).Stats.Pushed++),                                                                         \
+	(((name).Top > (name).Stats.Peak) ? (void)((name).Stats.Peak = (name).Top) : (void)0)
+
+/**
+ * @brief Pushes a value on a stack created by STD_STACK_DEFINE.
+ * @return Std_Error_t STD_OK , STD_BUFFER_FULL (the value is dropped as the policy says).
+ */
+#define STD_STACK_PUSH(name, value)                                                                  \
+	((((name).Top < (name).Capacity) || (STD_OVERFLOW_OVERWRITE_OLDEST == (name).Policy)) ?          \
+	 ((name##_arrBuffer[(name).Head] = (value)), STD_STACK_COMMIT_PUSH(name), STD_OK) :              \
+	 Std_StackOverflow(&(name), 1))
+
+/**
+ * @brief Pops the last value of a stack created by STD_STACK_DEFINE.
+ * @param pValue where the value is written.
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY (*pValue is not written).
+ */
+#define STD_STACK_POP(name, pValue)                                                                  \
+	((0 != (name).Top) ?                                                                             \
+	 (((name).Head = STD_STACK_PREV(name, (name).Head)), (*(pValue) = name##_arrBuffer[(name).Head]), \
+	  ((name).Top--), ((name).Stats.Popped++), STD_OK) :                                             \
+	 STD_BUFFER_EMPTY)
+
+/**
+ * @brief Reads the last value of a stack created by STD_STACK_DEFINE without removing it.
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY.
+ */
+#define STD_STACK_PEEK(name, pValue)                                                                 \
+	((0 != (name).Top) ? ((*(pValue) = name##_arrBuffer[STD_STACK_PREV(name, (name).Head)]), STD_OK) : STD_BUFFER_EMPTY)
+
+#define STD_STACK_COUNT(name)       ((name).Top)
+#define STD_STACK_IS_EMPTY(name)    (0 == (name).Top)
+#define STD_STACK_IS_FULL(name)     ((name).Capacity == (name).Top)
+#define STD_STACK_CLEAR(name)       ((name).Top = 0)
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+/**
+ * @brief Initializes an empty stack on a buffer.
+ *
+ * @param stack the stack.
+ * @param buffer capacity * elementSize bytes , owned by the stack until it is not used anymore.
+ * @param elementSize bytes of one element (1..255).
+ * @param capacity max number of elements (1..255).
+ * @param policy what a push on a full stack does.
+ * @param pfOverflow the call back of STD_OVERFLOW_REJECT (NULL_PTR : none).
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER , STD_INVALID_ARG.
+ */
+Std_Error_t Std_StackInit(Std_Stack_t *stack, void *buffer, u8 elementSize, u8 capacity, Std_OverflowPolicy_t policy, Ptr_VoidFuncVoid_t pfOverflow);
+
+/**
+ * @brief Copies one element on the top of the stack.
+ *
+ * @param stack the stack.
+ * @param element ElementSize bytes.
+ * @return Std_Error_t STD_OK , STD_BUFFER_FULL (dropped as the policy says) , STD_NULL_POINTER.
+ */
+Std_Error_t Std_StackPush(Std_Stack_t *stack, const void *element);
+
+/**
+ * @brief Copies the top element and removes it.
+ *
+ * @param stack the stack.
+ * @param element ElementSize bytes.
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY , STD_NULL_POINTER.
+ */
+Std_Error_t Std_StackPop(Std_Stack_t *stack, void *element);
+
+/**
+ * @brief Copies the top element without removing it.
+ *
+ * @param stack the stack.
+ * @param element ElementSize bytes.
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY , STD_NULL_POINTER.
+ */
+Std_Error_t Std_StackPeek(const Std_Stack_t *stack, void *element);
+
+/**
+ * @brief Copies a block of elements on the stack with one bound check : all of them or none.
+ *        elements[count - 1] becomes the top , with STD_OVERFLOW_OVERWRITE_OLDEST the oldest elements make room.
+ *
+ * @param stack the stack.
+ * @param elements count * ElementSize bytes.
+ * @param count the number of elements (1..Capacity).
+ * @return Std_Error_t STD_OK , STD_BUFFER_FULL (nothing is pushed) , STD_NULL_POINTER , STD_INVALID_ARG.
+ */
+Std_Error_t Std_StackPushN(Std_Stack_t *stack, const void *elements, u8 count);
+
+/**
+ * @brief Removes the count top elements with one bound check : all of them or none.
+ *        The block keeps the order of the stack (elements[count - 1] was the top) ,
+ *        the block of a Std_StackPushN is given back as it was pushed.
+ *
+ * @param stack the stack.
+ * @param elements count * ElementSize bytes.
+ * @param count the number of elements.
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY (less than count elements , nothing is popped) , STD_NULL_POINTER.
+ */
+Std_Error_t Std_StackPopN(Std_Stack_t *stack, void *elements, u8 count);
+
+/**
+ * @brief First half of Std_StackPushN : applies the policy , updates the counters and reserves count elements.
+ *        The caller writes them with Std_StackWriteAt (ex: out of a critical section).
+ *
+ * @param stack the stack.
+ * @param count the number of elements (1..Capacity).
+ * @param pIndex the index of the first reserved element.
+ * @return Std_Error_t STD_OK , STD_BUFFER_FULL (nothing is reserved) , STD_NULL_POINTER , STD_INVALID_ARG.
+ */
+Std_Error_t Std_StackReserveN(Std_Stack_t *stack, u8 count, u8 *pIndex);
+
+/**
+ * @brief Second half of Std_StackPushN : copies count elements from the index given by Std_StackReserveN (ring).
+ */
+void Std_StackWriteAt(Std_Stack_t *stack, u8 index, const void *elements, u8 count);
+
+/**
+ * @brief First half of Std_StackPopN : copies the count top elements without removing them.
+ *
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY , STD_NULL_POINTER.
+ */
+Std_Error_t Std_StackPeekN(const Std_Stack_t *stack, void *elements, u8 count);
+
+/**
+ * @brief Second half of Std_StackPopN : removes the count top elements without copying them.
+ *
+ * @return Std_Error_t STD_OK , STD_BUFFER_EMPTY , STD_NULL_POINTER.
+ */
+Std_Error_t Std_StackRemoveN(Std_Stack_t *stack, u8 count);
+
+/**
+ * @brief Applies the policy of a refused push : counts the dropped elements and calls the REJECT call back.
+ *        Used by STD_STACK_PUSH , not by the application.
+ *
+ * @return Std_Error_t STD_BUFFER_FULL.
+ */
+Std_Error_t Std_StackOverflow(Std_Stack_t *stack, u8 count);
+
+/**
+ * @brief Returns the number of elements in the stack (0 for a NULL stack).
+ */
+u8 Std_StackGetCount(const Std_Stack_t *stack);
+
+/**
+ * @brief Removes all the elements in a critical section (the counters are kept).
+ */
+void Std_StackClear(Std_Stack_t *stack);
+
+/**
+ * @brief Copies the counters in a critical section : the pushes and the pops of the ISRs go on.
+ *
+ * @param stack the stack.
+ * @param stats where the counters are copied.
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER.
+ */
+Std_Error_t Std_StackGetStats(const Std_Stack_t *stack, Std_BufferStats_t *stats);
+
+/**
+ * @brief Clears the counters , the peak restarts from the current number of elements.
+ */
+void Std_StackResetStats(Std_Stack_t *stack);
+
+#endif /* STD_STACK_H_ */
@@ -0,0 +1,63 @@
+/**
+ * @file Utils_Sleep.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the macros that put the CPU in the idle sleep mode
+ *         while waiting for a condition that is changed by an interrupt.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UTILS_SLEEP_H_
+#define UTILS_SLEEP_H_
+
+#include "Utils_interrupt.h"
+
+/* ================================== registers ================================== */
+#define SLEEP_MCUCR      (*(volatile u8*)0x55)   // MCU Control Register (same as MCUCR in MemMap.h)
+#define SLEEP_MCUCR_SE   7                       // Sleep Enable
+#define SLEEP_MODE_MASK  0x70                    // SM2:0 , 000 is the idle mode
+#define SLEEP_SREG_I     7                       // Global Interrupt Enable bit in SREG
+
+/* ================================== sleep ================================== */
+#define Sleep_SetIdleMode()   (SLEEP_MCUCR &= (u8)~SLEEP_MODE_MASK)
+
+/*
+ * Sleep_IdleWaitUntil(condition)
+ *
+ * Waits until the condition is true with the CPU in idle sleep mode.
+ * The CPU is woken up by any enabled interrupt (the caller must enable the interrupt that changes the condition),
+ * then the condition is checked again.
+ * The condition is checked with the interrupts disabled and "sei" is followed by "sleep" ,
+ * the AVR always executes the instruction after "sei" before any pending interrupt,
+ * so an interrupt that comes between the check and the sleep can not be lost.
+ * If the global interrupt is disabled the macro busy waits because no interrupt can wake the CPU.
+EX:
+	UART_RX_InterruptEnable();
+	Sleep_IdleWaitUntil(get_bit(UCSRA,UCSRA_RXC));
+ */
+#define Sleep_IdleWaitUntil(condition)                                           \
+	do{                                                                          \
+		if(0==(CRITICAL_SREG & (1<<SLEEP_SREG_I)))                               \
+		{                                                                        \
+			while(!(condition));                                                 \
+		}                                                                        \
+		else                                                                     \
+		{                                                                        \
+			Sleep_SetIdleMode();                                                 \
+			while(!(condition))                                                  \
+			{                                                                    \
+				__asm__ __volatile__ ("cli" ::: "memory");                       \
+				if(!(condition))                                                 \
+				{                                                                \
+					SLEEP_MCUCR |= (1<<SLEEP_MCUCR_SE);                          \
+					__asm__ __volatile__ ("sei" "\n\t" "sleep" ::: "memory");    \
+					SLEEP_MCUCR &= (u8)~(1<<SLEEP_MCUCR_SE);                     \
+				}                                                                \
+				__asm__ __volatile__ ("sei" ::: "memory");                       \
+			}                                                                    \
+		}                                                                        \
+	}while(0)
+
+#endif /* UTILS_SLEEP_H_ */
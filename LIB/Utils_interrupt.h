@@ -45,6 +45,19 @@
 #define Global_Interrupt_Enable__asm()    __asm__ __volatile__ ("sei" ::)
 #define Global_Interrupt_Disable__asm()   __asm__ __volatile__ ("cli" ::)
 
+/* ================================== critical section ================================== */
+/*
+EX:
+u8 sregCopy;
+Critical_Enter(sregCopy);
+	// code that must not be interrupted (keep it as short as possible)
+Critical_Exit(sregCopy);
+// the previous state of the I-bit is restored so the macros are safe inside an ISR too
+*/
+#define CRITICAL_SREG                     (*(volatile u8*)0x5F)  // Status Register (same as SREG in MemMap.h)
+#define Critical_Enter(sregCopy)          do{ (sregCopy)=CRITICAL_SREG; __asm__ __volatile__ ("cli" ::: "memory"); }while(0)
+#define Critical_Exit(sregCopy)           do{ __asm__ __volatile__ ("" ::: "memory"); CRITICAL_SREG=(sregCopy); }while(0)
+
 /* ================================== attributes ================================== */
 /** \def ISR_BLOCK
     \ingroup avr_interrupts
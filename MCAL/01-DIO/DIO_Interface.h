@@ -94,6 +94,22 @@ typedef enum{
  */
 void Dio_Init(void);
 
+/**
+ * @brief Sets the direction of a specific pin in the DIO module.
+ *
+ * This function sets the direction of a specific pin in the DIO module to either output, input with
+ * high impedance (free), or input with pull-up resistor enabled.
+ * Dio_Init sets the directions of DIO_Lcfg.c , this function is for the pins that change direction at run time
+ * (ex: the data bus of the LCD read back by the busy flag polling).
+ *
+ * @param pin The pin number to set its direction.
+ * @param direction The desired direction for the pin.
+ *        - DIO_PIN_DIRECTION_OUTPUT: Sets the pin as output (the pin voltage is set to LOW).
+ *        - DIO_PIN_DIRECTION_INPUT_FREE: Sets the pin as input with high impedance (free).
+ *        - DIO_PIN_DIRECTION_INPUT_PULLUP: Sets the pin as input with pull-up resistor enabled.
+ */
+void Dio_SetPinDirection(const DIO_PIN_t pin,const DIO_PIN_DIRECTION_t direction);
+
 /**
  * @brief Reads the voltage level of a specific pin.
  *
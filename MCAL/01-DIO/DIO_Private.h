@@ -11,13 +11,6 @@
 #ifndef DIO_PRIVATE_H_
 #define DIO_PRIVATE_H_
 
-/*-----------------------------------------------------------------------------*/
-/*                                                                             */
-/*                              PRIVATE Functions                              */
-/*                                                                             */
-/*-----------------------------------------------------------------------------*/
-static void Dio_SetPinDirection(const DIO_PIN_t pin,const DIO_PIN_DIRECTION_t direction);
-
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
 /*                              PRIVATE Definitions                            */
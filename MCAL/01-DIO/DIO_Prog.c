@@ -24,23 +24,45 @@
 
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
-/*                              PRIVATE Functions                              */
+/*                              PUPLIC Functions                              */
 /*                                                                             */
 /*-----------------------------------------------------------------------------*/
 
+
+
+/**
+ * @brief Initializes the Digital I/O (DIO) pins.
+ * 
+ * This function initializes the DIO pins by setting their directions based on the values
+ * in the 'arrOfPinsStatus' array which is located in DIO_lcfg.c.
+ * 
+ * @param None
+ * @return None
+ */
+void Dio_Init(void)
+{
+	DIO_PIN_t i;
+	for (i = PA0; i < DIO_TOTAL_PINS; i++)
+	{
+		Dio_SetPinDirection(i, arrOfPinsStatus[i]);
+	}
+}
+
 /**
  * @brief Sets the direction of a specific pin in the DIO module.
  *
  * This function sets the direction of a specific pin in the DIO module to either output, input with
  * high impedance (free), or input with pull-up resistor enabled.
+ * Dio_Init sets the directions of DIO_Lcfg.c , this function is for the pins that change direction at run time
+ * (ex: the data bus of the LCD read back by the busy flag polling).
  *
  * @param pin The pin number to set its direction.
  * @param direction The desired direction for the pin.
- *        - DIO_PIN_DIRECTION_OUTPUT: Sets the pin as output.
+ *        - DIO_PIN_DIRECTION_OUTPUT: Sets the pin as output (the pin voltage is set to LOW).
  *        - DIO_PIN_DIRECTION_INPUT_FREE: Sets the pin as input with high impedance (free).
  *        - DIO_PIN_DIRECTION_INPUT_PULLUP: Sets the pin as input with pull-up resistor enabled.
  */
-static void Dio_SetPinDirection(const DIO_PIN_t pin,const DIO_PIN_DIRECTION_t direction)
+void Dio_SetPinDirection(const DIO_PIN_t pin,const DIO_PIN_DIRECTION_t direction)
 {
 	volatile u8 *arrOf_DDR[]={&DDRA,&DDRB,&DDRC,&DDRD}; // Array of DDR registers for each port
 	volatile u8 *arrOf_PORT[]={&PORTA,&PORTB,&PORTC,&PORTD}; // Array of PORT registers for each port
@@ -64,32 +86,6 @@ static void Dio_SetPinDirection(const DIO_PIN_t pin,const DIO_PIN_DIRECTION_t di
 	}
 }
 
-/*-----------------------------------------------------------------------------*/
-/*                                                                             */
-/*                              PUPLIC Functions                              */
-/*                                                                             */
-/*-----------------------------------------------------------------------------*/
-
-
-
-/**
- * @brief Initializes the Digital I/O (DIO) pins.
- * 
- * This function initializes the DIO pins by setting their directions based on the values
- * in the 'arrOfPinsStatus' array which is located in DIO_lcfg.c.
- * 
- * @param None
- * @return None
- */
-void Dio_Init(void)
-{
-	DIO_PIN_t i;
-	for (i = PA0; i < DIO_TOTAL_PINS; i++)
-	{
-		Dio_SetPinDirection(i, arrOfPinsStatus[i]);
-	}
-}
-
 /**
  * @brief Reads the voltage level of a specific pin.
  *
@@ -18,6 +18,8 @@
 #include "MemMap.h"
 #include "Utils_interrupt.h"
 #include "Utils_BitMath.h"
+#include "Utils_Sleep.h"
+#include "SysTick_Interface.h"
 
 /*
  * the module files
@@ -85,7 +87,6 @@ void UART_RxDisable(void)
 void UART_Init(void)
 {
 	u8  UCSRC_var=0;
-	u16 UBRR_var=0; 
 	
 	// transmission speed
 	#if (SPEED_MODE==NORMAL_SPEED)
@@ -150,9 +151,7 @@ void UART_Init(void)
 	UCSRC=UCSRC_var;
 
 	// set the value of UBRR_var to UBRRH and UBRRL registers
-    UBRR_var=BaudRateArray[SPEED_MODE][CPU_F][BUAD_RATE];
-	UBRRH = (u8)(UBRR_var>>8);
-	UBRRL = (u8)UBRR_var;
+	UART_WriteBaudRate(BUAD_RATE);
 
 	//enable UART  receiver.
 	set_bit(UCSRB,UCSRB_RXEN);
@@ -160,6 +159,66 @@ void UART_Init(void)
 	set_bit(UCSRB,UCSRB_TXEN);
 }
 
+/**
+ * @brief Writes the UBRR value of a baud rate (BAUD_xxx) to UBRRH and UBRRL.
+ *
+ * @param baudRate the index of the baud rate in BaudRateArray.
+ */
+static void UART_WriteBaudRate(u8 baudRate)
+{
+	u16 UBRR_var=BaudRateArray[SPEED_MODE][CPU_F][baudRate];
+
+	// URSEL is 0 : the write goes to UBRRH (not UCSRC)
+	UBRRH = (u8)((UBRR_var>>8) & 0x0F);
+	UBRRL = (u8)UBRR_var;
+	UART_u8BaudRate = baudRate;
+}
+
+/**
+ * @brief Changes the baud rate without changing the frame (data bits , parity , stop bits).
+ *
+ * The byte being sent or received when the baud rate changes is corrupted :
+ * wait for the end of the transmission (the last byte echoed , or the TX complete flag) before the call.
+ * The bytes already received are discarded.
+ * 
+ * @param baudRate the new baud rate (BAUD_2400 .. BAUD_28800).
+ * @return Std_Error_t STD_OK , STD_INVALID_ARG if baudRate is not a supported baud rate.
+ */
+Std_Error_t UART_SetBaudRate(u8 baudRate)
+{
+	if(baudRate >= TOTAL_BAUD_RATE)
+	{
+		return STD_INVALID_ARG;
+	}
+	UART_WriteBaudRate(baudRate);
+	UART_FlushRx();
+	return STD_OK;
+}
+
+/**
+ * @brief Gets the baud rate in use.
+ *
+ * @return u8 the baud rate (BAUD_xxx) set by UART_Init or UART_SetBaudRate.
+ */
+u8 UART_GetBaudRate(void)
+{
+	return UART_u8BaudRate;
+}
+
+/**
+ * @brief Discards the received bytes waiting in the receive buffer (and their error flags).
+ */
+void UART_FlushRx(void)
+{
+	u8 dummy;
+
+	while(get_bit(UCSRA,UCSRA_RXC)==RX_COMPLETE)
+	{
+		dummy = UDR;
+		(void)dummy;
+	}
+}
+
 
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
@@ -219,7 +278,17 @@ void UART_SendByteBusyWait(const u8 data)
 	for transmitting a new byte so wait until this flag is set to one 
 	and it will cleared by hardware when you write new data to register.*/
 
+	#if (UART_WAIT_MODE==UART_WAIT_SLEEP_IDLE)
+	if(get_bit(UCSRA,UCSRA_UDRE)!=DATA_REG_EMPTY)
+	{
+		// the UDRE interrupt only wakes the CPU up , its ISR disables it again without calling the call back
+		u8 wakeMask = UART_WakeOnlyEnable(1<<UCSRB_UDRIE);
+		Sleep_IdleWaitUntil(get_bit(UCSRA,UCSRA_UDRE)==DATA_REG_EMPTY);
+		UART_WakeOnlyDisable(wakeMask);
+	}
+	#else
 	while(get_bit(UCSRA,UCSRA_UDRE)!=DATA_REG_EMPTY);  
+	#endif
 	UDR = data;
 }
 
@@ -236,11 +305,171 @@ u8 UART_ReceiveByteBusyWait(void)
 {
 	/*RXC flag is set when the UART receive data so  wait until this flag is set to one
 	and it will cleared by hardware when you read the data*/
+	#if (UART_WAIT_MODE==UART_WAIT_SLEEP_IDLE)
+	if(get_bit(UCSRA,UCSRA_RXC)!=RX_COMPLETE)
+	{
+		// the RXC interrupt only wakes the CPU up , its ISR disables it again without calling the call back
+		u8 wakeMask = UART_WakeOnlyEnable(1<<UCSRB_RXCIE);
+		Sleep_IdleWaitUntil(get_bit(UCSRA,UCSRA_RXC)==RX_COMPLETE);
+		UART_WakeOnlyDisable(wakeMask);
+	}
+	#else
 	while(get_bit(UCSRA,UCSRA_RXC)!=RX_COMPLETE);  
+	#endif
     return UDR;
 }
 
 
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                         Send and Receive Functions          	               */
+/*                               with timeout                                  */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+#if (UART_WAIT_MODE==UART_WAIT_SLEEP_IDLE)
+/**
+ * @brief Enables an interrupt of UCSRB to wake the CPU up only (its ISR does not call the call back).
+ *
+ * @param enableMask the mask of the interrupt in UCSRB (1<<UCSRB_RXCIE or 1<<UCSRB_UDRIE).
+ * @return u8 enableMask if the interrupt is enabled by this call , 0 if it was already enabled (an asynchronous transfer).
+ */
+static u8 UART_WakeOnlyEnable(u8 enableMask)
+{
+	u8 sregCopy;
+
+	if(0 != (UCSRB & enableMask))
+	{
+		return 0;
+	}
+	Critical_Enter(sregCopy);
+	UART_u8WakeOnly |= enableMask;
+	UCSRB |= enableMask;
+	Critical_Exit(sregCopy);
+	return enableMask;
+}
+
+/**
+ * @brief Disables the interrupt enabled by UART_WakeOnlyEnable if its ISR has not disabled it yet (timeout).
+ *
+ * @param enableMask the return of UART_WakeOnlyEnable.
+ */
+static void UART_WakeOnlyDisable(u8 enableMask)
+{
+	u8 sregCopy;
+
+	if(0 != enableMask)
+	{
+		Critical_Enter(sregCopy);
+		UART_u8WakeOnly &= (u8)~enableMask;
+		UCSRB &= (u8)~enableMask;
+		Critical_Exit(sregCopy);
+	}
+}
+#endif
+
+/**
+ * @brief Waits until a flag of UCSRA is set or the deadline is reached.
+ *
+ * @param flagMask the mask of the flag in UCSRA.
+ * @param deadline the tick (SysTick_GetTicks) at which the wait stops.
+ * @return Std_Error_t STD_OK if the flag is set , STD_TIMEOUT if the deadline is reached first.
+ */
+static Std_Error_t UART_WaitFlagTimeout(u8 flagMask, u16 deadline)
+{
+	#if (UART_WAIT_MODE==UART_WAIT_SLEEP_IDLE)
+	if(0 == (UCSRA & flagMask))
+	{
+		// the CPU is woken up by the flag interrupt or by the tick interrupt (every SYSTICK_TICK_MS)
+		u8 wakeMask = UART_WakeOnlyEnable((flagMask & (1<<UCSRA_UDRE)) ? (1<<UCSRB_UDRIE) : (1<<UCSRB_RXCIE));
+		Sleep_IdleWaitUntil((0 != (UCSRA & flagMask)) || SysTick_IsExpired(SysTick_GetTicks(), deadline));
+		UART_WakeOnlyDisable(wakeMask);
+	}
+	#else
+	u8 polls = UART_TIMEOUT_CHECK_PERIOD;
+
+	// the tick is read once every UART_TIMEOUT_CHECK_PERIOD polls , the other polls cost only a decrement and a branch
+	while(0 == (UCSRA & flagMask))
+	{
+		polls--;
+		if(0 == polls)
+		{
+			polls = UART_TIMEOUT_CHECK_PERIOD;
+			if(SysTick_IsExpired(SysTick_GetTicks(), deadline))
+			{
+				break;
+			}
+		}
+	}
+	#endif
+	return (0 != (UCSRA & flagMask)) ? STD_OK : STD_TIMEOUT;
+}
+
+/**
+ * @brief Sends a byte using the UART module with busy waiting until a deadline.
+ *
+ * This function waits until the UART data register is empty or the deadline is reached.
+ * The byte is written only if the data register is empty.
+ * The system tick must be running (SysTick_Init) and the global interrupt enabled.
+ * 
+ * @param data The byte to be sent using the UART module.
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t STD_OK if the byte is sent , STD_TIMEOUT if the deadline is reached first.
+ */
+Std_Error_t UART_SendByteTimeout(const u8 data, u16 deadline)
+{
+	Std_Error_t errorStatus = UART_WaitFlagTimeout((1<<UCSRA_UDRE), deadline);
+	if(STD_OK == errorStatus)
+	{
+		UDR = data;
+	}
+	return errorStatus;
+}
+
+/**
+ * @brief Receives a byte using the UART module with busy waiting until a deadline.
+ *
+ * This function waits until a byte is received or the deadline is reached.
+ * The system tick must be running (SysTick_Init) and the global interrupt enabled.
+ * 
+ * @param pdata A pointer to a variable to store the received byte (not changed on timeout).
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t STD_OK if a byte is received , STD_TIMEOUT if the deadline is reached first.
+ */
+Std_Error_t UART_ReceiveByteTimeout(u8 *pdata, u16 deadline)
+{
+	Std_Error_t errorStatus = UART_WaitFlagTimeout((1<<UCSRA_RXC), deadline);
+	if(STD_OK == errorStatus)
+	{
+		*pdata = UDR;
+	}
+	return errorStatus;
+}
+
+/**
+ * @brief Receives a byte and its error flags using the UART module with busy waiting until a deadline.
+ *
+ * The error flags belong to the byte at the head of the receive buffer , they are read before UDR.
+ * The system tick must be running (SysTick_Init) and the global interrupt enabled.
+ * 
+ * @param pdata A pointer to a variable to store the received byte (not changed on timeout).
+ * @param pErrors A pointer to a variable to store the errors of the byte :
+ *                0 or UART_ERROR_FRAME | UART_ERROR_OVERRUN | UART_ERROR_PARITY (not changed on timeout).
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t STD_OK if a byte is received , STD_TIMEOUT if the deadline is reached first.
+ */
+Std_Error_t UART_ReceiveByteStatusTimeout(u8 *pdata, u8 *pErrors, u16 deadline)
+{
+	Std_Error_t errorStatus = UART_WaitFlagTimeout((1<<UCSRA_RXC), deadline);
+	if(STD_OK == errorStatus)
+	{
+		*pErrors = UCSRA & (UART_ERROR_FRAME | UART_ERROR_OVERRUN | UART_ERROR_PARITY);
+		*pdata = UDR;
+	}
+	return errorStatus;
+}
+
+
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
 /*                         Send and Receive Functions          	               */
@@ -273,6 +502,28 @@ Std_Status_t UART_ReceiveBytePeriodicCheck(u8*pdata)
 return status;
 }
 
+/**
+ * @brief Sends a byte using the UART module with periodic checking.
+ *
+ * This function sends a byte using the UART module with periodic checking.
+ * The function checks the UDRE flag : if the data register is empty the byte is written and the function returns STD_DONE,
+ * else the byte is not sent and the function returns STD_PENDING (call it again later with the same byte).
+ * No interrupt or call back is used.
+ * 
+ * @param data The byte to be sent using the UART module.
+ * @return The status of the operation.
+ */
+Std_Status_t UART_SendBytePeriodicCheck(const u8 data)
+{
+	Std_Status_t status=STD_PENDING;
+	if(get_bit(UCSRA,UCSRA_UDRE)==DATA_REG_EMPTY)
+	{
+		UDR=data;
+		status=STD_DONE;
+	}
+	return status;
+}
+
 
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
@@ -301,6 +552,16 @@ return status;
 	clear_bit(UCSRB,UCSRB_TXCIE);
 }
 
+ void UART_UDRE_InterruptEnable(void)
+{
+	set_bit(UCSRB,UCSRB_UDRIE);
+}
+
+ void UART_UDRE_InterruptDisable(void)
+{
+	clear_bit(UCSRB,UCSRB_UDRIE);
+}
+
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
 /*                         Call Back Functions                                 */
@@ -329,7 +590,14 @@ void UART_UDRE_SetCallBack(void (*pfCallBack)(void))
 /*-----------------------------------------------------------------------------*/
  ISR(USART_RXC_VECT)
 {
-	if (pfCallBackUartRXC!=NULL_PTR)
+	if ((0 != (UART_u8WakeOnly & (1<<UCSRB_RXCIE))) || (pfCallBackUartRXC==NULL_PTR))
+	{
+		// wake up only (busy wait) , RXC stays set until UDR is read so disable the interrupt
+		// the call back of the last asynchronous reception is not called : the byte belongs to the busy wait
+		UART_u8WakeOnly &= (u8)~(1<<UCSRB_RXCIE);
+		clear_bit(UCSRB,UCSRB_RXCIE);
+	}
+	else
 	{
 		pfCallBackUartRXC();
 	}
@@ -345,7 +613,14 @@ void UART_UDRE_SetCallBack(void (*pfCallBack)(void))
 
  ISR(USART_UDRE_VECT)
 {
-	if (pfCallBackUartUDRE!=NULL_PTR)
+	if ((0 != (UART_u8WakeOnly & (1<<UCSRB_UDRIE))) || (pfCallBackUartUDRE==NULL_PTR))
+	{
+		// wake up only (busy wait) , UDRE stays set until UDR is written so disable the interrupt
+		// the call back of the last asynchronous transmission is not called : the slot belongs to the busy wait
+		UART_u8WakeOnly &= (u8)~(1<<UCSRB_UDRIE);
+		clear_bit(UCSRB,UCSRB_UDRIE);
+	}
+	else
 	{
 		pfCallBackUartUDRE();
 	}
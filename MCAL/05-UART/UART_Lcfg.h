@@ -28,6 +28,10 @@
 #define  PARITY_MODE        ODD_PARITY
 #define  N_DATA_BITS        _8_DATA_BITS
 #define  N_STOP_BITS        TWO_STOP_BIT
+#ifndef UART_WAIT_MODE      /* can be selected by the build (-DUART_WAIT_MODE=UART_WAIT_SPIN) , ex: the host benchmark builds both modes */
+#define  UART_WAIT_MODE     UART_WAIT_SLEEP_IDLE
+#endif
+#define  UART_TIMEOUT_CHECK_PERIOD   32  /**< flag polls between two reads of the tick in the timeout functions (1 .. 255) */
    
 
 #endif /* UART_LCFG_H_ */
\ No newline at end of file
@@ -58,6 +58,13 @@
 /************    number of stop bits*****************/
 #define  ONE_STOP_BIT   1
 #define  TWO_STOP_BIT   2
+/************    busy wait mode*****************/
+#define  UART_WAIT_SPIN         0  /**< the busy wait functions poll the flags at full power */
+#define  UART_WAIT_SLEEP_IDLE   1  /**< the busy wait functions sleep in idle mode until the RXC/UDRE interrupt wakes the CPU */
+/************    receive errors (bits of UCSRA)*****************/
+#define  UART_ERROR_PARITY      (1<<2)  /**< the parity of the byte is wrong */
+#define  UART_ERROR_OVERRUN     (1<<3)  /**< bytes were lost before this byte (receive buffer full) */
+#define  UART_ERROR_FRAME       (1<<4)  /**< the stop bit of the byte is 0 (wrong baud rate or noise) */
 
 
 /*-----------------------------------------------------------------------------*/
@@ -112,6 +119,30 @@ void UART_RxDisable(void);
  */
 void UART_Init(void);
 
+/**
+ * @brief Changes the baud rate without changing the frame (data bits , parity , stop bits).
+ *
+ * The byte being sent or received when the baud rate changes is corrupted :
+ * wait for the end of the transmission (the last byte echoed , or the TX complete flag) before the call.
+ * The bytes already received are discarded.
+ *
+ * @param baudRate the new baud rate (BAUD_2400 .. BAUD_28800).
+ * @return Std_Error_t STD_OK , STD_INVALID_ARG if baudRate is not a supported baud rate.
+ */
+Std_Error_t UART_SetBaudRate(u8 baudRate);
+
+/**
+ * @brief Gets the baud rate in use.
+ *
+ * @return u8 the baud rate (BAUD_xxx) set by UART_Init or UART_SetBaudRate.
+ */
+u8 UART_GetBaudRate(void);
+
+/**
+ * @brief Discards the received bytes waiting in the receive buffer (and their error flags).
+ */
+void UART_FlushRx(void);
+
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
 /*                         Send and Receive Functions          	               */
@@ -170,6 +201,55 @@ void UART_SendByteBusyWait(const u8 data);
  */
 u8 UART_ReceiveByteBusyWait(void);
 
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                         Send and Receive Functions          	               */
+/*                               with timeout                                  */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Sends a byte using the UART module with busy waiting until a deadline.
+ *
+ * This function waits until the UART data register is empty or the deadline is reached.
+ * The byte is written only if the data register is empty.
+ * The system tick must be running (SysTick_Init) and the global interrupt enabled.
+ *EX:
+ *	u16 deadline = SysTick_GetTicks() + 5;   // 5 ms
+ *	if(STD_TIMEOUT == UART_ReceiveByteTimeout(&data, deadline)) { ... }
+ * 
+ * @param data The byte to be sent using the UART module.
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t STD_OK if the byte is sent , STD_TIMEOUT if the deadline is reached first.
+ */
+Std_Error_t UART_SendByteTimeout(const u8 data, u16 deadline);
+
+/**
+ * @brief Receives a byte using the UART module with busy waiting until a deadline.
+ *
+ * This function waits until a byte is received or the deadline is reached.
+ * The system tick must be running (SysTick_Init) and the global interrupt enabled.
+ * 
+ * @param pdata A pointer to a variable to store the received byte (not changed on timeout).
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t STD_OK if a byte is received , STD_TIMEOUT if the deadline is reached first.
+ */
+Std_Error_t UART_ReceiveByteTimeout(u8 *pdata, u16 deadline);
+
+/**
+ * @brief Receives a byte and its error flags using the UART module with busy waiting until a deadline.
+ *
+ * The error flags belong to the byte at the head of the receive buffer , they are read before UDR.
+ * The system tick must be running (SysTick_Init) and the global interrupt enabled.
+ * 
+ * @param pdata A pointer to a variable to store the received byte (not changed on timeout).
+ * @param pErrors A pointer to a variable to store the errors of the byte :
+ *                0 or UART_ERROR_FRAME | UART_ERROR_OVERRUN | UART_ERROR_PARITY (not changed on timeout).
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t STD_OK if a byte is received , STD_TIMEOUT if the deadline is reached first.
+ */
+Std_Error_t UART_ReceiveByteStatusTimeout(u8 *pdata, u8 *pErrors, u16 deadline);
+
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
 /*                         Send and Receive Functions          	               */
@@ -188,6 +268,19 @@ u8 UART_ReceiveByteBusyWait(void);
  */
 Std_Status_t UART_ReceiveBytePeriodicCheck(u8*pdata);
 
+/**
+ * @brief Sends a byte using the UART module with periodic checking.
+ *
+ * This function sends a byte using the UART module with periodic checking.
+ * The function checks the UDRE flag : if the data register is empty the byte is written and the function returns STD_DONE,
+ * else the byte is not sent and the function returns STD_PENDING (call it again later with the same byte).
+ * No interrupt or call back is used.
+ * 
+ * @param data The byte to be sent using the UART module.
+ * @return The status of the operation.
+ */
+Std_Status_t UART_SendBytePeriodicCheck(const u8 data);
+
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
 /*                         Interrupt Functions                                 */
@@ -197,6 +290,8 @@ Std_Status_t UART_ReceiveBytePeriodicCheck(u8*pdata);
  void UART_RX_InterruptDisable(void);
  void UART_TX_InterruptEnable(void);
  void UART_TX_InterruptDisable(void);
+ void UART_UDRE_InterruptEnable(void);
+ void UART_UDRE_InterruptDisable(void);
 
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
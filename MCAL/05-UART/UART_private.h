@@ -24,6 +24,10 @@
 #define TX_COMPLETE     1
 #define RX_COMPLETE     1
 
+#if (UART_TIMEOUT_CHECK_PERIOD < 1) || (UART_TIMEOUT_CHECK_PERIOD > 255)
+#error "UART_TIMEOUT_CHECK_PERIOD must be 1 .. 255"
+#endif
+
 /*------------------------------------------------------------------------------*/
 /*                                                                              */
 /*                          Static Global Vaiables                              */
@@ -54,6 +58,57 @@ static void (*pfCallBackUartRXC)(void) = NULL_PTR;
  */
 static void (*pfCallBackUartUDRE)(void) = NULL_PTR;
 
+/**
+ * @brief the baud rate in use (BAUD_xxx) , set by UART_Init and UART_SetBaudRate.
+ */
+static u8 UART_u8BaudRate = BUAD_RATE;
+
+/**
+ * @brief the interrupts (UCSRB_RXCIE , UCSRB_UDRIE bits) enabled only to wake the CPU up from a busy wait.
+ *        Their ISR disables them without calling the call back : the call back of a finished asynchronous
+ *        transfer stays installed and must not run for the bytes of a busy wait.
+ */
+static volatile u8 UART_u8WakeOnly = 0;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                        Static Private Functions                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief Waits until a flag of UCSRA is set or the deadline is reached.
+ *
+ * @param flagMask the mask of the flag in UCSRA.
+ * @param deadline the tick (SysTick_GetTicks) at which the wait stops.
+ * @return Std_Error_t STD_OK if the flag is set , STD_TIMEOUT if the deadline is reached first.
+ */
+static Std_Error_t UART_WaitFlagTimeout(u8 flagMask, u16 deadline);
+
+#if (UART_WAIT_MODE==UART_WAIT_SLEEP_IDLE)
+/**
+ * @brief Enables an interrupt of UCSRB to wake the CPU up only (its ISR does not call the call back).
+ *
+ * @param enableMask the mask of the interrupt in UCSRB (1<<UCSRB_RXCIE or 1<<UCSRB_UDRIE).
+ * @return u8 enableMask if the interrupt is enabled by this call , 0 if it was already enabled (an asynchronous transfer).
+ */
+static u8 UART_WakeOnlyEnable(u8 enableMask);
+
+/**
+ * @brief Disables the interrupt enabled by UART_WakeOnlyEnable if its ISR has not disabled it yet (timeout).
+ *
+ * @param enableMask the return of UART_WakeOnlyEnable.
+ */
+static void UART_WakeOnlyDisable(u8 enableMask);
+#endif
+
+/**
+ * @brief Writes the UBRR value of a baud rate (BAUD_xxx) to UBRRH and UBRRL.
+ *
+ * @param baudRate the index of the baud rate in BaudRateArray.
+ */
+static void UART_WriteBaudRate(u8 baudRate);
+
 // Array to store the baud rate values for different speed modes, CPU frequencies, and baud rates
 static const u16 BaudRateArray[TOTAL_SPEED_MODE][TOTAL_CPU_F][TOTAL_BAUD_RATE] =
 {
@@ -0,0 +1,169 @@
+/**
+ * @file SW_UART_Interface.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the interfacing information of the software UART module.
+ *         The software UART drives several TX/RX channels on any DIO pins from one Timer0 compare match interrupt.
+ *         The timer ticks at 3 x baud rate : every tick counts the bit timers of the channels ,
+ *         writes a TX pin on a bit edge and reads an RX pin to detect the start bit and in the middle of each bit
+ *         (3x oversampling).
+ *         The frame is fixed to 8 data bits, no parity, 1 stop bit and all channels share the same baud rate.
+ *         The API has the same shape as UART_interface.h with the channel ID as first argument.
+ *         The ISR writes the PORT register of the TX pins : the other pins of these ports must be written
+ *         in a critical section (Critical_Enter / Critical_Exit) or the ISR write can be lost.
+ *
+ *         Achievable baud rate per number of channels (TX + RX active on every channel).
+ *         Measured on the compiled ISR (LLVM AVR backend , -Os) : cycles of every tick , interrupt entry and exit
+ *         included , while every channel sends and receives without pause with its TX looped back to its RX.
+ *         The average keeps the ISR under 50% of the CPU time and the longest tick is shorter than the tick period:
+ *
+ *         | channels | cycles per tick (average / longest) | 8 MHz | 16 MHz |
+ *         |----------|-------------------------------------|-------|--------|
+ *         |    1     |              109 / 136              |  9600 | 19200  |
+ *         |    2     |              325 / 404              |  2400 |  4800  |
+ *         |    3     |              423 / 542              |  2400 |  4800  |
+ *         |    4     |              522 / 680              |  2400 |  4800  |
+ *
+ *         From 2 channels the ISR loops over the channels and saves more registers (about 110 cycles).
+ *         A TX only or RX only channel costs about 60 cycles per tick instead of 95.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef SW_UART_INTERFACE_H_
+#define SW_UART_INTERFACE_H_
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define SW_UART_PIN_NOT_USED   0xFF /**< use it in SW_UART_Lcfg.c for a TX only or RX only channel */
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                         initialization Functions                            */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Initializes the software UART module.
+ *
+ * This function prepares the channels configured in SW_UART_Lcfg.c and starts Timer0 in CTC mode
+ * at 3 x SW_UART_BAUD_RATE.
+ * The TX pins must be configured as output and the RX pins as input (pull up) in DIO_Lcfg.c.
+ * The global interrupt must be enabled.
+ */
+void SW_UART_Init(void);
+
+/**
+ * @brief Stops Timer0 and the software UART channels.
+ */
+void SW_UART_DeInit(void);
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                         Send and Receive Functions          	               */
+/*                             with no ckecking                                */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Starts sending a byte on a channel without checking if the channel is busy.
+ *
+ * @param channel The channel ID (index in SW_UART_Lcfg.c).
+ * @param data The byte to be sent.
+ */
+void SW_UART_SendByteNoBlock(u8 channel, const u8 data);
+
+/**
+ * @brief Reads the oldest received byte of a channel without checking if a byte is received.
+ *
+ * @param channel The channel ID (index in SW_UART_Lcfg.c).
+ * @return The byte received.
+ */
+u8 SW_UART_ReceiveByteNoBlock(u8 channel);
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                         Send and Receive Functions          	               */
+/*                             with busy waiting                                */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Sends a byte on a channel with busy waiting.
+ *
+ * The function waits until the previous byte of the channel is sent (including its stop bit)
+ * then starts sending the new byte and returns.
+ *
+ * @param channel The channel ID (index in SW_UART_Lcfg.c).
+ * @param data The byte to be sent.
+ */
+void SW_UART_SendByteBusyWait(u8 channel, const u8 data);
+
+/**
+ * @brief Receives a byte from a channel with busy waiting.
+ *
+ * @param channel The channel ID (index in SW_UART_Lcfg.c).
+ * @return The byte received.
+ */
+u8 SW_UART_ReceiveByteBusyWait(u8 channel);
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                         Send and Receive Functions          	               */
+/*                           with periodic checking                            */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Starts sending a byte on a channel if it is free.
+ *
+ * @param channel The channel ID (index in SW_UART_Lcfg.c).
+ * @param data The byte to be sent.
+ * @return Std_Status_t STD_DONE if the byte is accepted , STD_PENDING if the channel is still busy.
+ */
+Std_Status_t SW_UART_SendBytePeriodicCheck(u8 channel, const u8 data);
+
+/**
+ * @brief Receives a byte from a channel with periodic checking.
+ *
+ * @param channel The channel ID (index in SW_UART_Lcfg.c).
+ * @param pdata A pointer to a variable to store the received byte.
+ * @return Std_Status_t STD_DONE if a byte is read , STD_PENDING if no byte is received yet.
+ */
+Std_Status_t SW_UART_ReceiveBytePeriodicCheck(u8 channel, u8 *pdata);
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                         Error Functions                                     */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Gets the number of frames with a bad stop bit received on a channel.
+ *
+ * @param channel The channel ID (index in SW_UART_Lcfg.c).
+ * @return u8 the frame error counter (saturates at 255).
+ */
+u8 SW_UART_GetFrameErrors(u8 channel);
+
+/**
+ * @brief Gets the number of bytes lost because the RX buffer of a channel was full.
+ *
+ * @param channel The channel ID (index in SW_UART_Lcfg.c).
+ * @return u8 the overrun counter (saturates at 255).
+ */
+u8 SW_UART_GetOverruns(u8 channel);
+
+
+#endif /* SW_UART_INTERFACE_H_ */
@@ -0,0 +1,46 @@
+/**
+ * @file SW_UART_Lcfg.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  this file contains the configuration of the software UART channels
+ *          - the TX pin of the channel (or SW_UART_PIN_NOT_USED)
+ *          - the RX pin of the channel (or SW_UART_PIN_NOT_USED)
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+* LIB
+*/
+#include "Std_Types.h"
+
+/*
+* Include MCAL layer files
+*/
+#include "DIO_Interface.h"
+
+/*
+* Include own files
+*/
+#include "SW_UART_Interface.h"
+#include "SW_UART_Lcfg.h"
+#include "SW_UART_Private.h"
+
+
+/*
+*  the channel ID is the index of the channel in this array.
+*  TX pins must be outputs and RX pins must be inputs (pull up) in DIO_Lcfg.c
+*/
+const SW_UART_CONFIG_t SW_UART_arrOfChannels[SW_UART_CHANNELS]=
+{
+	{
+		.SW_UART_TX_Pin=PA0,
+		.SW_UART_RX_Pin=PA1
+	},
+	{
+		.SW_UART_TX_Pin=SW_UART_PIN_NOT_USED,
+		.SW_UART_RX_Pin=PA2
+	}
+};
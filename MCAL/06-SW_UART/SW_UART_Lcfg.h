@@ -0,0 +1,28 @@
+/**
+ * @file SW_UART_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the configurations of the software UART module.
+ *         The user must configure the number of channels, the baud rate and the RX buffer size.
+ *         The pins of each channel are configured in SW_UART_Lcfg.c.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef SW_UART_LCFG_H_
+#define SW_UART_LCFG_H_
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*                   CHANGE THIS PART TO YOUR NEEDS                           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/******************* software UART configuration*********************************/
+#define  SW_UART_CHANNELS          2      /**< number of channels in SW_UART_Lcfg.c */
+#define  SW_UART_BAUD_RATE         2400   /**< baud rate of all the channels @see SW_UART_Interface.h for the limits */
+#define  SW_UART_RX_BUFFER_SIZE    8      /**< RX buffer size of each channel , must be a power of 2 (2 .. 128) */
+
+
+#endif /* SW_UART_LCFG_H_ */
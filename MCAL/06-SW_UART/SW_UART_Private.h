@@ -0,0 +1,116 @@
+/**
+ * @file SW_UART_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private information of the software UART module.
+ *         The user must not include this file in the application code.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef SW_UART_PRIVATE_H_
+#define SW_UART_PRIVATE_H_
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Macros                                 */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+#define SW_UART_OVERSAMPLING     3      /**< timer ticks per bit */
+#define SW_UART_TX_FRAME_BITS    10     /**< start + 8 data + stop */
+#define SW_UART_RX_FRAME_BITS    9      /**< 8 data + stop (the start bit is detected not sampled) */
+#define SW_UART_RX_FIRST_SAMPLE  4      /**< ticks from the start bit detection to the middle of the first data bit */
+#define SW_UART_TOTAL_PORTS      4
+#define SW_UART_BUFFER_MASK      (SW_UART_RX_BUFFER_SIZE-1)
+
+/* timer clocks between two ticks and the smallest prescaler that fits in the 8-bit OCR0 */
+#define SW_UART_TICK_CLOCKS      (F_CPU/(SW_UART_OVERSAMPLING*1UL*SW_UART_BAUD_RATE))
+#if   (SW_UART_TICK_CLOCKS <= 256UL)
+#define SW_UART_PRESCALER_BITS   0b001
+#define SW_UART_OCR0_VALUE       (SW_UART_TICK_CLOCKS-1)
+#elif ((SW_UART_TICK_CLOCKS/8UL) <= 256UL)
+#define SW_UART_PRESCALER_BITS   0b010
+#define SW_UART_OCR0_VALUE       ((SW_UART_TICK_CLOCKS/8UL)-1)
+#elif ((SW_UART_TICK_CLOCKS/64UL) <= 256UL)
+#define SW_UART_PRESCALER_BITS   0b011
+#define SW_UART_OCR0_VALUE       ((SW_UART_TICK_CLOCKS/64UL)-1)
+#else
+#error "SW_UART_BAUD_RATE is too low for Timer0"
+#endif
+
+#if ((SW_UART_RX_BUFFER_SIZE & SW_UART_BUFFER_MASK) != 0)
+#error "SW_UART_RX_BUFFER_SIZE must be a power of 2"
+#endif
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+typedef struct
+{
+	u8 SW_UART_TX_Pin; /**< DIO_PIN_t of the TX pin or SW_UART_PIN_NOT_USED */
+	u8 SW_UART_RX_Pin; /**< DIO_PIN_t of the RX pin or SW_UART_PIN_NOT_USED */
+}SW_UART_CONFIG_t;
+
+/**
+ * @brief run time state of one channel (pins are converted to register + bit mask once in SW_UART_Init).
+ */
+typedef struct
+{
+	/* TX */
+	volatile u8 *pTxPort;     /**< PORT register of the TX pin */
+	u8           TxMask;      /**< 0 if the channel has no TX pin */
+	u16          TxShift;     /**< frame bits , LSB is sent first */
+	u8           TxBitsLeft;
+	volatile u8  TxTick;      /**< ticks to the next bit , the channel is busy while it is not zero */
+	/* RX */
+	volatile u8 *pRxPin;      /**< PIN register of the RX pin */
+	u8           RxMask;      /**< 0 if the channel has no RX pin */
+	u8           RxShift;
+	u8           RxBitsLeft;  /**< 0 means waiting for a start bit */
+	u8           RxTick;
+	u8           RxBuffer[SW_UART_RX_BUFFER_SIZE];
+	volatile u8  RxHead;      /**< written by the ISR */
+	volatile u8  RxTail;      /**< written by the application */
+	volatile u8  FrameErrors;
+	volatile u8  Overruns;
+}SW_UART_CHANNEL_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                               Configuration                                  */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+extern const SW_UART_CONFIG_t SW_UART_arrOfChannels[SW_UART_CHANNELS];
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                       Timer0 Registers BitMap                                */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+enum {
+	TCCR0_CS00 = 0, // Clock Select
+	TCCR0_CS01,     // Clock Select
+	TCCR0_CS02,     // Clock Select
+	TCCR0_WGM01,    // Waveform Generation Mode
+	TCCR0_COM00,    // Compare Match Output Mode
+	TCCR0_COM01,    // Compare Match Output Mode
+	TCCR0_WGM00,    // Waveform Generation Mode
+	TCCR0_FOC0      // Force Output Compare
+};
+
+enum {
+	TIMSK_TOIE0 = 0, // Timer/Counter0 Overflow Interrupt Enable
+	TIMSK_OCIE0      // Timer/Counter0 Output Compare Match Interrupt Enable
+};
+
+
+#endif /* SW_UART_PRIVATE_H_ */
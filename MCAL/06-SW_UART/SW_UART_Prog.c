@@ -0,0 +1,359 @@
+/**
+ * @file SW_UART_Prog.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Software UART driver implementation file
+ *  	   One Timer0 compare match ISR services all the channels :
+ *  	   it shifts the TX channels and samples the RX channels.
+ *  	   The registers of the pins are resolved once in SW_UART_Init so the ISR reads or writes
+ *  	   a pin only on the ticks of a bit edge or a sample.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * LIB files
+ */
+#include "Std_Types.h"
+#include "MemMap.h"
+#include "Utils_interrupt.h"
+#include "Utils_BitMath.h"
+
+/*
+ * MCAL layer files
+ */
+#include "MCU_config.h"
+
+/*
+ * the module files
+ */
+#include "SW_UART_Interface.h"
+#include "SW_UART_Lcfg.h"
+#include "SW_UART_Private.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                Port Tables                                   */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/* indexed by DIO_PIN_t / 8 */
+static volatile u8 * const SW_UART_arrOfPin[SW_UART_TOTAL_PORTS]={&PINA,&PINB,&PINC,&PIND};
+static volatile u8 * const SW_UART_arrOfPort[SW_UART_TOTAL_PORTS]={&PORTA,&PORTB,&PORTC,&PORTD};
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                     Static Private Global Vaiables                           */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static SW_UART_CHANNEL_t SW_UART_arrOfChannelState[SW_UART_CHANNELS];
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                         initialization Functions                            */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Initializes the software UART module.
+ *
+ * This function prepares the channels configured in SW_UART_Lcfg.c and starts Timer0 in CTC mode
+ * at 3 x SW_UART_BAUD_RATE.
+ * The TX pins must be configured as output and the RX pins as input (pull up) in DIO_Lcfg.c.
+ * The global interrupt must be enabled.
+ */
+void SW_UART_Init(void)
+{
+	SW_UART_CHANNEL_t *chan;
+	u8 sregCopy;
+	u8 ch;
+
+	// a second init must not race with the ISR of the first one
+	SW_UART_DeInit();
+	for(ch=0; ch<SW_UART_CHANNELS; ch++)
+	{
+		chan=&SW_UART_arrOfChannelState[ch];
+		chan->TxMask=0;
+		chan->TxTick=0;
+		chan->RxMask=0;
+		chan->RxBitsLeft=0;
+		chan->RxHead=0;
+		chan->RxTail=0;
+		chan->FrameErrors=0;
+		chan->Overruns=0;
+
+		if(SW_UART_PIN_NOT_USED != SW_UART_arrOfChannels[ch].SW_UART_TX_Pin)
+		{
+			chan->pTxPort=SW_UART_arrOfPort[SW_UART_arrOfChannels[ch].SW_UART_TX_Pin/8];
+			chan->TxMask=1<<(SW_UART_arrOfChannels[ch].SW_UART_TX_Pin%8);
+			// idle line is high , the other pins of the port may be written by an ISR
+			Critical_Enter(sregCopy);
+			*chan->pTxPort |= chan->TxMask;
+			Critical_Exit(sregCopy);
+		}
+		if(SW_UART_PIN_NOT_USED != SW_UART_arrOfChannels[ch].SW_UART_RX_Pin)
+		{
+			chan->pRxPin=SW_UART_arrOfPin[SW_UART_arrOfChannels[ch].SW_UART_RX_Pin/8];
+			chan->RxMask=1<<(SW_UART_arrOfChannels[ch].SW_UART_RX_Pin%8);
+		}
+	}
+
+	// Timer0 : CTC mode , OC0 disconnected , tick = 3 x baud rate
+	TCCR0=0;
+	TCNT0=0;
+	OCR0=(u8)SW_UART_OCR0_VALUE;
+	TCCR0=(1<<TCCR0_WGM01)|SW_UART_PRESCALER_BITS;
+	// TIMSK is shared with the other timers
+	Critical_Enter(sregCopy);
+	set_bit(TIMSK,TIMSK_OCIE0);
+	Critical_Exit(sregCopy);
+}
+
+/**
+ * @brief Stops Timer0 and the software UART channels.
+ */
+void SW_UART_DeInit(void)
+{
+	u8 sregCopy;
+
+	Critical_Enter(sregCopy);
+	clear_bit(TIMSK,TIMSK_OCIE0);
+	Critical_Exit(sregCopy);
+	TCCR0=0;
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                         Send and Receive Functions          	               */
+/*                             with no ckecking                                */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Starts sending a byte on a channel without checking if the channel is busy.
+ *
+ * @param channel The channel ID (index in SW_UART_Lcfg.c).
+ * @param data The byte to be sent.
+ */
+void SW_UART_SendByteNoBlock(u8 channel, const u8 data)
+{
+	SW_UART_CHANNEL_t *chan=&SW_UART_arrOfChannelState[channel];
+	u8 sregCopy;
+
+	// the ISR must not see a half written frame , TIMSK is not touched (it is shared with the other timers)
+	Critical_Enter(sregCopy);
+	chan->TxShift=((u16)data<<1)|(1<<9); // start bit (0) + data + stop bit (1)
+	chan->TxBitsLeft=SW_UART_TX_FRAME_BITS;
+	chan->TxTick=1;                      // the start bit goes out on the next tick
+	Critical_Exit(sregCopy);
+}
+
+/**
+ * @brief Reads the oldest received byte of a channel without checking if a byte is received.
+ *
+ * @param channel The channel ID (index in SW_UART_Lcfg.c).
+ * @return The byte received.
+ */
+u8 SW_UART_ReceiveByteNoBlock(u8 channel)
+{
+	SW_UART_CHANNEL_t *chan=&SW_UART_arrOfChannelState[channel];
+	u8 data=chan->RxBuffer[chan->RxTail];
+	chan->RxTail=(chan->RxTail+1)&SW_UART_BUFFER_MASK;
+	return data;
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                         Send and Receive Functions          	               */
+/*                             with busy waiting                                */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Sends a byte on a channel with busy waiting.
+ *
+ * The function waits until the previous byte of the channel is sent (including its stop bit)
+ * then starts sending the new byte and returns.
+ *
+ * @param channel The channel ID (index in SW_UART_Lcfg.c).
+ * @param data The byte to be sent.
+ */
+void SW_UART_SendByteBusyWait(u8 channel, const u8 data)
+{
+	while(0!=SW_UART_arrOfChannelState[channel].TxTick);
+	SW_UART_SendByteNoBlock(channel,data);
+}
+
+/**
+ * @brief Receives a byte from a channel with busy waiting.
+ *
+ * @param channel The channel ID (index in SW_UART_Lcfg.c).
+ * @return The byte received.
+ */
+u8 SW_UART_ReceiveByteBusyWait(u8 channel)
+{
+	SW_UART_CHANNEL_t *chan=&SW_UART_arrOfChannelState[channel];
+	while(chan->RxHead==chan->RxTail);
+	return SW_UART_ReceiveByteNoBlock(channel);
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                         Send and Receive Functions          	               */
+/*                           with periodic checking                            */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Starts sending a byte on a channel if it is free.
+ *
+ * @param channel The channel ID (index in SW_UART_Lcfg.c).
+ * @param data The byte to be sent.
+ * @return Std_Status_t STD_DONE if the byte is accepted , STD_PENDING if the channel is still busy.
+ */
+Std_Status_t SW_UART_SendBytePeriodicCheck(u8 channel, const u8 data)
+{
+	Std_Status_t status=STD_PENDING;
+	if(0==SW_UART_arrOfChannelState[channel].TxTick)
+	{
+		SW_UART_SendByteNoBlock(channel,data);
+		status=STD_DONE;
+	}
+	return status;
+}
+
+/**
+ * @brief Receives a byte from a channel with periodic checking.
+ *
+ * @param channel The channel ID (index in SW_UART_Lcfg.c).
+ * @param pdata A pointer to a variable to store the received byte.
+ * @return Std_Status_t STD_DONE if a byte is read , STD_PENDING if no byte is received yet.
+ */
+Std_Status_t SW_UART_ReceiveBytePeriodicCheck(u8 channel, u8 *pdata)
+{
+	Std_Status_t status=STD_PENDING;
+	SW_UART_CHANNEL_t *chan=&SW_UART_arrOfChannelState[channel];
+	if(chan->RxHead!=chan->RxTail)
+	{
+		*pdata=SW_UART_ReceiveByteNoBlock(channel);
+		status=STD_DONE;
+	}
+	return status;
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                         Error Functions                                     */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Gets the number of frames with a bad stop bit received on a channel.
+ *
+ * @param channel The channel ID (index in SW_UART_Lcfg.c).
+ * @return u8 the frame error counter (saturates at 255).
+ */
+u8 SW_UART_GetFrameErrors(u8 channel)
+{
+	return SW_UART_arrOfChannelState[channel].FrameErrors;
+}
+
+/**
+ * @brief Gets the number of bytes lost because the RX buffer of a channel was full.
+ *
+ * @param channel The channel ID (index in SW_UART_Lcfg.c).
+ * @return u8 the overrun counter (saturates at 255).
+ */
+u8 SW_UART_GetOverruns(u8 channel)
+{
+	return SW_UART_arrOfChannelState[channel].Overruns;
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                         Interrupt Service Routines                          */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+ISR(TIMER0_COMP_VECT)
+{
+	SW_UART_CHANNEL_t *chan;
+	u8 level, next;
+
+	// the I-bit is cleared in the ISR : the read-modify-write of the ports can not be interrupted here
+	for(chan=&SW_UART_arrOfChannelState[0]; chan<&SW_UART_arrOfChannelState[SW_UART_CHANNELS]; chan++)
+	{
+		/* TX : a new bit every 3 ticks , TxTick keeps counting during the stop bit */
+		if(0!=chan->TxTick)
+		{
+			chan->TxTick--;
+			if((0==chan->TxTick) && (0!=chan->TxBitsLeft))
+			{
+				if(chan->TxShift & 1)
+				{
+					*chan->pTxPort |= chan->TxMask;
+				}
+				else
+				{
+					*chan->pTxPort &= (u8)~chan->TxMask;
+				}
+				chan->TxShift>>=1;
+				chan->TxBitsLeft--;
+				// the channel is free on the last tick of the stop bit : the next start bit follows without a gap
+				chan->TxTick=(0!=chan->TxBitsLeft) ? SW_UART_OVERSAMPLING : (SW_UART_OVERSAMPLING-1);
+			}
+		}
+
+		/* RX : detect the falling edge of the start bit then sample in the middle of each bit */
+		if(0!=chan->RxMask)
+		{
+			if(0==chan->RxBitsLeft)
+			{
+				if(0==(*chan->pRxPin & chan->RxMask))
+				{
+					chan->RxBitsLeft=SW_UART_RX_FRAME_BITS;
+					chan->RxTick=SW_UART_RX_FIRST_SAMPLE;
+				}
+			}
+			else
+			{
+				chan->RxTick--;
+				if(0==chan->RxTick)
+				{
+					level=*chan->pRxPin & chan->RxMask;
+					chan->RxTick=SW_UART_OVERSAMPLING;
+					chan->RxBitsLeft--;
+					if(0!=chan->RxBitsLeft)
+					{
+						chan->RxShift>>=1;
+						if(0!=level)
+						{
+							chan->RxShift|=0x80;
+						}
+					}
+					else if(0==level)
+					{
+						// stop bit is low
+						if(0xFF!=chan->FrameErrors)
+						{
+							chan->FrameErrors++;
+						}
+					}
+					else
+					{
+						next=(chan->RxHead+1)&SW_UART_BUFFER_MASK;
+						if(next!=chan->RxTail)
+						{
+							chan->RxBuffer[chan->RxHead]=chan->RxShift;
+							chan->RxHead=next;
+						}
+						else if(0xFF!=chan->Overruns)
+						{
+							chan->Overruns++;
+						}
+					}
+				}
+			}
+		}
+	}
+}
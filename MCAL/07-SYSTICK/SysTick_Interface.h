@@ -0,0 +1,70 @@
+/**
+ * @file SysTick_Interface.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the interfacing information of the system tick module.
+ *         The system tick is a 1 ms monotonic time base made with Timer2 in CTC mode.
+ *         It is shared by the modules that need a time base (delays with sleep , timeouts , ...).
+ *         The counter is 16-bit so it wraps every 65.536 seconds,
+ *         always compare ticks with a subtraction (now - start) , never with '<' or '>'.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef SYSTICK_INTERFACE_H_
+#define SYSTICK_INTERFACE_H_
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define SYSTICK_TICK_MS      1   /**< period of one tick in milliseconds */
+
+/**
+ * @brief checks if the deadline (in ticks) is reached , works across the counter wrap
+ *        as long as the deadline is less than 32767 ticks away.
+ */
+#define SysTick_IsExpired(now,deadline)   ((s16)((u16)(now)-(u16)(deadline)) >= 0)
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Starts Timer2 in CTC mode with a 1 ms compare match interrupt.
+ *        The global interrupt must be enabled for the tick to count.
+ */
+void SysTick_Init(void);
+
+/**
+ * @brief Reads the tick counter.
+ *
+ * @return u16 the number of ticks since SysTick_Init (wraps at 65535).
+ */
+u16 SysTick_GetTicks(void);
+
+/**
+ * @brief Checks if the system tick is running.
+ *
+ * @return Std_Bool_t STD_TRUE after SysTick_Init.
+ */
+Std_Bool_t SysTick_IsRunning(void);
+
+/**
+ * @brief Waits at least the given number of milliseconds with the CPU in idle sleep mode.
+ *
+ * The CPU is woken up by the tick interrupt (or any other interrupt) and goes back to sleep
+ * until the time is elapsed, so the delay may be up to 1 ms longer than requested.
+ * If the system tick is not running or the global interrupt is disabled it busy waits like _delay_ms.
+ *
+ * @param ms the delay in milliseconds (less than 32767).
+ */
+void SysTick_DelayMs(u16 ms);
+
+
+#endif /* SYSTICK_INTERFACE_H_ */
@@ -0,0 +1,68 @@
+/**
+ * @file SysTick_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private information of the system tick module.
+ *         The user must not include this file in the application code.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef SYSTICK_PRIVATE_H_
+#define SYSTICK_PRIVATE_H_
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Macros                                 */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+/* 125 timer clocks per tick , the prescaler is F_CPU / 125 kHz */
+#define SYSTICK_OCR2_VALUE    124
+#if   (F_CPU == 4000000UL)
+#define SYSTICK_PRESCALER_BITS  0b011 /**< clk/32 */
+#elif (F_CPU == 8000000UL)
+#define SYSTICK_PRESCALER_BITS  0b100 /**< clk/64 */
+#elif (F_CPU == 16000000UL)
+#define SYSTICK_PRESCALER_BITS  0b101 /**< clk/128 */
+#else
+#error "SysTick supports F_CPU 4 MHz , 8 MHz and 16 MHz only"
+#endif
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                     Static Private Global Vaiables                           */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static volatile u16 SysTick_u16Ticks = 0;
+static Std_Bool_t   SysTick_isRunning = STD_FALSE;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                       Timer2 Registers BitMap                                */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+enum {
+	TCCR2_CS20 = 0, // Clock Select
+	TCCR2_CS21,     // Clock Select
+	TCCR2_CS22,     // Clock Select
+	TCCR2_WGM21,    // Waveform Generation Mode
+	TCCR2_COM20,    // Compare Match Output Mode
+	TCCR2_COM21,    // Compare Match Output Mode
+	TCCR2_WGM20,    // Waveform Generation Mode
+	TCCR2_FOC2      // Force Output Compare
+};
+
+enum {
+	TIMSK_TOIE2 = 6, // Timer/Counter2 Overflow Interrupt Enable
+	TIMSK_OCIE2      // Timer/Counter2 Output Compare Match Interrupt Enable
+};
+
+
+#endif /* SYSTICK_PRIVATE_H_ */
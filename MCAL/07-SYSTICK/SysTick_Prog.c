@@ -0,0 +1,117 @@
+/**
+ * @file SysTick_Prog.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  System tick driver implementation file
+ *  	   Timer2 runs in CTC mode and its compare match interrupt increments a 1 ms tick counter.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * LIB files
+ */
+#include "Std_Types.h"
+#include "MemMap.h"
+#include "Utils_interrupt.h"
+#include "Utils_BitMath.h"
+#include "Utils_Sleep.h"
+
+/*
+ * MCAL layer files
+ */
+#include "MCU_config.h"
+
+/*
+ * the module files
+ */
+#include "SysTick_Interface.h"
+#include "SysTick_Private.h"
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Starts Timer2 in CTC mode with a 1 ms compare match interrupt.
+ *        The global interrupt must be enabled for the tick to count.
+ */
+void SysTick_Init(void)
+{
+	TCCR2=0;
+	TCNT2=0;
+	OCR2=SYSTICK_OCR2_VALUE;
+	TCCR2=(1<<TCCR2_WGM21)|SYSTICK_PRESCALER_BITS;
+	set_bit(TIMSK,TIMSK_OCIE2);
+	SysTick_isRunning=STD_TRUE;
+}
+
+/**
+ * @brief Reads the tick counter.
+ *
+ * @return u16 the number of ticks since SysTick_Init (wraps at 65535).
+ */
+u16 SysTick_GetTicks(void)
+{
+	u16 ticks;
+	u8 sregCopy;
+
+	// the 16-bit counter is read in two instructions , the tick ISR must not run in between
+	Critical_Enter(sregCopy);
+	ticks=SysTick_u16Ticks;
+	Critical_Exit(sregCopy);
+
+	return ticks;
+}
+
+/**
+ * @brief Checks if the system tick is running.
+ *
+ * @return Std_Bool_t STD_TRUE after SysTick_Init.
+ */
+Std_Bool_t SysTick_IsRunning(void)
+{
+	return SysTick_isRunning;
+}
+
+/**
+ * @brief Waits at least the given number of milliseconds with the CPU in idle sleep mode.
+ *
+ * The CPU is woken up by the tick interrupt (or any other interrupt) and goes back to sleep
+ * until the time is elapsed, so the delay may be up to 1 ms longer than requested.
+ * If the system tick is not running or the global interrupt is disabled it busy waits like _delay_ms.
+ *
+ * @param ms the delay in milliseconds (less than 32767).
+ */
+void SysTick_DelayMs(u16 ms)
+{
+	u16 start;
+
+	if((STD_FALSE==SysTick_isRunning) || (0==get_bit(SREG,SLEEP_SREG_I)))
+	{
+		for(; ms>0; ms--)
+		{
+			_delay_ms(1);
+		}
+	}
+	else
+	{
+		start=SysTick_GetTicks();
+		// '>' not '>=' : the first tick may come just after start
+		Sleep_IdleWaitUntil((u16)(SysTick_GetTicks()-start) > ms);
+	}
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                         Interrupt Service Routines                          */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+ISR(TIMER2_COMP_VECT)
+{
+	SysTick_u16Ticks++;
+}
@@ -0,0 +1,440 @@
+/**
+ * @file ARQ.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the selective repeat ARQ.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * LIB files
+ */
+#include "Std_Types.h"
+
+/*
+ * MCAL layer files
+ */
+#include "SysTick_Interface.h"
+
+/*
+ * Services files
+ */
+#include "CRC.h"
+#include "COBS.h"
+
+/*
+ * the module files
+ */
+#include "ARQ.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PRIVATE Macros                                  */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define ARQ_TYPE_DATA        0x01
+#define ARQ_TYPE_ACK         0x02
+#define ARQ_TYPE_NAK         0x03
+
+/* the slot of a sequence number is seq % ARQ_WINDOW_SIZE , it must stay the same when seq wraps at 256 */
+#if ((ARQ_WINDOW_SIZE & (ARQ_WINDOW_SIZE-1)) != 0) || (ARQ_WINDOW_SIZE > 64)
+#error "ARQ_WINDOW_SIZE must be a power of 2 and not more than 64"
+#endif
+#if (ARQ_MAX_PAYLOAD > 250) || (ARQ_MAX_PAYLOAD == 0)
+#error "ARQ_MAX_PAYLOAD must be 1 .. 250"
+#endif
+
+#define ARQ_SLOT(seq)        ((seq) & (ARQ_WINDOW_SIZE-1))
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Builds a frame , adds its CRC and sends it COBS encoded.
+ *
+ * @param link the link (from ARQ_Init).
+ * @param type ARQ_TYPE_DATA , ARQ_TYPE_ACK or ARQ_TYPE_NAK.
+ * @param seq the sequence number.
+ * @param payload the data (NULL_PTR if len is 0).
+ * @param len the number of data bytes.
+ */
+static void ARQ_SendFrame(ARQ_Link_t *link, u8 type, u8 seq, const u8 payload[], u8 len)
+{
+	u8 frame[ARQ_FRAME_SIZE];
+	u8 encoded[COBS_MAX_ENCODED_LEN(ARQ_FRAME_SIZE)];
+	u16 encodedLen=0;
+	u16 crc;
+	u8 i;
+
+	frame[0]=type;
+	frame[1]=seq;
+	frame[2]=len;
+	for(i=0; i<len; i++)
+	{
+		frame[ARQ_HEADER_SIZE+i]=payload[i];
+	}
+	crc=CRC16_Calculate(frame, ARQ_HEADER_SIZE+len);
+	frame[ARQ_HEADER_SIZE+len]=(u8)(crc>>8);
+	frame[ARQ_HEADER_SIZE+len+1]=(u8)crc;
+
+	// encoded in a buffer : the sink of COBS_EncodeToSink has no argument to know the link
+	COBS_Encode(frame, ARQ_HEADER_SIZE+len+ARQ_CRC_SIZE, encoded, sizeof(encoded), &encodedLen);
+	for(i=0; i<encodedLen; i++)
+	{
+		link->pConfig->pfSendByte(encoded[i]);
+	}
+	link->pConfig->pfSendByte(COBS_DELIMITER);
+	link->Stats.LineBytesSent+=encodedLen+1;
+}
+
+/**
+ * @brief Sends a data frame that is in the TX window and starts its timer.
+ *
+ * @param link the link (from ARQ_Init).
+ * @param seq the sequence number of the frame.
+ */
+static void ARQ_SendData(ARQ_Link_t *link, u8 seq)
+{
+	ARQ_Slot_t *slot=&link->TxSlots[ARQ_SLOT(seq)];
+
+	ARQ_SendFrame(link, ARQ_TYPE_DATA, seq, slot->Data, slot->Len);
+	slot->SentTick=SysTick_GetTicks();
+}
+
+/**
+ * @brief Sends again a data frame of the TX window.
+ *
+ * @param link the link (from ARQ_Init).
+ * @param seq the sequence number of the frame.
+ */
+static void ARQ_Retransmit(ARQ_Link_t *link, u8 seq)
+{
+	ARQ_Slot_t *slot=&link->TxSlots[ARQ_SLOT(seq)];
+
+	if(slot->Retries >= ARQ_MAX_RETRIES)
+	{
+		link->LinkStatus=STD_ERROR;
+		return;
+	}
+	slot->Retries++;
+	link->Stats.Retransmissions++;
+	ARQ_SendData(link, seq);
+}
+
+/**
+ * @brief Checks if a sequence number is in flight (sent and not out of the TX window).
+ *
+ * @param link the link (from ARQ_Init).
+ * @param seq the sequence number.
+ * @return u8 1 if it is in flight.
+ */
+static u8 ARQ_TxIsInFlight(const ARQ_Link_t *link, u8 seq)
+{
+	return ((u8)(seq-link->TxBase) < (u8)(link->TxNextSeq-link->TxBase)) ? 1 : 0;
+}
+
+/**
+ * @brief Handles a received data frame : ACKs it , keeps it and delivers the frames that are in order.
+ *
+ * @param link the link (from ARQ_Init).
+ * @param seq the sequence number of the frame.
+ * @param payload the data.
+ * @param len the number of data bytes.
+ */
+static void ARQ_HandleData(ARQ_Link_t *link, u8 seq, const u8 payload[], u8 len)
+{
+	ARQ_Slot_t *slot;
+	u8 i, idx;
+
+	if((u8)(seq-link->RxExpected) < ARQ_WINDOW_SIZE)
+	{
+		idx=ARQ_SLOT(seq);
+		if(0 == link->RxStored[idx])
+		{
+			slot=&link->RxSlots[idx];
+			for(i=0; i<len; i++)
+			{
+				slot->Data[i]=payload[i];
+			}
+			slot->Len=len;
+			link->RxStored[idx]=1;
+		}
+		ARQ_SendFrame(link, ARQ_TYPE_ACK, seq, NULL_PTR, 0);
+
+		// a frame after a missing one : ask for the missing one now instead of waiting for its timer
+		if((seq != link->RxExpected) && (0 == link->RxNakSent))
+		{
+			ARQ_SendFrame(link, ARQ_TYPE_NAK, link->RxExpected, NULL_PTR, 0);
+			link->RxNakSent=1;
+		}
+
+		// deliver in order
+		idx=ARQ_SLOT(link->RxExpected);
+		while(1 == link->RxStored[idx])
+		{
+			link->pConfig->pfDeliver(link->RxSlots[idx].Data, link->RxSlots[idx].Len);
+			link->Stats.PayloadBytesDelivered+=link->RxSlots[idx].Len;
+			link->RxStored[idx]=0;
+			link->RxExpected++;
+			link->RxNakSent=0;
+			idx=ARQ_SLOT(link->RxExpected);
+		}
+	}
+	else if((u8)(link->RxExpected-seq) <= ARQ_WINDOW_SIZE)
+	{
+		// already delivered , our ACK was lost
+		ARQ_SendFrame(link, ARQ_TYPE_ACK, seq, NULL_PTR, 0);
+	}
+	else
+	{
+		// out of both windows , ignored
+	}
+}
+
+/**
+ * @brief Handles a received ACK : the frame is not sent again and the TX window slides over the ACKed frames.
+ *
+ * @param link the link (from ARQ_Init).
+ * @param seq the sequence number of the ACKed frame.
+ */
+static void ARQ_HandleAck(ARQ_Link_t *link, u8 seq)
+{
+	if(1 == ARQ_TxIsInFlight(link, seq))
+	{
+		link->TxSlots[ARQ_SLOT(seq)].Acked=1;
+		while((link->TxBase != link->TxNextSeq) && (1 == link->TxSlots[ARQ_SLOT(link->TxBase)].Acked))
+		{
+			link->TxBase++;
+		}
+	}
+}
+
+/**
+ * @brief Handles a received NAK : the frame is sent again now.
+ *
+ * @param link the link (from ARQ_Init).
+ * @param seq the sequence number of the missing frame.
+ */
+static void ARQ_HandleNak(ARQ_Link_t *link, u8 seq)
+{
+	if((1 == ARQ_TxIsInFlight(link, seq)) && (0 == link->TxSlots[ARQ_SLOT(seq)].Acked))
+	{
+		ARQ_Retransmit(link, seq);
+	}
+}
+
+/**
+ * @brief Checks a decoded frame and passes it to its handler.
+ *
+ * @param link the link (from ARQ_Init).
+ * @param frame the decoded frame.
+ * @param len the number of bytes of the frame.
+ */
+static void ARQ_HandleFrame(ARQ_Link_t *link, const u8 frame[], u16 len)
+{
+	u16 crc;
+
+	if((len < (ARQ_HEADER_SIZE+ARQ_CRC_SIZE)) || (len != (u16)(ARQ_HEADER_SIZE+frame[2]+ARQ_CRC_SIZE)))
+	{
+		link->Stats.BadFrames++;
+		return;
+	}
+	crc=((u16)frame[len-2]<<8) | frame[len-1];
+	if(crc != CRC16_Calculate(frame, len-ARQ_CRC_SIZE))
+	{
+		link->Stats.BadFrames++;
+		return;
+	}
+
+	switch(frame[0])
+	{
+	case ARQ_TYPE_DATA:
+		if((0 != frame[2]) && (frame[2] <= ARQ_MAX_PAYLOAD))
+		{
+			ARQ_HandleData(link, frame[1], &frame[ARQ_HEADER_SIZE], frame[2]);
+		}
+		break;
+	case ARQ_TYPE_ACK:
+		ARQ_HandleAck(link, frame[1]);
+		break;
+	case ARQ_TYPE_NAK:
+		ARQ_HandleNak(link, frame[1]);
+		break;
+	default:
+		link->Stats.BadFrames++;
+		break;
+	}
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Initializes (or resets) the link , all the frames in flight are dropped.
+ *        The two sides must be initialized before sending.
+ *
+ * @param link the link (owned by the caller , several links can run at the same time).
+ * @param config the link functions (must stay valid).
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NULL_POINTER if link , config or one of its functions is NULL_PTR
+ */
+Std_Error_t ARQ_Init(ARQ_Link_t *link, const ARQ_Config_t *config)
+{
+	u8 i;
+
+	if((NULL_PTR == link) || (NULL_PTR == config) || (NULL_PTR == config->pfSendByte) || (NULL_PTR == config->pfReceiveByte) || (NULL_PTR == config->pfDeliver))
+	{
+		return STD_NULL_POINTER;
+	}
+
+	link->pConfig=config;
+	link->TxBase=0;
+	link->TxNextSeq=0;
+	link->RxExpected=0;
+	link->RxNakSent=0;
+	for(i=0; i<ARQ_WINDOW_SIZE; i++)
+	{
+		link->RxStored[i]=0;
+	}
+	link->Stats.LineBytesSent=0;
+	link->Stats.PayloadBytesDelivered=0;
+	link->Stats.DataFramesSent=0;
+	link->Stats.Retransmissions=0;
+	link->Stats.BadFrames=0;
+	COBS_DecoderInit(&link->RxDecoder, link->RxFrame, ARQ_FRAME_SIZE);
+	link->LinkStatus=STD_ACTIVE;
+
+	return STD_OK;
+}
+
+/**
+ * @brief Sends a payload , the data is copied so the buffer can be reused when the function returns.
+ *
+ * @param link the link (from ARQ_Init).
+ * @param data the payload.
+ * @param len the number of bytes (1 .. ARQ_MAX_PAYLOAD).
+ * @return Std_Error_t - STD_OK : the frame is sent and will be sent again until it is ACKed
+ *                     - STD_BUSY : the window is full , call ARQ_MainFunction and try again
+ *                     - STD_INVALID_ARG : len is 0 or more than ARQ_MAX_PAYLOAD
+ *                     - STD_NOT_CONNECTED : the link is down (ARQ_MAX_RETRIES reached) , call ARQ_Init
+ */
+Std_Error_t ARQ_Send(ARQ_Link_t *link, const u8 data[], u8 len)
+{
+	ARQ_Slot_t *slot;
+	u8 i;
+
+	if(STD_ACTIVE != link->LinkStatus)
+	{
+		return STD_NOT_CONNECTED;
+	}
+	if((0 == len) || (len > ARQ_MAX_PAYLOAD))
+	{
+		return STD_INVALID_ARG;
+	}
+	if((u8)(link->TxNextSeq-link->TxBase) >= ARQ_WINDOW_SIZE)
+	{
+		return STD_BUSY;
+	}
+
+	slot=&link->TxSlots[ARQ_SLOT(link->TxNextSeq)];
+	for(i=0; i<len; i++)
+	{
+		slot->Data[i]=data[i];
+	}
+	slot->Len=len;
+	slot->Acked=0;
+	slot->Retries=0;
+	link->TxNextSeq++;
+	link->Stats.DataFramesSent++;
+	ARQ_SendData(link, (u8)(link->TxNextSeq-1));
+
+	return STD_OK;
+}
+
+/**
+ * @brief Runs the protocol : reads the received bytes , handles the frames , sends the ACKs and NAKs
+ *        and sends again the frames whose timer expired.
+ *        Must be called periodically (at least once per ARQ_TIMEOUT_MS and often enough to read all the received bytes).
+ *
+ * @param link the link (from ARQ_Init).
+ */
+void ARQ_MainFunction(ARQ_Link_t *link)
+{
+	Std_Status_t status;
+	u16 now;
+	u8 data, seq;
+
+	if(NULL_PTR == link->pConfig)
+	{
+		return;
+	}
+
+	while(STD_DONE == link->pConfig->pfReceiveByte(&data))
+	{
+		status=COBS_DecoderPushByte(&link->RxDecoder, data);
+		if(STD_DONE == status)
+		{
+			ARQ_HandleFrame(link, link->RxFrame, link->RxDecoder.Len);
+		}
+		else if(STD_ERROR == status)
+		{
+			link->Stats.BadFrames++;
+		}
+	}
+
+	if(STD_ACTIVE != link->LinkStatus)
+	{
+		return;
+	}
+
+	now=SysTick_GetTicks();
+	for(seq=link->TxBase; seq!=link->TxNextSeq; seq++)
+	{
+		if((0 == link->TxSlots[ARQ_SLOT(seq)].Acked) && SysTick_IsExpired(now, link->TxSlots[ARQ_SLOT(seq)].SentTick+ARQ_TIMEOUT_MS))
+		{
+			ARQ_Retransmit(link, seq);
+		}
+	}
+}
+
+/**
+ * @brief Checks if all the sent frames are ACKed.
+ *
+ * @param link the link (from ARQ_Init).
+ * @return Std_Bool_t STD_TRUE if no frame is in flight.
+ */
+Std_Bool_t ARQ_IsIdle(const ARQ_Link_t *link)
+{
+	return (link->TxBase == link->TxNextSeq) ? STD_TRUE : STD_FALSE;
+}
+
+/**
+ * @brief Gets the state of the link.
+ *
+ * @param link the link (from ARQ_Init).
+ * @return Std_Status_t STD_ACTIVE , or STD_ERROR if a frame is not ACKed after ARQ_MAX_RETRIES retransmissions.
+ */
+Std_Status_t ARQ_GetStatus(const ARQ_Link_t *link)
+{
+	return link->LinkStatus;
+}
+
+/**
+ * @brief Gets the counters of the link.
+ *
+ * @param link the link (from ARQ_Init).
+ * @return const ARQ_Stats_t* the counters (reset by ARQ_Init).
+ */
+const ARQ_Stats_t* ARQ_GetStats(const ARQ_Link_t *link)
+{
+	return &link->Stats;
+}
@@ -0,0 +1,172 @@
+/**
+ * @file ARQ.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Reliable transport over a byte link (selective repeat ARQ).
+ *         Up to ARQ_WINDOW_SIZE data frames are sent without waiting for their ACK.
+ *         The receiver ACKs every frame it gets , keeps the frames that arrive out of order
+ *         and sends a NAK for the missing one so only the lost frames are sent again
+ *         (on the NAK or when the timer of the frame expires).
+ *
+ *         Frame on the line (COBS encoded , 0x00 delimited) :
+ *			type	+	seq		+	len		+	payload		+	CRC-16/CCITT
+ *size      1Byte		1Byte		1Byte		len Byte		2Byte (MSB first , over type .. payload)
+ *
+ *         The bytes are sent and received through the functions of ARQ_Config_t
+ *         (ex: the UART driver on the target , a simulated pipe on a PC).
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef ARQ_H_
+#define ARQ_H_
+
+#include "Std_Types.h"
+#include "COBS.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                           Configuration Macros                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define ARQ_WINDOW_SIZE      4     /**< frames in flight (power of 2 , max 64) , RAM = 2 x ARQ_WINDOW_SIZE x ARQ_MAX_PAYLOAD */
+#define ARQ_MAX_PAYLOAD      32    /**< max data bytes of one frame (max 250) */
+#define ARQ_TIMEOUT_MS       100   /**< time to wait for the ACK of a frame before sending it again */
+#define ARQ_MAX_RETRIES      10    /**< the link is down after a frame is sent ARQ_MAX_RETRIES times more without ACK */
+
+#define ARQ_HEADER_SIZE      3     /**< type + seq + len */
+#define ARQ_CRC_SIZE         2
+#define ARQ_FRAME_SIZE       (ARQ_HEADER_SIZE + ARQ_MAX_PAYLOAD + ARQ_CRC_SIZE)
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief the link functions , the module uses only these functions to reach the link.
+ */
+typedef struct
+{
+	Ptr_VoidFuncU8_t  pfSendByte;                        /**< sends one byte (ex: UART_SendByteBusyWait) */
+	Std_Status_t    (*pfReceiveByte)(u8 *pData);         /**< reads one byte if any , STD_DONE when a byte is read (ex: UART_ReceiveBytePeriodicCheck) */
+	void            (*pfDeliver)(const u8 data[], u8 len); /**< receives the payloads in order , once each */
+}ARQ_Config_t;
+
+/**
+ * @brief counters of the link (ex: goodput = PayloadBytesDelivered / time , efficiency = payload / LineBytesSent).
+ */
+typedef struct
+{
+	u32 LineBytesSent;          /**< all the bytes given to pfSendByte (data , ACK , NAK , retransmissions , framing) */
+	u32 PayloadBytesDelivered;  /**< payload bytes given to pfDeliver */
+	u16 DataFramesSent;         /**< first transmissions only */
+	u16 Retransmissions;        /**< on NAK or timeout */
+	u16 BadFrames;              /**< frames dropped because of a bad CRC or format */
+}ARQ_Stats_t;
+
+/**
+ * @brief a frame of the TX or the RX window.
+ */
+typedef struct
+{
+	u8  Data[ARQ_MAX_PAYLOAD];
+	u8  Len;
+	u8  Acked;      /**< TX : 1 when the ACK is received */
+	u8  Retries;    /**< TX : retransmissions of the frame */
+	u16 SentTick;   /**< TX : tick of the last transmission */
+}ARQ_Slot_t;
+
+/**
+ * @brief state of one end of a link , owned by the caller (several links can run at the same time ,
+ *        ex: two UARTs or the two ends of a simulated link). Only the ARQ functions change it.
+ */
+typedef struct
+{
+	const ARQ_Config_t *pConfig;
+	ARQ_Stats_t         Stats;
+	Std_Status_t        LinkStatus;
+
+	/* sender : the frames TxBase .. TxNextSeq-1 are in flight */
+	ARQ_Slot_t          TxSlots[ARQ_WINDOW_SIZE];
+	u8                  TxBase;
+	u8                  TxNextSeq;
+
+	/* receiver : the frames RxExpected .. RxExpected+ARQ_WINDOW_SIZE-1 are accepted */
+	ARQ_Slot_t          RxSlots[ARQ_WINDOW_SIZE];
+	u8                  RxStored[ARQ_WINDOW_SIZE];
+	u8                  RxExpected;
+	u8                  RxNakSent;   /**< 1 if a NAK is already sent for RxExpected */
+
+	u8                  RxFrame[ARQ_FRAME_SIZE];
+	COBS_Decoder_t      RxDecoder;
+}ARQ_Link_t;
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Initializes (or resets) the link , all the frames in flight are dropped.
+ *        The two sides must be initialized before sending.
+ *
+ * @param link the link (owned by the caller , several links can run at the same time).
+ * @param config the link functions (must stay valid).
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NULL_POINTER if link , config or one of its functions is NULL_PTR
+ */
+Std_Error_t ARQ_Init(ARQ_Link_t *link, const ARQ_Config_t *config);
+
+/**
+ * @brief Sends a payload , the data is copied so the buffer can be reused when the function returns.
+ *
+ * @param link the link (from ARQ_Init).
+ * @param data the payload.
+ * @param len the number of bytes (1 .. ARQ_MAX_PAYLOAD).
+ * @return Std_Error_t - STD_OK : the frame is sent and will be sent again until it is ACKed
+ *                     - STD_BUSY : the window is full , call ARQ_MainFunction and try again
+ *                     - STD_INVALID_ARG : len is 0 or more than ARQ_MAX_PAYLOAD
+ *                     - STD_NOT_CONNECTED : the link is down (ARQ_MAX_RETRIES reached) , call ARQ_Init
+ */
+Std_Error_t ARQ_Send(ARQ_Link_t *link, const u8 data[], u8 len);
+
+/**
+ * @brief Runs the protocol : reads the received bytes , handles the frames , sends the ACKs and NAKs
+ *        and sends again the frames whose timer expired.
+ *        Must be called periodically (at least once per ARQ_TIMEOUT_MS and often enough to read all the received bytes).
+ *
+ * @param link the link (from ARQ_Init).
+ */
+void ARQ_MainFunction(ARQ_Link_t *link);
+
+/**
+ * @brief Checks if all the sent frames are ACKed.
+ *
+ * @param link the link (from ARQ_Init).
+ * @return Std_Bool_t STD_TRUE if no frame is in flight.
+ */
+Std_Bool_t ARQ_IsIdle(const ARQ_Link_t *link);
+
+/**
+ * @brief Gets the state of the link.
+ *
+ * @param link the link (from ARQ_Init).
+ * @return Std_Status_t STD_ACTIVE , or STD_ERROR if a frame is not ACKed after ARQ_MAX_RETRIES retransmissions.
+ */
+Std_Status_t ARQ_GetStatus(const ARQ_Link_t *link);
+
+/**
+ * @brief Gets the counters of the link.
+ *
+ * @param link the link (from ARQ_Init).
+ * @return const ARQ_Stats_t* the counters (reset by ARQ_Init).
+ */
+const ARQ_Stats_t* ARQ_GetStats(const ARQ_Link_t *link);
+
+
+#endif /* ARQ_H_ */
@@ -0,0 +1,290 @@
+/**
+ * @file COBS.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the COBS encoder and decoder.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * LIB files
+ */
+#include "Std_Types.h"
+
+/*
+ * the module files
+ */
+#include "COBS.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PRIVATE Macros                                  */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define COBS_MAX_CODE      0xFF   /**< code of a block of 254 data bytes that is not followed by a 0x00 */
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Encodes a buffer (the delimiter is not added).
+ *
+ * @param src the data to be encoded (may contain any byte value).
+ * @param len the number of bytes of the data.
+ * @param dst the buffer of the encoded data (must not overlap src).
+ * @param dstSize the size of dst , COBS_MAX_ENCODED_LEN(len) is always enough.
+ * @param pEncodedLen a pointer to store the number of encoded bytes.
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NULL_POINTER if a pointer is NULL_PTR
+ *                     - STD_BUFFER_OVERFLOW if dst is too small
+ */
+Std_Error_t COBS_Encode(const u8 src[], u16 len, u8 dst[], u16 dstSize, u16 *pEncodedLen)
+{
+	u16 i, codeIdx=0, out=1;
+	u8 code=1;
+
+	if((NULL_PTR == src) || (NULL_PTR == dst) || (NULL_PTR == pEncodedLen))
+	{
+		return STD_NULL_POINTER;
+	}
+	if(0 == dstSize)
+	{
+		return STD_BUFFER_OVERFLOW;
+	}
+
+	// dst[codeIdx] is reserved for the code of the current block , it is written when the block ends
+	for(i=0; i<len; i++)
+	{
+		if(out >= dstSize)
+		{
+			return STD_BUFFER_OVERFLOW;
+		}
+		if(0 == src[i])
+		{
+			dst[codeIdx]=code;
+			codeIdx=out;
+			out++;
+			code=1;
+		}
+		else
+		{
+			dst[out]=src[i];
+			out++;
+			code++;
+			if(COBS_MAX_CODE == code)
+			{
+				if(out >= dstSize)
+				{
+					return STD_BUFFER_OVERFLOW;
+				}
+				dst[codeIdx]=code;
+				codeIdx=out;
+				out++;
+				code=1;
+			}
+		}
+	}
+	dst[codeIdx]=code;
+
+	*pEncodedLen=out;
+	return STD_OK;
+}
+
+/**
+ * @brief Encodes a buffer and passes the encoded bytes one by one to a sink function , then the delimiter.
+ *        No output buffer is needed (ex: sink = UART_SendByteBusyWait).
+ *
+ * @param src the data to be encoded.
+ * @param len the number of bytes of the data.
+ * @param sink the function that takes the encoded bytes.
+ */
+void COBS_EncodeToSink(const u8 src[], u16 len, Ptr_VoidFuncU8_t sink)
+{
+	u16 pos=0, k;
+	u8 run;
+
+	// same output as COBS_Encode : the code of a block is known after looking ahead for the next 0x00
+	while(1)
+	{
+		run=0;
+		while((run < (COBS_MAX_CODE-1)) && ((pos+run) < len) && (0 != src[pos+run]))
+		{
+			run++;
+		}
+
+		sink(run+1);
+		for(k=0; k<run; k++)
+		{
+			sink(src[pos+k]);
+		}
+		pos+=run;
+
+		if(run < (COBS_MAX_CODE-1))
+		{
+			if(pos == len)
+			{
+				break;
+			}
+			pos++; // the 0x00 is replaced by the code of the next block
+		}
+	}
+	sink(COBS_DELIMITER);
+}
+
+/**
+ * @brief Decodes a complete encoded frame (without the delimiter).
+ *
+ * @param src the encoded data.
+ * @param len the number of encoded bytes.
+ * @param dst the buffer of the decoded data (may be the same as src , decoding in place is allowed).
+ * @param dstSize the size of dst (len - 1 is always enough).
+ * @param pDecodedLen a pointer to store the number of decoded bytes.
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NULL_POINTER if a pointer is NULL_PTR
+ *                     - STD_NOT_VALID if the data is not a valid COBS frame (it contains a 0x00 or a block is cut)
+ *                     - STD_BUFFER_OVERFLOW if dst is too small
+ */
+Std_Error_t COBS_Decode(const u8 src[], u16 len, u8 dst[], u16 dstSize, u16 *pDecodedLen)
+{
+	u16 i=0, out=0;
+	u8 code, k, data;
+
+	if((NULL_PTR == src) || (NULL_PTR == dst) || (NULL_PTR == pDecodedLen))
+	{
+		return STD_NULL_POINTER;
+	}
+
+	// out never passes i , so dst may be src
+	while(i < len)
+	{
+		code=src[i];
+		i++;
+		if((0 == code) || ((code-1) > (len-i)))
+		{
+			return STD_NOT_VALID;
+		}
+		for(k=1; k<code; k++)
+		{
+			data=src[i];
+			i++;
+			if(0 == data)
+			{
+				return STD_NOT_VALID;
+			}
+			if(out >= dstSize)
+			{
+				return STD_BUFFER_OVERFLOW;
+			}
+			dst[out]=data;
+			out++;
+		}
+		// the end of a short block is a 0x00 of the data , except for the last block
+		if((COBS_MAX_CODE != code) && (i < len))
+		{
+			if(out >= dstSize)
+			{
+				return STD_BUFFER_OVERFLOW;
+			}
+			dst[out]=0;
+			out++;
+		}
+	}
+
+	*pDecodedLen=out;
+	return STD_OK;
+}
+
+/**
+ * @brief Prepares a streaming decoder.
+ *
+ * @param decoder the decoder.
+ * @param buffer the buffer of the decoded frames.
+ * @param capacity the size of the buffer.
+ */
+void COBS_DecoderInit(COBS_Decoder_t *decoder, u8 buffer[], u16 capacity)
+{
+	decoder->Buffer=buffer;
+	decoder->Capacity=capacity;
+	decoder->Len=0;
+	decoder->BlockLeft=0;
+	decoder->PendingZero=0;
+	decoder->Started=0;
+	decoder->Error=0;
+}
+
+/**
+ * @brief Pushes one received byte to a streaming decoder (short enough to be called from an ISR).
+ *
+ * A frame ends at the delimiter , then the decoder is ready for the next frame automatically.
+ * Empty frames (consecutive delimiters) are ignored.
+ *
+ * @param decoder the decoder.
+ * @param data the received byte.
+ * @return Std_Status_t - STD_PENDING : the frame is not complete
+ *                      - STD_DONE : a frame is complete , decoder->Len bytes are in the buffer
+ *                                   (they are overwritten by the next frame)
+ *                      - STD_ERROR : the frame that ended with this delimiter is bad (cut block or too long) and is dropped
+ */
+Std_Status_t COBS_DecoderPushByte(COBS_Decoder_t *decoder, u8 data)
+{
+	Std_Status_t status=STD_PENDING;
+
+	if(COBS_DELIMITER == data)
+	{
+		if(1 == decoder->Started)
+		{
+			// the pending 0x00 of the last block is not part of the data
+			status=((0 == decoder->Error) && (0 == decoder->BlockLeft)) ? STD_DONE : STD_ERROR;
+		}
+		decoder->BlockLeft=0;
+		decoder->PendingZero=0;
+		decoder->Started=0;
+		decoder->Error=0;
+		return status;
+	}
+
+	if(0 == decoder->Started)
+	{
+		decoder->Started=1;
+		decoder->Len=0;
+	}
+	if(1 == decoder->Error)
+	{
+		return status;
+	}
+
+	if(0 == decoder->BlockLeft)
+	{
+		// code byte
+		if(1 == decoder->PendingZero)
+		{
+			if(decoder->Len >= decoder->Capacity)
+			{
+				decoder->Error=1;
+				return status;
+			}
+			decoder->Buffer[decoder->Len]=0;
+			decoder->Len++;
+		}
+		decoder->BlockLeft=data-1;
+		decoder->PendingZero=(COBS_MAX_CODE != data) ? 1 : 0;
+	}
+	else
+	{
+		if(decoder->Len >= decoder->Capacity)
+		{
+			decoder->Error=1;
+			return status;
+		}
+		decoder->Buffer[decoder->Len]=data;
+		decoder->Len++;
+		decoder->BlockLeft--;
+	}
+	return status;
+}
@@ -0,0 +1,128 @@
+/**
+ * @file COBS.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Consistent Overhead Byte Stuffing (COBS).
+ *         The encoder removes every 0x00 from the data so 0x00 can be used as the frame delimiter :
+ *         the data is split in blocks of up to 254 non zero bytes , every block starts with a code byte
+ *         (1 + the number of data bytes of the block) and ends where the data had a 0x00.
+ *         The overhead is 1 byte per started 254 bytes of data , whatever the data is.
+ *
+ *         On the line a frame is sent as : encoded data + 0x00
+ *         A receiver that loses a byte resynchronizes on the next 0x00.
+ *EX:
+ *	encode : 11 22 00 33  ->  03 11 22 02 33      (then the 0x00 delimiter)
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef COBS_H_
+#define COBS_H_
+
+#include "Std_Types.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define COBS_DELIMITER                 0x00
+
+/** the maximum size of the encoded data of len bytes (without the delimiter) */
+#define COBS_MAX_ENCODED_LEN(len)      ((len) + ((len)/254) + 1)
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief state of the streaming decoder.
+ *        The bytes are pushed one by one (ex: from the UART RX call back) and decoded directly in the user buffer.
+ *        The user must not change the members , they are read only (Len is valid when a frame is complete).
+ */
+typedef struct
+{
+	u8           *Buffer;       /**< the decoded data of the current frame */
+	u16           Capacity;     /**< size of the buffer */
+	u16           Len;          /**< number of decoded bytes */
+	u8            BlockLeft;    /**< data bytes left in the current block (0 : the next byte is a code) */
+	u8            PendingZero;  /**< 1 if a 0x00 must be added before the next block */
+	u8            Started;      /**< 1 if at least one byte of the frame is received */
+	u8            Error;        /**< 1 if the frame is bad , the bytes are dropped until the next delimiter */
+}COBS_Decoder_t;
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Encodes a buffer (the delimiter is not added).
+ *
+ * @param src the data to be encoded (may contain any byte value).
+ * @param len the number of bytes of the data.
+ * @param dst the buffer of the encoded data (must not overlap src).
+ * @param dstSize the size of dst , COBS_MAX_ENCODED_LEN(len) is always enough.
+ * @param pEncodedLen a pointer to store the number of encoded bytes.
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NULL_POINTER if a pointer is NULL_PTR
+ *                     - STD_BUFFER_OVERFLOW if dst is too small
+ */
+Std_Error_t COBS_Encode(const u8 src[], u16 len, u8 dst[], u16 dstSize, u16 *pEncodedLen);
+
+/**
+ * @brief Encodes a buffer and passes the encoded bytes one by one to a sink function , then the delimiter.
+ *        No output buffer is needed (ex: sink = UART_SendByteBusyWait).
+ *
+ * @param src the data to be encoded.
+ * @param len the number of bytes of the data.
+ * @param sink the function that takes the encoded bytes.
+ */
+void COBS_EncodeToSink(const u8 src[], u16 len, Ptr_VoidFuncU8_t sink);
+
+/**
+ * @brief Decodes a complete encoded frame (without the delimiter).
+ *
+ * @param src the encoded data.
+ * @param len the number of encoded bytes.
+ * @param dst the buffer of the decoded data (may be the same as src , decoding in place is allowed).
+ * @param dstSize the size of dst (len - 1 is always enough).
+ * @param pDecodedLen a pointer to store the number of decoded bytes.
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NULL_POINTER if a pointer is NULL_PTR
+ *                     - STD_NOT_VALID if the data is not a valid COBS frame (it contains a 0x00 or a block is cut)
+ *                     - STD_BUFFER_OVERFLOW if dst is too small
+ */
+Std_Error_t COBS_Decode(const u8 src[], u16 len, u8 dst[], u16 dstSize, u16 *pDecodedLen);
+
+/**
+ * @brief Prepares a streaming decoder.
+ *
+ * @param decoder the decoder.
+ * @param buffer the buffer of the decoded frames.
+ * @param capacity the size of the buffer.
+ */
+void COBS_DecoderInit(COBS_Decoder_t *decoder, u8 buffer[], u16 capacity);
+
+/**
+ * @brief Pushes one received byte to a streaming decoder (short enough to be called from an ISR).
+ *
+ * A frame ends at the delimiter , then the decoder is ready for the next frame automatically.
+ * Empty frames (consecutive delimiters) are ignored.
+ *
+ * @param decoder the decoder.
+ * @param data the received byte.
+ * @return Std_Status_t - STD_PENDING : the frame is not complete
+ *                      - STD_DONE : a frame is complete , decoder->Len bytes are in the buffer
+ *                                   (they are overwritten by the next frame)
+ *                      - STD_ERROR : the frame that ended with this delimiter is bad (cut block or too long) and is dropped
+ */
+Std_Status_t COBS_DecoderPushByte(COBS_Decoder_t *decoder, u8 data);
+
+
+#endif /* COBS_H_ */
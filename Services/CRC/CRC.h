@@ -0,0 +1,113 @@
+/**
+ * @file CRC.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  CRC-8 and CRC-16/CCITT calculation.
+ *          - CRC-8       : poly 0x07   , init 0x00   , no reflection , no final xor (check "123456789" = 0xF4)
+ *          - CRC-16/CCITT: poly 0x1021 , init 0xFFFF , no reflection , no final xor (check "123456789" = 0x29B1)
+ *          - CRC-16/MODBUS: poly 0xA001 (0x8005 reflected) , init 0xFFFF , reflected , no final xor (check "123456789" = 0x4B37)
+ *            sent low byte first , the CRC of a frame followed by its CRC is 0.
+ *         The implementation is selected at build time by CRC_IMPLEMENTATION (speed / flash trade-off).
+ *
+ *         Approximate cost per byte on the ATmega32 (avr-gcc -Os) :
+ *         | CRC_IMPLEMENTATION | CRC-8 cycles | CRC-8 table | CRC-16 cycles | CRC-16 table |
+ *         |--------------------|--------------|-------------|---------------|--------------|
+ *         | CRC_TABLE_256      |     ~12      |  256 bytes  |      ~22      |  512 bytes   |
+ *         | CRC_TABLE_16       |     ~30      |   16 bytes  |      ~50      |   32 bytes   |
+ *         | CRC_BITWISE        |     ~70      |    none     |     ~110      |    none      |
+ *         CRC-16/MODBUS has the same cost and table size as CRC-16/CCITT.
+ *         the tables are in flash (PROGMEM) , they do not use any RAM.
+ *         for reference a byte at 115200 baud takes ~690 cycles at 8 MHz.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef CRC_H_
+#define CRC_H_
+
+#include "Std_Types.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define CRC_TABLE_256    0   /**< one flash table lookup per byte */
+#define CRC_TABLE_16     1   /**< two nibble table lookups per byte */
+#define CRC_BITWISE      2   /**< eight shift/xor steps per byte , no table */
+
+#define CRC8_INIT          0x00
+#define CRC16_INIT         0xFFFF
+#define CRC16_MODBUS_INIT  0xFFFF
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                           Configuration Macros                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define CRC_IMPLEMENTATION   CRC_TABLE_16
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Adds one byte to a CRC-8.
+ *
+ * @param crc the CRC of the previous bytes (CRC8_INIT for the first byte).
+ * @param data the new byte.
+ * @return u8 the CRC including the new byte.
+ */
+u8 CRC8_Update(u8 crc, u8 data);
+
+/**
+ * @brief Calculates the CRC-8 of a buffer.
+ *
+ * @param buffer the data.
+ * @param len the number of bytes.
+ * @return u8 the CRC-8 of the buffer.
+ */
+u8 CRC8_Calculate(const u8 buffer[], u16 len);
+
+/**
+ * @brief Adds one byte to a CRC-16/CCITT.
+ *
+ * @param crc the CRC of the previous bytes (CRC16_INIT for the first byte).
+ * @param data the new byte.
+ * @return u16 the CRC including the new byte.
+ */
+u16 CRC16_Update(u16 crc, u8 data);
+
+/**
+ * @brief Calculates the CRC-16/CCITT of a buffer.
+ *
+ * @param buffer the data.
+ * @param len the number of bytes.
+ * @return u16 the CRC-16 of the buffer.
+ */
+u16 CRC16_Calculate(const u8 buffer[], u16 len);
+
+/**
+ * @brief Adds one byte to a CRC-16/MODBUS.
+ *
+ * @param crc the CRC of the previous bytes (CRC16_MODBUS_INIT for the first byte).
+ * @param data the new byte.
+ * @return u16 the CRC including the new byte.
+ */
+u16 CRC16Modbus_Update(u16 crc, u8 data);
+
+/**
+ * @brief Calculates the CRC-16/MODBUS of a buffer.
+ *
+ * @param buffer the data.
+ * @param len the number of bytes.
+ * @return u16 the CRC-16/MODBUS of the buffer.
+ */
+u16 CRC16Modbus_Calculate(const u8 buffer[], u16 len);
+
+
+#endif /* CRC_H_ */
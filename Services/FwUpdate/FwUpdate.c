@@ -0,0 +1,508 @@
+/**
+ * @file FwUpdate.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the firmware update receiver (XMODEM-CRC).
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * LIB files
+ */
+#include "Std_Types.h"
+#include "Utils_interrupt.h"
+
+/*
+ * MCAL files
+ */
+#include "UART_Interface.h"
+#include "SysTick_Interface.h"
+
+/*
+ * Services files
+ */
+#include "CRC.h"
+
+/*
+ * the module files
+ */
+#include "FwUpdate.h"
+#include "FwUpdate_Lcfg.h"
+#include "FwUpdate_Private.h"
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Starts the reception : sets the RX call back , enables the RX interrupt and asks for the first block ('C').
+ *
+ * @param flash the flash backend (must stay valid during the update).
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NULL_POINTER if flash or one of its functions is NULL_PTR
+ *                     - STD_INVALID_ARG if flash->Size is not a multiple of FWUPDATE_PAGE_SIZE
+ */
+Std_Error_t FwUpdate_Start(const FwUpdate_Flash_t *flash)
+{
+	if((NULL_PTR == flash) || (NULL_PTR == flash->pfBegin) || (NULL_PTR == flash->pfWritePage) || (NULL_PTR == flash->pfCommit))
+	{
+		return STD_NULL_POINTER;
+	}
+	if((0 == flash->Size) || (0 != (flash->Size % FWUPDATE_PAGE_SIZE)))
+	{
+		return STD_INVALID_ARG;
+	}
+
+	FwUpdate_pFlash = flash;
+	FwUpdate_u16Fill = 0;
+	FwUpdate_u32Offset = 0;
+	FwUpdate_bHeader = STD_FALSE;
+	FwUpdate_u8Expected = 1;
+	FwUpdate_u8ErrorsInRow = 0;
+	FwUpdate_u8Starts = 1;
+	FwUpdate_u16ImageCrc = CRC16_INIT;
+	FwUpdate_Info.ImageSize = 0;
+	FwUpdate_Info.Received = 0;
+	FwUpdate_Info.Blocks = 0;
+	FwUpdate_Info.Naks = 0;
+	FwUpdate_Info.Duplicates = 0;
+	FwUpdate_Info.Error = FWUPDATE_ERR_NONE;
+	FwUpdate_u8Phase = FWUPDATE_PHASE_RUNNING;
+
+	UART_RX_InterruptDisable();
+	UART_RX_SetCallBack(FwUpdate_RxCallBack);
+	UART_FlushRx();
+	FwUpdate_u8CanCount = 0;
+	FwUpdate_u16LastRxTick = SysTick_GetTicks();
+	UART_RX_InterruptEnable();
+	FwUpdate_Answer(FWUPDATE_CRC_MODE);
+
+	return STD_OK;
+}
+
+/**
+ * @brief Runs the protocol : checks the received block , writes the full pages , answers the sender , checks the timeouts.
+ *        Call it in the super loop until it returns STD_DONE or STD_ERROR.
+ *
+ * @return Std_Status_t - STD_PENDING while the update runs
+ *                      - STD_DONE when the image is verified and committed
+ *                      - STD_ERROR when the update failed (FwUpdate_GetInfo gives the reason) , nothing is committed
+ *                      - STD_IDLE if the update is not started
+ */
+Std_Status_t FwUpdate_MainFunction(void)
+{
+	u16 sinceTx;
+
+	if(FWUPDATE_PHASE_RUNNING == FwUpdate_u8Phase)
+	{
+		switch(FwUpdate_u8RxState)
+		{
+		case FWUPDATE_RX_BLOCK:
+			FwUpdate_CheckBlock();
+			break;
+
+		case FWUPDATE_RX_EOT:
+			FwUpdate_Finish();
+			break;
+
+		case FWUPDATE_RX_CAN:
+			FwUpdate_Info.Error = FWUPDATE_ERR_CANCELLED;
+			FwUpdate_Stop(FWUPDATE_PHASE_FAILED);
+			break;
+
+		case FWUPDATE_RX_PURGE:
+			if(FwUpdate_TicksSinceRx() >= FWUPDATE_PURGE_MS)
+			{
+				FwUpdate_Answer((STD_TRUE == FwUpdate_bHeader) ? FWUPDATE_NAK : FWUPDATE_CRC_MODE);
+			}
+			break;
+
+		case FWUPDATE_RX_START:
+			sinceTx = SysTick_GetTicks() - FwUpdate_u16LastTxTick;
+			if(STD_FALSE == FwUpdate_bHeader)
+			{
+				// no sender yet : 'C' again
+				if(sinceTx >= FWUPDATE_START_INTERVAL_MS)
+				{
+					if(FwUpdate_u8Starts >= FWUPDATE_START_RETRIES)
+					{
+						FwUpdate_Fail(FWUPDATE_ERR_NO_SENDER);
+					}
+					else
+					{
+						FwUpdate_u8Starts++;
+						FwUpdate_Answer(FWUPDATE_CRC_MODE);
+					}
+				}
+			}
+			else if(sinceTx >= FWUPDATE_BLOCK_TIMEOUT_MS)
+			{
+				FwUpdate_Reject();
+			}
+			break;
+
+		default: /* inside a block */
+			if(FwUpdate_TicksSinceRx() >= FWUPDATE_BYTE_TIMEOUT_MS)
+			{
+				FwUpdate_Reject();
+			}
+			break;
+		}
+	}
+
+	switch(FwUpdate_u8Phase)
+	{
+	case FWUPDATE_PHASE_RUNNING: return STD_PENDING;
+	case FWUPDATE_PHASE_DONE:    return STD_DONE;
+	case FWUPDATE_PHASE_FAILED:  return STD_ERROR;
+	default:                     return STD_IDLE;
+	}
+}
+
+/**
+ * @brief Cancels the update (the sender gets CAN CAN) , nothing is committed.
+ */
+void FwUpdate_Abort(void)
+{
+	if(FWUPDATE_PHASE_RUNNING == FwUpdate_u8Phase)
+	{
+		FwUpdate_Fail(FWUPDATE_ERR_CANCELLED);
+	}
+}
+
+/**
+ * @brief Gets the progress of the update.
+ *
+ * @param info the copy of the progress.
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER.
+ */
+Std_Error_t FwUpdate_GetInfo(FwUpdate_Info_t *info)
+{
+	if(NULL_PTR == info)
+	{
+		return STD_NULL_POINTER;
+	}
+	*info = FwUpdate_Info;
+
+	return STD_OK;
+}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                        Static Private Functions                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief RXC call back : stores the data of the block in the buffer , the other bytes in the block fields.
+ */
+static void FwUpdate_RxCallBack(void)
+{
+	u8 data = UART_ReceiveByteNoBlock();
+
+	FwUpdate_u16LastRxTick = SysTick_GetTicks();
+	switch(FwUpdate_u8RxState)
+	{
+	case FWUPDATE_RX_START:
+		if(FWUPDATE_SOH == data)
+		{
+			FwUpdate_u8RxState = FWUPDATE_RX_NUM;
+		}
+		else if(FWUPDATE_EOT == data)
+		{
+			FwUpdate_u8RxState = FWUPDATE_RX_EOT;
+		}
+		else if(FWUPDATE_CAN == data)
+		{
+			// one CAN may be noise , the sender cancels with two
+			FwUpdate_u8CanCount++;
+			if(FwUpdate_u8CanCount >= 2)
+			{
+				FwUpdate_u8RxState = FWUPDATE_RX_CAN;
+			}
+			break;
+		}
+		FwUpdate_u8CanCount = 0;
+		break;
+
+	case FWUPDATE_RX_NUM:
+		FwUpdate_u8BlockNum = data;
+		FwUpdate_u8RxState = FWUPDATE_RX_INV;
+		break;
+
+	case FWUPDATE_RX_INV:
+		FwUpdate_u8BlockInv = data;
+		FwUpdate_u8RxIdx = 0;
+		FwUpdate_u8RxState = FWUPDATE_RX_DATA;
+		break;
+
+	case FWUPDATE_RX_DATA:
+		// the data goes directly after the good blocks of the page
+		FwUpdate_arrBuffer[FwUpdate_u16Fill + FwUpdate_u8RxIdx] = data;
+		FwUpdate_u8RxIdx++;
+		if(FWUPDATE_BLOCK_SIZE == FwUpdate_u8RxIdx)
+		{
+			FwUpdate_u8RxState = FWUPDATE_RX_CRC_HI;
+		}
+		break;
+
+	case FWUPDATE_RX_CRC_HI:
+		FwUpdate_u16BlockCrc = (u16)data << 8;
+		FwUpdate_u8RxState = FWUPDATE_RX_CRC_LO;
+		break;
+
+	case FWUPDATE_RX_CRC_LO:
+		FwUpdate_u16BlockCrc |= data;
+		FwUpdate_u8RxState = FWUPDATE_RX_BLOCK;
+		break;
+
+	default: /* BLOCK , EOT , CAN : the main function owns the buffer , PURGE : the byte is dropped */
+		break;
+	}
+}
+
+/**
+ * @brief Ticks since the last received byte.
+ */
+static u16 FwUpdate_TicksSinceRx(void)
+{
+	u8 sregCopy;
+	u16 lastRx;
+
+	Critical_Enter(sregCopy);
+	lastRx = FwUpdate_u16LastRxTick;
+	Critical_Exit(sregCopy);
+
+	return SysTick_GetTicks() - lastRx;
+}
+
+/**
+ * @brief Gives the line back to the RXC ISR and sends a control character (ACK , NAK , 'C').
+ */
+static void FwUpdate_Answer(u8 control)
+{
+	// the ISR is ready before the sender gets the answer
+	FwUpdate_u8RxState = FWUPDATE_RX_START;
+	UART_SendByteBusyWait(control);
+	FwUpdate_u16LastTxTick = SysTick_GetTicks();
+}
+
+/**
+ * @brief Counts a bad block or a timeout and drops the rest of the block , the NAK is sent after the silence.
+ */
+static void FwUpdate_Reject(void)
+{
+	FwUpdate_Info.Naks++;
+	FwUpdate_u8ErrorsInRow++;
+	if(FwUpdate_u8ErrorsInRow >= FWUPDATE_MAX_RETRIES)
+	{
+		FwUpdate_Fail(FWUPDATE_ERR_RETRIES);
+		return;
+	}
+	FwUpdate_u8RxState = FWUPDATE_RX_PURGE;
+}
+
+/**
+ * @brief Checks the received block and stores it.
+ */
+static void FwUpdate_CheckBlock(void)
+{
+	const u8 *block = &FwUpdate_arrBuffer[FwUpdate_u16Fill];
+	u16 crc = FWUPDATE_XMODEM_CRC_INIT;
+	FwUpdate_Error_t error;
+	u8 i;
+
+	for(i=0; i<FWUPDATE_BLOCK_SIZE; i++)
+	{
+		crc = CRC16_Update(crc, block[i]);
+	}
+	if((0xFF != (u8)(FwUpdate_u8BlockNum ^ FwUpdate_u8BlockInv)) || (crc != FwUpdate_u16BlockCrc))
+	{
+		FwUpdate_Reject();
+		return;
+	}
+	FwUpdate_u8ErrorsInRow = 0;
+
+	// the ACK of the previous block was lost : the sender sends it again
+	if((STD_TRUE == FwUpdate_bHeader) && (FwUpdate_u8BlockNum == (u8)(FwUpdate_u8Expected - 1)))
+	{
+		FwUpdate_Info.Duplicates++;
+		FwUpdate_Answer(FWUPDATE_ACK);
+		return;
+	}
+	if(FwUpdate_u8BlockNum != FwUpdate_u8Expected)
+	{
+		FwUpdate_Fail(FWUPDATE_ERR_SEQUENCE);
+		return;
+	}
+
+	if(STD_FALSE == FwUpdate_bHeader)
+	{
+		error = FwUpdate_ReadHeader(block);
+		if(FWUPDATE_ERR_NONE != error)
+		{
+			FwUpdate_Fail(error);
+			return;
+		}
+		FwUpdate_bHeader = STD_TRUE;
+	}
+	else if(STD_OK != FwUpdate_StoreBlock(block))
+	{
+		FwUpdate_Fail(FWUPDATE_ERR_FLASH);
+		return;
+	}
+
+	// the ACK goes after the page is programmed : the sender sends nothing while the interrupts are disabled by the flash
+	FwUpdate_Info.Blocks++;
+	FwUpdate_u8Expected++;
+	FwUpdate_Answer(FWUPDATE_ACK);
+}
+
+/**
+ * @brief Reads the header block.
+ *
+ * @return FwUpdate_Error_t FWUPDATE_ERR_NONE , FWUPDATE_ERR_HEADER , FWUPDATE_ERR_TOO_BIG , FWUPDATE_ERR_FLASH.
+ */
+static FwUpdate_Error_t FwUpdate_ReadHeader(const u8 block[])
+{
+	const char *magic = FWUPDATE_HEADER_MAGIC;
+	u32 size;
+	u8 i;
+
+	for(i=0; i<4; i++)
+	{
+		if((u8)magic[i] != block[i])
+		{
+			return FWUPDATE_ERR_HEADER;
+		}
+	}
+	size = (u32)block[4] | ((u32)block[5] << 8) | ((u32)block[6] << 16) | ((u32)block[7] << 24);
+	if(0 == size)
+	{
+		return FWUPDATE_ERR_HEADER;
+	}
+	if(size > FwUpdate_pFlash->Size)
+	{
+		return FWUPDATE_ERR_TOO_BIG;
+	}
+	if(STD_OK != FwUpdate_pFlash->pfBegin(size))
+	{
+		return FWUPDATE_ERR_FLASH;
+	}
+	FwUpdate_Info.ImageSize = size;
+	FwUpdate_u16HeaderCrc = (u16)block[8] | ((u16)block[9] << 8);
+
+	return FWUPDATE_ERR_NONE;
+}
+
+/**
+ * @brief Adds the image bytes of a block to the CRC and writes the buffer when a page is full.
+ *
+ * @return Std_Error_t STD_OK , the error of the backend.
+ */
+static Std_Error_t FwUpdate_StoreBlock(const u8 block[])
+{
+	u32 left = FwUpdate_Info.ImageSize - FwUpdate_Info.Received;
+	u8 count = (left < FWUPDATE_BLOCK_SIZE) ? (u8)left : FWUPDATE_BLOCK_SIZE;
+	u8 i;
+
+	// the padding of the last block and the blocks after the image are not part of the CRC
+	for(i=0; i<count; i++)
+	{
+		FwUpdate_u16ImageCrc = CRC16_Update(FwUpdate_u16ImageCrc, block[i]);
+	}
+	FwUpdate_Info.Received += count;
+
+	FwUpdate_u16Fill += FWUPDATE_BLOCK_SIZE;
+	if(FwUpdate_u16Fill >= FWUPDATE_PAGE_SIZE)
+	{
+		return FwUpdate_WritePages(FwUpdate_u16Fill);
+	}
+	return STD_OK;
+}
+
+/**
+ * @brief Writes the pages of the buffer that hold image bytes and empties the buffer.
+ *
+ * @param len bytes of the buffer (multiple of FWUPDATE_PAGE_SIZE).
+ * @return Std_Error_t STD_OK , the error of the backend.
+ */
+static Std_Error_t FwUpdate_WritePages(u16 len)
+{
+	Std_Error_t error = STD_OK;
+	u16 i;
+
+	for(i=0; (i<len) && (STD_OK == error); i+=FWUPDATE_PAGE_SIZE)
+	{
+		if(FwUpdate_u32Offset < FwUpdate_Info.ImageSize)
+		{
+			error = FwUpdate_pFlash->pfWritePage(FwUpdate_u32Offset, &FwUpdate_arrBuffer[i]);
+		}
+		FwUpdate_u32Offset += FWUPDATE_PAGE_SIZE;
+	}
+	FwUpdate_u16Fill = 0;
+
+	return error;
+}
+
+/**
+ * @brief End of the transfer : writes the last page , verifies the image and commits it.
+ */
+static void FwUpdate_Finish(void)
+{
+	u16 i;
+
+	// a page bigger than a block may be partly filled
+	if(0 != FwUpdate_u16Fill)
+	{
+		for(i=FwUpdate_u16Fill; i<FWUPDATE_BUFFER_SIZE; i++)
+		{
+			FwUpdate_arrBuffer[i] = 0xFF;
+		}
+		if(STD_OK != FwUpdate_WritePages(FWUPDATE_BUFFER_SIZE))
+		{
+			FwUpdate_Fail(FWUPDATE_ERR_FLASH);
+			return;
+		}
+	}
+
+	if((STD_FALSE == FwUpdate_bHeader) || (FwUpdate_Info.Received != FwUpdate_Info.ImageSize) ||
+	   (FwUpdate_u16ImageCrc != FwUpdate_u16HeaderCrc))
+	{
+		FwUpdate_Fail(FWUPDATE_ERR_VERIFY);
+		return;
+	}
+	if(STD_OK != FwUpdate_pFlash->pfCommit(FwUpdate_Info.ImageSize, FwUpdate_u16ImageCrc))
+	{
+		FwUpdate_Fail(FWUPDATE_ERR_FLASH);
+		return;
+	}
+	FwUpdate_Answer(FWUPDATE_ACK);
+	FwUpdate_Stop(FWUPDATE_PHASE_DONE);
+}
+
+/**
+ * @brief Stops the update with an error (the sender gets CAN CAN).
+ */
+static void FwUpdate_Fail(FwUpdate_Error_t error)
+{
+	FwUpdate_Info.Error = error;
+	FwUpdate_Stop(FWUPDATE_PHASE_FAILED);
+	UART_SendByteBusyWait(FWUPDATE_CAN);
+	UART_SendByteBusyWait(FWUPDATE_CAN);
+}
+
+/**
+ * @brief Stops the reception.
+ */
+static void FwUpdate_Stop(u8 phase)
+{
+	UART_RX_InterruptDisable();
+	UART_RX_SetCallBack(NULL_PTR);
+	FwUpdate_u8Phase = phase;
+}
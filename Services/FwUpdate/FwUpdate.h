@@ -0,0 +1,152 @@
+/**
+ * @file FwUpdate.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Firmware update receiver over UART (XMODEM-CRC , 128 bytes blocks).
+ *         The blocks are received by the RXC interrupt directly in the page buffer ,
+ *         every good block is streamed to the staging area of the flash as soon as a page is full
+ *         and the CRC of the whole image is calculated on the fly : the image is never kept in RAM.
+ *         The staged image is committed only if its size and its CRC match the header , else the sender gets a cancel.
+ *
+ *         The image is packed by FwUpdate_Pack.py : the first block is a header , it is not written to the flash.
+ *         | offset | size | field                                              |
+ *         |--------|------|----------------------------------------------------|
+ *         |   0    |  4   | "FWUP"                                             |
+ *         |   4    |  4   | image size in bytes (little endian)                |
+ *         |   8    |  2   | CRC-16/CCITT of the image (CRC16_Calculate , LE)   |
+ *         the next blocks are the image , the last one is padded with 0x1A.
+ *
+ *         The flash is written through a backend (FwUpdate_Flash_t) : FwUpdate_FlashAvr.c programs the ATmega32 flash ,
+ *         a file or a RAM model can be used to test the protocol and the throughput on a PC.
+ *EX:
+ *	FwUpdate_Start(&FwUpdate_FlashAvr);
+ *	while(STD_PENDING == (status = FwUpdate_MainFunction()));
+ *	if(STD_DONE == status) { reset : the boot loader (FwUpdate_AvrBoot) copies the staged image }
+ *
+ *         The receiver takes the UART : the RX call back is set by FwUpdate_Start.
+ *         The system tick must be running (SysTick_Init) and the global interrupt enabled.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef FWUPDATE_H_
+#define FWUPDATE_H_
+
+#include "Std_Types.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define FWUPDATE_BLOCK_SIZE      128
+#define FWUPDATE_HEADER_MAGIC    "FWUP"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief the flash backend.
+ *        The functions are called from FwUpdate_MainFunction , the sender waits for the ACK while they run.
+ */
+typedef struct
+{
+	u32 Size;   /**< bytes of the staging area (multiple of FWUPDATE_PAGE_SIZE) , the bigger images are refused */
+
+	/**
+	 * @brief Prepares the staging area for a new image (ex: removes the commit mark of the previous image).
+	 * @return Std_Error_t STD_OK , any other value cancels the update.
+	 */
+	Std_Error_t (*pfBegin)(u32 imageSize);
+
+	/**
+	 * @brief Erases and programs one page of the staging area and checks it.
+	 * @param offset the offset of the page in the staging area (multiple of FWUPDATE_PAGE_SIZE).
+	 * @param page FWUPDATE_PAGE_SIZE bytes.
+	 * @return Std_Error_t STD_OK , any other value cancels the update.
+	 */
+	Std_Error_t (*pfWritePage)(u32 offset, const u8 page[]);
+
+	/**
+	 * @brief Marks the staged image valid , called only after the size and the CRC of the image are verified.
+	 * @return Std_Error_t STD_OK , any other value fails the update.
+	 */
+	Std_Error_t (*pfCommit)(u32 imageSize, u16 imageCrc);
+}FwUpdate_Flash_t;
+
+/**
+ * @brief the reason of a failed update.
+ */
+typedef enum
+{
+	FWUPDATE_ERR_NONE,
+	FWUPDATE_ERR_NO_SENDER,     /**< no block after FWUPDATE_START_RETRIES 'C' */
+	FWUPDATE_ERR_RETRIES,       /**< FWUPDATE_MAX_RETRIES bad blocks or timeouts in a row */
+	FWUPDATE_ERR_SEQUENCE,      /**< a block number out of sequence (blocks lost) */
+	FWUPDATE_ERR_HEADER,        /**< the first block is not a header */
+	FWUPDATE_ERR_TOO_BIG,       /**< the image is bigger than the staging area */
+	FWUPDATE_ERR_FLASH,         /**< the backend failed */
+	FWUPDATE_ERR_VERIFY,        /**< the size or the CRC of the received image does not match the header */
+	FWUPDATE_ERR_CANCELLED      /**< cancelled by the sender or by FwUpdate_Abort */
+}FwUpdate_Error_t;
+
+/**
+ * @brief the progress of the update.
+ */
+typedef struct
+{
+	u32              ImageSize;     /**< from the header , 0 before the header */
+	u32              Received;      /**< bytes of the image received and checked */
+	u16              Blocks;        /**< good blocks (header included) */
+	u16              Naks;          /**< bad blocks and timeouts */
+	u16              Duplicates;    /**< blocks sent again because an ACK was lost */
+	FwUpdate_Error_t Error;
+}FwUpdate_Info_t;
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Starts the reception : sets the RX call back , enables the RX interrupt and asks for the first block ('C').
+ *
+ * @param flash the flash backend (must stay valid during the update).
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NULL_POINTER if flash or one of its functions is NULL_PTR
+ *                     - STD_INVALID_ARG if flash->Size is not a multiple of FWUPDATE_PAGE_SIZE
+ */
+Std_Error_t FwUpdate_Start(const FwUpdate_Flash_t *flash);
+
+/**
+ * @brief Runs the protocol : checks the received block , writes the full pages , answers the sender , checks the timeouts.
+ *        Call it in the super loop until it returns STD_DONE or STD_ERROR.
+ *
+ * @return Std_Status_t - STD_PENDING while the update runs
+ *                      - STD_DONE when the image is verified and committed
+ *                      - STD_ERROR when the update failed (FwUpdate_GetInfo gives the reason) , nothing is committed
+ *                      - STD_IDLE if the update is not started
+ */
+Std_Status_t FwUpdate_MainFunction(void);
+
+/**
+ * @brief Cancels the update (the sender gets CAN CAN) , nothing is committed.
+ */
+void FwUpdate_Abort(void);
+
+/**
+ * @brief Gets the progress of the update.
+ *
+ * @param info the copy of the progress.
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER.
+ */
+Std_Error_t FwUpdate_GetInfo(FwUpdate_Info_t *info);
+
+
+#endif /* FWUPDATE_H_ */
@@ -0,0 +1,54 @@
+/**
+ * @file FwUpdate_BootAvr.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the reset entry of the ATmega32 boot loader of the firmware update :
+ *         it copies a committed image (FwUpdate_AvrBoot) then jumps to the application.
+ * @warning the BOOTRST fuse must be programmed : every reset starts here (0x7000) , before the C runtime of the application ,
+ *          see FwUpdate_FlashAvr.h for the link options.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * LIB files
+ */
+#include "Std_Types.h"
+#include "MemMap.h"
+
+/*
+ * the module files
+ */
+#include "FwUpdate.h"
+#include "FwUpdate_FlashAvr.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define FWUPDATE_AVR_RAMEND   0x085F   /**< the last SRAM address of the ATmega32 */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              Reset entry                                     */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief The reset vector of the boot section : sets the stack and the zero register (no C runtime yet) ,
+ *        copies a committed image and starts the application at 0x0000 (its own C runtime).
+ *        The interrupts are disabled by the reset and stay disabled.
+ */
+__attribute__((naked, used, section(".bootentry"))) void FwUpdate_AvrBootEntry(void)
+{
+	__asm__ __volatile__ ("clr __zero_reg__" ::);
+	SPH = (u8)(FWUPDATE_AVR_RAMEND >> 8);
+	SPL = (u8)FWUPDATE_AVR_RAMEND;
+
+	(void)FwUpdate_AvrBoot();
+
+	__asm__ __volatile__ ("jmp 0" ::);
+}
@@ -0,0 +1,240 @@
+/**
+ * @file FwUpdate_FlashAvr.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the ATmega32 flash backend (SPM) of the firmware update receiver.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <avr/boot.h>
+#include <avr/pgmspace.h>
+
+/*
+ * LIB files
+ */
+#include "Std_Types.h"
+#include "Utils_interrupt.h"
+
+/*
+ * the module files
+ */
+#include "FwUpdate.h"
+#include "FwUpdate_Lcfg.h"
+#include "FwUpdate_FlashAvr.h"
+
+#if (FWUPDATE_PAGE_SIZE != SPM_PAGESIZE)
+#error "FWUPDATE_PAGE_SIZE must be SPM_PAGESIZE with the AVR backend"
+#endif
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                        Static Private Functions                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief Erases and programs one page of the flash and reads it back.
+ *        The erase and the write are two critical sections of up to 4.5 ms each (tWD_FLASH) :
+ *        the vectors and the ISRs are in the RWW section , no interrupt may run while SPM is busy.
+ *        The RWW section is enabled again after the erase , the pending interrupts run between the two.
+ *
+ * @param address the address of the page in the flash.
+ * @param page SPM_PAGESIZE bytes.
+ * @return Std_Error_t STD_OK , STD_NOK if the flash does not hold the page.
+ */
+BOOTLOADER_SECTION static Std_Error_t FwUpdate_AvrProgram(u16 address, const u8 page[])
+{
+	u8 sregCopy;
+	u16 i;
+
+	Critical_Enter(sregCopy);
+	eeprom_busy_wait();
+	boot_page_erase(address);
+	boot_spm_busy_wait();
+	boot_rww_enable();
+	Critical_Exit(sregCopy);
+
+	// the fill and the write in one critical section : an ISR writing the EEPROM would abort the page buffer
+	Critical_Enter(sregCopy);
+	eeprom_busy_wait();
+	for(i=0; i<SPM_PAGESIZE; i+=2)
+	{
+		boot_page_fill(address + i, (u16)page[i] | ((u16)page[i + 1] << 8));
+	}
+	boot_page_write(address);
+	boot_spm_busy_wait();
+	boot_rww_enable();
+	Critical_Exit(sregCopy);
+
+	for(i=0; i<SPM_PAGESIZE; i++)
+	{
+		if(pgm_read_byte(address + i) != page[i])
+		{
+			return STD_NOK;
+		}
+	}
+	return STD_OK;
+}
+
+/**
+ * @brief Removes the mark of the previous image : the boot loader must not copy a half written image.
+ */
+BOOTLOADER_SECTION static Std_Error_t FwUpdate_AvrBegin(u32 imageSize)
+{
+	u8 page[SPM_PAGESIZE];
+	u16 i;
+
+	(void)imageSize;
+	for(i=0; i<SPM_PAGESIZE; i++)
+	{
+		page[i] = 0xFF;
+	}
+	return FwUpdate_AvrProgram(FWUPDATE_AVR_MARK_ADDRESS, page);
+}
+
+/**
+ * @brief Programs one page of the staging area.
+ */
+BOOTLOADER_SECTION static Std_Error_t FwUpdate_AvrWritePage(u32 offset, const u8 page[])
+{
+	return FwUpdate_AvrProgram((u16)(FWUPDATE_AVR_STAGING_START + offset), page);
+}
+
+/**
+ * @brief Writes the mark of the verified image.
+ */
+BOOTLOADER_SECTION static Std_Error_t FwUpdate_AvrCommit(u32 imageSize, u16 imageCrc)
+{
+	u8 page[SPM_PAGESIZE];
+	const char *magic = FWUPDATE_HEADER_MAGIC;
+	u16 i;
+
+	for(i=0; i<SPM_PAGESIZE; i++)
+	{
+		page[i] = 0xFF;
+	}
+	for(i=0; i<4; i++)
+	{
+		page[i] = (u8)magic[i];
+		page[4 + i] = (u8)(imageSize >> (8 * i));
+	}
+	page[8] = (u8)imageCrc;
+	page[9] = (u8)(imageCrc >> 8);
+
+	return FwUpdate_AvrProgram(FWUPDATE_AVR_MARK_ADDRESS, page);
+}
+
+/**
+ * @brief Adds one byte to a CRC-16/CCITT , the bitwise form of CRC16_Update (Services/CRC) :
+ *        the boot loader cannot call the application section , which it may have half copied.
+ */
+BOOTLOADER_SECTION static u16 FwUpdate_AvrCrc16(u16 crc, u8 data)
+{
+	u8 bit;
+
+	crc ^= (u16)data << 8;
+	for(bit=0; bit<8; bit++)
+	{
+		crc = (crc & 0x8000) ? (u16)((crc << 1) ^ 0x1021) : (u16)(crc << 1);
+	}
+	return crc;
+}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              Boot loader                                     */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief Copies the committed image of the staging area to the application at reset.
+ *        It runs before the C runtime of the application (FwUpdate_BootAvr.c) : no global variable , no library call.
+ *
+ * @return Std_Status_t - STD_IDLE no mark : nothing is written
+ *                      - STD_DONE the image is copied to 0x0000 and the mark is erased
+ *                      - STD_ERROR the mark is erased without a copy (bad size or CRC) ,
+ *                                  or a page was not programmed : the mark stays and the copy runs again at the next reset
+ */
+BOOTLOADER_SECTION Std_Status_t FwUpdate_AvrBoot(void)
+{
+	u8 page[SPM_PAGESIZE];
+	u32 imageSize = 0;
+	u16 imageCrc;
+	u16 crc = 0xFFFF; /**< CRC16_INIT */
+	u16 address;
+	u16 i;
+
+	// the magic is compared to constants : the string literals are in .data , not initialized yet
+	if((FWUPDATE_HEADER_MAGIC[0] != pgm_read_byte(FWUPDATE_AVR_MARK_ADDRESS + 0)) ||
+	   (FWUPDATE_HEADER_MAGIC[1] != pgm_read_byte(FWUPDATE_AVR_MARK_ADDRESS + 1)) ||
+	   (FWUPDATE_HEADER_MAGIC[2] != pgm_read_byte(FWUPDATE_AVR_MARK_ADDRESS + 2)) ||
+	   (FWUPDATE_HEADER_MAGIC[3] != pgm_read_byte(FWUPDATE_AVR_MARK_ADDRESS + 3)))
+	{
+		return STD_IDLE;
+	}
+	for(i=0; i<4; i++)
+	{
+		imageSize |= (u32)pgm_read_byte(FWUPDATE_AVR_MARK_ADDRESS + 4 + i) << (8 * i);
+	}
+	imageCrc = (u16)pgm_read_byte(FWUPDATE_AVR_MARK_ADDRESS + 8) | ((u16)pgm_read_byte(FWUPDATE_AVR_MARK_ADDRESS + 9) << 8);
+
+	for(i=0; i<SPM_PAGESIZE; i++)
+	{
+		page[i] = 0xFF;
+	}
+	if((0 == imageSize) || (imageSize > (FWUPDATE_AVR_STAGING_SIZE - FWUPDATE_PAGE_SIZE)) || (imageSize > FWUPDATE_AVR_STAGING_START))
+	{
+		(void)FwUpdate_AvrProgram(FWUPDATE_AVR_MARK_ADDRESS, page);
+		return STD_ERROR;
+	}
+	// the staging area is checked again : a committed image may have been damaged since
+	for(address=0; address<(u16)imageSize; address++)
+	{
+		crc = FwUpdate_AvrCrc16(crc, pgm_read_byte(FWUPDATE_AVR_STAGING_START + address));
+	}
+	if(crc != imageCrc)
+	{
+		(void)FwUpdate_AvrProgram(FWUPDATE_AVR_MARK_ADDRESS, page);
+		return STD_ERROR;
+	}
+
+	// page by page from 0x0000 : after a reset in the middle the mark is still there and the copy starts again
+	for(address=0; address<(u16)imageSize; address+=SPM_PAGESIZE)
+	{
+		for(i=0; i<SPM_PAGESIZE; i++)
+		{
+			page[i] = pgm_read_byte(FWUPDATE_AVR_STAGING_START + address + i);
+		}
+		if(STD_OK != FwUpdate_AvrProgram(address, page))
+		{
+			return STD_ERROR;
+		}
+	}
+
+	// the mark is erased last
+	for(i=0; i<SPM_PAGESIZE; i++)
+	{
+		page[i] = 0xFF;
+	}
+	if(STD_OK != FwUpdate_AvrProgram(FWUPDATE_AVR_MARK_ADDRESS, page))
+	{
+		return STD_ERROR;
+	}
+	return STD_DONE;
+}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  Backend                                     */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+const FwUpdate_Flash_t FwUpdate_FlashAvr =
+{
+	FWUPDATE_AVR_STAGING_SIZE - FWUPDATE_PAGE_SIZE,
+	FwUpdate_AvrBegin,
+	FwUpdate_AvrWritePage,
+	FwUpdate_AvrCommit
+};
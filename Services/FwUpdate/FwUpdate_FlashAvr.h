@@ -0,0 +1,69 @@
+/**
+ * @file FwUpdate_FlashAvr.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  ATmega32 flash backend of the firmware update receiver.
+ *         The pages are programmed with SPM in the staging area of FwUpdate_Lcfg.h and read back ,
+ *         the commit writes the mark in the last page of the staging area :
+ *         | offset | size | field                       |
+ *         |--------|------|-----------------------------|
+ *         |   0    |  4   | "FWUP"                      |
+ *         |   4    |  4   | image size (little endian)  |
+ *         |   8    |  2   | CRC-16/CCITT of the image   |
+ *         The boot loader (FwUpdate_AvrBoot , called at every reset by FwUpdate_BootAvr.c) checks the mark and the CRC
+ *         of the staging area , copies the image to 0x0000 page by page and erases the mark.
+ * @warning SPM runs only from the boot loader section : the functions of the backend and of the boot loader are put in
+ *          the .bootloader section , the reset entry in the .bootentry section at the start of the boot section.
+ *          Program the BOOTRST fuse , BOOTSZ = 2048 words and link with
+ *          -Wl,--section-start=.bootentry=0x7000 -Wl,--section-start=.bootloader=0x7040 .
+ *          The image sent is the application only : avr-objcopy -O binary -R .bootentry -R .bootloader ,
+ *          the boot section is never copied (an update cannot change it).
+ *          The interrupts are disabled during the erase and during the write of a page (up to 4.5 ms each , they run
+ *          between the two) : the vectors and the ISRs of the application are in the RWW section , which cannot be
+ *          read while SPM is busy. The timer ticks of these 2 windows are lost (SysTick is late by up to 8 ms per page).
+ *          No UART byte is lost : the ACK of a block is sent after its page is programmed , the sender waits for it.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef FWUPDATE_FLASHAVR_H_
+#define FWUPDATE_FLASHAVR_H_
+
+#include "FwUpdate.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define FWUPDATE_AVR_MARK_ADDRESS   (FWUPDATE_AVR_STAGING_START + FWUPDATE_AVR_STAGING_SIZE - FWUPDATE_PAGE_SIZE)
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  Backend                                     */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief the backend to pass to FwUpdate_Start , its Size leaves the mark page out of the staging area.
+ */
+extern const FwUpdate_Flash_t FwUpdate_FlashAvr;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              Boot loader                                     */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief Copies the committed image of the staging area to the application (the reset entry calls it).
+ *        The mark is erased after the last page : a reset during the copy starts it again.
+ *
+ * @return Std_Status_t - STD_IDLE no mark : nothing is written
+ *                      - STD_DONE the image is copied and the mark is erased
+ *                      - STD_ERROR bad size or CRC : the mark is erased , the application is not changed ,
+ *                                  or a page was not programmed : the copy runs again at the next reset
+ */
+Std_Status_t FwUpdate_AvrBoot(void);
+
+
+#endif /* FWUPDATE_FLASHAVR_H_ */
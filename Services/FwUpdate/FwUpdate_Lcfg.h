@@ -0,0 +1,40 @@
+/**
+ * @file FwUpdate_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  this file contains the configuration of the firmware update receiver
+ *          - the size of a flash page (the RAM buffer of the receiver)
+ *          - the timeouts and the retries of the XMODEM-CRC protocol
+ *          - the staging area of the ATmega32 flash backend (FwUpdate_FlashAvr.c)
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef FWUPDATE_LCFG_H_
+#define FWUPDATE_LCFG_H_
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                           Configuration Macros                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define FWUPDATE_PAGE_SIZE           128     /**< bytes written by one call of pfWritePage (SPM_PAGESIZE of the ATmega32) ,
+                                                  a divisor or a multiple of the 128 bytes of a block */
+#define FWUPDATE_START_INTERVAL_MS   1000    /**< a 'C' is sent at this period until the first block */
+#define FWUPDATE_START_RETRIES       60      /**< the 'C' sent before the update fails (no sender) */
+#define FWUPDATE_BYTE_TIMEOUT_MS     1000    /**< max silence inside a block */
+#define FWUPDATE_BLOCK_TIMEOUT_MS    10000   /**< max silence between two blocks (a NAK is sent) */
+#define FWUPDATE_PURGE_MS            50      /**< silence of the line that ends the bytes of a bad block before the NAK */
+#define FWUPDATE_MAX_RETRIES         10      /**< bad blocks in a row before the update is cancelled */
+
+/*
+ * the ATmega32 backend : the new image is staged in the upper half of the application flash ,
+ * the last page of the staging area keeps the commit mark read by the boot loader.
+ * 0x0000 .. 0x37FF application , 0x3800 .. 0x6FFF staging , 0x7000 .. 0x7FFF boot loader (BOOTSZ = 2048 words)
+ */
+#define FWUPDATE_AVR_STAGING_START   0x3800
+#define FWUPDATE_AVR_STAGING_SIZE    0x3800
+
+
+#endif /* FWUPDATE_LCFG_H_ */
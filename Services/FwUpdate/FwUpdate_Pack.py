@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""
+@file FwUpdate_Pack.py
+@author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+@brief  PC packer of the images of the firmware update receiver (FwUpdate.c).
+        The image (raw binary or Intel HEX from avr-objcopy) is written after a header block of 128 bytes :
+        "FWUP" , the size of the image (4 bytes LE) , its CRC-16/CCITT (init 0xFFFF , 2 bytes LE) , 0xFF up to 128 bytes.
+        The packed file is sent as it is by any XMODEM-CRC sender (sx , Tera Term , minicom).
+EX:
+    python FwUpdate_Pack.py app.hex app.fwu
+    python FwUpdate_Pack.py app.bin app.fwu --max-size 14208
+    sx app.fwu < /dev/ttyUSB0 > /dev/ttyUSB0
+@version 0.1
+@date 2024-04-01
+
+@copyright Copyright (c) 2024
+"""
+import argparse
+import struct
+import sys
+
+BLOCK_SIZE = 128
+MAGIC = b"FWUP"
+
+
+def crc16_ccitt(data, crc=0xFFFF):
+    """CRC-16/CCITT , the same as CRC16_Calculate of Services/CRC."""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if (crc & 0x8000) else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def read_hex(path):
+    """Reads the data records of an Intel HEX file , the holes are filled with 0xFF."""
+    memory = {}
+    base = 0
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            line = line.strip()
+            if not line:
+                continue
+            if not line.startswith(":"):
+                raise ValueError("%s:%d: not an Intel HEX record" % (path, number))
+            record = bytes.fromhex(line[1:])
+            if (sum(record) & 0xFF) != 0:
+                raise ValueError("%s:%d: wrong checksum" % (path, number))
+            count, address, kind = record[0], (record[1] << 8) | record[2], record[3]
+            data = record[4:4 + count]
+            if kind == 0x00:
+                for i, byte in enumerate(data):
+                    memory[base + address + i] = byte
+            elif kind == 0x01:
+                break
+            elif kind == 0x02:
+                base = ((data[0] << 8) | data[1]) << 4
+            elif kind == 0x04:
+                base = ((data[0] << 8) | data[1]) << 16
+    if not memory:
+        return b""
+    image = bytearray(b"\xFF" * (max(memory) + 1))
+    for address, byte in memory.items():
+        image[address] = byte
+    return bytes(image)
+
+
+def pack(image):
+    """Returns the header block followed by the image."""
+    header = MAGIC + struct.pack("<IH", len(image), crc16_ccitt(image))
+    return header + b"\xFF" * (BLOCK_SIZE - len(header)) + image
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Packs an image for the XMODEM-CRC firmware update receiver.")
+    parser.add_argument("image", help="raw binary or Intel HEX (.hex)")
+    parser.add_argument("output", help="the packed file")
+    parser.add_argument("--max-size", type=int, default=0, help="size of the staging area (0 : no check)")
+    args = parser.parse_args()
+
+    if args.image.lower().endswith(".hex"):
+        image = read_hex(args.image)
+    else:
+        with open(args.image, "rb") as f:
+            image = f.read()
+    if not image:
+        sys.exit("%s: empty image" % args.image)
+    if args.max_size and len(image) > args.max_size:
+        sys.exit("%s: %d bytes , the staging area has %d" % (args.image, len(image), args.max_size))
+
+    with open(args.output, "wb") as f:
+        f.write(pack(image))
+    print("%s: %d bytes , crc 0x%04X , %d blocks" % (args.output, len(image), crc16_ccitt(image),
+                                                   1 + (len(image) + BLOCK_SIZE - 1) // BLOCK_SIZE))
+
+
+if __name__ == "__main__":
+    main()
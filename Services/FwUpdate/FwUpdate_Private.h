@@ -0,0 +1,164 @@
+/**
+ * @file FwUpdate_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private information of the firmware update receiver.
+ *         The user must not include this file in the application code.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef FWUPDATE_PRIVATE_H_
+#define FWUPDATE_PRIVATE_H_
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Macros                                 */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+/* XMODEM control characters */
+#define FWUPDATE_SOH             0x01
+#define FWUPDATE_EOT             0x04
+#define FWUPDATE_ACK             0x06
+#define FWUPDATE_NAK             0x15
+#define FWUPDATE_CAN             0x18
+#define FWUPDATE_CRC_MODE        'C'      /**< sent instead of NAK before the first block : CRC-16 instead of the checksum */
+
+#define FWUPDATE_XMODEM_CRC_INIT 0x0000   /**< the block CRC is CRC-16/CCITT with init 0 (CRC-16/XMODEM) */
+#define FWUPDATE_HEADER_SIZE     10       /**< magic(4) + size(4) + CRC(2) */
+
+/* the buffer takes one block , or one page if the page is bigger */
+#if (FWUPDATE_PAGE_SIZE > FWUPDATE_BLOCK_SIZE)
+#define FWUPDATE_BUFFER_SIZE     FWUPDATE_PAGE_SIZE
+#else
+#define FWUPDATE_BUFFER_SIZE     FWUPDATE_BLOCK_SIZE
+#endif
+
+/* the state of the reception (RXC ISR) */
+#define FWUPDATE_RX_START        0        /**< waits for SOH , EOT or CAN */
+#define FWUPDATE_RX_NUM          1
+#define FWUPDATE_RX_INV          2
+#define FWUPDATE_RX_DATA         3
+#define FWUPDATE_RX_CRC_HI       4
+#define FWUPDATE_RX_CRC_LO       5
+#define FWUPDATE_RX_BLOCK        6        /**< a block is complete , the main function owns the buffer */
+#define FWUPDATE_RX_EOT          7        /**< the sender ended the transfer */
+#define FWUPDATE_RX_CAN          8        /**< the sender cancelled the transfer (CAN CAN) */
+#define FWUPDATE_RX_PURGE        9        /**< the bytes of a bad block are dropped until a silence */
+
+/* the phase of the update */
+#define FWUPDATE_PHASE_IDLE      0
+#define FWUPDATE_PHASE_RUNNING   1
+#define FWUPDATE_PHASE_DONE      2
+#define FWUPDATE_PHASE_FAILED    3
+
+#if ((FWUPDATE_PAGE_SIZE % FWUPDATE_BLOCK_SIZE) != 0) && ((FWUPDATE_BLOCK_SIZE % FWUPDATE_PAGE_SIZE) != 0)
+#error "FWUPDATE_PAGE_SIZE must be a divisor or a multiple of 128"
+#endif
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                     Static Private Global Vaiables                           */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static const FwUpdate_Flash_t *FwUpdate_pFlash = NULL_PTR;
+static u8  FwUpdate_arrBuffer[FWUPDATE_BUFFER_SIZE];    /**< the data of the blocks go directly in the page */
+static u16 FwUpdate_u16Fill = 0;                        /**< bytes of the good blocks in the buffer */
+static u32 FwUpdate_u32Offset = 0;                      /**< offset of the buffer in the staging area */
+
+/* written by the RXC ISR */
+static volatile u8  FwUpdate_u8RxState = FWUPDATE_RX_START;
+static volatile u8  FwUpdate_u8RxIdx = 0;
+static volatile u8  FwUpdate_u8BlockNum = 0;
+static volatile u8  FwUpdate_u8BlockInv = 0;
+static volatile u16 FwUpdate_u16BlockCrc = 0;
+static volatile u8  FwUpdate_u8CanCount = 0;
+static volatile u16 FwUpdate_u16LastRxTick = 0;
+
+static u8  FwUpdate_u8Phase = FWUPDATE_PHASE_IDLE;
+static Std_Bool_t FwUpdate_bHeader = STD_FALSE;         /**< the header block is received */
+static u8  FwUpdate_u8Expected = 1;                     /**< number of the next block */
+static u8  FwUpdate_u8ErrorsInRow = 0;
+static u8  FwUpdate_u8Starts = 0;                       /**< 'C' sent */
+static u16 FwUpdate_u16LastTxTick = 0;                  /**< tick of the last 'C' , ACK or NAK */
+static u16 FwUpdate_u16ImageCrc = 0;                    /**< CRC of the image bytes received */
+static u16 FwUpdate_u16HeaderCrc = 0;
+static FwUpdate_Info_t FwUpdate_Info;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                        Static Private Functions                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief RXC call back : stores the data of the block in the buffer , the other bytes in the block fields.
+ */
+static void FwUpdate_RxCallBack(void);
+
+/**
+ * @brief Ticks since the last received byte.
+ */
+static u16 FwUpdate_TicksSinceRx(void);
+
+/**
+ * @brief Gives the line back to the RXC ISR and sends a control character (ACK , NAK , 'C').
+ */
+static void FwUpdate_Answer(u8 control);
+
+/**
+ * @brief Counts a bad block or a timeout and drops the rest of the block , the NAK is sent after the silence.
+ */
+static void FwUpdate_Reject(void);
+
+/**
+ * @brief Checks the received block and stores it.
+ */
+static void FwUpdate_CheckBlock(void);
+
+/**
+ * @brief Reads the header block.
+ *
+ * @return FwUpdate_Error_t FWUPDATE_ERR_NONE , FWUPDATE_ERR_HEADER , FWUPDATE_ERR_TOO_BIG , FWUPDATE_ERR_FLASH.
+ */
+static FwUpdate_Error_t FwUpdate_ReadHeader(const u8 block[]);
+
+/**
+ * @brief Adds the image bytes of a block to the CRC and writes the buffer when a page is full.
+ *
+ * @return Std_Error_t STD_OK , the error of the backend.
+ */
+static Std_Error_t FwUpdate_StoreBlock(const u8 block[]);
+
+/**
+ * @brief Writes the pages of the buffer that hold image bytes and empties the buffer.
+ *
+ * @param len bytes of the buffer (multiple of FWUPDATE_PAGE_SIZE).
+ * @return Std_Error_t STD_OK , the error of the backend.
+ */
+static Std_Error_t FwUpdate_WritePages(u16 len);
+
+/**
+ * @brief End of the transfer : writes the last page , verifies the image and commits it.
+ */
+static void FwUpdate_Finish(void);
+
+/**
+ * @brief Stops the update with an error (the sender gets CAN CAN).
+ */
+static void FwUpdate_Fail(FwUpdate_Error_t error);
+
+/**
+ * @brief Stops the reception.
+ */
+static void FwUpdate_Stop(u8 phase);
+
+
+#endif /* FWUPDATE_PRIVATE_H_ */
@@ -0,0 +1,273 @@
+/**
+ * @file Log.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the binary trace logger.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * LIB files
+ */
+#include "Std_Types.h"
+#include "Utils_interrupt.h"
+
+/*
+ * Services files
+ */
+#include "UART_TxChain.h"
+
+/*
+ * the module files
+ */
+#include "Log.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PRIVATE Macros                                  */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define LOG_HEADER_SIZE      3      /**< ID + len */
+#define LOG_DROPPED_SIZE     (LOG_HEADER_SIZE + 2)
+
+#if ((LOG_BUFFER_SIZE & (LOG_BUFFER_SIZE-1)) != 0) || (LOG_BUFFER_SIZE > 32768)
+#error "LOG_BUFFER_SIZE must be a power of 2 and not more than 32768"
+#endif
+#if (LOG_MAX_ARGS > 126)
+#error "LOG_MAX_ARGS must not be more than 126"
+#endif
+
+#define LOG_MASK(idx)        ((idx) & (LOG_BUFFER_SIZE-1))
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                     Static Private Global Vaiables                           */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static u8  Log_arrBuffer[LOG_BUFFER_SIZE];
+static u16 Log_u16Head = 0;                  /**< next byte to write */
+static volatile u16 Log_u16Tail = 0;         /**< first byte not sent yet (moved by the UART ISR) */
+static u16 Log_u16SendEnd = 0;               /**< the value of Log_u16Tail when the transmission in progress is done */
+static u16 Log_u16DroppedTotal = 0;
+static u16 Log_u16DroppedPending = 0;        /**< lost records not reported yet by a LOG_ID_DROPPED record */
+
+static UART_TxDesc_t Log_TxDesc;             /**< the logger owns its descriptor (not taken from the UART_TxChain pool) */
+static UART_TxFrag_t Log_arrTxFrags[2];      /**< the sent bytes may wrap at the end of the buffer */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                        Static Private Functions                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief Copies bytes at the head of the buffer (the space must be checked before).
+ */
+static void Log_Put(const u8 data[], u8 size)
+{
+	u8 i;
+
+	for(i=0; i<size; i++)
+	{
+		Log_arrBuffer[Log_u16Head] = data[i];
+		Log_u16Head = LOG_MASK(Log_u16Head + 1);
+	}
+}
+
+/**
+ * @brief Writes the header of a record : ID (LSB first) + len.
+ */
+static void Log_PutHeader(u16 id, u8 size)
+{
+	u8 header[LOG_HEADER_SIZE];
+
+	header[0] = (u8)id;
+	header[1] = (u8)(id >> 8);
+	header[2] = size;
+	Log_Put(header, LOG_HEADER_SIZE);
+}
+
+/**
+ * @brief UART_TxChain completion call back : the sent bytes are free (called from the UART ISR).
+ */
+static void Log_TxDoneCallBack(UART_TxDesc_t *desc)
+{
+	(void)desc;
+	Log_u16Tail = Log_u16SendEnd;
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Empties the buffer and resets the counter of the lost records.
+ *        The UART must be initialized.
+ */
+void Log_Init(void)
+{
+	u8 sregCopy;
+
+	Critical_Enter(sregCopy);
+	UART_TxDescAbort(&Log_TxDesc);
+	Log_TxDesc.Status = STD_IDLE;
+	Log_TxDesc.Next   = NULL_PTR;
+	Log_u16Head = 0;
+	Log_u16Tail = 0;
+	Log_u16SendEnd = 0;
+	Log_u16DroppedTotal = 0;
+	Log_u16DroppedPending = 0;
+	Critical_Exit(sregCopy);
+}
+
+/**
+ * @brief Writes a record in the buffer (use the LOG macro).
+ *        If the buffer is full the record is lost and counted ,
+ *        a LOG_ID_DROPPED record is written before the next record that fits.
+ *        Can be called from an ISR.
+ *
+ * @param id the ID of the message.
+ * @param args the arguments.
+ * @param size the number of bytes of the arguments (max 2 x LOG_MAX_ARGS).
+ * @return Std_Error_t - STD_OK
+ *                     - STD_BUFFER_FULL if the record is lost
+ *                     - STD_INVALID_ARG if size is more than 2 x LOG_MAX_ARGS
+ */
+Std_Error_t Log_Write(u16 id, const u16 args[], u8 size)
+{
+	Std_Error_t errorStatus = STD_OK;
+	u16 freeBytes;
+	u16 needed = (u16)LOG_HEADER_SIZE + size;
+	u8 sregCopy;
+	u8 i;
+	u8 arg[2];
+
+	if(size > (2 * LOG_MAX_ARGS))
+	{
+		return STD_INVALID_ARG;
+	}
+
+	Critical_Enter(sregCopy);
+	/* one byte stays empty so head == tail means empty */
+	freeBytes = (u16)(LOG_BUFFER_SIZE - 1) - LOG_MASK(Log_u16Head - Log_u16Tail);
+	if(Log_u16DroppedPending != 0)
+	{
+		needed += LOG_DROPPED_SIZE;
+	}
+
+	if(needed > freeBytes)
+	{
+		if(Log_u16DroppedPending != 0xFFFF)
+		{
+			Log_u16DroppedPending++;
+		}
+		if(Log_u16DroppedTotal != 0xFFFF)
+		{
+			Log_u16DroppedTotal++;
+		}
+		errorStatus = STD_BUFFER_FULL;
+	}
+	else
+	{
+		if(Log_u16DroppedPending != 0)
+		{
+			Log_PutHeader(LOG_ID_DROPPED, 2);
+			arg[0] = (u8)Log_u16DroppedPending;
+			arg[1] = (u8)(Log_u16DroppedPending >> 8);
+			Log_Put(arg, 2);
+			Log_u16DroppedPending = 0;
+		}
+		Log_PutHeader(id, size);
+		for(i=0; i<(size/2); i++)
+		{
+			arg[0] = (u8)args[i];
+			arg[1] = (u8)(args[i] >> 8);
+			Log_Put(arg, 2);
+		}
+	}
+	Critical_Exit(sregCopy);
+
+	return errorStatus;
+}
+
+/**
+ * @brief Starts the transmission of the records in the buffer if the previous transmission is done.
+ *        The records are sent by the UART interrupt (UART_TxChain) , the function never waits.
+ *        Call it periodically from the main loop.
+ */
+void Log_MainFunction(void)
+{
+	u16 head, tail;
+	u8 fragCount;
+	u8 sregCopy;
+
+	if(STD_PENDING == Log_TxDesc.Status)
+	{
+		return;
+	}
+
+	Critical_Enter(sregCopy);
+	head = Log_u16Head;
+	tail = Log_u16Tail;
+	Critical_Exit(sregCopy);
+
+	if(head != tail)
+	{
+		/* the bytes from tail to head , in 2 fragments if they wrap at the end of the buffer */
+		Log_arrTxFrags[0].Data = &Log_arrBuffer[tail];
+		if(head > tail)
+		{
+			Log_arrTxFrags[0].Len = head - tail;
+			fragCount = 1;
+		}
+		else
+		{
+			Log_arrTxFrags[0].Len  = LOG_BUFFER_SIZE - tail;
+			Log_arrTxFrags[1].Data = &Log_arrBuffer[0];
+			Log_arrTxFrags[1].Len  = head;
+			fragCount = 2;
+		}
+		Log_u16SendEnd = head;
+		UART_TxDescSubmit(&Log_TxDesc, Log_arrTxFrags, fragCount, Log_TxDoneCallBack);
+	}
+}
+
+/**
+ * @brief Waits until all the records are sent (ex: before a reset).
+ *        The global interrupt must be enabled.
+ */
+void Log_Flush(void)
+{
+	Std_Bool_t empty;
+	u8 sregCopy;
+
+	do
+	{
+		Log_MainFunction();
+		Critical_Enter(sregCopy);
+		empty = (Log_u16Head == Log_u16Tail) ? STD_TRUE : STD_FALSE;
+		Critical_Exit(sregCopy);
+	}while(STD_FALSE == empty);
+}
+
+/**
+ * @brief Gets the number of lost records since Log_Init.
+ *
+ * @return u16 the number of records lost because the buffer was full.
+ */
+u16 Log_GetDroppedCount(void)
+{
+	u16 count;
+	u8 sregCopy;
+
+	Critical_Enter(sregCopy);
+	count = Log_u16DroppedTotal;
+	Critical_Exit(sregCopy);
+
+	return count;
+}
@@ -0,0 +1,148 @@
+/**
+ * @file Log.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Binary trace logger with deferred formatting.
+ *         A log call writes only the 16-bit ID of the message and the raw bytes of its arguments in a RAM ring buffer ,
+ *         the format string stays on the PC : Log_Decoder.py reads the table of Log_Lcfg.h and prints the text.
+ *         Log_MainFunction sends the buffer by the UART interrupt (UART_TxChain) so the caller never waits for the UART.
+ *         The messages above LOG_LEVEL are removed at compile time (no code , no time).
+ *
+ *         Record in the buffer and on the line :
+ *			ID			+	len		+	arguments
+ *size      2Byte (LSB first)	1Byte		len Byte (every argument LSB first)
+ *
+ *EX:
+ *	LOG(BOOT, MCUCSR);
+ *	LOG(TEMPERATURE, temp/10, temp%10, LOG_U32(SysTick_GetTicks()));
+ *	...
+ *	while(1) { Log_MainFunction(); ... }
+ *
+ *	PC : python Log_Decoder.py COM3 --baud 9600 (or a file of the received bytes)
+ *	[INFO] temp=23.5 C at 10250 ms
+ *
+ *         Time of a LOG call with 2 arguments : about 150 cycles (~10 us at 16 MHz) ,
+ *         the same text with UART_Printf at 9600 baud takes about 1 ms per character.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef LOG_H_
+#define LOG_H_
+
+#include "Std_Types.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define LOG_LEVEL_NONE       0
+#define LOG_LEVEL_ERROR      1
+#define LOG_LEVEL_WARN       2
+#define LOG_LEVEL_INFO       3
+#define LOG_LEVEL_DEBUG      4
+
+#include "Log_Lcfg.h"
+
+#define LOG_ID_DROPPED       0xFFFF   /**< record sent when records were lost (buffer full) , argument : number of lost records */
+
+/**
+ * @brief passes a 32-bit argument (for %ld %lu %lx).
+ */
+#define LOG_U32(value)       (u16)((u32)(value)) , (u16)((u32)(value) >> 16)
+
+/**
+ * @brief writes a log message.
+ *        name is the name of the message in LOG_MESSAGES , the arguments are converted to 16 bits.
+ *        If the level of the message is above LOG_LEVEL the condition is false at compile time :
+ *        the call and its arguments are removed by the compiler.
+ *        Can be called from an ISR.
+ */
+#define LOG(name, ...)                                                                 \
+	do{                                                                                \
+		if(LOG_LEVEL_OF_##name <= LOG_LEVEL)                                           \
+		{                                                                              \
+			const u16 Log_arrArgs[] = {0 , ##__VA_ARGS__};                              \
+			Log_Write(LOG_ID_##name, &Log_arrArgs[1], (u8)(sizeof(Log_arrArgs) - sizeof(u16))); \
+		}                                                                              \
+	}while(0)
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+#define LOG_ID_ENUM(name, level, format)       LOG_ID_##name,
+#define LOG_LEVEL_ENUM(name, level, format)    LOG_LEVEL_OF_##name = (level),
+
+/**
+ * @brief the IDs of the messages (the line of the message in LOG_MESSAGES).
+ */
+typedef enum
+{
+	LOG_MESSAGES(LOG_ID_ENUM)
+	LOG_ID_COUNT
+}Log_Id_t;
+
+/**
+ * @brief the level of every message , used by LOG to remove the disabled messages.
+ */
+enum
+{
+	LOG_MESSAGES(LOG_LEVEL_ENUM)
+	LOG_LEVEL_OF_COUNT
+};
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Empties the buffer and resets the counter of the lost records.
+ *        The UART must be initialized.
+ */
+void Log_Init(void);
+
+/**
+ * @brief Writes a record in the buffer (use the LOG macro).
+ *        If the buffer is full the record is lost and counted ,
+ *        a LOG_ID_DROPPED record is written before the next record that fits.
+ *        Can be called from an ISR.
+ *
+ * @param id the ID of the message.
+ * @param args the arguments.
+ * @param size the number of bytes of the arguments (max 2 x LOG_MAX_ARGS).
+ * @return Std_Error_t - STD_OK
+ *                     - STD_BUFFER_FULL if the record is lost
+ *                     - STD_INVALID_ARG if size is more than 2 x LOG_MAX_ARGS
+ */
+Std_Error_t Log_Write(u16 id, const u16 args[], u8 size);
+
+/**
+ * @brief Starts the transmission of the records in the buffer if the previous transmission is done.
+ *        The records are sent by the UART interrupt (UART_TxChain) , the function never waits.
+ *        Call it periodically from the main loop.
+ */
+void Log_MainFunction(void);
+
+/**
+ * @brief Waits until all the records are sent (ex: before a reset).
+ *        The global interrupt must be enabled.
+ */
+void Log_Flush(void);
+
+/**
+ * @brief Gets the number of lost records since Log_Init.
+ *
+ * @return u16 the number of records lost because the buffer was full.
+ */
+u16 Log_GetDroppedCount(void);
+
+
+#endif /* LOG_H_ */
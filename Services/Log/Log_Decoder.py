@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""
+@file Log_Decoder.py
+@author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+@brief  PC decoder of the binary trace logger (Log.c).
+        The format strings are read from the LOG_MESSAGES table of Log_Lcfg.h (the same file used to build the program)
+        so the IDs always match the program.
+EX:
+    python Log_Decoder.py capture.bin                  (a file of the received bytes)
+    python Log_Decoder.py COM3 --baud 9600             (a serial port , needs pyserial)
+    python Log_Decoder.py /dev/ttyUSB0 --cfg ../Log/Log_Lcfg.h
+@version 0.1
+@date 2024-04-01
+
+@copyright Copyright (c) 2024
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+
+LOG_ID_DROPPED = 0xFFFF
+LOG_HEADER_SIZE = 3
+
+# X(name , level , "format")
+MESSAGE_RE = re.compile(r'X\(\s*(\w+)\s*,\s*LOG_LEVEL_(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)')
+# %[flags][width][l]type
+SPEC_RE = re.compile(r'%([-0]*)(\d*)(l?)([duxXc%])')
+
+
+def load_messages(cfg_path):
+    """Returns the list of (name , level , format) in the order of the table (the index is the ID)."""
+    with open(cfg_path) as cfg:
+        text = cfg.read()
+    return [(m.group(1), m.group(2), bytes(m.group(3), "utf-8").decode("unicode_escape"))
+            for m in MESSAGE_RE.finditer(text)]
+
+
+def args_size(fmt):
+    """Number of bytes of the arguments of a format : 2 per argument , 4 with l."""
+    size = 0
+    for flags, width, long_arg, conv in SPEC_RE.findall(fmt):
+        if conv != '%':
+            size += 4 if long_arg else 2
+    return size
+
+
+def format_message(fmt, data):
+    """Formats the arguments (LSB first) like the C printf of the program."""
+    pos = 0
+
+    def replace(m):
+        nonlocal pos
+        flags, width, long_arg, conv = m.groups()
+        if conv == '%':
+            return '%'
+        size = 4 if long_arg else 2
+        value = int.from_bytes(data[pos:pos + size], "little")
+        pos += size
+        if conv == 'd' and value >= (1 << (8 * size - 1)):
+            value -= 1 << (8 * size)
+        if conv == 'c':
+            return chr(value & 0xFF)
+        return ('%' + flags + width + (conv if conv != 'u' else 'd')) % value
+
+    return SPEC_RE.sub(replace, fmt)
+
+
+def decode(stream, messages, out=sys.stdout):
+    """Decodes the records of a byte stream , the bytes of a broken record are skipped until a valid header."""
+    buf = bytearray()
+    while True:
+        chunk = stream.read(64)
+        if not chunk:
+            break
+        buf += chunk
+        while len(buf) >= LOG_HEADER_SIZE:
+            msg_id, size = struct.unpack_from("<HB", buf)
+            if msg_id == LOG_ID_DROPPED and size == 2:
+                expected = 2
+            elif msg_id < len(messages):
+                expected = args_size(messages[msg_id][2])
+            else:
+                expected = None
+            if expected != size:
+                del buf[0]      # not a header , resynchronize
+                continue
+            if len(buf) < LOG_HEADER_SIZE + size:
+                break
+            data = bytes(buf[LOG_HEADER_SIZE:LOG_HEADER_SIZE + size])
+            del buf[:LOG_HEADER_SIZE + size]
+            if msg_id == LOG_ID_DROPPED:
+                out.write("[LOG] %u records lost (buffer full)\n" % int.from_bytes(data, "little"))
+            else:
+                name, level, fmt = messages[msg_id]
+                out.write("[%s] %s\n" % (level, format_message(fmt, data)))
+            out.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="decodes the binary logs of Log.c")
+    parser.add_argument("source", help="file of the received bytes or serial port")
+    parser.add_argument("--baud", type=int, default=9600)
+    parser.add_argument("--cfg", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "Log_Lcfg.h"),
+                        help="the Log_Lcfg.h used to build the program")
+    args = parser.parse_args()
+
+    messages = load_messages(args.cfg)
+    if os.path.isfile(args.source):
+        with open(args.source, "rb") as stream:
+            decode(stream, messages)
+    else:
+        import serial
+        with serial.Serial(args.source, args.baud, timeout=0.1) as port:
+            class PortStream:
+                def read(self, n):
+                    data = b""
+                    while not data:
+                        data = port.read(n)
+                    return data
+            decode(PortStream(), messages)
+
+
+if __name__ == "__main__":
+    main()
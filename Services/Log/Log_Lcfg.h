@@ -0,0 +1,45 @@
+/**
+ * @file Log_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  this file contains the configuration of the binary trace logger
+ *          - the compile time log level
+ *          - the size of the RAM ring buffer
+ *          - the table of the log messages (name , level , format)
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef LOG_LCFG_H_
+#define LOG_LCFG_H_
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                           Configuration Macros                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define LOG_LEVEL            LOG_LEVEL_INFO   /**< the messages with a higher level are removed at compile time */
+#define LOG_BUFFER_SIZE      128              /**< bytes of the ring buffer (power of 2 , max 32768) */
+#define LOG_MAX_ARGS         6                /**< max 16-bit arguments of one message (a 32-bit argument takes 2) */
+
+/*
+ * the table of the log messages , one line per message :
+ *	X(name , level , "format")
+ * the ID of a message is its line number in the table (from 0) , it is the only thing sent with the arguments :
+ * the format strings are not in the program , Log_Decoder.py reads them from this file.
+ * Add the new messages at the end so the IDs of the old logs stay the same.
+ *
+ * the format accepts (every argument is sent in 2 bytes , 4 bytes with l) :
+ *	%d %u %x %X %c   16-bit argument
+ *	%ld %lu %lx %lX  32-bit argument , passed with LOG_U32(value)
+ */
+#define LOG_MESSAGES(X)                                                            \
+	X(BOOT,            LOG_LEVEL_INFO,   "boot , reset flags=0x%02X")               \
+	X(UART_RX_OVERRUN, LOG_LEVEL_WARN,   "uart rx overrun , count=%u")              \
+	X(ADC_SAMPLE,      LOG_LEVEL_DEBUG,  "adc ch=%u value=%u")                      \
+	X(TEMPERATURE,     LOG_LEVEL_INFO,   "temp=%d.%u C at %lu ms")                  \
+	X(ASSERT,          LOG_LEVEL_ERROR,  "assert failed , line=%u")
+
+
+#endif /* LOG_LCFG_H_ */
@@ -0,0 +1,384 @@
+/**
+ * @file Modbus.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the Modbus RTU slave.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * LIB files
+ */
+#include "Std_Types.h"
+#include "Utils_interrupt.h"
+
+/*
+ * MCAL files
+ */
+#include "UART_Interface.h"
+#include "SysTick_Interface.h"
+
+/*
+ * Services files
+ */
+#include "CRC.h"
+
+/*
+ * the module files
+ */
+#include "Modbus.h"
+#include "Modbus_Lcfg.h"
+#include "Modbus_Private.h"
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Checks the register map , calculates the 3.5 characters silence of the baud rate
+ *        and starts the interrupt reception.
+ *        UART_Init and SysTick_Init must be called before , call it again after UART_SetBaudRate.
+ *
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NOT_CONFIGURED if a region of Modbus_arrRegions has no data or no register
+ */
+Std_Error_t Modbus_Init(void)
+{
+	u8 i;
+	u16 baud, t35Us;
+
+	for(i=0; i<MODBUS_REGION_COUNT; i++)
+	{
+		if((NULL_PTR == Modbus_arrRegions[i].Data) || (0 == Modbus_arrRegions[i].Count))
+		{
+			return STD_NOT_CONFIGURED;
+		}
+	}
+
+	baud = Modbus_arrBaudValues[UART_GetBaudRate()];
+	t35Us = (baud > 19200) ? MODBUS_T35_FIXED_US : (u16)((35UL * MODBUS_CHAR_BITS * 100000UL) / baud);
+	// the ticks are counted from the tick of the last byte : one more tick so the real silence is never shorter
+	Modbus_u8T35Ticks = (u8)(((t35Us + (1000U * SYSTICK_TICK_MS) - 1) / (1000U * SYSTICK_TICK_MS)) + 1);
+
+	UART_RX_InterruptDisable();
+	UART_UDRE_InterruptDisable();
+	UART_TX_InterruptDisable();
+	UART_RX_SetCallBack(Modbus_RxCallBack);
+	UART_UDRE_SetCallBack(Modbus_UdreCallBack);
+	UART_TX_SetCallBack(Modbus_TxCallBack);
+	UART_FlushRx();
+	Modbus_Restart();
+	UART_RX_InterruptEnable();
+
+	return STD_OK;
+}
+
+/**
+ * @brief Ends the frame after the silence , executes the request and starts the response.
+ *        Call it in the super loop : a frame is executed at the first call after its silence ,
+ *        the bytes of the next request are dropped until the response of the previous one is sent.
+ */
+void Modbus_MainFunction(void)
+{
+	u8 sregCopy;
+	u16 len, crc;
+	u8 address;
+
+	Critical_Enter(sregCopy);
+	if((MODBUS_STATE_RECEIVING == Modbus_u8State) && (0 != Modbus_u16Len) &&
+	   ((u16)(SysTick_GetTicks() - Modbus_u16LastRxTick) >= Modbus_u8T35Ticks))
+	{
+		Modbus_u8State = MODBUS_STATE_FRAME_READY;
+	}
+	Critical_Exit(sregCopy);
+
+	if(MODBUS_STATE_FRAME_READY != Modbus_u8State)
+	{
+		return;
+	}
+
+	// from here the ISRs do not touch the buffer
+	len = Modbus_u16Len;
+	if(STD_TRUE == Modbus_bOverflow)
+	{
+		Modbus_Stats.Overflows++;
+		Modbus_Restart();
+		return;
+	}
+	// the CRC of a frame followed by its CRC (low byte first) is 0
+	if((len < MODBUS_MIN_FRAME) || (0 != CRC16Modbus_Calculate(Modbus_arrFrame, len)))
+	{
+		Modbus_Stats.CrcErrors++;
+		Modbus_Restart();
+		return;
+	}
+	address = Modbus_arrFrame[0];
+	if((address != Modbus_u8Address) && (MODBUS_BROADCAST_ADDRESS != address))
+	{
+		Modbus_Restart();
+		return;
+	}
+
+	Modbus_Stats.Frames++;
+	len = Modbus_Execute(len - MODBUS_CRC_SIZE);
+	if(MODBUS_BROADCAST_ADDRESS == address)
+	{
+		Modbus_Stats.Broadcasts++;
+		Modbus_Restart();
+		return;
+	}
+
+	crc = CRC16Modbus_Calculate(Modbus_arrFrame, len);
+	Modbus_arrFrame[len++] = (u8)crc;
+	Modbus_arrFrame[len++] = (u8)(crc >> 8);
+	Modbus_u16Len = len;
+	Modbus_u16TxIdx = 0;
+	Modbus_u8State = MODBUS_STATE_REPLYING;
+	UART_UDRE_InterruptEnable();
+}
+
+/**
+ * @brief Changes the address of the slave (ex: read from DIP switches).
+ *
+ * @param address the new address (1 .. 247).
+ * @return Std_Error_t STD_OK , STD_INVALID_ARG if the address is 0 or more than 247.
+ */
+Std_Error_t Modbus_SetSlaveAddress(u8 address)
+{
+	if((MODBUS_BROADCAST_ADDRESS == address) || (address > MODBUS_MAX_SLAVE_ADDRESS))
+	{
+		return STD_INVALID_ARG;
+	}
+	Modbus_u8Address = address;
+
+	return STD_OK;
+}
+
+/**
+ * @brief Gets a copy of the counters.
+ *
+ * @param stats the copy.
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER.
+ */
+Std_Error_t Modbus_GetStats(Modbus_Stats_t *stats)
+{
+	u8 sregCopy;
+
+	if(NULL_PTR == stats)
+	{
+		return STD_NULL_POINTER;
+	}
+	// DroppedBytes is counted by the RXC ISR
+	Critical_Enter(sregCopy);
+	*stats = Modbus_Stats;
+	Critical_Exit(sregCopy);
+
+	return STD_OK;
+}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                        Static Private Functions                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief RXC call back : stores the byte and its time.
+ */
+static void Modbus_RxCallBack(void)
+{
+	u8 data = UART_ReceiveByteNoBlock();
+	u16 now = SysTick_GetTicks();
+
+	if(MODBUS_STATE_RECEIVING != Modbus_u8State)
+	{
+		Modbus_Stats.DroppedBytes++;
+		return;
+	}
+	if((0 != Modbus_u16Len) && ((u16)(now - Modbus_u16LastRxTick) >= Modbus_u8T35Ticks))
+	{
+		// the main function did not see the end of the previous frame : it is ended here and this byte is dropped
+		Modbus_u8State = MODBUS_STATE_FRAME_READY;
+		Modbus_Stats.DroppedBytes++;
+		return;
+	}
+	if(Modbus_u16Len < MODBUS_BUFFER_SIZE)
+	{
+		Modbus_arrFrame[Modbus_u16Len] = data;
+		Modbus_u16Len++;
+	}
+	else
+	{
+		Modbus_bOverflow = STD_TRUE;
+	}
+	Modbus_u16LastRxTick = now;
+}
+
+/**
+ * @brief UDRE call back : sends the next byte of the response.
+ */
+static void Modbus_UdreCallBack(void)
+{
+	UART_SendByteNoBlock(Modbus_arrFrame[Modbus_u16TxIdx]);
+	Modbus_u16TxIdx++;
+	if(Modbus_u16TxIdx >= Modbus_u16Len)
+	{
+		// the last byte is in UDR : the end of the response is its TX complete
+		UART_UDRE_InterruptDisable();
+		UART_TX_InterruptEnable();
+	}
+}
+
+/**
+ * @brief TXC call back : the last stop bit is on the line , the reception starts again.
+ */
+static void Modbus_TxCallBack(void)
+{
+	UART_TX_InterruptDisable();
+	Modbus_Restart();
+}
+
+/**
+ * @brief Empties the buffer and gives it back to the RXC ISR.
+ */
+static void Modbus_Restart(void)
+{
+	Modbus_u16Len = 0;
+	Modbus_bOverflow = STD_FALSE;
+	// the state is the last : the RXC ISR may run just after it
+	Modbus_u8State = MODBUS_STATE_RECEIVING;
+}
+
+/**
+ * @brief Finds the region holding the registers start .. start+count-1.
+ *
+ * @return const Modbus_Region_t* the region , NULL_PTR if the registers are not in one region of this type.
+ */
+static const Modbus_Region_t* Modbus_FindRegion(Modbus_RegisterType_t type, u16 start, u16 count)
+{
+	u8 i;
+	const Modbus_Region_t *region;
+
+	for(i=0; i<MODBUS_REGION_COUNT; i++)
+	{
+		region = &Modbus_arrRegions[i];
+		if((type == region->Type) && (start >= region->Start) &&
+		   (((u32)start + count) <= ((u32)region->Start + region->Count)))
+		{
+			return region;
+		}
+	}
+	return NULL_PTR;
+}
+
+/**
+ * @brief Replaces the request by an exception response.
+ *
+ * @return u16 the length of the response without the CRC.
+ */
+static u16 Modbus_Exception(u8 code)
+{
+	Modbus_Stats.Exceptions++;
+	Modbus_arrFrame[1] |= MODBUS_EXCEPTION_FLAG;
+	Modbus_arrFrame[2] = code;
+
+	return 3;
+}
+
+/**
+ * @brief Executes the request of the buffer and writes the response over it.
+ *
+ * @param len the length of the request without the CRC.
+ * @return u16 the length of the response without the CRC.
+ */
+static u16 Modbus_Execute(u16 len)
+{
+	u8 *frame = Modbus_arrFrame;
+	const Modbus_Region_t *region;
+	u16 start, count, i;
+	u16 *data;
+	u8 function = frame[1];
+
+	if((MODBUS_FC_READ_HOLDING != function) && (MODBUS_FC_READ_INPUT != function) &&
+	   (MODBUS_FC_WRITE_SINGLE != function) && (MODBUS_FC_WRITE_MULTIPLE != function))
+	{
+		return Modbus_Exception(MODBUS_EX_ILLEGAL_FUNCTION);
+	}
+	// every request has the address of the first register after the function code
+	if(len < 6)
+	{
+		return Modbus_Exception(MODBUS_EX_ILLEGAL_VALUE);
+	}
+	start = ((u16)frame[2] << 8) | frame[3];
+	count = ((u16)frame[4] << 8) | frame[5];
+
+	switch(function)
+	{
+	case MODBUS_FC_READ_HOLDING:
+	case MODBUS_FC_READ_INPUT:
+		// request : address function start(2) count(2) , response : address function bytes(1) values(2*count)
+		if((6 != len) || (0 == count) || (count > MODBUS_MAX_READ) || ((5 + 2 * count) > MODBUS_BUFFER_SIZE))
+		{
+			return Modbus_Exception(MODBUS_EX_ILLEGAL_VALUE);
+		}
+		region = Modbus_FindRegion((MODBUS_FC_READ_HOLDING == function) ? MODBUS_HOLDING_REGISTER : MODBUS_INPUT_REGISTER, start, count);
+		if(NULL_PTR == region)
+		{
+			return Modbus_Exception(MODBUS_EX_ILLEGAL_ADDRESS);
+		}
+		// the values overwrite the start and the count , they are in the locals
+		data = &region->Data[start - region->Start];
+		frame[2] = (u8)(2 * count);
+		for(i=0; i<count; i++)
+		{
+			frame[3 + 2 * i] = (u8)(data[i] >> 8);
+			frame[4 + 2 * i] = (u8)data[i];
+		}
+		return 3 + 2 * count;
+
+	case MODBUS_FC_WRITE_SINGLE:
+		// request : address function register(2) value(2) , response : the request
+		if(6 != len)
+		{
+			return Modbus_Exception(MODBUS_EX_ILLEGAL_VALUE);
+		}
+		region = Modbus_FindRegion(MODBUS_HOLDING_REGISTER, start, 1);
+		if(NULL_PTR == region)
+		{
+			return Modbus_Exception(MODBUS_EX_ILLEGAL_ADDRESS);
+		}
+		region->Data[start - region->Start] = count;
+		if(NULL_PTR != region->pfWritten)
+		{
+			region->pfWritten(start, 1);
+		}
+		return 6;
+
+	default: /* MODBUS_FC_WRITE_MULTIPLE */
+		// request : address function start(2) count(2) bytes(1) values(2*count) , response : the first 6 bytes
+		if((len < 7) || (0 == count) || (count > MODBUS_MAX_WRITE) || (frame[6] != 2 * count) || (len != 7 + 2 * count))
+		{
+			return Modbus_Exception(MODBUS_EX_ILLEGAL_VALUE);
+		}
+		region = Modbus_FindRegion(MODBUS_HOLDING_REGISTER, start, count);
+		if(NULL_PTR == region)
+		{
+			return Modbus_Exception(MODBUS_EX_ILLEGAL_ADDRESS);
+		}
+		data = &region->Data[start - region->Start];
+		for(i=0; i<count; i++)
+		{
+			data[i] = ((u16)frame[7 + 2 * i] << 8) | frame[8 + 2 * i];
+		}
+		if(NULL_PTR != region->pfWritten)
+		{
+			region->pfWritten(start, count);
+		}
+		return 6;
+	}
+}
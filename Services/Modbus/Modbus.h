@@ -0,0 +1,145 @@
+/**
+ * @file Modbus.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Modbus RTU slave over UART.
+ *         The bytes are received by the RXC interrupt , a silence of 3.5 characters on the line ends the frame.
+ *         The main function checks the CRC-16/MODBUS , runs the request on the register map (Modbus_Lcfg.c)
+ *         and builds the response in place in the receive buffer (no copy) , then the UDRE interrupt sends it.
+ *         Function codes :
+ *           - 03 read holding registers       - 04 read input registers
+ *           - 06 write single register        - 16 write multiple registers
+ *         the other function codes get the exception 01 , the address 0 (broadcast) is executed without response.
+ *EX:
+ *	UART_Init();
+ *	SysTick_Init();
+ *	Global_Interrupt_Enable__asm();
+ *	Modbus_Init();
+ *	while(1)
+ *	{
+ *		Modbus_arrInputRegisters[0] = ADC_value;
+ *		Modbus_MainFunction();
+ *	}
+ *
+ *         The slave takes the UART : the RXC , TXC and UDRE call backs are set by Modbus_Init.
+ *         The frame must be 8 data bits (UART_Lcfg.h) , Modbus RTU asks for even parity and 1 stop bit or no parity and 2 stop bits.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef MODBUS_H_
+#define MODBUS_H_
+
+#include "Std_Types.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define MODBUS_BROADCAST_ADDRESS      0
+#define MODBUS_MAX_SLAVE_ADDRESS      247
+
+/* function codes */
+#define MODBUS_FC_READ_HOLDING        0x03
+#define MODBUS_FC_READ_INPUT          0x04
+#define MODBUS_FC_WRITE_SINGLE        0x06
+#define MODBUS_FC_WRITE_MULTIPLE      0x10
+
+/* exception codes */
+#define MODBUS_EX_ILLEGAL_FUNCTION    0x01
+#define MODBUS_EX_ILLEGAL_ADDRESS     0x02   /**< a register of the request is not in one region of the map */
+#define MODBUS_EX_ILLEGAL_VALUE       0x03   /**< wrong quantity , byte count or length */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief the type of a region of the register map.
+ */
+typedef enum
+{
+	MODBUS_HOLDING_REGISTER,   /**< read/write by the master (03 , 06 , 16) */
+	MODBUS_INPUT_REGISTER      /**< read only by the master (04) */
+}Modbus_RegisterType_t;
+
+/**
+ * @brief Pointer to the call back of a region called after the master writes registers (06 , 16).
+ *        It is called from Modbus_MainFunction (not from an ISR) before the response is sent.
+ *
+ * @param address the Modbus address of the first written register.
+ * @param count the number of written registers.
+ */
+typedef void (*Modbus_WriteCallBack_t)(u16 address, u16 count);
+
+/**
+ * @brief one region of the register map : Count registers from the Modbus address Start stored in Data[0 .. Count-1].
+ */
+typedef struct
+{
+	Modbus_RegisterType_t   Type;
+	u16                     Start;
+	u16                     Count;
+	u16                    *Data;
+	Modbus_WriteCallBack_t  pfWritten;   /**< may be NULL_PTR */
+}Modbus_Region_t;
+
+/**
+ * @brief the counters of the slave.
+ */
+typedef struct
+{
+	u16 Frames;         /**< frames with a good CRC for this slave (broadcast included) */
+	u16 CrcErrors;      /**< frames with a wrong CRC or shorter than 4 bytes */
+	u16 Exceptions;     /**< exception responses */
+	u16 Broadcasts;     /**< requests to the address 0 */
+	u16 Overflows;      /**< frames longer than MODBUS_BUFFER_SIZE */
+	u16 DroppedBytes;   /**< bytes received while a request was executed or a response was sent */
+}Modbus_Stats_t;
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Checks the register map , calculates the 3.5 characters silence of the baud rate
+ *        and starts the interrupt reception.
+ *        UART_Init and SysTick_Init must be called before , call it again after UART_SetBaudRate.
+ *
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NOT_CONFIGURED if a region of Modbus_arrRegions has no data or no register
+ */
+Std_Error_t Modbus_Init(void);
+
+/**
+ * @brief Ends the frame after the silence , executes the request and starts the response.
+ *        Call it in the super loop : a frame is executed at the first call after its silence ,
+ *        the bytes of the next request are dropped until the response of the previous one is sent.
+ */
+void Modbus_MainFunction(void);
+
+/**
+ * @brief Changes the address of the slave (ex: read from DIP switches).
+ *
+ * @param address the new address (1 .. 247).
+ * @return Std_Error_t STD_OK , STD_INVALID_ARG if the address is 0 or more than 247.
+ */
+Std_Error_t Modbus_SetSlaveAddress(u8 address);
+
+/**
+ * @brief Gets a copy of the counters.
+ *
+ * @param stats the copy.
+ * @return Std_Error_t STD_OK , STD_NULL_POINTER.
+ */
+Std_Error_t Modbus_GetStats(Modbus_Stats_t *stats);
+
+
+#endif /* MODBUS_H_ */
@@ -0,0 +1,40 @@
+/**
+ * @file Modbus_Lcfg.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  this file contains the register map of the Modbus RTU slave
+ *          - the type of every region (holding / input)
+ *          - its first Modbus address and its number of registers
+ *          - the RAM array of the registers and the call back of the writes
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+* LIB
+*/
+#include "Std_Types.h"
+
+/*
+* Include own files
+*/
+#include "Modbus.h"
+#include "Modbus_Lcfg.h"
+
+/*
+* the registers of the example map
+*/
+u16 Modbus_arrHoldingRegisters[MODBUS_HOLDING_COUNT];
+u16 Modbus_arrInputRegisters[MODBUS_INPUT_COUNT];
+
+/*
+*  a request must be inside one region , the regions of the same type must not overlap.
+*  the addresses are the ones of the frame (0 based , the register 40001 of the master is the address 0).
+*/
+const Modbus_Region_t Modbus_arrRegions[MODBUS_REGION_COUNT] =
+{
+	{MODBUS_HOLDING_REGISTER, 0x0000, MODBUS_HOLDING_COUNT, Modbus_arrHoldingRegisters, NULL_PTR},
+	{MODBUS_INPUT_REGISTER,   0x0000, MODBUS_INPUT_COUNT,   Modbus_arrInputRegisters,   NULL_PTR},
+};
@@ -0,0 +1,44 @@
+/**
+ * @file Modbus_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  this file contains the configuration of the Modbus RTU slave
+ *          - the address of the slave and the size of the frame buffer
+ *          - the size of the register map (the regions are in Modbus_Lcfg.c)
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef MODBUS_LCFG_H_
+#define MODBUS_LCFG_H_
+
+#include "Std_Types.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                           Configuration Macros                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define MODBUS_SLAVE_ADDRESS     1      /**< 1 .. 247 , it can be changed at run time with Modbus_SetSlaveAddress */
+#define MODBUS_BUFFER_SIZE       256    /**< the request is received and the response is built in this buffer ,
+                                             256 takes every standard frame , a smaller buffer limits the registers per request */
+#define MODBUS_REGION_COUNT      2      /**< number of entries of Modbus_arrRegions (Modbus_Lcfg.c) */
+
+#define MODBUS_HOLDING_COUNT     16     /**< holding registers of the example map (read/write : 03 , 06 , 16) */
+#define MODBUS_INPUT_COUNT       8      /**< input registers of the example map (read only : 04) */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              Register Data                                   */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/*
+ * the registers of the example map , the application reads the holding registers (written by the master)
+ * and writes the input registers (read by the master).
+ */
+extern u16 Modbus_arrHoldingRegisters[MODBUS_HOLDING_COUNT];
+extern u16 Modbus_arrInputRegisters[MODBUS_INPUT_COUNT];
+
+
+#endif /* MODBUS_LCFG_H_ */
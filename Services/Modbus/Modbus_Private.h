@@ -0,0 +1,114 @@
+/**
+ * @file Modbus_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private information of the Modbus RTU slave.
+ *         The user must not include this file in the application code.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef MODBUS_PRIVATE_H_
+#define MODBUS_PRIVATE_H_
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Macros                                 */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+#define MODBUS_MIN_FRAME         4      /**< address + function + CRC */
+#define MODBUS_CRC_SIZE          2
+#define MODBUS_CHAR_BITS         11     /**< the character time of the standard : start + 8 data + parity + stop */
+#define MODBUS_T35_FIXED_US      1750   /**< the silence above 19200 baud */
+#define MODBUS_MAX_READ          125    /**< registers of one 03 / 04 request */
+#define MODBUS_MAX_WRITE         123    /**< registers of one 16 request */
+#define MODBUS_EXCEPTION_FLAG    0x80
+
+/* the state of the frame buffer */
+#define MODBUS_STATE_RECEIVING   0      /**< the RXC ISR fills the buffer */
+#define MODBUS_STATE_FRAME_READY 1      /**< the silence ended the frame , the main function owns the buffer */
+#define MODBUS_STATE_REPLYING    2      /**< the UDRE ISR sends the response from the buffer */
+
+#if (MODBUS_BUFFER_SIZE < 8) || (MODBUS_BUFFER_SIZE > 256)
+#error "MODBUS_BUFFER_SIZE must be 8 .. 256"
+#endif
+#if (MODBUS_SLAVE_ADDRESS == 0) || (MODBUS_SLAVE_ADDRESS > 247)
+#error "MODBUS_SLAVE_ADDRESS must be 1 .. 247"
+#endif
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                     Static Private Global Vaiables                           */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static u8 Modbus_arrFrame[MODBUS_BUFFER_SIZE];       /**< the request , then the response */
+static volatile u16 Modbus_u16Len = 0;              /**< bytes received , then bytes of the response */
+static volatile u16 Modbus_u16TxIdx = 0;
+static volatile u16 Modbus_u16LastRxTick = 0;       /**< tick of the last received byte */
+static volatile u8  Modbus_u8State = MODBUS_STATE_RECEIVING;
+static volatile Std_Bool_t Modbus_bOverflow = STD_FALSE;
+static u8 Modbus_u8Address = MODBUS_SLAVE_ADDRESS;
+static u8 Modbus_u8T35Ticks = 0;                    /**< ticks of silence that end a frame */
+static Modbus_Stats_t Modbus_Stats;
+
+static const u16 Modbus_arrBaudValues[TOTAL_BAUD_RATE] = {2400, 4800, 9600, 14400, 19200, 28800};
+
+extern const Modbus_Region_t Modbus_arrRegions[MODBUS_REGION_COUNT];
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                        Static Private Functions                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief RXC call back : stores the byte and its time.
+ */
+static void Modbus_RxCallBack(void);
+
+/**
+ * @brief UDRE call back : sends the next byte of the response.
+ */
+static void Modbus_UdreCallBack(void);
+
+/**
+ * @brief TXC call back : the last stop bit is on the line , the reception starts again.
+ */
+static void Modbus_TxCallBack(void);
+
+/**
+ * @brief Empties the buffer and gives it back to the RXC ISR.
+ */
+static void Modbus_Restart(void);
+
+/**
+ * @brief Finds the region holding the registers start .. start+count-1.
+ *
+ * @return const Modbus_Region_t* the region , NULL_PTR if the registers are not in one region of this type.
+ */
+static const Modbus_Region_t* Modbus_FindRegion(Modbus_RegisterType_t type, u16 start, u16 count);
+
+/**
+ * @brief Replaces the request by an exception response.
+ *
+ * @return u16 the length of the response without the CRC.
+ */
+static u16 Modbus_Exception(u8 code);
+
+/**
+ * @brief Executes the request of the buffer and writes the response over it.
+ *
+ * @param len the length of the request without the CRC.
+ * @return u16 the length of the response without the CRC.
+ */
+static u16 Modbus_Execute(u16 len);
+
+
+#endif /* MODBUS_PRIVATE_H_ */
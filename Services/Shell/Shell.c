@@ -0,0 +1,486 @@
+/**
+ * @file Shell.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the command shell over UART.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <avr/pgmspace.h>
+
+/*
+ * LIB files
+ */
+#include "Std_Types.h"
+#include "MemMap.h"
+
+/*
+ * MCAL layer files
+ */
+#include "UART_interface.h"
+
+/*
+ * Services files
+ */
+#include "UART_Services.h"
+
+/*
+ * the module files
+ */
+#include "Shell.h"
+#include "Shell_Lcfg.h"
+#include "Shell_Private.h"
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Checks the command table and prints the prompt.
+ *        The UART must be initialized.
+ *
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NOT_VALID if an entry of the table has a wrong hash or can not be reached from its slot
+ *                       (the hash literal in Shell_Lcfg.h is not the hash of the name)
+ */
+Std_Error_t Shell_Init(void)
+{
+	Std_Error_t state = STD_OK;
+	u16 slot = 0;
+	u16 probe = 0;
+	u16 hash = 0;
+
+	for(slot = 0; slot < SHELL_TABLE_SIZE; slot++)
+	{
+		hash = pgm_read_word(&Shell_arrOfCommands[slot].Hash);
+		if(hash != 0)
+		{
+			if(hash != Shell_HashFlash(pgm_read_ptr(&Shell_arrOfCommands[slot].Name)))
+			{
+				state = STD_NOT_VALID;
+			}
+			else
+			{
+				/* the search goes from the home slot to this slot , no empty slot must be between them */
+				for(probe = SHELL_SLOT(hash); probe != slot; probe = (probe + 1) & (SHELL_TABLE_SIZE-1))
+				{
+					if(pgm_read_word(&Shell_arrOfCommands[probe].Hash) == 0)
+					{
+						state = STD_NOT_VALID;
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	Shell_u8LineLen = 0;
+	Shell_u8LastChar = 0;
+	Shell_bLineOverflow = STD_FALSE;
+	UART_Printf(SHELL_PROMPT);
+	return state;
+}
+
+/**
+ * @brief Reads the characters received by the UART and runs the command of every complete line.
+ *        Call it periodically from the main loop , it never waits.
+ */
+void Shell_MainFunction(void)
+{
+	u8 ch = 0;
+
+	while(UART_ReceiveBytePeriodicCheck(&ch) == STD_DONE)
+	{
+		Shell_ReceiveChar(ch);
+	}
+}
+
+/**
+ * @brief Adds one received character to the line , the command runs when the line ends ('\r' or '\n').
+ *        Use it instead of Shell_MainFunction when the characters come from another source (ring buffer , ...).
+ *
+ * @param ch the received character.
+ */
+void Shell_ReceiveChar(u8 ch)
+{
+	if((ch == '\r') || (ch == '\n'))
+	{
+		/* "\r\n" is one line end */
+		if(!((ch == '\n') && (Shell_u8LastChar == '\r')))
+		{
+			UART_Printf("\r\n");
+			if(Shell_bLineOverflow == STD_TRUE)
+			{
+				UART_Printf("ERR %u\r\n", (u16)STD_BUFFER_OVERFLOW);
+			}
+			else if(Shell_u8LineLen > 0)
+			{
+				Shell_arrLine[Shell_u8LineLen] = NULL_CHAR;
+				Shell_Execute();
+			}
+			else
+			{
+				/* empty line */
+			}
+			Shell_u8LineLen = 0;
+			Shell_bLineOverflow = STD_FALSE;
+			UART_Printf(SHELL_PROMPT);
+		}
+	}
+	else if((ch == SHELL_BACKSPACE) || (ch == SHELL_DELETE))
+	{
+		if(Shell_u8LineLen > 0)
+		{
+			Shell_u8LineLen--;
+#if SHELL_ECHO
+			UART_Printf("\b \b");
+#endif
+		}
+	}
+	else if(Shell_u8LineLen < SHELL_LINE_SIZE)
+	{
+		Shell_arrLine[Shell_u8LineLen] = (char)ch;
+		Shell_u8LineLen++;
+#if SHELL_ECHO
+		UART_SendByteBusyWait(ch);
+#endif
+	}
+	else
+	{
+		/* the line is dropped when it ends */
+		Shell_bLineOverflow = STD_TRUE;
+	}
+	Shell_u8LastChar = ch;
+}
+
+/**
+ * @brief Calculates the hash of a command name : hash = (hash * 33) ^ ch , from 5381 , on 16 bits.
+ *        The same function must be used to calculate the hash literals in Shell_Lcfg.h.
+ *
+ * @param name the NULL terminated name.
+ * @return u16 the hash.
+ */
+u16 Shell_Hash(const char *name)
+{
+	u16 hash = SHELL_HASH_INIT;
+
+	while(*name != NULL_CHAR)
+	{
+		hash = (u16)((hash << 5) + hash) ^ (u8)*name;
+		name++;
+	}
+	return hash;
+}
+
+/**
+ * @brief Converts an argument to a number , decimal or hexadecimal with the "0x" prefix.
+ *
+ * @param str the argument.
+ * @param pValue a pointer to store the number.
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NOT_VALID if the argument is not a number or is more than 0xFFFF
+ */
+Std_Error_t Shell_ParseNumber(const char *str, u16 *pValue)
+{
+	Std_Error_t state = STD_OK;
+	u32 value = 0;
+	u8 base = 10;
+	u8 digit = 0;
+
+	if((str[0] == '0') && ((str[1] == 'x') || (str[1] == 'X')))
+	{
+		base = 16;
+		str += 2;
+	}
+	if(*str == NULL_CHAR)
+	{
+		state = STD_NOT_VALID;
+	}
+	while((*str != NULL_CHAR) && (state == STD_OK))
+	{
+		if((*str >= '0') && (*str <= '9'))
+		{
+			digit = (u8)(*str - '0');
+		}
+		else if((*str >= 'a') && (*str <= 'f'))
+		{
+			digit = (u8)(*str - 'a' + 10);
+		}
+		else if((*str >= 'A') && (*str <= 'F'))
+		{
+			digit = (u8)(*str - 'A' + 10);
+		}
+		else
+		{
+			digit = 0xFF;
+		}
+
+		if(digit >= base)
+		{
+			state = STD_NOT_VALID;
+		}
+		else
+		{
+			value = (value * base) + digit;
+			if(value > 0xFFFF)
+			{
+				state = STD_NOT_VALID;
+			}
+		}
+		str++;
+	}
+	if(state == STD_OK)
+	{
+		*pValue = (u16)value;
+	}
+	return state;
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              Built-in commands                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief help : prints the name and the help of every command.
+ */
+Std_Error_t Shell_CmdHelp(u8 argc, char *argv[])
+{
+	u16 slot = 0;
+
+	(void)argc;
+	(void)argv;
+	for(slot = 0; slot < SHELL_TABLE_SIZE; slot++)
+	{
+		if(pgm_read_word(&Shell_arrOfCommands[slot].Hash) != 0)
+		{
+			Shell_PrintFlash(pgm_read_ptr(&Shell_arrOfCommands[slot].Name));
+			UART_Printf("\t");
+			Shell_PrintFlash(pgm_read_ptr(&Shell_arrOfCommands[slot].Help));
+			UART_Printf("\r\n");
+		}
+	}
+	return STD_OK;
+}
+
+/**
+ * @brief port <a..d> [value] : reads the PIN register , or writes the PORT register if a value is given.
+ */
+Std_Error_t Shell_CmdPort(u8 argc, char *argv[])
+{
+	static volatile u8 * const Shell_arrOfPinReg[SHELL_TOTAL_PORTS]  = {&PINA, &PINB, &PINC, &PIND};
+	static volatile u8 * const Shell_arrOfPortReg[SHELL_TOTAL_PORTS] = {&PORTA, &PORTB, &PORTC, &PORTD};
+	Std_Error_t state = STD_OK;
+	u8 port = 0;
+	u16 value = 0;
+
+	if((argc < 2) || (argc > 3) || (argv[1][1] != NULL_CHAR))
+	{
+		state = STD_INVALID_ARG;
+	}
+	else
+	{
+		port = (u8)((argv[1][0] | 0x20) - 'a');  /* lower case */
+		if(port >= SHELL_TOTAL_PORTS)
+		{
+			state = STD_INVALID_ARG;
+		}
+		else if(argc == 2)
+		{
+			UART_Printf("0x%02X\r\n", (u16)*Shell_arrOfPinReg[port]);
+		}
+		else if(Shell_ParseNumber(argv[2], &value) != STD_OK)
+		{
+			state = STD_INVALID_ARG;
+		}
+		else if(value > 0xFF)
+		{
+			state = STD_OUT_OF_RANGE;
+		}
+		else
+		{
+			*Shell_arrOfPortReg[port] = (u8)value;
+			UART_Printf("OK\r\n");
+		}
+	}
+	return state;
+}
+
+/**
+ * @brief peek <address> : reads an I/O register (address 0x20 .. 0x5F in the data space).
+ * @warning reading some registers has side effects (ex: UDR , the flags cleared by reading).
+ */
+Std_Error_t Shell_CmdPeek(u8 argc, char *argv[])
+{
+	Std_Error_t state = STD_OK;
+	u16 address = 0;
+
+	if((argc != 2) || (Shell_ParseNumber(argv[1], &address) != STD_OK))
+	{
+		state = STD_INVALID_ARG;
+	}
+	else if((address < SHELL_IO_FIRST) || (address > SHELL_IO_LAST))
+	{
+		state = STD_OUT_OF_RANGE;
+	}
+	else
+	{
+		UART_Printf("0x%02X\r\n", (u16)*(volatile u8*)(u16)address);
+	}
+	return state;
+}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                        Static Private Functions                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief Sends a string stored in flash (PROGMEM).
+ */
+static void Shell_PrintFlash(const char *str)
+{
+	u8 ch = pgm_read_byte(str);
+
+	while(ch != NULL_CHAR)
+	{
+		UART_SendByteBusyWait(ch);
+		str++;
+		ch = pgm_read_byte(str);
+	}
+}
+
+/**
+ * @brief Shell_Hash of a name stored in flash (PROGMEM).
+ */
+static u16 Shell_HashFlash(const char *name)
+{
+	u16 hash = SHELL_HASH_INIT;
+	u8 ch = pgm_read_byte(name);
+
+	while(ch != NULL_CHAR)
+	{
+		hash = (u16)((hash << 5) + hash) ^ ch;
+		name++;
+		ch = pgm_read_byte(name);
+	}
+	return hash;
+}
+
+/**
+ * @brief Finds the slot of a command.
+ *        The search starts at SHELL_SLOT(hash) and goes to the next slot until the command or an empty slot.
+ *
+ * @return const Shell_Command_t* the entry in flash , NULL_PTR if the command is not in the table.
+ */
+static const Shell_Command_t* Shell_Find(const char *name)
+{
+	const Shell_Command_t *pCommand = NULL_PTR;
+	const char *pName = NULL_PTR;
+	const char *pArg = NULL_PTR;
+	u16 hash = Shell_Hash(name);
+	u16 entryHash = 0;
+	u16 slot = SHELL_SLOT(hash);
+	u16 count = 0;
+
+	for(count = 0; count < SHELL_TABLE_SIZE; count++)
+	{
+		entryHash = pgm_read_word(&Shell_arrOfCommands[slot].Hash);
+		if(entryHash == 0)
+		{
+			break;
+		}
+		if(entryHash == hash)
+		{
+			/* same hash , the name is compared to reject a different name with the same hash */
+			pName = pgm_read_ptr(&Shell_arrOfCommands[slot].Name);
+			pArg = name;
+			while((*pArg != NULL_CHAR) && ((u8)*pArg == pgm_read_byte(pName)))
+			{
+				pArg++;
+				pName++;
+			}
+			if((*pArg == NULL_CHAR) && (pgm_read_byte(pName) == NULL_CHAR))
+			{
+				pCommand = &Shell_arrOfCommands[slot];
+				break;
+			}
+		}
+		slot = (slot + 1) & (SHELL_TABLE_SIZE-1);
+	}
+	return pCommand;
+}
+
+/**
+ * @brief Splits the line in arguments and runs the command.
+ */
+static void Shell_Execute(void)
+{
+	char *argv[SHELL_MAX_ARGS];
+	u8 argc = 0;
+	u8 idx = 0;
+	Std_Bool_t inWord = STD_FALSE;
+	Std_Error_t state = STD_OK;
+	const Shell_Command_t *pCommand = NULL_PTR;
+	Shell_Handler_t pfHandler = NULL_PTR;
+
+	/* the spaces are replaced by NULL , argv points inside the line */
+	for(idx = 0; (idx < Shell_u8LineLen) && (state == STD_OK); idx++)
+	{
+		if(Shell_arrLine[idx] == ' ')
+		{
+			Shell_arrLine[idx] = NULL_CHAR;
+			inWord = STD_FALSE;
+		}
+		else if(inWord == STD_FALSE)
+		{
+			if(argc < SHELL_MAX_ARGS)
+			{
+				argv[argc] = &Shell_arrLine[idx];
+				argc++;
+				inWord = STD_TRUE;
+			}
+			else
+			{
+				state = STD_INVALID_ARG;
+			}
+		}
+		else
+		{
+			/* inside a word */
+		}
+	}
+
+	if(argc == 0)
+	{
+		/* only spaces */
+	}
+	else if(state != STD_OK)
+	{
+		UART_Printf("ERR %u\r\n", (u16)state);
+	}
+	else
+	{
+		pCommand = Shell_Find(argv[0]);
+		if(pCommand == NULL_PTR)
+		{
+			UART_Printf("unknown command: %s\r\n", argv[0]);
+		}
+		else
+		{
+			pfHandler = (Shell_Handler_t)pgm_read_ptr(&pCommand->pfHandler);
+			state = pfHandler(argc, argv);
+			if(state != STD_OK)
+			{
+				UART_Printf("ERR %u\r\n", (u16)state);
+			}
+		}
+	}
+}
@@ -0,0 +1,134 @@
+/**
+ * @file Shell.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Line oriented command shell over UART.
+ *         The received characters are collected in a line buffer , the line is split in place in
+ *         arguments (no copy) and the command is found by the hash of its name in a table in flash :
+ *         the hash selects the slot directly so the lookup time and the RAM do not grow with the number of commands.
+ *         The command table is in Shell_Lcfg.c.
+ *EX:
+ *	> port a          -> 0x3C        (reads PINA)
+ *	> port b 0x0F     -> OK          (writes PORTB)
+ *	> peek 0x3F       -> 0x80        (reads SREG)
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef SHELL_H_
+#define SHELL_H_
+
+#include "Std_Types.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief home slot of a command in the table , the hash is folded so all its bits are used.
+ *        It is a constant expression , it is used as the index of the table initializers in Shell_Lcfg.c.
+ */
+#define SHELL_SLOT(hash)     ((((hash) ^ ((hash)>>8))) & (SHELL_TABLE_SIZE-1))
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief command handler.
+ *        argv[0] is the command name , the arguments are NULL terminated strings inside the line buffer.
+ *        The handler prints its result with UART_Printf and returns STD_OK ,
+ *        any other value is printed as "ERR <value>" by the shell.
+ */
+typedef Std_Error_t (*Shell_Handler_t)(u8 argc, char *argv[]);
+
+/**
+ * @brief one entry of the command table (in flash).
+ */
+typedef struct
+{
+	u16              Hash;      /**< Shell_Hash of the name (0 : empty slot) */
+	const char      *Name;      /**< name in flash (PROGMEM) */
+	Shell_Handler_t  pfHandler;
+	const char      *Help;      /**< one line of help in flash (PROGMEM) */
+}Shell_Command_t;
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Checks the command table and prints the prompt.
+ *        The UART must be initialized.
+ *
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NOT_VALID if an entry of the table has a wrong hash or can not be reached from its slot
+ *                       (the hash literal in Shell_Lcfg.h is not the hash of the name)
+ */
+Std_Error_t Shell_Init(void);
+
+/**
+ * @brief Reads the characters received by the UART and runs the command of every complete line.
+ *        Call it periodically from the main loop , it never waits.
+ */
+void Shell_MainFunction(void);
+
+/**
+ * @brief Adds one received character to the line , the command runs when the line ends ('\r' or '\n').
+ *        Use it instead of Shell_MainFunction when the characters come from another source (ring buffer , ...).
+ *
+ * @param ch the received character.
+ */
+void Shell_ReceiveChar(u8 ch);
+
+/**
+ * @brief Calculates the hash of a command name : hash = (hash * 33) ^ ch , from 5381 , on 16 bits.
+ *        The same function must be used to calculate the hash literals in Shell_Lcfg.h.
+ *
+ * @param name the NULL terminated name.
+ * @return u16 the hash.
+ */
+u16 Shell_Hash(const char *name);
+
+/**
+ * @brief Converts an argument to a number , decimal or hexadecimal with the "0x" prefix.
+ *
+ * @param str the argument.
+ * @param pValue a pointer to store the number.
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NOT_VALID if the argument is not a number or is more than 0xFFFF
+ */
+Std_Error_t Shell_ParseNumber(const char *str, u16 *pValue);
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              Built-in commands                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief help : prints the name and the help of every command.
+ */
+Std_Error_t Shell_CmdHelp(u8 argc, char *argv[]);
+
+/**
+ * @brief port <a..d> [value] : reads the PIN register , or writes the PORT register if a value is given.
+ */
+Std_Error_t Shell_CmdPort(u8 argc, char *argv[]);
+
+/**
+ * @brief peek <address> : reads an I/O register (address 0x20 .. 0x5F in the data space).
+ * @warning reading some registers has side effects (ex: UDR , the flags cleared by reading).
+ */
+Std_Error_t Shell_CmdPeek(u8 argc, char *argv[]);
+
+
+#endif /* SHELL_H_ */
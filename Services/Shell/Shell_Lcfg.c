@@ -0,0 +1,48 @@
+/**
+ * @file Shell_Lcfg.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  this file contains the command table of the shell (in flash)
+ *          - the hash of the name (Shell_Lcfg.h)
+ *          - the name and the help line (in flash)
+ *          - the handler
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <avr/pgmspace.h>
+
+/*
+* LIB
+*/
+#include "Std_Types.h"
+
+/*
+* Include own files
+*/
+#include "Shell.h"
+#include "Shell_Lcfg.h"
+
+/*
+* the names and the help lines , in flash
+*/
+static const char Shell_NameHelp[] PROGMEM = "help";
+static const char Shell_HelpHelp[] PROGMEM = "list the commands";
+static const char Shell_NamePort[] PROGMEM = "port";
+static const char Shell_HelpPort[] PROGMEM = "port <a..d> [value] : read PINx / write PORTx";
+static const char Shell_NamePeek[] PROGMEM = "peek";
+static const char Shell_HelpPeek[] PROGMEM = "peek <address> : read an I/O register (0x20..0x5F)";
+
+/*
+*  every command is put in the slot SHELL_SLOT of its hash , the other slots are empty.
+*  if two commands have the same slot the compiler warns (-Woverride-init) :
+*  put the second one in the next free slot ([SHELL_SLOT(x)+1] , it is found by linear probing).
+*/
+const Shell_Command_t Shell_arrOfCommands[SHELL_TABLE_SIZE] PROGMEM =
+{
+	[SHELL_SLOT(SHELL_HASH_HELP)] = {SHELL_HASH_HELP, Shell_NameHelp, Shell_CmdHelp, Shell_HelpHelp},
+	[SHELL_SLOT(SHELL_HASH_PORT)] = {SHELL_HASH_PORT, Shell_NamePort, Shell_CmdPort, Shell_HelpPort},
+	[SHELL_SLOT(SHELL_HASH_PEEK)] = {SHELL_HASH_PEEK, Shell_NamePeek, Shell_CmdPeek, Shell_HelpPeek},
+};
@@ -0,0 +1,41 @@
+/**
+ * @file Shell_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  this file contains the configuration of the command shell
+ *          - the size of the line and the number of arguments
+ *          - the size of the command table
+ *          - the hash of every command name
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef SHELL_LCFG_H_
+#define SHELL_LCFG_H_
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                           Configuration Macros                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define SHELL_LINE_SIZE      32          /**< max characters of a line (the longer lines are dropped) */
+#define SHELL_MAX_ARGS       4           /**< max words of a line (command name included) */
+#define SHELL_TABLE_SIZE     16          /**< slots of the command table (power of 2 , keep it at least 2 x the commands) */
+#define SHELL_ECHO           1           /**< 1 : the received characters are sent back (terminal without local echo) , 0 : no echo */
+#define SHELL_PROMPT         "> "
+
+/*
+ * the hash of the command names (Shell_Hash)
+ * to add a command calculate the hash of its name , ex with python :
+ *	h=5381
+ *	for c in b"name": h=((h*33)^c)&0xFFFF
+ *	print(hex(h))
+ * Shell_Init returns STD_NOT_VALID if a literal is wrong.
+ */
+#define SHELL_HASH_HELP      0x5C94      /**< "help" */
+#define SHELL_HASH_PORT      0xD85C      /**< "port" */
+#define SHELL_HASH_PEEK      0xC17E      /**< "peek" */
+
+
+#endif /* SHELL_LCFG_H_ */
@@ -0,0 +1,82 @@
+/**
+ * @file Shell_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private information of the command shell.
+ *         The user must not include this file in the application code.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef SHELL_PRIVATE_H_
+#define SHELL_PRIVATE_H_
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Macros                                 */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+#define SHELL_HASH_INIT      5381
+#define SHELL_TOTAL_PORTS    4
+#define SHELL_IO_FIRST       0x20   /**< first I/O register in the data space */
+#define SHELL_IO_LAST        0x5F   /**< last I/O register in the data space */
+#define SHELL_BACKSPACE      0x08
+#define SHELL_DELETE         0x7F
+
+#if ((SHELL_TABLE_SIZE & (SHELL_TABLE_SIZE-1)) != 0) || (SHELL_TABLE_SIZE > 256)
+#error "SHELL_TABLE_SIZE must be a power of 2 and not more than 256"
+#endif
+#if (SHELL_LINE_SIZE > 255) || (SHELL_MAX_ARGS == 0)
+#error "SHELL_LINE_SIZE must be less than 256 and SHELL_MAX_ARGS more than 0"
+#endif
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                     Static Private Global Vaiables                           */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static char Shell_arrLine[SHELL_LINE_SIZE + 1];  /**< + 1 for the NULL */
+static u8   Shell_u8LineLen = 0;
+static u8   Shell_u8LastChar = 0;                /**< to see "\r\n" as one line end */
+static Std_Bool_t Shell_bLineOverflow = STD_FALSE;
+
+extern const Shell_Command_t Shell_arrOfCommands[SHELL_TABLE_SIZE];
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                        Static Private Functions                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief Sends a string stored in flash (PROGMEM).
+ */
+static void Shell_PrintFlash(const char *str);
+
+/**
+ * @brief Shell_Hash of a name stored in flash (PROGMEM).
+ */
+static u16 Shell_HashFlash(const char *name);
+
+/**
+ * @brief Finds the slot of a command.
+ *        The search starts at SHELL_SLOT(hash) and goes to the next slot until the command or an empty slot.
+ *
+ * @return const Shell_Command_t* the entry in flash , NULL_PTR if the command is not in the table.
+ */
+static const Shell_Command_t* Shell_Find(const char *name);
+
+/**
+ * @brief Splits the line in arguments and runs the command.
+ */
+static void Shell_Execute(void);
+
+
+#endif /* SHELL_PRIVATE_H_ */
@@ -0,0 +1,314 @@
+/**
+ * @file UART_SelfTest.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the UART link self-test.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * LIB files
+ */
+#include "Std_Types.h"
+
+/*
+ * MCAL files
+ */
+#include "UART_Interface.h"
+#include "SysTick_Interface.h"
+
+/*
+ * Services files
+ */
+#include "UART_Services.h"
+
+/*
+ * the module files
+ */
+#include "UART_SelfTest.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PRIVATE Macros                                  */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define UART_SELFTEST_LFSR_TAPS   0xB400   /**< x^16 + x^14 + x^13 + x^11 + 1 , period 65535 */
+#define UART_SELFTEST_FRAME_BITS  13       /**< longest frame : start + 9 data + parity + 2 stop */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                     Static Private Global Vaiables                           */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static const u16 UART_SelfTest_arrBaudValues[TOTAL_BAUD_RATE] = {2400, 4800, 9600, 14400, 19200, 28800};
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                        Static Private Functions                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief Next byte of the pseudo-random sequence (16-bit Galois LFSR).
+ */
+static u8 UART_SelfTestNextByte(u16 *pState)
+{
+	u16 state = *pState;
+
+	state = (state & 1) ? ((state >> 1) ^ UART_SELFTEST_LFSR_TAPS) : (state >> 1);
+	*pState = state;
+	return (u8)state;
+}
+
+/**
+ * @brief Number of bits set in a byte.
+ */
+static u8 UART_SelfTestCountBits(u8 value)
+{
+	u8 count = 0;
+
+	while(0 != value)
+	{
+		value &= (u8)(value - 1);
+		count++;
+	}
+	return count;
+}
+
+/**
+ * @brief Bad bytes of a result.
+ */
+static u16 UART_SelfTestBadBytes(const UART_SelfTestResult_t *result)
+{
+	return result->Lost + result->WrongBytes + result->FrameErrors + result->ParityErrors + result->Overruns;
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Tests one baud rate : sends the sequence byte by byte and checks every echo.
+ *        The UART is switched to baudRate (and stays there).
+ *
+ * @param config the parameters of the test.
+ * @param baudRate the baud rate (BAUD_xxx).
+ * @param result the result of the baud rate.
+ * @return Std_Error_t - STD_OK if the baud rate is reliable
+ *                     - STD_NOK if it is not
+ *                     - STD_NULL_POINTER , STD_INVALID_ARG
+ */
+Std_Error_t UART_SelfTestBaud(const UART_SelfTestConfig_t *config, u8 baudRate, UART_SelfTestResult_t *result)
+{
+	u16 bytes, timeoutMs, state;
+	u16 i, start, rtt;
+	u32 rttTotal = 0;
+	u8 expected, data, errors;
+	u8 lostInRow = 0;
+
+	if((NULL_PTR == config) || (NULL_PTR == result))
+	{
+		return STD_NULL_POINTER;
+	}
+	if(baudRate >= TOTAL_BAUD_RATE)
+	{
+		return STD_INVALID_ARG;
+	}
+
+	bytes     = (0 != config->BytesPerBaud) ? config->BytesPerBaud : UART_SELFTEST_BYTES_PER_BAUD;
+	timeoutMs = (0 != config->TimeoutMs)    ? config->TimeoutMs    : UART_SELFTEST_TIMEOUT_MS;
+	// the byte goes out and comes back : 2 frames on the line + 1 tick of rounding
+	timeoutMs += (u16)((2UL * UART_SELFTEST_FRAME_BITS * 1000UL) / UART_SelfTest_arrBaudValues[baudRate]) + 1;
+	state     = (0 != config->Seed)         ? config->Seed         : UART_SELFTEST_SEED;
+	state    ^= baudRate;   // another sequence at every baud rate
+	if(0 == state)
+	{
+		state = UART_SELFTEST_SEED;
+	}
+
+	result->Sent = 0;
+	result->Received = 0;
+	result->WrongBytes = 0;
+	result->BitErrors = 0;
+	result->FrameErrors = 0;
+	result->ParityErrors = 0;
+	result->Overruns = 0;
+	result->Lost = 0;
+	result->LatencyAvgUs = 0;
+	result->LatencyMaxMs = 0;
+	result->Tested = STD_TRUE;
+
+	if((UART_SELFTEST_REMOTE_ECHO == config->Mode) && (NULL_PTR != config->pfBeforeBaud))
+	{
+		config->pfBeforeBaud(baudRate);
+	}
+	UART_RX_InterruptDisable();
+	UART_RX_SetCallBack(NULL_PTR);
+	UART_SetBaudRate(baudRate);
+	SysTick_DelayMs(UART_SELFTEST_SETTLE_MS);
+	UART_FlushRx();
+
+	// stop and wait : one byte on the line at a time , so the round trip of every byte is measured
+	for(i=0; (i < bytes) && (lostInRow < UART_SELFTEST_MAX_LOST_IN_ROW); i++)
+	{
+		expected = UART_SelfTestNextByte(&state);
+		result->Sent++;
+		start = SysTick_GetTicks();
+		if(STD_OK != UART_SendByteTimeout(expected, start + timeoutMs))
+		{
+			result->Lost++;
+			lostInRow++;
+			continue;
+		}
+
+		if(STD_OK != UART_ReceiveByteStatusTimeout(&data, &errors, start + timeoutMs))
+		{
+			// a late echo would be taken as the echo of the next byte
+			SysTick_DelayMs(timeoutMs);
+			UART_FlushRx();
+			result->Lost++;
+			lostInRow++;
+			continue;
+		}
+		lostInRow = 0;
+		rtt = SysTick_GetTicks() - start;
+		rttTotal += rtt;
+		if(rtt > result->LatencyMaxMs)
+		{
+			result->LatencyMaxMs = rtt;
+		}
+		result->Received++;
+
+		if(0 != (errors & UART_ERROR_FRAME))
+		{
+			result->FrameErrors++;
+		}
+		else if(0 != (errors & UART_ERROR_PARITY))
+		{
+			result->ParityErrors++;
+		}
+		else if(0 != (errors & UART_ERROR_OVERRUN))
+		{
+			result->Overruns++;
+		}
+		else if(data != expected)
+		{
+			result->WrongBytes++;
+			result->BitErrors += UART_SelfTestCountBits(data ^ expected);
+		}
+	}
+	// the bytes not sent after a dead link are lost
+	result->Lost += bytes - i;
+	result->Sent += bytes - i;
+
+	if(0 != result->Received)
+	{
+		rttTotal = (rttTotal * 1000UL * SYSTICK_TICK_MS) / result->Received;
+		result->LatencyAvgUs = (rttTotal > 0xFFFF) ? 0xFFFF : (u16)rttTotal;
+	}
+	result->Reliable = (UART_SelfTestBadBytes(result) <= UART_SELFTEST_MAX_ERRORS) ? STD_TRUE : STD_FALSE;
+
+	return (STD_TRUE == result->Reliable) ? STD_OK : STD_NOK;
+}
+
+/**
+ * @brief Tests every baud rate of config->BaudMask from the lowest and selects the highest reliable one.
+ *
+ * @param config the parameters of the test.
+ * @param report the report (the baud rates not tested have Tested = STD_FALSE).
+ * @return Std_Error_t - STD_OK if a reliable baud rate is found
+ *                     - STD_NOK if no baud rate is reliable (the previous baud rate is restored)
+ *                     - STD_NULL_POINTER
+ */
+Std_Error_t UART_SelfTestRun(const UART_SelfTestConfig_t *config, UART_SelfTestReport_t *report)
+{
+	u8 mask, baudRate;
+	u8 previous = UART_GetBaudRate();
+	u8 finalBaud = previous;
+
+	if((NULL_PTR == config) || (NULL_PTR == report))
+	{
+		return STD_NULL_POINTER;
+	}
+
+	mask = (0 != config->BaudMask) ? config->BaudMask : (u8)((1 << TOTAL_BAUD_RATE) - 1);
+	report->BestBaudRate = UART_SELFTEST_NO_BAUD;
+	for(baudRate=0; baudRate<TOTAL_BAUD_RATE; baudRate++)
+	{
+		report->Results[baudRate].Tested = STD_FALSE;
+		report->Results[baudRate].Reliable = STD_FALSE;
+		if(0 != (mask & (1 << baudRate)))
+		{
+			if(STD_OK == UART_SelfTestBaud(config, baudRate, &report->Results[baudRate]))
+			{
+				report->BestBaudRate = baudRate;
+			}
+		}
+	}
+
+	if((UART_SELFTEST_NO_BAUD != report->BestBaudRate) && (STD_TRUE == config->KeepBest))
+	{
+		finalBaud = report->BestBaudRate;
+	}
+	if((UART_SELFTEST_REMOTE_ECHO == config->Mode) && (NULL_PTR != config->pfBeforeBaud))
+	{
+		config->pfBeforeBaud(finalBaud);
+	}
+	UART_SetBaudRate(finalBaud);
+
+	return (UART_SELFTEST_NO_BAUD != report->BestBaudRate) ? STD_OK : STD_NOK;
+}
+
+/**
+ * @brief Gets the byte error rate of a result in parts per million of the sent bytes.
+ *
+ * @param result the result of a baud rate.
+ * @return u32 the bad bytes (lost , wrong , frame , parity , overrun) per million sent bytes.
+ */
+u32 UART_SelfTestErrorPpm(const UART_SelfTestResult_t *result)
+{
+	if((NULL_PTR == result) || (0 == result->Sent))
+	{
+		return 0;
+	}
+	return ((u32)UART_SelfTestBadBytes(result) * 1000000UL) / result->Sent;
+}
+
+/**
+ * @brief Prints the report with UART_Printf , one line per tested baud rate.
+ *EX:
+ *	baud=9600 sent=200 lost=0 wrong=0 bits=0 fe=0 pe=0 dor=0 ppm=0 rtt_avg=1250us rtt_max=2ms ok
+ *	best=19200
+ *
+ * @param report the report of UART_SelfTestRun.
+ */
+void UART_SelfTestPrintReport(const UART_SelfTestReport_t *report)
+{
+	u8 baudRate;
+	const UART_SelfTestResult_t *result;
+
+	for(baudRate=0; baudRate<TOTAL_BAUD_RATE; baudRate++)
+	{
+		result = &report->Results[baudRate];
+		if(STD_TRUE == result->Tested)
+		{
+			UART_Printf("baud=%u sent=%u lost=%u wrong=%u bits=%u fe=%u pe=%u dor=%u ppm=%lu rtt_avg=%uus rtt_max=%ums %s\r\n",
+			            UART_SelfTest_arrBaudValues[baudRate], result->Sent, result->Lost, result->WrongBytes, result->BitErrors,
+			            result->FrameErrors, result->ParityErrors, result->Overruns, UART_SelfTestErrorPpm(result),
+			            result->LatencyAvgUs, result->LatencyMaxMs, (STD_TRUE == result->Reliable) ? "ok" : "bad");
+		}
+	}
+	if(UART_SELFTEST_NO_BAUD != report->BestBaudRate)
+	{
+		UART_Printf("best=%u\r\n", UART_SelfTest_arrBaudValues[report->BestBaudRate]);
+	}
+	else
+	{
+		UART_Printf("best=none\r\n");
+	}
+}
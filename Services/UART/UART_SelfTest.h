@@ -0,0 +1,157 @@
+/**
+ * @file UART_SelfTest.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  UART link self-test for the production test and the field.
+ *         A pseudo-random sequence is sent byte by byte through a loopback (TX wired to RX) or a remote echo ,
+ *         every echoed byte is checked and timed at every baud rate :
+ *           - round trip latency (average and max)
+ *           - wrong bytes and wrong bits , frame , parity and overrun errors , lost bytes
+ *         then the highest baud rate without errors is selected.
+ *EX:
+ *	UART_SelfTestConfig_t config = {UART_SELFTEST_LOOPBACK, 0, 0, 0, 0, STD_TRUE, NULL_PTR};
+ *	UART_SelfTestReport_t report;
+ *	if(STD_OK == UART_SelfTestRun(&config, &report)) { // the UART runs at report.BestBaudRate }
+ *	UART_SelfTestPrintReport(&report);
+ *
+ *         The test takes the UART : the asynchronous receptions must be stopped and the RX call back is removed.
+ *         The system tick must be running (SysTick_Init) and the global interrupt enabled.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UART_SELFTEST_H_
+#define UART_SELFTEST_H_
+
+#include "Std_Types.h"
+#include "UART_Interface.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                           Configuration Macros                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define  UART_SELFTEST_BYTES_PER_BAUD    200      /**< default bytes sent at every baud rate */
+#define  UART_SELFTEST_TIMEOUT_MS        2        /**< default latency of the echo added to the time of 2 frames (loopback) */
+#define  UART_SELFTEST_SEED              0xACE1   /**< default seed of the pseudo-random sequence (not 0) */
+#define  UART_SELFTEST_MAX_ERRORS        0        /**< bad bytes (lost , wrong , frame , parity , overrun) allowed at a reliable baud rate */
+#define  UART_SELFTEST_MAX_LOST_IN_ROW   4        /**< the test of a baud rate stops after this number of lost bytes in a row (no link) */
+#define  UART_SELFTEST_SETTLE_MS         2        /**< idle time after a change of the baud rate */
+
+#define  UART_SELFTEST_NO_BAUD           0xFF     /**< BestBaudRate when no baud rate is reliable */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief where the bytes come back from.
+ */
+typedef enum
+{
+	UART_SELFTEST_LOOPBACK,      /**< TX wired to RX (test plug) */
+	UART_SELFTEST_REMOTE_ECHO    /**< the peer sends back every byte , it must follow the changes of the baud rate */
+}UART_SelfTestMode_t;
+
+/**
+ * @brief Pointer to the call back called before every change of the baud rate (remote echo) ,
+ *        at the old baud rate , so the application can tell the peer to switch to the new baud rate.
+ */
+typedef void (*UART_SelfTestBaudCallBack_t)(u8 baudRate);
+
+/**
+ * @brief parameters of the test (0 selects the default value of the member).
+ */
+typedef struct
+{
+	UART_SelfTestMode_t          Mode;
+	u8                           BaudMask;      /**< (1<<BAUD_xxx) of the baud rates to test , 0 : all */
+	u16                          BytesPerBaud;  /**< 0 : UART_SELFTEST_BYTES_PER_BAUD */
+	u16                          TimeoutMs;     /**< latency of the echo added to the time of 2 frames (the peer) , 0 : UART_SELFTEST_TIMEOUT_MS */
+	u16                          Seed;          /**< 0 : UART_SELFTEST_SEED */
+	Std_Bool_t                   KeepBest;      /**< STD_TRUE : the UART stays at the best baud rate , STD_FALSE : the previous baud rate is restored */
+	UART_SelfTestBaudCallBack_t  pfBeforeBaud;  /**< may be NULL_PTR (loopback) */
+}UART_SelfTestConfig_t;
+
+/**
+ * @brief result of one baud rate.
+ */
+typedef struct
+{
+	u16         Sent;
+	u16         Received;
+	u16         WrongBytes;      /**< received with a different value */
+	u16         BitErrors;       /**< wrong bits in the wrong bytes */
+	u16         FrameErrors;
+	u16         ParityErrors;
+	u16         Overruns;
+	u16         Lost;            /**< not received before the timeout */
+	u16         LatencyAvgUs;    /**< average round trip of the received bytes */
+	u16         LatencyMaxMs;
+	Std_Bool_t  Tested;
+	Std_Bool_t  Reliable;        /**< not more than UART_SELFTEST_MAX_ERRORS bad bytes */
+}UART_SelfTestResult_t;
+
+/**
+ * @brief report of the test , one result per baud rate (index BAUD_xxx).
+ */
+typedef struct
+{
+	UART_SelfTestResult_t  Results[TOTAL_BAUD_RATE];
+	u8                     BestBaudRate;  /**< the highest reliable baud rate or UART_SELFTEST_NO_BAUD */
+}UART_SelfTestReport_t;
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Tests one baud rate : sends the sequence byte by byte and checks every echo.
+ *        The UART is switched to baudRate (and stays there).
+ *
+ * @param config the parameters of the test.
+ * @param baudRate the baud rate (BAUD_xxx).
+ * @param result the result of the baud rate.
+ * @return Std_Error_t - STD_OK if the baud rate is reliable
+ *                     - STD_NOK if it is not
+ *                     - STD_NULL_POINTER , STD_INVALID_ARG
+ */
+Std_Error_t UART_SelfTestBaud(const UART_SelfTestConfig_t *config, u8 baudRate, UART_SelfTestResult_t *result);
+
+/**
+ * @brief Tests every baud rate of config->BaudMask from the lowest and selects the highest reliable one.
+ *
+ * @param config the parameters of the test.
+ * @param report the report (the baud rates not tested have Tested = STD_FALSE).
+ * @return Std_Error_t - STD_OK if a reliable baud rate is found
+ *                     - STD_NOK if no baud rate is reliable (the previous baud rate is restored)
+ *                     - STD_NULL_POINTER
+ */
+Std_Error_t UART_SelfTestRun(const UART_SelfTestConfig_t *config, UART_SelfTestReport_t *report);
+
+/**
+ * @brief Gets the byte error rate of a result in parts per million of the sent bytes.
+ *
+ * @param result the result of a baud rate.
+ * @return u32 the bad bytes (lost , wrong , frame , parity , overrun) per million sent bytes.
+ */
+u32 UART_SelfTestErrorPpm(const UART_SelfTestResult_t *result);
+
+/**
+ * @brief Prints the report with UART_Printf , one line per tested baud rate.
+ *EX:
+ *	baud=9600 sent=200 lost=0 wrong=0 bits=0 fe=0 pe=0 dor=0 ppm=0 rtt_avg=1250us rtt_max=2ms ok
+ *	best=19200
+ *
+ * @param report the report of UART_SelfTestRun.
+ */
+void UART_SelfTestPrintReport(const UART_SelfTestReport_t *report);
+
+
+#endif /* UART_SELFTEST_H_ */
@@ -14,16 +14,89 @@
  */
 #include "Std_Types.h"
 #include "Utils_BitMath.h"
+#include "Utils_interrupt.h"
+#include "Std_Lib.h"
 
 /*
  * MCAL layer files
  */
 #include "UART_Interface.h"
+#include "UART_Lcfg.h"
+#include "SysTick_Interface.h"
+
+/*
+ * Services files
+ */
+#include "CRC.h"
+#include "COBS.h"
 
 /*
  * the module files
  */
 #include "UART_Services.h"
+#include "UART_Services_Private.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              PRIVATE Macros                                  */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/* the check of the checksum protocol is accumulated in a u16 , only UART_CHECKSUM_SIZE bytes of it are sent */
+#if   (UART_CHECKSUM_TYPE == UART_CHECKSUM_SUM16)
+#define UART_CHECKSUM_INIT                  0
+#define UART_CHECKSUM_ADD_LEN(check,data)   (check)            /* the length is not covered */
+#define UART_CHECKSUM_ADD_DATA(check,data)  ((u16)((check)+(data)))
+#define UART_CHECKSUM_SIZE                  2
+#elif (UART_CHECKSUM_TYPE == UART_CHECKSUM_CRC8)
+#define UART_CHECKSUM_INIT                  CRC8_INIT
+#define UART_CHECKSUM_ADD_LEN(check,data)   CRC8_Update((u8)(check),(data))
+#define UART_CHECKSUM_ADD_DATA(check,data)  CRC8_Update((u8)(check),(data))
+#define UART_CHECKSUM_SIZE                  1
+#elif (UART_CHECKSUM_TYPE == UART_CHECKSUM_CRC16)
+#define UART_CHECKSUM_INIT                  CRC16_INIT
+#define UART_CHECKSUM_ADD_LEN(check,data)   CRC16_Update((check),(data))
+#define UART_CHECKSUM_ADD_DATA(check,data)  CRC16_Update((check),(data))
+#define UART_CHECKSUM_SIZE                  2
+#else
+#error "UART_CHECKSUM_TYPE must be UART_CHECKSUM_SUM16 , UART_CHECKSUM_CRC8 or UART_CHECKSUM_CRC16"
+#endif
+
+/* the CPU clock , the frame of UART_Lcfg.h and the baud rate give the time of one byte on the line */
+#if   (CPU_F == _4_MHZ)
+#define UART_CPU_HZ                         4000000UL
+#elif (CPU_F == _8_MHZ)
+#define UART_CPU_HZ                         8000000UL
+#else
+#define UART_CPU_HZ                         16000000UL
+#endif
+#define UART_FRAME_BITS                     (1UL + N_DATA_BITS + ((PARITY_MODE != NO_PARITY) ? 1UL : 0UL) + N_STOP_BITS)
+#define UART_BYTE_CYCLES(baud)              ((UART_CPU_HZ * UART_FRAME_BITS) / (baud))
+
+/* the budget of one call of UART_SendBurstPeriodicCheck : UART_BURST_LOOP_SHARE % of the loop period in whole byte times ,
+ * one budget per baud rate as UART_SetBaudRate changes the byte time */
+#if (UART_BURST_LOOP_SHARE < 1) || (UART_BURST_LOOP_SHARE > 100)
+#error "UART_BURST_LOOP_SHARE must be 1 .. 100"
+#endif
+#define UART_BURST_LOOP_CYCLES              ((UART_CPU_HZ / 1000UL) * UART_BURST_LOOP_PERIOD_MS)
+#define UART_BURST_LOOP_BYTES(baud)         ((UART_BURST_LOOP_CYCLES / 100UL) * UART_BURST_LOOP_SHARE / UART_BYTE_CYCLES(baud))
+#define UART_BURST_CYCLE_BUDGET(baud)       (((UART_BURST_LOOP_BYTES(baud) > 0) ? UART_BURST_LOOP_BYTES(baud) : 1UL) * UART_BYTE_CYCLES(baud))
+#define UART_BURST_POLL_BUDGET(baud)        ((UART_BURST_CYCLE_BUDGET(baud) / UART_BURST_POLL_CYCLES) + 1UL)
+#if (UART_BURST_POLL_BUDGET(2400UL) > 65535UL) || (UART_BURST_POLL_BUDGET(4800UL) > 65535UL) || \
+    (UART_BURST_POLL_BUDGET(9600UL) > 65535UL) || (UART_BURST_POLL_BUDGET(14400UL) > 65535UL) || \
+    (UART_BURST_POLL_BUDGET(19200UL) > 65535UL) || (UART_BURST_POLL_BUDGET(28800UL) > 65535UL)
+#error "UART_BURST_LOOP_PERIOD_MS * UART_BURST_LOOP_SHARE is too long for the u16 poll counter of UART_SendBurstPeriodicCheck"
+#endif
+
+/* the poll budget of UART_SendBurstPeriodicCheck , indexed by UART_GetBaudRate() (BAUD_2400 .. BAUD_28800) */
+static const u16 UART_arrBurstPollBudget[TOTAL_BAUD_RATE] =
+{
+	UART_BURST_POLL_BUDGET(2400UL),
+	UART_BURST_POLL_BUDGET(4800UL),
+	UART_BURST_POLL_BUDGET(9600UL),
+	UART_BURST_POLL_BUDGET(14400UL),
+	UART_BURST_POLL_BUDGET(19200UL),
+	UART_BURST_POLL_BUDGET(28800UL)
+};
 
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
@@ -60,7 +133,7 @@ void UART_SendStringBusyWait(const u8 Str[],String_Terminate_t Terminate)
 
 void UART_SendBufferBusyWait(const u8 buffer[])
 {
-	u8 i = 0;
+	u16 i = 0;
 	while(buffer[i] != NULL_CHAR)
 	{
 		UART_SendByteBusyWait(buffer[i]);
@@ -81,7 +154,7 @@ void UART_SendBufferBusyWait(const u8 buffer[])
  */
 void UART_SendStringBusyWait(const u8 Str[])
 {
-	u8 i = 0;
+	u16 i = 0;
 	while(Str[i] != NULL_CHAR)
 	{
 		UART_SendByteBusyWait(Str[i]);
@@ -103,7 +176,7 @@ void UART_SendStringBusyWait(const u8 Str[])
  */
 void UART_ReceiveStringBusyWait(u8 Str[]) 
 {
-	u8 i = 0;
+	u16 i = 0;
 	Str[i] = UART_ReceiveByteBusyWait();
 	while(Str[i] != STRING_TERMINATOR)
 	{
@@ -113,6 +186,211 @@ void UART_ReceiveStringBusyWait(u8 Str[])
 	Str[i] = NULL_CHAR;
 }
 
+/**
+ * @brief Sends a number of bytes over UART using busy-waiting.
+ *
+ * This function sends len bytes starting from buffer over UART using busy-waiting.
+ * The buffer is not scanned for a terminator so it may contain any byte value (binary data).
+ * The function does not return until all bytes have been sent.
+ *
+ * @param buffer The buffer containing the data to be sent.
+ * @param len The number of bytes to be sent (0 .. 65535).
+ */
+void UART_SendBufferLenBusyWait(const u8 buffer[], u16 len)
+{
+	const u8 *end = buffer + len;
+	while(buffer != end)
+	{
+		UART_SendByteBusyWait(*buffer);
+		buffer++;
+	}
+}
+
+/**
+ * @brief Receives a number of bytes over UART using busy-waiting.
+ *
+ * This function receives exactly len bytes over UART using busy-waiting and stores them in buffer.
+ * No terminator is expected or added so the data may contain any byte value (binary data).
+ *
+ * @param buffer The buffer in which to store the received data (at least len bytes).
+ * @param len The number of bytes to be received (0 .. 65535).
+ */
+void UART_ReceiveBufferLenBusyWait(u8 buffer[], u16 len)
+{
+	u8 *end = buffer + len;
+	while(buffer != end)
+	{
+		*buffer = UART_ReceiveByteBusyWait();
+		buffer++;
+	}
+}
+
+/**
+ * @brief Receives a string over UART using busy-waiting without overflowing the buffer.
+ *
+ * This function receives characters until STRING_TERMINATOR is received or the buffer is full.
+ * The received string is always terminated by a NULL character in the buffer,
+ * so at most capacity-1 characters are stored.
+ *
+ * @param Str The buffer in which to store the received string.
+ * @param capacity The size of the buffer in bytes (at least 1).
+ * @return u16 The number of characters stored (without the NULL character).
+ */
+u16 UART_ReceiveStringBoundedBusyWait(u8 Str[], u16 capacity)
+{
+	u16 i = 0;
+	u8 ch;
+
+	if(0 == capacity)
+	{
+		return 0;
+	}
+	while(i < (capacity-1))
+	{
+		ch = UART_ReceiveByteBusyWait();
+		if(STRING_TERMINATOR == ch)
+		{
+			break;
+		}
+		Str[i] = ch;
+		i++;
+	}
+	Str[i] = NULL_CHAR;
+	return i;
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                         Send and Receive Functions          	               */
+/*                               with timeout                                  */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+/* the timeout functions need the system tick (SysTick_Init) and the global interrupt enabled ,
+ * the deadline is an absolute tick : SysTick_GetTicks() + timeout */
+
+/**
+ * @brief Sends a number of bytes over UART using busy-waiting until a deadline.
+ *
+ * Like UART_SendBufferLenBusyWait but the function gives up when the deadline is reached.
+ * The deadline is for the whole transfer (not for every byte).
+ *
+ * @param buffer The buffer containing the data to be sent.
+ * @param len The number of bytes to be sent (0 .. 65535).
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t STD_OK if all the bytes are sent , STD_TIMEOUT if the deadline is reached first.
+ */
+Std_Error_t UART_SendBufferLenTimeout(const u8 buffer[], u16 len, u16 deadline)
+{
+	Std_Error_t errorStatus = STD_OK;
+	u16 i;
+
+	for(i=0; (i<len) && (STD_OK == errorStatus); i++)
+	{
+		errorStatus = UART_SendByteTimeout(buffer[i], deadline);
+	}
+	return errorStatus;
+}
+
+/**
+ * @brief Sends a string over UART using busy-waiting until a deadline , the NULL character is sent too.
+ *
+ * Like UART_SendStringBusyWait but the function gives up when the deadline is reached.
+ *
+ * @param Str The string to be sent.
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t STD_OK if the string is sent , STD_TIMEOUT if the deadline is reached first.
+ */
+Std_Error_t UART_SendStringTimeout(const u8 Str[], u16 deadline)
+{
+	Std_Error_t errorStatus = STD_OK;
+	u16 i = 0;
+
+	do
+	{
+		errorStatus = UART_SendByteTimeout(Str[i], deadline);
+	}while((STD_OK == errorStatus) && (NULL_CHAR != Str[i++]));
+	return errorStatus;
+}
+
+/**
+ * @brief Receives a number of bytes over UART using busy-waiting until a deadline.
+ *
+ * Like UART_ReceiveBufferLenBusyWait but the function gives up when the deadline is reached.
+ *
+ * @param buffer The buffer in which to store the received data (at least len bytes).
+ * @param len The number of bytes to be received (0 .. 65535).
+ * @param pLen a pointer to store the number of bytes received (may be NULL_PTR).
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t STD_OK if len bytes are received , STD_TIMEOUT if the deadline is reached first.
+ */
+Std_Error_t UART_ReceiveBufferLenTimeout(u8 buffer[], u16 len, u16 *pLen, u16 deadline)
+{
+	Std_Error_t errorStatus = STD_OK;
+	u16 i = 0;
+
+	while((i < len) && (STD_OK == errorStatus))
+	{
+		errorStatus = UART_ReceiveByteTimeout(&buffer[i], deadline);
+		if(STD_OK == errorStatus)
+		{
+			i++;
+		}
+	}
+	if(NULL_PTR != pLen)
+	{
+		*pLen = i;
+	}
+	return errorStatus;
+}
+
+/**
+ * @brief Receives a string over UART using busy-waiting until a deadline without overflowing the buffer.
+ *
+ * Like UART_ReceiveStringBoundedBusyWait but the function gives up when the deadline is reached.
+ * The received string is always terminated by a NULL character in the buffer (also on timeout).
+ *
+ * @param Str The buffer in which to store the received string.
+ * @param capacity The size of the buffer in bytes (at least 1).
+ * @param pLen a pointer to store the number of characters stored without the NULL character (may be NULL_PTR).
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t - STD_OK : STRING_TERMINATOR is received
+ *                     - STD_BUFFER_FULL : capacity-1 characters are stored and STRING_TERMINATOR is not received
+ *                     - STD_TIMEOUT : the deadline is reached first
+ *                     - STD_INVALID_ARG : capacity is 0
+ */
+Std_Error_t UART_ReceiveStringTimeout(u8 Str[], u16 capacity, u16 *pLen, u16 deadline)
+{
+	Std_Error_t errorStatus = STD_BUFFER_FULL;
+	u16 i = 0;
+	u8 ch;
+
+	if(0 == capacity)
+	{
+		return STD_INVALID_ARG;
+	}
+	while(i < (capacity-1))
+	{
+		if(STD_OK != UART_ReceiveByteTimeout(&ch, deadline))
+		{
+			errorStatus = STD_TIMEOUT;
+			break;
+		}
+		if(STRING_TERMINATOR == ch)
+		{
+			errorStatus = STD_OK;
+			break;
+		}
+		Str[i] = ch;
+		i++;
+	}
+	Str[i] = NULL_CHAR;
+	if(NULL_PTR != pLen)
+	{
+		*pLen = i;
+	}
+	return errorStatus;
+}
+
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
 /*                         Send and Receive Functions          	               */
@@ -203,6 +481,47 @@ void UART_SendStringAsynch (u8 Str[])
 	UART_SendByteNoBlock(Str[0]);
 }
 
+/**
+ * @brief This function is a callback function for UART transmission of a number of bytes.
+ * 
+ */
+static void UART_TxCallBackLen(void)
+{
+	if(Asynch_Send_LenIdx < Asynch_Send_Len)
+	{
+		UART_SendByteNoBlock(Asynch_Send_LenBuffer[Asynch_Send_LenIdx]);
+		Asynch_Send_LenIdx++;
+	}
+	else
+	{
+		UART_TX_InterruptDisable();
+	}
+}
+
+/**
+ * @brief Sends a number of bytes over UART using asynchronous transmission.
+ *
+ * This function sends len bytes starting from buffer over UART using asynchronous transmission.
+ * The buffer is not scanned for a terminator so it may contain any byte value (binary data).
+ * The function returns immediately after the first byte is sent.
+ *
+ * @param buffer The buffer containing the data to be sent (must stay valid until the end of the transmission).
+ * @param len The number of bytes to be sent (0 .. 65535).
+ */
+void UART_SendBufferLenAsynch(const u8 buffer[], u16 len)
+{
+	if(0 == len)
+	{
+		return;
+	}
+	Asynch_Send_LenBuffer=buffer;
+	Asynch_Send_Len=len;
+	Asynch_Send_LenIdx=1;
+	UART_TX_SetCallBack(UART_TxCallBackLen);
+	UART_TX_InterruptEnable();
+	UART_SendByteNoBlock(buffer[0]);
+}
+
 /*Receive Function*/
 /**
  * @brief This function is a callback function for UART reception without null character.
@@ -210,10 +529,8 @@ void UART_SendStringAsynch (u8 Str[])
  */
 static void UART_RxCallBackWithoutNull(void)
 {
-	static u8 i=0;
-	Asynch_receive_buffer[i]=UART_ReceiveByteNoBlock();
-	i++;
-
+	Asynch_receive_buffer[Asynch_receive_bufferIdx]=UART_ReceiveByteNoBlock();
+	Asynch_receive_bufferIdx++;
 }
 
 /**
@@ -228,6 +545,7 @@ static void UART_RxCallBackWithoutNull(void)
 void UART_ReceiveInBuffer_Asynch(u8 buffer[])
 {
 	Asynch_receive_buffer=buffer;
+	Asynch_receive_bufferIdx=0;
 	UART_RX_SetCallBack(UART_RxCallBackWithoutNull);
 	UART_RX_InterruptEnable();
 }
@@ -238,15 +556,16 @@ void UART_ReceiveInBuffer_Asynch(u8 buffer[])
  */
 static void UART_RxCallBackWithNull(void)
 {
-	static u8 i=0;
-	if (NULL_CHAR != Asynch_receive_str[i])
+	u8 data=UART_ReceiveByteNoBlock();
+	Asynch_receive_str[Asynch_receive_strIdx]=data;
+	if (NULL_CHAR != data)
 	{
-		Asynch_receive_str[i]=UART_ReceiveByteNoBlock();
-		i++;
+		Asynch_receive_strIdx++;
 	}
 	else
 	{
-		i=0;
+		// the received byte is the terminator (not the old content of the buffer)
+		Asynch_receive_strIdx=0;
 		UART_RX_InterruptDisable();
 	}
 }
@@ -264,10 +583,167 @@ static void UART_RxCallBackWithNull(void)
 void UART_ReceiveString_Asynch(u8 Str[])
 {
 	Asynch_receive_str=Str;
+	Asynch_receive_strIdx=0;
 	UART_RX_SetCallBack(UART_RxCallBackWithNull);
 	UART_RX_InterruptEnable();
 }
 
+/**
+ * @brief This function is a callback function for UART reception of a number of bytes.
+ * 
+ */
+static void UART_RxCallBackLen(void)
+{
+	Asynch_receive_LenBuffer[Asynch_receive_LenIdx]=UART_ReceiveByteNoBlock();
+	Asynch_receive_LenIdx++;
+	if(Asynch_receive_LenIdx == Asynch_receive_Len)
+	{
+		UART_RX_InterruptDisable();
+	}
+}
+
+/**
+ * @brief Receives a number of bytes over UART using asynchronous reception.
+ *
+ * This function receives exactly len bytes over UART using asynchronous reception and stores them in buffer.
+ * The reception stops (RX interrupt disabled) when len bytes are received so the buffer can not overflow.
+ * The function returns immediately, use UART_ReceiveBufferLenAsynchStatus to know when the reception is done.
+ *
+ * @param buffer The buffer in which to store the received data (at least len bytes).
+ * @param len The number of bytes to be received (0 .. 65535).
+ */
+void UART_ReceiveBufferLenAsynch(u8 buffer[], u16 len)
+{
+	Asynch_receive_LenBuffer=buffer;
+	Asynch_receive_Len=len;
+	Asynch_receive_LenIdx=0;
+	if(0 != len)
+	{
+		UART_RX_SetCallBack(UART_RxCallBackLen);
+		UART_RX_InterruptEnable();
+	}
+}
+
+/**
+ * @brief Gets the status of the reception started by UART_ReceiveBufferLenAsynch.
+ *
+ * @return Std_Status_t STD_DONE when all the bytes are received , STD_PENDING otherwise.
+ */
+Std_Status_t UART_ReceiveBufferLenAsynchStatus(void)
+{
+	u16 idx;
+	u8 sregCopy;
+
+	// the RX ISR writes the 16-bit index one byte at a time
+	Critical_Enter(sregCopy);
+	idx=Asynch_receive_LenIdx;
+	Critical_Exit(sregCopy);
+	return (idx == Asynch_receive_Len) ? STD_DONE : STD_PENDING;
+}
+
+/**
+ * @brief This function is a callback function for the bounded asynchronous reception.
+ *        It stores the received byte and completes the reception on the terminator or when the buffer is full.
+ * 
+ */
+static void UART_RxCallBackBounded(void)
+{
+	u8 data=UART_ReceiveByteNoBlock();
+	Std_Error_t status;
+
+	if((u16)data == Asynch_Rx.Terminator)
+	{
+		status=STD_OK;
+	}
+	else
+	{
+		Asynch_Rx.Buffer[Asynch_Rx.Len]=data;
+		Asynch_Rx.Len++;
+		if(Asynch_Rx.Len < Asynch_Rx.Capacity)
+		{
+			return;
+		}
+		status=(UART_RX_NO_TERMINATOR == Asynch_Rx.Terminator) ? STD_OK : STD_BUFFER_FULL;
+	}
+
+	// reset before the call back so it can start the next reception
+	UART_RX_InterruptDisable();
+	Asynch_Rx.Busy=STD_FALSE;
+	if(NULL_PTR != Asynch_Rx.pfDone)
+	{
+		Asynch_Rx.pfDone(Asynch_Rx.Buffer, Asynch_Rx.Len, status);
+	}
+}
+
+/**
+ * @brief Starts a bounded asynchronous reception.
+ *
+ * The bytes are received by the RX interrupt while the CPU does other work.
+ * The reception completes when the terminator is received (it is not stored) or when capacity bytes are received,
+ * then the RX interrupt is disabled and pfDone is called from the ISR with the number of bytes stored.
+ * The buffer can never overflow.
+ *
+ * @param buffer The buffer in which to store the received data.
+ * @param capacity The size of the buffer in bytes (at least 1).
+ * @param terminator The byte that ends the reception (0 .. 255) or UART_RX_NO_TERMINATOR to receive exactly capacity bytes.
+ * @param pfDone The completion call back (may be NULL_PTR , then poll UART_ReceiveAsynchIsBusy).
+ * @return Std_Error_t - STD_OK if the reception is started
+ *                     - STD_NULL_POINTER if buffer is NULL_PTR
+ *                     - STD_INVALID_ARG if capacity is 0
+ *                     - STD_BUSY if a reception is already in progress
+ */
+Std_Error_t UART_ReceiveAsynch(u8 buffer[], u16 capacity, u16 terminator, UART_RxDoneCallBack_t pfDone)
+{
+	if(NULL_PTR == buffer)
+	{
+		return STD_NULL_POINTER;
+	}
+	if(0 == capacity)
+	{
+		return STD_INVALID_ARG;
+	}
+	if(STD_TRUE == Asynch_Rx.Busy)
+	{
+		return STD_BUSY;
+	}
+
+	Asynch_Rx.Buffer=buffer;
+	Asynch_Rx.Capacity=capacity;
+	Asynch_Rx.Terminator=terminator;
+	Asynch_Rx.Len=0;
+	Asynch_Rx.pfDone=pfDone;
+	Asynch_Rx.Busy=STD_TRUE;
+
+	UART_RX_SetCallBack(UART_RxCallBackBounded);
+	UART_RX_InterruptEnable();
+	return STD_OK;
+}
+
+/**
+ * @brief Cancels the reception started by UART_ReceiveAsynch.
+ *
+ * The RX interrupt is disabled and the state is reset so a new reception can be started.
+ * The completion call back is not called.
+ *
+ * @return u16 The number of bytes stored in the buffer before the cancellation.
+ */
+u16 UART_ReceiveAsynchCancel(void)
+{
+	UART_RX_InterruptDisable();
+	Asynch_Rx.Busy=STD_FALSE;
+	return Asynch_Rx.Len;
+}
+
+/**
+ * @brief Checks if the reception started by UART_ReceiveAsynch is still in progress.
+ *
+ * @return Std_Bool_t STD_TRUE while the reception is in progress.
+ */
+Std_Bool_t UART_ReceiveAsynchIsBusy(void)
+{
+	return Asynch_Rx.Busy;
+}
+
 
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
@@ -384,89 +860,254 @@ Std_Status_t UART_SendStringPeriodicCheck(u8 Str[])
 }
 
 
-/*------------------------------------------------------------------------------*/
-/*                                                                              */
-/*                                  CheckSum                                    */   
-/*                             PROTOCOL ABOVE UART                              */
-/*                                                                              */
-/*------------------------------------------------------------------------------*/
-/*			Frame of this checkSum protocol:
-			Data_Len	+	data    +	sum
-size        1Byte			1Byte       2byte( (maxCharSize=255)*(maxNumOfChar=255)=65025 )
-max_value   255             255         65535
-*/
-
 /**
- * @brief Sends a string over UART using busy-waiting with a checksum.
+ * @brief Sends a number of bytes over UART using periodic checking.
  *
- * This function sends a string over UART using busy-waiting.
- * It calculates the checksum of the string and sends it after the string.
- * The function waits until the UART is ready to transmit data and then sends each character of the string sequentially.
- * The function does not return until the entire string has been sent.
- * The string is terminated by a NULL character.
- * The checksum is calculated as the sum of all characters in the string.
- * The checksum is sent as two bytes, with the least significant byte sent first.
+ * This function sends len bytes starting from buffer over UART using periodic checking.
+ * The buffer is not scanned for a terminator so it may contain any byte value (binary data).
+ * The function checks periodically if the previous byte has been sent before sending the next byte.
+ * The function returns STD_PENDING until all bytes are sent.
+ * The function returns STD_DONE when all bytes are sent.
  *
- * @param str The string to be sent.
+ * @param buffer The buffer containing the data to be sent.
+ * @param len The number of bytes to be sent (0 .. 65535).
+ * @return The status of the transmission.
  */
-void UART_SendStringCheckSumBusyWait(u8 str[])
+Std_Status_t UART_SendBufferLenPeriodicCheck(const u8 buffer[], u16 len)
 {
-	u8 i=0,len=0;
-	u16 sum=0;
-
-	// Calulate length of the string & the Sum of Characters
-	while(NULL_CHAR != str[len])
+	static	u16 i=0;
+	Std_Status_t status=STD_PENDING;
+	if (0==i)
 	{
-		sum+=str[len];	
-		len++;
+		UART_TX_SetCallBack(UART_TxPeriodicCheckCallBack);
+		UART_TX_InterruptEnable();
 	}
-	UART_SendByteBusyWait(len);
-
-	// send the string 
-	for(i=0;i<len;i++)
+	// check if the previous byte is sended or not before sending the next byte
+	if(STD_TRUE==isByteSended)
 	{
-		UART_SendByteBusyWait(str[i]);
-	}
-
-	//send the sum
-	UART_SendByteBusyWait((u8)sum);
-	UART_SendByteBusyWait((u8)(sum>>8));
-}
-
-/**
- * @brief Receives a string over UART using busy-waiting with a checksum.
+		if(i < len)
+		{
+			isByteSended=STD_FALSE;
+			UART_SendByteNoBlock(buffer[i]);
+			i++;
+		}
+		else
+		{
+			i=0;
+			UART_TX_InterruptDisable();
+			status=STD_DONE;
+		}
+	}
+	return status;
+}
+
+/**
+ * @brief Prepares a burst transmission of a number of bytes.
+ *
+ * @param tx the state of the transmission (owned by the caller).
+ * @param buffer The buffer containing the data to be sent (must stay valid until the transmission is done).
+ * @param len The number of bytes to be sent.
+ */
+void UART_BurstTxInit(UART_BurstTx_t *tx, const u8 buffer[], u16 len)
+{
+	tx->Data = buffer;
+	tx->Len  = len;
+	tx->Idx  = 0;
+}
+
+/**
+ * @brief Prepares a burst transmission of a string , the NULL character is sent too (like UART_SendStringPeriodicCheck).
+ *
+ * @param tx the state of the transmission (owned by the caller).
+ * @param Str The string to be sent (must stay valid until the transmission is done).
+ */
+void UART_BurstTxInitString(UART_BurstTx_t *tx, const u8 Str[])
+{
+	u16 len = 0;
+
+	while(NULL_CHAR != Str[len])
+	{
+		len++;
+	}
+	UART_BurstTxInit(tx, Str, len + 1);
+}
+
+/**
+ * @brief Sends the bytes of a burst transmission using periodic checking.
+ *
+ * On every call the UDRE flag is polled and a byte is written each time the data register is empty,
+ * until all the bytes are sent or the poll budget of the baud rate in use is spent
+ * (about UART_BURST_LOOP_SHARE % of UART_BURST_LOOP_PERIOD_MS , rounded to whole byte times of UART_GetBaudRate()).
+ * So a slow super loop sends many bytes per call instead of one ,
+ * the transmission runs at about UART_BURST_LOOP_SHARE % of the line rate.
+ * No interrupt is used and the state is in tx , so the function does not share any state with the other UART functions.
+ *EX:
+ *	UART_BurstTx_t tx;
+ *	UART_BurstTxInit(&tx, frame, sizeof(frame));
+ *	while(1) { UART_SendBurstPeriodicCheck(&tx); ... }
+ *
+ * @param tx the state of the transmission (from UART_BurstTxInit).
+ * @return Std_Status_t STD_PENDING until all the bytes are written to the UART , then STD_DONE
+ *                      (the last byte may still be in the shift register).
+ */
+Std_Status_t UART_SendBurstPeriodicCheck(UART_BurstTx_t *tx)
+{
+	u16 polls = UART_arrBurstPollBudget[UART_GetBaudRate()];
+	u16 idx = tx->Idx;
+
+	/* one poll while the data register is full (UART_BURST_POLL_CYCLES , counted by hand from the ATmega32 instruction timings) :
+	 * idx < Len 3 , polls != 0 3 , load of Data[idx] 5 , call 4 ,
+	 * UART_SendBytePeriodicCheck (in , sbrs , rjmp , ldi , ret) 9 , status check 3 , polls-- 2 , loop jump 2 = 31 */
+	while((idx < tx->Len) && (0 != polls))
+	{
+		if(STD_DONE == UART_SendBytePeriodicCheck(tx->Data[idx]))
+		{
+			idx++;
+		}
+		polls--;
+	}
+	tx->Idx = idx;
+
+	return (idx < tx->Len) ? STD_PENDING : STD_DONE;
+}
+
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  CheckSum                                    */   
+/*                             PROTOCOL ABOVE UART                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/*			Frame of this checkSum protocol:
+			Data_Len	+	data    +	check
+size        1Byte			len Byte    2byte (1byte for UART_CHECKSUM_CRC8)
+max_value   255             255
+the check is selected by UART_CHECKSUM_TYPE and sent with the least significant byte first :
+  - UART_CHECKSUM_SUM16 : sum of the data bytes (the length is not covered)
+  - UART_CHECKSUM_CRC8  : CRC-8 of the length and the data (1 byte)
+  - UART_CHECKSUM_CRC16 : CRC-16/CCITT of the length and the data
+*/
+
+/**
+ * @brief Sends the check of a frame with busy-waiting , the least significant byte first.
+ *
+ * @param check the check of the frame.
+ */
+static void UART_SendCheckBusyWait(u16 check)
+{
+	UART_SendByteBusyWait((u8)check);
+#if (UART_CHECKSUM_SIZE == 2)
+	UART_SendByteBusyWait((u8)(check>>8));
+#endif
+}
+
+/**
+ * @brief Receives the check of a frame with busy-waiting.
+ *
+ * @return u16 the received check.
+ */
+static u16 UART_ReceiveCheckBusyWait(void)
+{
+	u16 check=UART_ReceiveByteBusyWait();
+#if (UART_CHECKSUM_SIZE == 2)
+	check|=((u16)UART_ReceiveByteBusyWait())<<8;
+#endif
+	return check;
+}
+
+/**
+ * @brief Receives the check of a frame until a deadline , the least significant byte first.
+ *
+ * @param pCheck a pointer to store the received check.
+ * @param deadline the tick at which the function gives up.
+ * @return Std_Error_t STD_OK or STD_TIMEOUT.
+ */
+static Std_Error_t UART_ReceiveCheckTimeout(u16 *pCheck, u16 deadline)
+{
+	Std_Error_t errorStatus;
+	u8 data;
+
+	errorStatus=UART_ReceiveByteTimeout(&data, deadline);
+	*pCheck=data;
+#if (UART_CHECKSUM_SIZE == 2)
+	if(STD_OK == errorStatus)
+	{
+		errorStatus=UART_ReceiveByteTimeout(&data, deadline);
+		*pCheck|=((u16)data)<<8;
+	}
+#endif
+	return errorStatus;
+}
+
+/**
+ * @brief Sends a string over UART using busy-waiting with a checksum.
+ *
+ * This function sends a string over UART using busy-waiting.
+ * It calculates the check of the string (UART_CHECKSUM_TYPE) and sends it after the string.
+ * The function waits until the UART is ready to transmit data and then sends each character of the string sequentially.
+ * The function does not return until the entire string has been sent.
+ * The string is terminated by a NULL character.
+ * The check is sent with the least significant byte first.
+ *
+ * @param str The string to be sent.
+ */
+void UART_SendStringCheckSumBusyWait(u8 str[])
+{
+	u8 i=0,len=0;
+	u16 check=UART_CHECKSUM_INIT;
+
+	// Calulate length of the string
+	while(NULL_CHAR != str[len])
+	{
+		len++;
+	}
+	UART_SendByteBusyWait(len);
+	check=UART_CHECKSUM_ADD_LEN(check,len);
+
+	// send the string & calculate the check
+	for(i=0;i<len;i++)
+	{
+		check=UART_CHECKSUM_ADD_DATA(check,str[i]);
+		UART_SendByteBusyWait(str[i]);
+	}
+
+	//send the check
+	UART_SendCheckBusyWait(check);
+}
+
+/**
+ * @brief Receives a string over UART using busy-waiting with a checksum.
  *
  * This function receives a string over UART using busy-waiting.
- * It calculates the checksum of the received string and compares it to the received checksum.
+ * It calculates the check of the received string and compares it to the received check.
  * The function waits until the UART is ready to receive data and then receives the length of the string.
- * The function then receives the string and calculates the checksum.
- * The function returns STD_OK if the checksums match, and STD_NOK if they do not.
+ * The function then receives the string and calculates the check.
+ * The function returns STD_OK if the checks match, and STD_NOK if they do not.
  *
  * @param str The buffer in which to store the received string.
  * @return The status of the checksum comparison.
  */
 Std_Error_t UART_ReceiveStringCheckSumBusyWait(u8 str[])
 {
-	u8 i=0,len=0,firstbyte=0,secondbyte=0;
-	u16 receivedSum=0,calculatedSum=0;
+	u8 i=0,len=0;
+	u16 receivedCheck=0,calculatedCheck=UART_CHECKSUM_INIT;
 	Std_Error_t	errorStatus=STD_NOK;
 
 	// Receive the length of the string
 	len=UART_ReceiveByteBusyWait();
+	calculatedCheck=UART_CHECKSUM_ADD_LEN(calculatedCheck,len);
 
-	// Receive the string & calculate the sum
+	// Receive the string & calculate the check
 	for(i=0;i<len;i++)
 	{
 		str[i]=UART_ReceiveByteBusyWait();
-		calculatedSum+=str[i];
+		calculatedCheck=UART_CHECKSUM_ADD_DATA(calculatedCheck,str[i]);
 	}
 
-	// Receive the sum
-	firstbyte=UART_ReceiveByteBusyWait();
-	secondbyte=UART_ReceiveByteBusyWait();
-	receivedSum=((u16)secondbyte<<8)|((u16)firstbyte); 
+	// Receive the check
+	receivedCheck=UART_ReceiveCheckBusyWait();
 
-	if(calculatedSum==receivedSum)
+	if(calculatedCheck==receivedCheck)
 	{
 		errorStatus=STD_OK;
 	}
@@ -477,3 +1118,717 @@ Std_Error_t UART_ReceiveStringCheckSumBusyWait(u8 str[])
 	return errorStatus;
 }
 
+/*			Frame of the length based checkSum protocol:
+			Data_Len	+	data    +	check
+size        2Byte			len Byte    2byte (1byte for UART_CHECKSUM_CRC8) same check as the string frame
+the length and the check are sent with the least significant byte first
+*/
+
+/**
+ * @brief Sends a number of bytes over UART using busy-waiting with a checksum.
+ *
+ * This function sends a frame made of the 16-bit length, the data and the check (UART_CHECKSUM_TYPE).
+ * The data may contain any byte value (binary data) and may be longer than 255 bytes.
+ *
+ * @param buffer The buffer containing the data to be sent.
+ * @param len The number of bytes to be sent (0 .. 65535).
+ */
+void UART_SendBufferCheckSumBusyWait(const u8 buffer[], u16 len)
+{
+	const u8 *end = buffer + len;
+	u16 check=UART_CHECKSUM_INIT;
+
+	UART_SendByteBusyWait((u8)len);
+	UART_SendByteBusyWait((u8)(len>>8));
+	check=UART_CHECKSUM_ADD_LEN(check,(u8)len);
+	check=UART_CHECKSUM_ADD_LEN(check,(u8)(len>>8));
+
+	// send the data & calculate the check
+	while(buffer != end)
+	{
+		check=UART_CHECKSUM_ADD_DATA(check,*buffer);
+		UART_SendByteBusyWait(*buffer);
+		buffer++;
+	}
+
+	//send the check
+	UART_SendCheckBusyWait(check);
+}
+
+/**
+ * @brief Receives a frame sent by UART_SendBufferCheckSumBusyWait using busy-waiting.
+ *
+ * This function receives the 16-bit length, the data and the check, and compares the check with the calculated one.
+ * At most capacity bytes are stored in buffer, the extra bytes of a longer frame are received and
+ * added to the check but not stored, so the receiver stays synchronized with the sender.
+ *
+ * @param buffer The buffer in which to store the received data.
+ * @param capacity The size of the buffer in bytes.
+ * @param pLen A pointer to a variable to store the length of the frame (may be NULL_PTR).
+ * @return Std_Error_t - STD_OK if the checks match
+ *                     - STD_NOK if they do not match
+ *                     - STD_BUFFER_OVERFLOW if the frame is longer than capacity (only capacity bytes are stored)
+ */
+Std_Error_t UART_ReceiveBufferCheckSumBusyWait(u8 buffer[], u16 capacity, u16 *pLen)
+{
+	u16 i=0,len=0,receivedCheck=0,calculatedCheck=UART_CHECKSUM_INIT;
+	u8 data;
+	Std_Error_t	errorStatus=STD_NOK;
+
+	// Receive the length of the frame
+	data=UART_ReceiveByteBusyWait();
+	calculatedCheck=UART_CHECKSUM_ADD_LEN(calculatedCheck,data);
+	len=data;
+	data=UART_ReceiveByteBusyWait();
+	calculatedCheck=UART_CHECKSUM_ADD_LEN(calculatedCheck,data);
+	len|=((u16)data)<<8;
+
+	// Receive the data & calculate the check
+	for(i=0;i<len;i++)
+	{
+		data=UART_ReceiveByteBusyWait();
+		calculatedCheck=UART_CHECKSUM_ADD_DATA(calculatedCheck,data);
+		if(i<capacity)
+		{
+			buffer[i]=data;
+		}
+	}
+
+	// Receive the check
+	receivedCheck=UART_ReceiveCheckBusyWait();
+
+	if(NULL_PTR!=pLen)
+	{
+		*pLen=len;
+	}
+
+	if(len>capacity)
+	{
+		errorStatus=STD_BUFFER_OVERFLOW;
+	}
+	else if(calculatedCheck==receivedCheck)
+	{
+		errorStatus=STD_OK;
+	}
+	else
+	{
+		errorStatus=STD_NOK;
+	}
+	return errorStatus;
+}
+
+/**
+ * @brief Receives a string frame of the CheckSum protocol using busy-waiting until a deadline.
+ *
+ * Like UART_ReceiveStringCheckSumBusyWait but the function gives up when the deadline is reached
+ * (the deadline is for the whole frame).
+ *
+ * @param str The buffer in which to store the received string (at least 255 bytes).
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t - STD_OK : the check is correct
+ *                     - STD_NOK : the check is not correct
+ *                     - STD_TIMEOUT : the deadline is reached before the end of the frame
+ */
+Std_Error_t UART_ReceiveStringCheckSumTimeout(u8 str[], u16 deadline)
+{
+	u8 i=0,len=0;
+	u16 receivedCheck=0,calculatedCheck=UART_CHECKSUM_INIT;
+	Std_Error_t	errorStatus;
+
+	// Receive the length of the string
+	errorStatus=UART_ReceiveByteTimeout(&len, deadline);
+	calculatedCheck=UART_CHECKSUM_ADD_LEN(calculatedCheck,len);
+
+	// Receive the string & calculate the check
+	for(i=0;(i<len) && (STD_OK==errorStatus);i++)
+	{
+		errorStatus=UART_ReceiveByteTimeout(&str[i], deadline);
+		calculatedCheck=UART_CHECKSUM_ADD_DATA(calculatedCheck,str[i]);
+	}
+
+	// Receive the check
+	if(STD_OK==errorStatus)
+	{
+		errorStatus=UART_ReceiveCheckTimeout(&receivedCheck, deadline);
+	}
+
+	if((STD_OK==errorStatus) && (calculatedCheck!=receivedCheck))
+	{
+		errorStatus=STD_NOK;
+	}
+	return errorStatus;
+}
+
+/**
+ * @brief Receives a buffer frame of the CheckSum protocol using busy-waiting until a deadline.
+ *
+ * Like UART_ReceiveBufferCheckSumBusyWait but the function gives up when the deadline is reached
+ * (the deadline is for the whole frame).
+ *
+ * @param buffer The buffer in which to store the received data.
+ * @param capacity The size of the buffer in bytes.
+ * @param pLen a pointer to store the length field of the frame (may be NULL_PTR , not changed on timeout).
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t - STD_OK : the check is correct
+ *                     - STD_NOK : the check is not correct
+ *                     - STD_BUFFER_OVERFLOW : the frame is longer than capacity (the extra bytes are dropped)
+ *                     - STD_TIMEOUT : the deadline is reached before the end of the frame
+ */
+Std_Error_t UART_ReceiveBufferCheckSumTimeout(u8 buffer[], u16 capacity, u16 *pLen, u16 deadline)
+{
+	u16 i=0,len=0,receivedCheck=0,calculatedCheck=UART_CHECKSUM_INIT;
+	u8 data=0;
+	Std_Error_t	errorStatus;
+
+	// Receive the length of the frame
+	errorStatus=UART_ReceiveByteTimeout(&data, deadline);
+	calculatedCheck=UART_CHECKSUM_ADD_LEN(calculatedCheck,data);
+	len=data;
+	if(STD_OK==errorStatus)
+	{
+		errorStatus=UART_ReceiveByteTimeout(&data, deadline);
+		calculatedCheck=UART_CHECKSUM_ADD_LEN(calculatedCheck,data);
+		len|=((u16)data)<<8;
+	}
+
+	// Receive the data & calculate the check
+	for(i=0;(i<len) && (STD_OK==errorStatus);i++)
+	{
+		errorStatus=UART_ReceiveByteTimeout(&data, deadline);
+		calculatedCheck=UART_CHECKSUM_ADD_DATA(calculatedCheck,data);
+		if(i<capacity)
+		{
+			buffer[i]=data;
+		}
+	}
+
+	// Receive the check
+	if(STD_OK==errorStatus)
+	{
+		errorStatus=UART_ReceiveCheckTimeout(&receivedCheck, deadline);
+	}
+
+	if(STD_OK==errorStatus)
+	{
+		if(NULL_PTR!=pLen)
+		{
+			*pLen=len;
+		}
+		if(len>capacity)
+		{
+			errorStatus=STD_BUFFER_OVERFLOW;
+		}
+		else if(calculatedCheck!=receivedCheck)
+		{
+			errorStatus=STD_NOK;
+		}
+		else
+		{
+			errorStatus=STD_OK;
+		}
+	}
+	return errorStatus;
+}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                          Non blocking frame parser                           */
+/*                            of the CheckSum protocol                          */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief Moves the parser back to the first state (waiting for the length of a new frame).
+ *
+ * @param parser the frame parser.
+ */
+static void UART_FrameParserRestart(UART_FrameParser_t *parser)
+{
+	parser->State=UART_FRAME_WAIT_LEN_LOW;
+	parser->Check=UART_CHECKSUM_INIT;
+	parser->Idx=0;
+}
+
+/**
+ * @brief Prepares a frame parser for the frames of UART_SendStringCheckSumBusyWait (1 byte length)
+ *        or UART_SendBufferCheckSumBusyWait (2 bytes length).
+ *
+ * @param parser the frame parser.
+ * @param lenBytes the size of the length field : 1 or 2.
+ * @param buffer the buffer of the received data.
+ * @param capacity the size of the buffer (a longer frame is received but dropped).
+ * @param timeoutMs the maximum time between the first and the last byte of a frame in ms
+ *                  (0 : no timeout , else SysTick must be running).
+ * @param pfFrame the call back of the valid frames (called from UART_FrameParserPushByte).
+ */
+void UART_FrameParserInit(UART_FrameParser_t *parser, u8 lenBytes, u8 buffer[], u16 capacity, u16 timeoutMs, UART_FrameCallBack_t pfFrame)
+{
+	parser->LenBytes=lenBytes;
+	parser->Buffer=buffer;
+	parser->Capacity=capacity;
+	parser->TimeoutMs=timeoutMs;
+	parser->pfFrame=pfFrame;
+	parser->CheckErrors=0;
+	parser->Overflows=0;
+	parser->Timeouts=0;
+	UART_FrameParserRestart(parser);
+}
+
+/**
+ * @brief Feeds one received byte to a frame parser (from the RX ISR , a ring buffer or a polling loop).
+ *
+ * The function never waits , it only moves the parser to its next state.
+ * When the last byte of a valid frame is pushed the call back is called with the data of the frame.
+ * A frame that is not complete after timeoutMs is dropped and the byte starts a new frame.
+ *
+ * @param parser the frame parser.
+ * @param data the received byte.
+ * @return Std_Status_t - STD_PENDING : the frame is not complete
+ *                      - STD_DONE : a valid frame is received
+ *                      - STD_ERROR : the frame is dropped (bad check or longer than capacity)
+ */
+Std_Status_t UART_FrameParserPushByte(UART_FrameParser_t *parser, u8 data)
+{
+	Std_Status_t status=STD_PENDING;
+	u16 now;
+
+	if(0 != parser->TimeoutMs)
+	{
+		now=SysTick_GetTicks();
+		if(UART_FRAME_WAIT_LEN_LOW == parser->State)
+		{
+			parser->Deadline=now+parser->TimeoutMs;
+		}
+		else if(SysTick_IsExpired(now, parser->Deadline))
+		{
+			// the rest of the old frame is lost , this byte is the length of a new frame
+			parser->Timeouts++;
+			UART_FrameParserRestart(parser);
+			parser->Deadline=now+parser->TimeoutMs;
+		}
+	}
+
+	switch(parser->State)
+	{
+	case UART_FRAME_WAIT_LEN_LOW:
+		parser->Check=UART_CHECKSUM_ADD_LEN(parser->Check,data);
+		parser->Len=data;
+		parser->State=(2 == parser->LenBytes) ? UART_FRAME_WAIT_LEN_HIGH : UART_FRAME_WAIT_DATA;
+		break;
+
+	case UART_FRAME_WAIT_LEN_HIGH:
+		parser->Check=UART_CHECKSUM_ADD_LEN(parser->Check,data);
+		parser->Len|=((u16)data)<<8;
+		parser->State=UART_FRAME_WAIT_DATA;
+		break;
+
+	case UART_FRAME_WAIT_DATA:
+		parser->Check=UART_CHECKSUM_ADD_DATA(parser->Check,data);
+		if(parser->Idx < parser->Capacity)
+		{
+			parser->Buffer[parser->Idx]=data;
+		}
+		parser->Idx++;
+		break;
+
+	case UART_FRAME_WAIT_CHECK_LOW:
+		parser->ReceivedCheck=data;
+		parser->State=UART_FRAME_WAIT_CHECK_HIGH;
+		break;
+
+	case UART_FRAME_WAIT_CHECK_HIGH:
+		parser->ReceivedCheck|=((u16)data)<<8;
+		parser->State=UART_FRAME_COMPLETE;
+		break;
+
+	default:
+		UART_FrameParserRestart(parser);
+		break;
+	}
+
+	// the states without bytes left are passed here (empty data , 1 byte check)
+	if((UART_FRAME_WAIT_DATA == parser->State) && (parser->Idx == parser->Len))
+	{
+		parser->State=UART_FRAME_WAIT_CHECK_LOW;
+	}
+	else if((UART_FRAME_WAIT_CHECK_HIGH == parser->State) && (1 == UART_CHECKSUM_SIZE))
+	{
+		parser->State=UART_FRAME_COMPLETE;
+	}
+
+	if(UART_FRAME_COMPLETE == parser->State)
+	{
+		if(parser->Len > parser->Capacity)
+		{
+			parser->Overflows++;
+			status=STD_ERROR;
+		}
+		else if(parser->Check != parser->ReceivedCheck)
+		{
+			parser->CheckErrors++;
+			status=STD_ERROR;
+		}
+		else
+		{
+			status=STD_DONE;
+			if(NULL_PTR != parser->pfFrame)
+			{
+				parser->pfFrame(parser->Buffer, parser->Len);
+			}
+		}
+		UART_FrameParserRestart(parser);
+	}
+	return status;
+}
+
+/**
+ * @brief Drops a frame that is not complete after the timeout even if no more bytes are received.
+ *        Call it periodically (ex: from the main loop) when the sender may stop in the middle of a frame.
+ *
+ * @param parser the frame parser.
+ * @return Std_Bool_t STD_TRUE if a frame is dropped.
+ */
+Std_Bool_t UART_FrameParserCheckTimeout(UART_FrameParser_t *parser)
+{
+	Std_Bool_t isExpired=STD_FALSE;
+	u8 sregCopy;
+
+	// the parser may be fed from the RX ISR
+	Critical_Enter(sregCopy);
+	if((0 != parser->TimeoutMs) && (UART_FRAME_WAIT_LEN_LOW != parser->State) && SysTick_IsExpired(SysTick_GetTicks(), parser->Deadline))
+	{
+		parser->Timeouts++;
+		UART_FrameParserRestart(parser);
+		isExpired=STD_TRUE;
+	}
+	Critical_Exit(sregCopy);
+
+	return isExpired;
+}
+
+/**
+ * @brief This function is a callback function for the asynchronous frame reception.
+ * 
+ */
+static void UART_RxCallBackFrameParser(void)
+{
+	UART_FrameParserPushByte(Asynch_FrameParser, UART_ReceiveByteNoBlock());
+}
+
+/**
+ * @brief Feeds a frame parser from the RX interrupt until UART_ReceiveFrameAsynchStop is called.
+ *        The call back of the parser is called from the RX ISR.
+ *
+ * @param parser a parser prepared by UART_FrameParserInit (must stay valid until the reception is stopped).
+ */
+void UART_ReceiveFrameAsynch(UART_FrameParser_t *parser)
+{
+	Asynch_FrameParser=parser;
+	UART_RX_SetCallBack(UART_RxCallBackFrameParser);
+	UART_RX_InterruptEnable();
+}
+
+/**
+ * @brief Stops the reception started by UART_ReceiveFrameAsynch.
+ */
+void UART_ReceiveFrameAsynchStop(void)
+{
+	UART_RX_InterruptDisable();
+}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                    COBS                                      */
+/*                             PROTOCOL ABOVE UART                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/*			Frame of the COBS protocol:
+			COBS encoded data	+	0x00
+size        len + 1 + len/254 Byte   1Byte
+the data may contain any byte value , the receiver resynchronizes on the next 0x00
+*/
+
+/**
+ * @brief Sends a COBS frame over UART using busy-waiting.
+ *
+ * The data is encoded while it is sent , no extra buffer is needed.
+ *
+ * @param buffer The data to be sent (may contain any byte value).
+ * @param len The number of bytes to be sent.
+ */
+void UART_SendFrameCOBSBusyWait(const u8 buffer[], u16 len)
+{
+	COBS_EncodeToSink(buffer, len, UART_SendByteBusyWait);
+}
+
+/**
+ * @brief Receives a COBS frame over UART using busy-waiting.
+ *
+ * The bytes are decoded while they are received , the function returns at the delimiter of the frame.
+ * Empty frames are skipped.
+ *
+ * @param buffer The buffer in which to store the decoded data.
+ * @param capacity The size of the buffer in bytes.
+ * @param pLen A pointer to a variable to store the number of decoded bytes.
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NOT_VALID if the frame is bad or longer than capacity (the receiver is already resynchronized)
+ */
+Std_Error_t UART_ReceiveFrameCOBSBusyWait(u8 buffer[], u16 capacity, u16 *pLen)
+{
+	COBS_Decoder_t decoder;
+	Std_Status_t status=STD_PENDING;
+
+	COBS_DecoderInit(&decoder, buffer, capacity);
+	while(STD_PENDING == status)
+	{
+		status=COBS_DecoderPushByte(&decoder, UART_ReceiveByteBusyWait());
+	}
+	*pLen=decoder.Len;
+	return (STD_DONE == status) ? STD_OK : STD_NOT_VALID;
+}
+
+/**
+ * @brief Receives a COBS frame using busy-waiting until a deadline.
+ *
+ * Like UART_ReceiveFrameCOBSBusyWait but the function gives up when the deadline is reached
+ * (the deadline is for the whole frame).
+ *
+ * @param buffer The buffer in which to store the decoded data.
+ * @param capacity The size of the buffer in bytes.
+ * @param pLen a pointer to store the number of decoded bytes.
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t - STD_OK : a valid frame is received
+ *                     - STD_NOT_VALID : the frame is not valid or longer than capacity
+ *                     - STD_TIMEOUT : the deadline is reached before the delimiter
+ */
+Std_Error_t UART_ReceiveFrameCOBSTimeout(u8 buffer[], u16 capacity, u16 *pLen, u16 deadline)
+{
+	COBS_Decoder_t decoder;
+	Std_Status_t status=STD_PENDING;
+	u8 data;
+
+	COBS_DecoderInit(&decoder, buffer, capacity);
+	while(STD_PENDING == status)
+	{
+		if(STD_OK != UART_ReceiveByteTimeout(&data, deadline))
+		{
+			*pLen=decoder.Len;
+			return STD_TIMEOUT;
+		}
+		status=COBS_DecoderPushByte(&decoder, data);
+	}
+	*pLen=decoder.Len;
+	return (STD_DONE == status) ? STD_OK : STD_NOT_VALID;
+}
+
+/**
+ * @brief This function is a callback function for the asynchronous COBS reception.
+ *        It decodes the received byte and calls the user call back at the end of every frame.
+ * 
+ */
+static void UART_RxCallBackCOBS(void)
+{
+	Std_Status_t status=COBS_DecoderPushByte(Asynch_COBS_Decoder, UART_ReceiveByteNoBlock());
+
+	if((STD_PENDING != status) && (NULL_PTR != Asynch_COBS_pfDone))
+	{
+		Asynch_COBS_pfDone(Asynch_COBS_Decoder->Buffer, Asynch_COBS_Decoder->Len, (STD_DONE == status) ? STD_OK : STD_NOT_VALID);
+	}
+}
+
+/**
+ * @brief Starts the continuous reception of COBS frames using the RX interrupt.
+ *
+ * Every received byte is decoded in the RX ISR , at the end of every frame pfDone is called with
+ * the decoded data and STD_OK , or STD_NOT_VALID for a bad frame (it is dropped).
+ * The data is valid only inside the call back (the next frame is decoded in the same buffer).
+ * The reception continues until UART_ReceiveFrameCOBSAsynchStop is called.
+ *
+ * @param decoder A decoder prepared by COBS_DecoderInit (must stay valid until the reception is stopped).
+ * @param pfDone The call back of the frames.
+ */
+void UART_ReceiveFrameCOBSAsynch(COBS_Decoder_t *decoder, UART_RxDoneCallBack_t pfDone)
+{
+	Asynch_COBS_Decoder=decoder;
+	Asynch_COBS_pfDone=pfDone;
+	UART_RX_SetCallBack(UART_RxCallBackCOBS);
+	UART_RX_InterruptEnable();
+}
+
+/**
+ * @brief Stops the reception started by UART_ReceiveFrameCOBSAsynch.
+ */
+void UART_ReceiveFrameCOBSAsynchStop(void)
+{
+	UART_RX_InterruptDisable();
+}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                         Double buffered reception                            */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief This function is a callback function for the double buffered reception.
+ *        It stores the received byte and swaps the buffers at the end of every record.
+ * 
+ */
+static void UART_RxCallBackPingPong(void)
+{
+	UART_PingPong_t *pp=Asynch_PingPong;
+	u16 idx=pp->Idx;
+
+	pp->Buffer[pp->Fill][idx]=UART_ReceiveByteNoBlock();
+	idx++;
+	if(idx<pp->RecordSize)
+	{
+		pp->Idx=idx;
+	}
+	else if(STD_FALSE==pp->Ready)
+	{
+		// the other buffer is free : it becomes the fill buffer and the complete record goes to the application
+		pp->Idx=0;
+		pp->Ready=STD_TRUE;
+		pp->Fill^=1;
+		if(NULL_PTR!=pp->pfReady)
+		{
+			pp->pfReady(pp->Buffer[pp->Fill^1], pp->RecordSize);
+		}
+	}
+	else
+	{
+		// the application still holds the other buffer : the record is dropped and the buffer is filled again
+		pp->Idx=0;
+		if(0xFFFF!=pp->Dropped)
+		{
+			pp->Dropped++;
+		}
+	}
+}
+
+/**
+ * @brief Starts the continuous reception of fixed size records in two buffers using the RX interrupt.
+ *
+ * The ISR fills one buffer while the application processes the other one.
+ * When a record is complete and the other buffer is released the buffers are swapped and pfReady is called (from the ISR)
+ * with the complete record , it belongs to the application until UART_PingPongRelease.
+ * If the previous record is not released yet the new record is dropped (counted in Dropped) and the buffer is filled again.
+ * The reception must start on a record boundary (ex: before the sensor starts streaming).
+ *EX:
+ *	static u8 recA[32] , recB[32];
+ *	static UART_PingPong_t rx;
+ *	UART_ReceivePingPongStart(&rx, recA, recB, 32, NULL_PTR);
+ *	while(1)
+ *	{
+ *		u8 *record = UART_PingPongGetRecord(&rx);
+ *		if(NULL_PTR != record) { Process(record); UART_PingPongRelease(&rx); }
+ *	}
+ *
+ * @param pp the state of the reception (must stay valid until the reception is stopped).
+ * @param bufferA , bufferB two buffers of recordSize bytes.
+ * @param recordSize the size of one record in bytes (at least 1).
+ * @param pfReady the call back of the records (may be NULL_PTR , then poll UART_PingPongGetRecord).
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NULL_POINTER if pp or a buffer is NULL_PTR
+ *                     - STD_INVALID_ARG if recordSize is 0
+ */
+Std_Error_t UART_ReceivePingPongStart(UART_PingPong_t *pp, u8 bufferA[], u8 bufferB[], u16 recordSize, UART_RecordReadyCallBack_t pfReady)
+{
+	if((NULL_PTR==pp) || (NULL_PTR==bufferA) || (NULL_PTR==bufferB))
+	{
+		return STD_NULL_POINTER;
+	}
+	if(0==recordSize)
+	{
+		return STD_INVALID_ARG;
+	}
+
+	UART_RX_InterruptDisable();
+	pp->Buffer[0]=bufferA;
+	pp->Buffer[1]=bufferB;
+	pp->RecordSize=recordSize;
+	pp->Idx=0;
+	pp->Fill=0;
+	pp->Ready=STD_FALSE;
+	pp->Dropped=0;
+	pp->pfReady=pfReady;
+	Asynch_PingPong=pp;
+	UART_RX_SetCallBack(UART_RxCallBackPingPong);
+	UART_RX_InterruptEnable();
+	return STD_OK;
+}
+
+/**
+ * @brief Gets the record ready for the application.
+ *
+ * @param pp the state of the reception.
+ * @return u8* the record (RecordSize bytes) or NULL_PTR if no record is ready.
+ */
+u8* UART_PingPongGetRecord(UART_PingPong_t *pp)
+{
+	// Fill is changed by the ISR only while Ready is STD_FALSE , so it is stable here
+	return (STD_TRUE==pp->Ready) ? pp->Buffer[pp->Fill^1] : NULL_PTR;
+}
+
+/**
+ * @brief Gives the buffer of the processed record back to the ISR , the next complete record can be delivered.
+ *        May be called from the ready call back.
+ *
+ * @param pp the state of the reception.
+ */
+void UART_PingPongRelease(UART_PingPong_t *pp)
+{
+	pp->Ready=STD_FALSE;
+}
+
+/**
+ * @brief Gets the number of records dropped because the application was too slow.
+ *
+ * @param pp the state of the reception.
+ * @return u16 the number of dropped records (saturates at 65535).
+ */
+u16 UART_PingPongGetDropped(UART_PingPong_t *pp)
+{
+	u16 dropped;
+	u8 sregCopy;
+
+	Critical_Enter(sregCopy);
+	dropped=pp->Dropped;
+	Critical_Exit(sregCopy);
+	return dropped;
+}
+
+/**
+ * @brief Stops the reception started by UART_ReceivePingPongStart , the record being received is dropped.
+ */
+void UART_ReceivePingPongStop(void)
+{
+	UART_RX_InterruptDisable();
+}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              Formatted output                                */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief Sends formatted text over UART using busy-waiting (printf like , see Std_Printf for the conversions).
+ *
+ * The characters are sent as soon as they are formatted , no buffer is used.
+ *
+ * @param format The format string.
+ * @param ... The values of the conversions.
+ * @return u16 The number of characters sent.
+ */
+u16 UART_Printf(const char *format, ...)
+{
+	va_list args;
+	u16 written;
+
+	va_start(args, format);
+	written=Std_vPrintf(UART_SendByteBusyWait, format, args);
+	va_end(args);
+	return written;
+}
@@ -12,6 +12,7 @@
 #ifndef UART_SERVICES_H_
 #define UART_SERVICES_H_
 
+#include "COBS.h"
 
 /*------------------------------------------------------------------------------*/
 /*                                                                              */
@@ -26,24 +27,102 @@
 #define NULL_STR_TERMINATOR 	    0x00 /**<NULL_TERMINATOR*/  
 #define STRING_TERMINATOR           PROTEUS_VT_STR_TERMINATOR
 
-/*------------------------------------------------------------------------------*/
-/*                                                                              */
-/*                         Static Global Vaiables                               */
-/*                                                                              */
-/*------------------------------------------------------------------------------*/
-static volatile  Std_Bool_t isByteSended=STD_TRUE;
-static u8  *Asynch_Send_Str;
-static u8  *Asynch_receive_str;
-static u8  *Asynch_Send_buffer;
-static u8  *Asynch_receive_buffer;
+#define UART_RX_NO_TERMINATOR       0xFFFF /**< terminator argument of UART_ReceiveAsynch to receive a fixed number of bytes */
 
+/* the check of the CheckSum protocol (the sender and the receiver must use the same check) */
+#define UART_CHECKSUM_SUM16         0 /**< sum of the data bytes modulo 65536 (first version of the protocol) */
+#define UART_CHECKSUM_CRC8          1 /**< CRC-8 of the length and the data (Services/CRC) */
+#define UART_CHECKSUM_CRC16         2 /**< CRC-16/CCITT of the length and the data (Services/CRC) */
+#define UART_CHECKSUM_TYPE          UART_CHECKSUM_CRC16
 
+/* the time given to one call of UART_SendBurstPeriodicCheck , called once per loop of the super loop :
+ * a call polls the UART during UART_BURST_LOOP_SHARE % of the loop period (whole byte times of the baud rate in use , at least one) ,
+ * so the burst sends at about this share of the line rate and uses the same share of the CPU
+ * (ex: 8 MHz , 9600 baud , 12-bit frames , 250 ms loop , 20 % : 50 ms per call , 40 bytes per call , 160 B/s) */
+#define UART_BURST_LOOP_PERIOD_MS   250   /**< period of the loop that calls UART_SendBurstPeriodicCheck (main.c) */
+#define UART_BURST_LOOP_SHARE       20    /**< % of the loop period spent in one call (1 .. 100) */
+#define UART_BURST_POLL_CYCLES      31    /**< cycles of one UDRE poll of the burst loop , a hand count from the ATmega32 instruction timings
+                                                 (see UART_SendBurstPeriodicCheck) , not measured on the compiled code */
 
 /*------------------------------------------------------------------------------*/
 /*                                                                              */
 /*                                  TYPEDEFS                                    */
 /*                                                                              */
 /*------------------------------------------------------------------------------*/
+/**
+ * @brief Pointer to the completion call back of UART_ReceiveAsynch.
+ *        It is called from the RX ISR with the buffer , the number of bytes stored and the status :
+ *        - STD_OK : the terminator is received (or capacity bytes are received when there is no terminator)
+ *        - STD_BUFFER_FULL : the buffer is full and the terminator is not received
+ */
+typedef void (*UART_RxDoneCallBack_t)(u8 buffer[], u16 len, Std_Error_t status);
+
+/**
+ * @brief states of the frame parser of the CheckSum protocol.
+ */
+typedef enum{
+	UART_FRAME_WAIT_LEN_LOW,
+	UART_FRAME_WAIT_LEN_HIGH,
+	UART_FRAME_WAIT_DATA,
+	UART_FRAME_WAIT_CHECK_LOW,
+	UART_FRAME_WAIT_CHECK_HIGH,
+	UART_FRAME_COMPLETE
+}	UART_FrameState_t;
+
+/**
+ * @brief Pointer to the call back of the frame parser , called with the data of every valid frame.
+ */
+typedef void (*UART_FrameCallBack_t)(const u8 data[], u16 len);
+
+/**
+ * @brief state of the frame parser (the user must not change the members after UART_FrameParserInit).
+ */
+typedef struct{
+	volatile UART_FrameState_t  State;
+	u8                          LenBytes;      /**< 1 : string frame , 2 : buffer frame */
+	u8                         *Buffer;
+	u16                         Capacity;
+	u16                         Len;           /**< length field of the current frame */
+	u16                         Idx;           /**< data bytes received */
+	u16                         Check;         /**< check calculated over the received bytes */
+	u16                         ReceivedCheck;
+	u16                         TimeoutMs;
+	volatile u16                Deadline;      /**< tick at which the current frame is dropped */
+	UART_FrameCallBack_t        pfFrame;
+	u16                         CheckErrors;   /**< frames dropped because of a bad check */
+	u16                         Overflows;     /**< frames dropped because they are longer than capacity */
+	u16                         Timeouts;      /**< frames dropped because of the timeout */
+}	UART_FrameParser_t;
+
+/**
+ * @brief state of a burst transmission , owned by the caller (several transmissions can be prepared at the same time).
+ */
+typedef struct{
+	const u8   *Data;
+	u16         Len;
+	u16         Idx;    /**< bytes written to the UART */
+}	UART_BurstTx_t;
+
+/**
+ * @brief Pointer to the call back of the double buffered reception , called from the RX ISR with every complete record.
+ */
+typedef void (*UART_RecordReadyCallBack_t)(u8 record[], u16 len);
+
+/**
+ * @brief state of the double buffered (ping-pong) reception.
+ *        The ISR fills Buffer[Fill] , the other buffer belongs to the application from the ready call back
+ *        until UART_PingPongRelease : the ISR never writes it so no copy or lock is needed.
+ */
+typedef struct{
+	u8                          *Buffer[2];
+	u16                          RecordSize;
+	volatile u16                 Idx;       /**< bytes of the record being received */
+	volatile u8                  Fill;      /**< index of the buffer filled by the ISR */
+	volatile Std_Bool_t          Ready;     /**< STD_TRUE while the other buffer holds a record not released */
+	volatile u16                 Dropped;   /**< records dropped because the application did not release the previous one */
+	UART_RecordReadyCallBack_t   pfReady;
+}	UART_PingPong_t;
+
 /***********ToDo*************/
 /*
 typedef enum{
@@ -116,19 +195,117 @@ void UART_SendStringBusyWait(const u8 Str[]);
  * @param Str The buffer in which to store the received string.
  */
 void UART_ReceiveStringBusyWait(u8 Str[]);
+
+/**
+ * @brief Sends a number of bytes over UART using busy-waiting.
+ *
+ * This function sends len bytes starting from buffer over UART using busy-waiting.
+ * The buffer is not scanned for a terminator so it may contain any byte value (binary data).
+ * The function does not return until all bytes have been sent.
+ *
+ * @param buffer The buffer containing the data to be sent.
+ * @param len The number of bytes to be sent (0 .. 65535).
+ */
+void UART_SendBufferLenBusyWait(const u8 buffer[], u16 len);
+
+/**
+ * @brief Receives a number of bytes over UART using busy-waiting.
+ *
+ * This function receives exactly len bytes over UART using busy-waiting and stores them in buffer.
+ * No terminator is expected or added so the data may contain any byte value (binary data).
+ *
+ * @param buffer The buffer in which to store the received data (at least len bytes).
+ * @param len The number of bytes to be received (0 .. 65535).
+ */
+void UART_ReceiveBufferLenBusyWait(u8 buffer[], u16 len);
+
+/**
+ * @brief Receives a string over UART using busy-waiting without overflowing the buffer.
+ *
+ * This function receives characters until STRING_TERMINATOR is received or the buffer is full.
+ * The received string is always terminated by a NULL character in the buffer,
+ * so at most capacity-1 characters are stored.
+ *
+ * @param Str The buffer in which to store the received string.
+ * @param capacity The size of the buffer in bytes (at least 1).
+ * @return u16 The number of characters stored (without the NULL character).
+ */
+u16 UART_ReceiveStringBoundedBusyWait(u8 Str[], u16 capacity);
+
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
 /*                         Send and Receive Functions          	               */
-/*                                Asynchronous                                 */
+/*                               with timeout                                  */
 /*                                                                             */
 /*-----------------------------------------------------------------------------*/
-/*Send */
+/* the timeout functions need the system tick (SysTick_Init) and the global interrupt enabled ,
+ * the deadline is an absolute tick : SysTick_GetTicks() + timeout */
 
 /**
- * @brief This function is a callback function for UART transmission without null character.
- * 
+ * @brief Sends a number of bytes over UART using busy-waiting until a deadline.
+ *
+ * Like UART_SendBufferLenBusyWait but the function gives up when the deadline is reached.
+ * The deadline is for the whole transfer (not for every byte).
+ *
+ * @param buffer The buffer containing the data to be sent.
+ * @param len The number of bytes to be sent (0 .. 65535).
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t STD_OK if all the bytes are sent , STD_TIMEOUT if the deadline is reached first.
+ */
+Std_Error_t UART_SendBufferLenTimeout(const u8 buffer[], u16 len, u16 deadline);
+
+/**
+ * @brief Sends a string over UART using busy-waiting until a deadline , the NULL character is sent too.
+ *
+ * Like UART_SendStringBusyWait but the function gives up when the deadline is reached.
+ *
+ * @param Str The string to be sent.
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t STD_OK if the string is sent , STD_TIMEOUT if the deadline is reached first.
+ */
+Std_Error_t UART_SendStringTimeout(const u8 Str[], u16 deadline);
+
+/**
+ * @brief Receives a number of bytes over UART using busy-waiting until a deadline.
+ *
+ * Like UART_ReceiveBufferLenBusyWait but the function gives up when the deadline is reached.
+ *
+ * @param buffer The buffer in which to store the received data (at least len bytes).
+ * @param len The number of bytes to be received (0 .. 65535).
+ * @param pLen a pointer to store the number of bytes received (may be NULL_PTR).
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t STD_OK if len bytes are received , STD_TIMEOUT if the deadline is reached first.
+ */
+Std_Error_t UART_ReceiveBufferLenTimeout(u8 buffer[], u16 len, u16 *pLen, u16 deadline);
+
+/**
+ * @brief Receives a string over UART using busy-waiting until a deadline without overflowing the buffer.
+ *
+ * Like UART_ReceiveStringBoundedBusyWait but the function gives up when the deadline is reached.
+ * The received string is always terminated by a NULL character in the buffer (also on timeout).
+ *
+ * @param Str The buffer in which to store the received string.
+ * @param capacity The size of the buffer in bytes (at least 1).
+ * @param pLen a pointer to store the number of characters stored without the NULL character (may be NULL_PTR).
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t - STD_OK : STRING_TERMINATOR is received
+ *                     - STD_BUFFER_FULL : capacity-1 characters are stored and STRING_TERMINATOR is not received
+ *                     - STD_TIMEOUT : the deadline is reached first
+ *                     - STD_INVALID_ARG : capacity is 0
+ */
+Std_Error_t UART_ReceiveStringTimeout(u8 Str[], u16 capacity, u16 *pLen, u16 deadline);
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                         Send and Receive Functions          	               */
+/*                                Asynchronous                                 */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+/*Send */
+/*
+ * @note the send functions of this section and of the periodic checking section keep their progress in a single
+ *       module state, so only one transfer of each kind can be in flight.
+ *       Use the sessions of UART_Session.h when several tasks send at the same time.
  */
-static void UART_TxCallBackWithoutNull(void);
 
 /**
  * @brief Sends a buffer of data over UART using asynchronous transmission.
@@ -141,12 +318,6 @@ static void UART_TxCallBackWithoutNull(void);
  */
 void UART_SendBufferAsynch(u8 buffer[]);
 
-/**
- * @brief This function is a callback function for UART transmission with null character.
- * 
- */
-static void UART_TxCallBackWithNull(void);
-
 /**
  * @brief Sends a string over UART using asynchronous transmission.
  *
@@ -159,13 +330,19 @@ static void UART_TxCallBackWithNull(void);
  */
 void UART_SendStringAsynch (u8 Str[]);
 
-/*Receive Function*/
 /**
- * @brief This function is a callback function for UART reception without null character.
- * 
+ * @brief Sends a number of bytes over UART using asynchronous transmission.
+ *
+ * This function sends len bytes starting from buffer over UART using asynchronous transmission.
+ * The buffer is not scanned for a terminator so it may contain any byte value (binary data).
+ * The function returns immediately after the first byte is sent.
+ *
+ * @param buffer The buffer containing the data to be sent (must stay valid until the end of the transmission).
+ * @param len The number of bytes to be sent (0 .. 65535).
  */
-static void UART_RxCallBackWithoutNull(void);
+void UART_SendBufferLenAsynch(const u8 buffer[], u16 len);
 
+/*Receive Function*/
 /**
  * @brief Receives a buffer of data over UART using asynchronous reception.
  *
@@ -177,12 +354,6 @@ static void UART_RxCallBackWithoutNull(void);
  */
 void UART_ReceiveInBuffer_Asynch(u8 buffer[]);
 
-/**
- * @brief This function is a callback function for UART reception with null character.
- * 
- */
-static void UART_RxCallBackWithNull(void);
-
 /**
  * @brief Receives a string over UART using asynchronous reception.
  *
@@ -194,6 +365,61 @@ static void UART_RxCallBackWithNull(void);
  * @param Str The buffer in which to store the received string.
  */
 void UART_ReceiveString_Asynch(u8 Str[]);
+
+/**
+ * @brief Receives a number of bytes over UART using asynchronous reception.
+ *
+ * This function receives exactly len bytes over UART using asynchronous reception and stores them in buffer.
+ * The reception stops (RX interrupt disabled) when len bytes are received so the buffer can not overflow.
+ * The function returns immediately, use UART_ReceiveBufferLenAsynchStatus to know when the reception is done.
+ *
+ * @param buffer The buffer in which to store the received data (at least len bytes).
+ * @param len The number of bytes to be received (0 .. 65535).
+ */
+void UART_ReceiveBufferLenAsynch(u8 buffer[], u16 len);
+
+/**
+ * @brief Gets the status of the reception started by UART_ReceiveBufferLenAsynch.
+ *
+ * @return Std_Status_t STD_DONE when all the bytes are received , STD_PENDING otherwise.
+ */
+Std_Status_t UART_ReceiveBufferLenAsynchStatus(void);
+
+/**
+ * @brief Starts a bounded asynchronous reception.
+ *
+ * The bytes are received by the RX interrupt while the CPU does other work.
+ * The reception completes when the terminator is received (it is not stored) or when capacity bytes are received,
+ * then the RX interrupt is disabled and pfDone is called from the ISR with the number of bytes stored.
+ * The buffer can never overflow.
+ *
+ * @param buffer The buffer in which to store the received data.
+ * @param capacity The size of the buffer in bytes (at least 1).
+ * @param terminator The byte that ends the reception (0 .. 255) or UART_RX_NO_TERMINATOR to receive exactly capacity bytes.
+ * @param pfDone The completion call back (may be NULL_PTR , then poll UART_ReceiveAsynchIsBusy).
+ * @return Std_Error_t - STD_OK if the reception is started
+ *                     - STD_NULL_POINTER if buffer is NULL_PTR
+ *                     - STD_INVALID_ARG if capacity is 0
+ *                     - STD_BUSY if a reception is already in progress
+ */
+Std_Error_t UART_ReceiveAsynch(u8 buffer[], u16 capacity, u16 terminator, UART_RxDoneCallBack_t pfDone);
+
+/**
+ * @brief Cancels the reception started by UART_ReceiveAsynch.
+ *
+ * The RX interrupt is disabled and the state is reset so a new reception can be started.
+ * The completion call back is not called.
+ *
+ * @return u16 The number of bytes stored in the buffer before the cancellation.
+ */
+u16 UART_ReceiveAsynchCancel(void);
+
+/**
+ * @brief Checks if the reception started by UART_ReceiveAsynch is still in progress.
+ *
+ * @return Std_Bool_t STD_TRUE while the reception is in progress.
+ */
+Std_Bool_t UART_ReceiveAsynchIsBusy(void);
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
 /*                         Send and Receive Functions          	               */
@@ -201,12 +427,6 @@ void UART_ReceiveString_Asynch(u8 Str[]);
 /*                                                                             */
 /*-----------------------------------------------------------------------------*/
 
-/**
- * @brief This function is a callback function for UART transmission with periodic checking.
- * 
- */
-static void UART_TxPeriodicCheckCallBack(void);
-
 /**
  * @brief Sends a buffer of data over UART using periodic checking.
  *
@@ -238,6 +458,58 @@ Std_Status_t UART_SendBufferPeriodicCheck(u8 buffer[]);
  */
 Std_Status_t UART_SendStringPeriodicCheck(u8 Str[]);
 
+/**
+ * @brief Sends a number of bytes over UART using periodic checking.
+ *
+ * This function sends len bytes starting from buffer over UART using periodic checking.
+ * The buffer is not scanned for a terminator so it may contain any byte value (binary data).
+ * The function checks periodically if the previous byte has been sent before sending the next byte.
+ * The function returns STD_PENDING until all bytes are sent.
+ * The function returns STD_DONE when all bytes are sent.
+ *
+ * @param buffer The buffer containing the data to be sent.
+ * @param len The number of bytes to be sent (0 .. 65535).
+ * @return The status of the transmission.
+ */
+Std_Status_t UART_SendBufferLenPeriodicCheck(const u8 buffer[], u16 len);
+
+/**
+ * @brief Prepares a burst transmission of a number of bytes.
+ *
+ * @param tx the state of the transmission (owned by the caller).
+ * @param buffer The buffer containing the data to be sent (must stay valid until the transmission is done).
+ * @param len The number of bytes to be sent.
+ */
+void UART_BurstTxInit(UART_BurstTx_t *tx, const u8 buffer[], u16 len);
+
+/**
+ * @brief Prepares a burst transmission of a string , the NULL character is sent too (like UART_SendStringPeriodicCheck).
+ *
+ * @param tx the state of the transmission (owned by the caller).
+ * @param Str The string to be sent (must stay valid until the transmission is done).
+ */
+void UART_BurstTxInitString(UART_BurstTx_t *tx, const u8 Str[]);
+
+/**
+ * @brief Sends the bytes of a burst transmission using periodic checking.
+ *
+ * On every call the UDRE flag is polled and a byte is written each time the data register is empty,
+ * until all the bytes are sent or the poll budget of the baud rate in use is spent
+ * (about UART_BURST_LOOP_SHARE % of UART_BURST_LOOP_PERIOD_MS , rounded to whole byte times of UART_GetBaudRate()).
+ * So a slow super loop sends many bytes per call instead of one ,
+ * the transmission runs at about UART_BURST_LOOP_SHARE % of the line rate.
+ * No interrupt is used and the state is in tx , so the function does not share any state with the other UART functions.
+ *EX:
+ *	UART_BurstTx_t tx;
+ *	UART_BurstTxInit(&tx, frame, sizeof(frame));
+ *	while(1) { UART_SendBurstPeriodicCheck(&tx); ... }
+ *
+ * @param tx the state of the transmission (from UART_BurstTxInit).
+ * @return Std_Status_t STD_PENDING until all the bytes are written to the UART , then STD_DONE
+ *                      (the last byte may still be in the shift register).
+ */
+Std_Status_t UART_SendBurstPeriodicCheck(UART_BurstTx_t *tx);
+
 /*------------------------------------------------------------------------------*/
 /*                                                                              */
 /*                                  CheckSum                                    */   
@@ -245,21 +517,24 @@ Std_Status_t UART_SendStringPeriodicCheck(u8 Str[]);
 /*                                                                              */
 /*------------------------------------------------------------------------------*/
 /*			Frame of this checkSum protocol:
-			Data_Len	+	data    +	sum
-size        1Byte			1Byte       2byte( (maxCharSize=255)*(maxNumOfChar=255)=65025 )
-max_value   255             255         65535
+			Data_Len	+	data    +	check
+size        1Byte			len Byte    2byte (1byte for UART_CHECKSUM_CRC8)
+max_value   255             255
+the check is selected by UART_CHECKSUM_TYPE and sent with the least significant byte first :
+  - UART_CHECKSUM_SUM16 : sum of the data bytes (the length is not covered)
+  - UART_CHECKSUM_CRC8  : CRC-8 of the length and the data (1 byte)
+  - UART_CHECKSUM_CRC16 : CRC-16/CCITT of the length and the data
 */
 
 /**
  * @brief Sends a string over UART using busy-waiting with a checksum.
  *
  * This function sends a string over UART using busy-waiting.
- * It calculates the checksum of the string and sends it after the string.
+ * It calculates the check of the string (UART_CHECKSUM_TYPE) and sends it after the string.
  * The function waits until the UART is ready to transmit data and then sends each character of the string sequentially.
  * The function does not return until the entire string has been sent.
  * The string is terminated by a NULL character.
- * The checksum is calculated as the sum of all characters in the string.
- * The checksum is sent as two bytes, with the least significant byte sent first.
+ * The check is sent with the least significant byte first.
  *
  * @param str The string to be sent.
  */
@@ -269,16 +544,288 @@ void UART_SendStringCheckSumBusyWait(u8 str[]);
  * @brief Receives a string over UART using busy-waiting with a checksum.
  *
  * This function receives a string over UART using busy-waiting.
- * It calculates the checksum of the received string and compares it to the received checksum.
+ * It calculates the check of the received string and compares it to the received check.
  * The function waits until the UART is ready to receive data and then receives the length of the string.
- * The function then receives the string and calculates the checksum.
- * The function returns STD_OK if the checksums match, and STD_NOK if they do not.
+ * The function then receives the string and calculates the check.
+ * The function returns STD_OK if the checks match, and STD_NOK if they do not.
  *
  * @param str The buffer in which to store the received string.
  * @return The status of the checksum comparison.
  */
 Std_Error_t UART_ReceiveStringCheckSumBusyWait(u8 str[]);
 
+/*			Frame of the length based checkSum protocol:
+			Data_Len	+	data    +	check
+size        2Byte			len Byte    2byte (1byte for UART_CHECKSUM_CRC8) same check as the string frame
+the length and the check are sent with the least significant byte first
+*/
+
+/**
+ * @brief Sends a number of bytes over UART using busy-waiting with a checksum.
+ *
+ * This function sends a frame made of the 16-bit length, the data and the check (UART_CHECKSUM_TYPE).
+ * The data may contain any byte value (binary data) and may be longer than 255 bytes.
+ *
+ * @param buffer The buffer containing the data to be sent.
+ * @param len The number of bytes to be sent (0 .. 65535).
+ */
+void UART_SendBufferCheckSumBusyWait(const u8 buffer[], u16 len);
+
+/**
+ * @brief Receives a frame sent by UART_SendBufferCheckSumBusyWait using busy-waiting.
+ *
+ * This function receives the 16-bit length, the data and the check, and compares the check with the calculated one.
+ * At most capacity bytes are stored in buffer, the extra bytes of a longer frame are received and
+ * added to the check but not stored, so the receiver stays synchronized with the sender.
+ *
+ * @param buffer The buffer in which to store the received data.
+ * @param capacity The size of the buffer in bytes.
+ * @param pLen A pointer to a variable to store the length of the frame (may be NULL_PTR).
+ * @return Std_Error_t - STD_OK if the checks match
+ *                     - STD_NOK if they do not match
+ *                     - STD_BUFFER_OVERFLOW if the frame is longer than capacity (only capacity bytes are stored)
+ */
+Std_Error_t UART_ReceiveBufferCheckSumBusyWait(u8 buffer[], u16 capacity, u16 *pLen);
+
+/**
+ * @brief Receives a string frame of the CheckSum protocol using busy-waiting until a deadline.
+ *
+ * Like UART_ReceiveStringCheckSumBusyWait but the function gives up when the deadline is reached
+ * (the deadline is for the whole frame).
+ *
+ * @param str The buffer in which to store the received string (at least 255 bytes).
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t - STD_OK : the check is correct
+ *                     - STD_NOK : the check is not correct
+ *                     - STD_TIMEOUT : the deadline is reached before the end of the frame
+ */
+Std_Error_t UART_ReceiveStringCheckSumTimeout(u8 str[], u16 deadline);
+
+/**
+ * @brief Receives a buffer frame of the CheckSum protocol using busy-waiting until a deadline.
+ *
+ * Like UART_ReceiveBufferCheckSumBusyWait but the function gives up when the deadline is reached
+ * (the deadline is for the whole frame).
+ *
+ * @param buffer The buffer in which to store the received data.
+ * @param capacity The size of the buffer in bytes.
+ * @param pLen a pointer to store the length field of the frame (may be NULL_PTR , not changed on timeout).
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t - STD_OK : the check is correct
+ *                     - STD_NOK : the check is not correct
+ *                     - STD_BUFFER_OVERFLOW : the frame is longer than capacity (the extra bytes are dropped)
+ *                     - STD_TIMEOUT : the deadline is reached before the end of the frame
+ */
+Std_Error_t UART_ReceiveBufferCheckSumTimeout(u8 buffer[], u16 capacity, u16 *pLen, u16 deadline);
+
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                          Non blocking frame parser                           */
+/*                            of the CheckSum protocol                          */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief Prepares a frame parser for the frames of UART_SendStringCheckSumBusyWait (1 byte length)
+ *        or UART_SendBufferCheckSumBusyWait (2 bytes length).
+ *
+ * @param parser the frame parser.
+ * @param lenBytes the size of the length field : 1 or 2.
+ * @param buffer the buffer of the received data.
+ * @param capacity the size of the buffer (a longer frame is received but dropped).
+ * @param timeoutMs the maximum time between the first and the last byte of a frame in ms
+ *                  (0 : no timeout , else SysTick must be running).
+ * @param pfFrame the call back of the valid frames (called from UART_FrameParserPushByte).
+ */
+void UART_FrameParserInit(UART_FrameParser_t *parser, u8 lenBytes, u8 buffer[], u16 capacity, u16 timeoutMs, UART_FrameCallBack_t pfFrame);
+
+/**
+ * @brief Feeds one received byte to a frame parser (from the RX ISR , a ring buffer or a polling loop).
+ *
+ * The function never waits , it only moves the parser to its next state.
+ * When the last byte of a valid frame is pushed the call back is called with the data of the frame.
+ * A frame that is not complete after timeoutMs is dropped and the byte starts a new frame.
+ *
+ * @param parser the frame parser.
+ * @param data the received byte.
+ * @return Std_Status_t - STD_PENDING : the frame is not complete
+ *                      - STD_DONE : a valid frame is received
+ *                      - STD_ERROR : the frame is dropped (bad check or longer than capacity)
+ */
+Std_Status_t UART_FrameParserPushByte(UART_FrameParser_t *parser, u8 data);
+
+/**
+ * @brief Drops a frame that is not complete after the timeout even if no more bytes are received.
+ *        Call it periodically (ex: from the main loop) when the sender may stop in the middle of a frame.
+ *
+ * @param parser the frame parser.
+ * @return Std_Bool_t STD_TRUE if a frame is dropped.
+ */
+Std_Bool_t UART_FrameParserCheckTimeout(UART_FrameParser_t *parser);
+
+/**
+ * @brief Feeds a frame parser from the RX interrupt until UART_ReceiveFrameAsynchStop is called.
+ *        The call back of the parser is called from the RX ISR.
+ *
+ * @param parser a parser prepared by UART_FrameParserInit (must stay valid until the reception is stopped).
+ */
+void UART_ReceiveFrameAsynch(UART_FrameParser_t *parser);
+
+/**
+ * @brief Stops the reception started by UART_ReceiveFrameAsynch.
+ */
+void UART_ReceiveFrameAsynchStop(void);
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                    COBS                                      */
+/*                             PROTOCOL ABOVE UART                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/*			Frame of the COBS protocol:
+			COBS encoded data	+	0x00
+size        len + 1 + len/254 Byte   1Byte
+the data may contain any byte value , the receiver resynchronizes on the next 0x00
+*/
+
+/**
+ * @brief Sends a COBS frame over UART using busy-waiting.
+ *
+ * The data is encoded while it is sent , no extra buffer is needed.
+ *
+ * @param buffer The data to be sent (may contain any byte value).
+ * @param len The number of bytes to be sent.
+ */
+void UART_SendFrameCOBSBusyWait(const u8 buffer[], u16 len);
+
+/**
+ * @brief Receives a COBS frame over UART using busy-waiting.
+ *
+ * The bytes are decoded while they are received , the function returns at the delimiter of the frame.
+ * Empty frames are skipped.
+ *
+ * @param buffer The buffer in which to store the decoded data.
+ * @param capacity The size of the buffer in bytes.
+ * @param pLen A pointer to a variable to store the number of decoded bytes.
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NOT_VALID if the frame is bad or longer than capacity (the receiver is already resynchronized)
+ */
+Std_Error_t UART_ReceiveFrameCOBSBusyWait(u8 buffer[], u16 capacity, u16 *pLen);
+
+/**
+ * @brief Receives a COBS frame using busy-waiting until a deadline.
+ *
+ * Like UART_ReceiveFrameCOBSBusyWait but the function gives up when the deadline is reached
+ * (the deadline is for the whole frame).
+ *
+ * @param buffer The buffer in which to store the decoded data.
+ * @param capacity The size of the buffer in bytes.
+ * @param pLen a pointer to store the number of decoded bytes.
+ * @param deadline the tick (SysTick_GetTicks() + timeout) at which the function gives up (less than 32767 ticks away).
+ * @return Std_Error_t - STD_OK : a valid frame is received
+ *                     - STD_NOT_VALID : the frame is not valid or longer than capacity
+ *                     - STD_TIMEOUT : the deadline is reached before the delimiter
+ */
+Std_Error_t UART_ReceiveFrameCOBSTimeout(u8 buffer[], u16 capacity, u16 *pLen, u16 deadline);
+
+/**
+ * @brief Starts the continuous reception of COBS frames using the RX interrupt.
+ *
+ * Every received byte is decoded in the RX ISR , at the end of every frame pfDone is called with
+ * the decoded data and STD_OK , or STD_NOT_VALID for a bad frame (it is dropped).
+ * The data is valid only inside the call back (the next frame is decoded in the same buffer).
+ * The reception continues until UART_ReceiveFrameCOBSAsynchStop is called.
+ *
+ * @param decoder A decoder prepared by COBS_DecoderInit (must stay valid until the reception is stopped).
+ * @param pfDone The call back of the frames.
+ */
+void UART_ReceiveFrameCOBSAsynch(COBS_Decoder_t *decoder, UART_RxDoneCallBack_t pfDone);
+
+/**
+ * @brief Stops the reception started by UART_ReceiveFrameCOBSAsynch.
+ */
+void UART_ReceiveFrameCOBSAsynchStop(void);
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                         Double buffered reception                            */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief Starts the continuous reception of fixed size records in two buffers using the RX interrupt.
+ *
+ * The ISR fills one buffer while the application processes the other one.
+ * When a record is complete and the other buffer is released the buffers are swapped and pfReady is called (from the ISR)
+ * with the complete record , it belongs to the application until UART_PingPongRelease.
+ * If the previous record is not released yet the new record is dropped (counted in Dropped) and the buffer is filled again.
+ * The reception must start on a record boundary (ex: before the sensor starts streaming).
+ *EX:
+ *	static u8 recA[32] , recB[32];
+ *	static UART_PingPong_t rx;
+ *	UART_ReceivePingPongStart(&rx, recA, recB, 32, NULL_PTR);
+ *	while(1)
+ *	{
+ *		u8 *record = UART_PingPongGetRecord(&rx);
+ *		if(NULL_PTR != record) { Process(record); UART_PingPongRelease(&rx); }
+ *	}
+ *
+ * @param pp the state of the reception (must stay valid until the reception is stopped).
+ * @param bufferA , bufferB two buffers of recordSize bytes.
+ * @param recordSize the size of one record in bytes (at least 1).
+ * @param pfReady the call back of the records (may be NULL_PTR , then poll UART_PingPongGetRecord).
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NULL_POINTER if pp or a buffer is NULL_PTR
+ *                     - STD_INVALID_ARG if recordSize is 0
+ */
+Std_Error_t UART_ReceivePingPongStart(UART_PingPong_t *pp, u8 bufferA[], u8 bufferB[], u16 recordSize, UART_RecordReadyCallBack_t pfReady);
+
+/**
+ * @brief Gets the record ready for the application.
+ *
+ * @param pp the state of the reception.
+ * @return u8* the record (RecordSize bytes) or NULL_PTR if no record is ready.
+ */
+u8* UART_PingPongGetRecord(UART_PingPong_t *pp);
+
+/**
+ * @brief Gives the buffer of the processed record back to the ISR , the next complete record can be delivered.
+ *        May be called from the ready call back.
+ *
+ * @param pp the state of the reception.
+ */
+void UART_PingPongRelease(UART_PingPong_t *pp);
+
+/**
+ * @brief Gets the number of records dropped because the application was too slow.
+ *
+ * @param pp the state of the reception.
+ * @return u16 the number of dropped records (saturates at 65535).
+ */
+u16 UART_PingPongGetDropped(UART_PingPong_t *pp);
+
+/**
+ * @brief Stops the reception started by UART_ReceivePingPongStart , the record being received is dropped.
+ */
+void UART_ReceivePingPongStop(void);
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                              Formatted output                                */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief Sends formatted text over UART using busy-waiting (printf like , see Std_Printf for the conversions).
+ *
+ * The characters are sent as soon as they are formatted , no buffer is used.
+ *
+ * @param format The format string.
+ * @param ... The values of the conversions.
+ * @return u16 The number of characters sent.
+ */
+u16 UART_Printf(const char *format, ...);
 
 
 #endif /* UART_SERVICES_H_ */
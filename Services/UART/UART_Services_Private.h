@@ -0,0 +1,167 @@
+/**
+ * @file UART_Services_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private information of the UART services (the module state and the ISR call backs).
+ *         The user must not include this file in the application code.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UART_SERVICES_PRIVATE_H_
+#define UART_SERVICES_PRIVATE_H_
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief state of the bounded asynchronous reception.
+ */
+typedef struct{
+	u8                    *Buffer;
+	u16                    Capacity;
+	volatile u16           Len;
+	u16                    Terminator;
+	UART_RxDoneCallBack_t  pfDone;
+	volatile Std_Bool_t    Busy;
+}	UART_AsynchRx_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                     Static Private Global Vaiables                           */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static volatile  Std_Bool_t isByteSended=STD_TRUE;
+static u8  *Asynch_Send_Str;
+static u8  *Asynch_receive_str;
+static u8  *Asynch_Send_buffer;
+static u8  *Asynch_receive_buffer;
+static u16  Asynch_receive_strIdx;
+static u16  Asynch_receive_bufferIdx;
+static const u8  *Asynch_Send_LenBuffer;
+static volatile u16 Asynch_Send_Len;
+static volatile u16 Asynch_Send_LenIdx;
+static u8  *Asynch_receive_LenBuffer;
+static volatile u16 Asynch_receive_Len;
+static volatile u16 Asynch_receive_LenIdx;
+static UART_AsynchRx_t Asynch_Rx = {NULL_PTR, 0, 0, 0, NULL_PTR, STD_FALSE};
+static UART_PingPong_t       *Asynch_PingPong;
+static COBS_Decoder_t        *Asynch_COBS_Decoder;
+static UART_RxDoneCallBack_t  Asynch_COBS_pfDone;
+static UART_FrameParser_t    *Asynch_FrameParser;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                        Static Private Functions                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief This function is a callback function for UART transmission without null character.
+ * 
+ */
+static void UART_TxCallBackWithoutNull(void);
+
+/**
+ * @brief This function is a callback function for UART transmission with null character.
+ * 
+ */
+static void UART_TxCallBackWithNull(void);
+
+/**
+ * @brief This function is a callback function for UART transmission of a number of bytes.
+ * 
+ */
+static void UART_TxCallBackLen(void);
+
+/**
+ * @brief This function is a callback function for UART reception without null character.
+ * 
+ */
+static void UART_RxCallBackWithoutNull(void);
+
+/**
+ * @brief This function is a callback function for UART reception with null character.
+ * 
+ */
+static void UART_RxCallBackWithNull(void);
+
+/**
+ * @brief This function is a callback function for UART reception of a number of bytes.
+ * 
+ */
+static void UART_RxCallBackLen(void);
+
+/**
+ * @brief This function is a callback function for the bounded asynchronous reception.
+ *        It stores the received byte and completes the reception on the terminator or when the buffer is full.
+ * 
+ */
+static void UART_RxCallBackBounded(void);
+
+/**
+ * @brief This function is a callback function for UART transmission with periodic checking.
+ * 
+ */
+static void UART_TxPeriodicCheckCallBack(void);
+
+/**
+ * @brief Sends the check of a frame with busy-waiting , the least significant byte first.
+ *
+ * @param check the check of the frame.
+ */
+static void UART_SendCheckBusyWait(u16 check);
+
+/**
+ * @brief Receives the check of a frame with busy-waiting.
+ *
+ * @return u16 the received check.
+ */
+static u16 UART_ReceiveCheckBusyWait(void);
+
+/**
+ * @brief Receives the check of a frame until a deadline , the least significant byte first.
+ *
+ * @param pCheck a pointer to store the received check.
+ * @param deadline the tick at which the function gives up.
+ * @return Std_Error_t STD_OK or STD_TIMEOUT.
+ */
+static Std_Error_t UART_ReceiveCheckTimeout(u16 *pCheck, u16 deadline);
+
+/**
+ * @brief Moves the parser back to the first state (waiting for the length of a new frame).
+ *
+ * @param parser the frame parser.
+ */
+static void UART_FrameParserRestart(UART_FrameParser_t *parser);
+
+/**
+ * @brief This function is a callback function for the asynchronous frame reception.
+ * 
+ */
+static void UART_RxCallBackFrameParser(void);
+
+/**
+ * @brief This function is a callback function for the asynchronous COBS reception.
+ *        It decodes the received byte and calls the user call back at the end of every frame.
+ * 
+ */
+static void UART_RxCallBackCOBS(void);
+
+/**
+ * @brief This function is a callback function for the double buffered reception.
+ *        It stores the received byte and swaps the buffers at the end of every record.
+ * 
+ */
+static void UART_RxCallBackPingPong(void);
+
+
+#endif /* UART_SERVICES_PRIVATE_H_ */
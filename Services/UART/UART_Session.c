@@ -0,0 +1,260 @@
+/**
+ * @file UART_Session.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the handle-based asynchronous UART transmission.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * LIB files
+ */
+#include "Std_Types.h"
+#include "Utils_interrupt.h"
+
+/*
+ * the module files
+ */
+#include "UART_TxChain.h"
+#include "UART_Session.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                          Static Global Vaiables                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static UART_Session_t SessionPool[UART_SESSION_POOL_SIZE];
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Converts a handle to its session.
+ *
+ * @param handle the handle of the session.
+ * @return UART_Session_t* the session or NULL_PTR if the handle is not an open session.
+ */
+static UART_Session_t* UART_SessionGet(UART_SessionHandle_t handle)
+{
+	if((handle < UART_SESSION_POOL_SIZE) && (1 == SessionPool[handle].InUse))
+	{
+		return &SessionPool[handle];
+	}
+	return NULL_PTR;
+}
+
+/**
+ * @brief This function is the completion call back of the descriptors of the sessions (called from the UDRE ISR).
+ *
+ * @param desc the descriptor of the session.
+ */
+static void UART_SessionChainDone(UART_TxDesc_t *desc)
+{
+	UART_Session_t *session = (UART_Session_t*)desc;
+
+	if(NULL_PTR != session->pfDone)
+	{
+		session->pfDone((UART_SessionHandle_t)(session - SessionPool));
+	}
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Opens a session.
+ *
+ * @param pHandle a pointer to store the handle of the session.
+ * @param pfDone the completion call back of the session (may be NULL_PTR , then poll UART_SessionGetStatus).
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NULL_POINTER if pHandle is NULL_PTR
+ *                     - STD_OUT_OF_MEMORY if all the sessions are open (*pHandle is UART_SESSION_INVALID_HANDLE)
+ */
+Std_Error_t UART_SessionOpen(UART_SessionHandle_t *pHandle, UART_SessionDoneCallBack_t pfDone)
+{
+	Std_Error_t errorStatus = STD_OUT_OF_MEMORY;
+	u8 i, sregCopy;
+
+	if(NULL_PTR == pHandle)
+	{
+		return STD_NULL_POINTER;
+	}
+
+	*pHandle = UART_SESSION_INVALID_HANDLE;
+	Critical_Enter(sregCopy);
+	for(i=0; i<UART_SESSION_POOL_SIZE; i++)
+	{
+		if(0 == SessionPool[i].InUse)
+		{
+			SessionPool[i].InUse       = 1;
+			SessionPool[i].pfDone      = pfDone;
+			SessionPool[i].Desc.Status = STD_IDLE;
+			SessionPool[i].Desc.Next   = NULL_PTR;
+			SessionPool[i].Frag.Len    = 0;
+			*pHandle    = i;
+			errorStatus = STD_OK;
+			break;
+		}
+	}
+	Critical_Exit(sregCopy);
+
+	return errorStatus;
+}
+
+/**
+ * @brief Closes a session , a transfer in progress is aborted.
+ *
+ * @param handle the handle of the session.
+ * @return Std_Error_t - STD_OK
+ *                     - STD_INVALID_ARG if the handle is not an open session
+ */
+Std_Error_t UART_SessionClose(UART_SessionHandle_t handle)
+{
+	UART_Session_t *session = UART_SessionGet(handle);
+
+	if(NULL_PTR == session)
+	{
+		return STD_INVALID_ARG;
+	}
+	UART_TxDescAbort(&session->Desc);
+	session->InUse = 0;
+	return STD_OK;
+}
+
+/**
+ * @brief Queues a number of bytes for transmission on a session.
+ *
+ * The function returns immediately , the bytes are sent by the UART interrupt
+ * after all the transfers queued before this one (by any session).
+ * The global interrupt must be enabled.
+ *
+ * @param handle the handle of the session.
+ * @param buffer The data to be sent (not copied , must stay valid until the transfer is done).
+ * @param len The number of bytes to be sent.
+ * @return Std_Error_t - STD_OK
+ *                     - STD_INVALID_ARG if the handle is not an open session
+ *                     - STD_NULL_POINTER if buffer is NULL_PTR
+ *                     - STD_BUSY if the previous transfer of the session is not done
+ */
+Std_Error_t UART_SessionSendBuffer(UART_SessionHandle_t handle, const u8 buffer[], u16 len)
+{
+	UART_Session_t *session = UART_SessionGet(handle);
+
+	if(NULL_PTR == session)
+	{
+		return STD_INVALID_ARG;
+	}
+	if(NULL_PTR == buffer)
+	{
+		return STD_NULL_POINTER;
+	}
+	if(STD_PENDING == session->Desc.Status)
+	{
+		return STD_BUSY;
+	}
+
+	session->Frag.Data = buffer;
+	session->Frag.Len  = len;
+	return UART_TxDescSubmit(&session->Desc, &session->Frag, 1, UART_SessionChainDone);
+}
+
+/**
+ * @brief Queues a string for transmission on a session.
+ *
+ * Same as UART_SessionSendBuffer , the string is sent with its NULL character like UART_SendStringAsynch.
+ *
+ * @param handle the handle of the session.
+ * @param Str The string to be sent (not copied , must stay valid until the transfer is done).
+ * @return Std_Error_t same as UART_SessionSendBuffer.
+ */
+Std_Error_t UART_SessionSendString(UART_SessionHandle_t handle, const u8 Str[])
+{
+	u16 len = 0;
+
+	if(NULL_PTR == Str)
+	{
+		return STD_NULL_POINTER;
+	}
+	while(NULL_CHAR != Str[len])
+	{
+		len++;
+	}
+	return UART_SessionSendBuffer(handle, Str, len+1);
+}
+
+/**
+ * @brief Gets the status of the last transfer of a session.
+ *
+ * @param handle the handle of the session.
+ * @return Std_Status_t - STD_IDLE : nothing sent yet or the transfer is aborted
+ *                      - STD_PENDING : the transfer is queued or being sent
+ *                      - STD_DONE : all the bytes are handed to the UART
+ *                      - STD_ERROR : the handle is not an open session
+ */
+Std_Status_t UART_SessionGetStatus(UART_SessionHandle_t handle)
+{
+	UART_Session_t *session = UART_SessionGet(handle);
+
+	if(NULL_PTR == session)
+	{
+		return STD_ERROR;
+	}
+	return session->Desc.Status;
+}
+
+/**
+ * @brief Gets the number of bytes of the current transfer already handed to the UART.
+ *
+ * @param handle the handle of the session.
+ * @return u16 the number of bytes sent (0 if the handle is not an open session).
+ */
+u16 UART_SessionGetProgress(UART_SessionHandle_t handle)
+{
+	UART_Session_t *session = UART_SessionGet(handle);
+	u16 progress = 0;
+	u8 sregCopy;
+
+	if(NULL_PTR != session)
+	{
+		// the cursor is changed by the UDRE ISR
+		Critical_Enter(sregCopy);
+		if(STD_DONE == session->Desc.Status)
+		{
+			progress = session->Frag.Len;
+		}
+		else if(STD_PENDING == session->Desc.Status)
+		{
+			progress = session->Desc.ByteIdx;
+		}
+		Critical_Exit(sregCopy);
+	}
+	return progress;
+}
+
+/**
+ * @brief Aborts the transfer of a session , the other sessions are not affected.
+ *        The session stays open and a new transfer can be started right after.
+ *
+ * @param handle the handle of the session.
+ * @return Std_Error_t - STD_OK
+ *                     - STD_INVALID_ARG if the handle is not an open session
+ */
+Std_Error_t UART_SessionAbort(UART_SessionHandle_t handle)
+{
+	UART_Session_t *session = UART_SessionGet(handle);
+
+	if(NULL_PTR == session)
+	{
+		return STD_INVALID_ARG;
+	}
+	return UART_TxDescAbort(&session->Desc);
+}
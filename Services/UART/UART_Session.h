@@ -0,0 +1,146 @@
+/**
+ * @file UART_Session.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Handle-based asynchronous UART transmission.
+ *         Every session owns its data pointer, cursor and status so several application tasks can send
+ *         at the same time without sharing any state : the transfers are queued in FIFO order
+ *         and sent one after the other by the UART interrupt (through UART_TxChain).
+ *EX:
+ *	UART_SessionHandle_t telemetry;
+ *	UART_SessionOpen(&telemetry, NULL_PTR);
+ *	UART_SessionSendBuffer(telemetry, frame, sizeof(frame));
+ *	...
+ *	if(STD_DONE == UART_SessionGetStatus(telemetry)) { // the frame buffer can be reused }
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UART_SESSION_H_
+#define UART_SESSION_H_
+
+#include "Std_Types.h"
+#include "UART_TxChain.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                           Configuration Macros                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define  UART_SESSION_POOL_SIZE   4   /**< number of sessions that can be open at the same time (max 254) */
+
+#define  UART_SESSION_INVALID_HANDLE   0xFF
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+typedef u8 UART_SessionHandle_t;
+
+/**
+ * @brief Pointer to the completion call back of a session.
+ *        It is called from the UART ISR when the last byte of a transfer is handed to the UART,
+ *        a new transfer may be started on the same session from inside the call back.
+ */
+typedef void (*UART_SessionDoneCallBack_t)(UART_SessionHandle_t handle);
+
+/**
+ * @brief state of one session.
+ * @note Desc must stay the first member , the completion call back of the chain casts the descriptor back to the session.
+ */
+typedef struct
+{
+	UART_TxDesc_t               Desc;   /**< the session owns its descriptor (not taken from the UART_TxChain pool) */
+	UART_TxFrag_t               Frag;   /**< the data of the current transfer */
+	UART_SessionDoneCallBack_t  pfDone;
+	u8                          InUse;
+}UART_Session_t;
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Opens a session.
+ *
+ * @param pHandle a pointer to store the handle of the session.
+ * @param pfDone the completion call back of the session (may be NULL_PTR , then poll UART_SessionGetStatus).
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NULL_POINTER if pHandle is NULL_PTR
+ *                     - STD_OUT_OF_MEMORY if all the sessions are open (*pHandle is UART_SESSION_INVALID_HANDLE)
+ */
+Std_Error_t UART_SessionOpen(UART_SessionHandle_t *pHandle, UART_SessionDoneCallBack_t pfDone);
+
+/**
+ * @brief Closes a session , a transfer in progress is aborted.
+ *
+ * @param handle the handle of the session.
+ * @return Std_Error_t - STD_OK
+ *                     - STD_INVALID_ARG if the handle is not an open session
+ */
+Std_Error_t UART_SessionClose(UART_SessionHandle_t handle);
+
+/**
+ * @brief Queues a number of bytes for transmission on a session.
+ *
+ * The function returns immediately , the bytes are sent by the UART interrupt
+ * after all the transfers queued before this one (by any session).
+ * The global interrupt must be enabled.
+ *
+ * @param handle the handle of the session.
+ * @param buffer The data to be sent (not copied , must stay valid until the transfer is done).
+ * @param len The number of bytes to be sent.
+ * @return Std_Error_t - STD_OK
+ *                     - STD_INVALID_ARG if the handle is not an open session
+ *                     - STD_NULL_POINTER if buffer is NULL_PTR
+ *                     - STD_BUSY if the previous transfer of the session is not done
+ */
+Std_Error_t UART_SessionSendBuffer(UART_SessionHandle_t handle, const u8 buffer[], u16 len);
+
+/**
+ * @brief Queues a string for transmission on a session.
+ *
+ * Same as UART_SessionSendBuffer , the string is sent with its NULL character like UART_SendStringAsynch.
+ *
+ * @param handle the handle of the session.
+ * @param Str The string to be sent (not copied , must stay valid until the transfer is done).
+ * @return Std_Error_t same as UART_SessionSendBuffer.
+ */
+Std_Error_t UART_SessionSendString(UART_SessionHandle_t handle, const u8 Str[]);
+
+/**
+ * @brief Gets the status of the last transfer of a session.
+ *
+ * @param handle the handle of the session.
+ * @return Std_Status_t - STD_IDLE : nothing sent yet or the transfer is aborted
+ *                      - STD_PENDING : the transfer is queued or being sent
+ *                      - STD_DONE : all the bytes are handed to the UART
+ *                      - STD_ERROR : the handle is not an open session
+ */
+Std_Status_t UART_SessionGetStatus(UART_SessionHandle_t handle);
+
+/**
+ * @brief Gets the number of bytes of the current transfer already handed to the UART.
+ *
+ * @param handle the handle of the session.
+ * @return u16 the number of bytes sent (0 if the handle is not an open session).
+ */
+u16 UART_SessionGetProgress(UART_SessionHandle_t handle);
+
+/**
+ * @brief Aborts the transfer of a session , the other sessions are not affected.
+ *        The session stays open and a new transfer can be started right after.
+ *
+ * @param handle the handle of the session.
+ * @return Std_Error_t - STD_OK
+ *                     - STD_INVALID_ARG if the handle is not an open session
+ */
+Std_Error_t UART_SessionAbort(UART_SessionHandle_t handle);
+
+
+#endif /* UART_SESSION_H_ */
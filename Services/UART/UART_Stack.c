@@ -8,6 +8,10 @@
  * @copyright Copyright (c) 2024
  * 
  */
+#include "Std_Types.h"
+#include "Utils_interrupt.h"
+#include "Std_Buffer.h"
+#include "Std_Stack.h"
 #include "UART_Stack.h"
 
 /*------------------------------------------------------------------------------*/
@@ -15,8 +19,7 @@
 /*                          Static Global Vaiables                              */
 /*                                                                              */
 /*------------------------------------------------------------------------------*/
-static u8 Stack[STACK_SIZE];
-static u8 SP=0;
+STD_STACK_DEFINE(UART_Stack, u8, STACK_SIZE, STACK_OVERFLOW_POLICY, STACK_OVERFLOW_CALLBACK);
 
 /**
  * @brief  This function is used to push data to the stack
@@ -27,18 +30,14 @@ static u8 SP=0;
  */
 Stack_Status_Type Push(u8 data)
 {
-	Stack_Status_Type Status;
-	if(SP==STACK_SIZE)
-	{
-		Status= STACK_FULL;
-	}
-	else
-	{
-		Stack[SP]=data;
-		SP++;
-		Status= DONE;
-	}
-	return Status;
+	Std_Error_t status;
+	u8 sregCopy;
+
+	Critical_Enter(sregCopy);
+	status = STD_STACK_PUSH(UART_Stack, data);
+	Critical_Exit(sregCopy);
+
+	return (STD_OK == status) ? DONE : STACK_FULL;
 }
 
 /**
@@ -50,16 +49,94 @@ Stack_Status_Type Push(u8 data)
  */
 Stack_Status_Type Pop(u8 *Pdata)
 {
-		Stack_Status_Type Status;
-		if(SP==0)
+	Std_Error_t status;
+	u8 sregCopy;
+
+	Critical_Enter(sregCopy);
+	status = STD_STACK_POP(UART_Stack, Pdata);
+	Critical_Exit(sregCopy);
+
+	return (STD_OK == status) ? DONE : STACK_EMPTY;
+}
+
+/**
+ * @brief  This function is used to push a block of bytes to the stack with one bound check
+ * 
+ * @param data the bytes , data[len - 1] becomes the top
+ * @param len the number of bytes
+ * @return Stack_Status_Type DONE if all the bytes are pushed
+ * 	       - STACK_FULL if there is no room for all of them (none is pushed , len is added to the drops)
+ */
+Stack_Status_Type PushN(const u8 data[], u8 len)
+{
+	Std_Error_t status;
+	u8 sregCopy, index;
+
+	// reserve the bytes : a push of an ISR after this point goes above them
+	Critical_Enter(sregCopy);
+	status = Std_StackReserveN(&UART_Stack, len, &index);
+	Critical_Exit(sregCopy);
+
+	if(STD_OK != status)
+	{
+		return STACK_FULL;
+	}
+	Std_StackWriteAt(&UART_Stack, index, data, len);
+	return DONE;
+}
+
+/**
+ * @brief  This function is used to pop a block of bytes from the stack with one bound check
+ * 
+ * @param data where the bytes are copied in the order of the stack , data[len - 1] was the top
+ * @param len the number of bytes
+ * @return Stack_Status_Type DONE if the len bytes are popped
+ * 	       - STACK_EMPTY if the stack has less than len bytes (none is popped)
+ */
+Stack_Status_Type PopN(u8 data[], u8 len)
+{
+	Std_Bool_t popped = STD_FALSE;
+	u32 pushed;
+	u8 sregCopy;
+
+	do
+	{
+		// every push (even one that overwrites the oldest byte) changes the pushed counter
+		Critical_Enter(sregCopy);
+		pushed = UART_Stack.Stats.Pushed;
+		Critical_Exit(sregCopy);
+
+		if(STD_OK != Std_StackPeekN(&UART_Stack, data, len))
 		{
-			Status= STACK_EMPTY;
+			return STACK_EMPTY;
 		}
-		else
+
+		Critical_Enter(sregCopy);
+		if(pushed == UART_Stack.Stats.Pushed)
 		{
-			SP--;
-			*Pdata=Stack[SP];
-			Status= DONE;
+			Std_StackRemoveN(&UART_Stack, len);
+			popped = STD_TRUE;
 		}
-		return Status;
-}
\ No newline at end of file
+		Critical_Exit(sregCopy);
+	}while(STD_FALSE == popped);
+
+	return DONE;
+}
+
+/**
+ * @brief  This function returns the number of bytes in the stack
+ */
+u8 Stack_GetCount(void)
+{
+	return UART_Stack.Top;
+}
+
+/**
+ * @brief  This function reads the counters of the stack (without stopping the pushes)
+ * 
+ * @param stats where the counters are copied (drops , overwrites , peak , pushed and popped bytes)
+ */
+void Stack_GetStats(Std_BufferStats_t *stats)
+{
+	Std_StackGetStats(&UART_Stack, stats);
+}
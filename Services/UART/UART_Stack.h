@@ -2,6 +2,14 @@
  * @file UART_Stack.h
  * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
  * @brief  This is a stack implementation using UART to send and receive data
+ *         The bytes are kept in a Std_Stack (LIB/Std_Stack.h) of STACK_SIZE elements.
+ *
+ *         The stack is shared by an ISR and the main loop (ex: Push from the RX call back , Pop from the super loop) :
+ *         - Push and Pop change the top inside a critical section of a few instructions (they can be called anywhere).
+ *         - PushN reserves its bytes in the critical section and copies them after it (the interrupts are not held for the copy).
+ *         - PopN copies the top bytes with the interrupts enabled and removes them only if no byte was pushed meanwhile
+ *           (else it copies the new top again) : the bytes are popped by one context only (the main loop).
+ *         - a push on the full stack follows STACK_OVERFLOW_POLICY , Stack_GetStats reads the counters while the bytes come in.
  * @version 0.1
  * @date 2024-04-01
  * 
@@ -12,6 +20,7 @@
 #define UART_STACK_H_
 
 #include "Std_Types.h"
+#include "Std_Buffer.h"
 
 
 /*------------------------------------------------------------------------------*/
@@ -21,6 +30,15 @@
 /*------------------------------------------------------------------------------*/
 #define  STACK_SIZE  10
 
+/**
+ * @brief what a push on the full stack does (Std_OverflowPolicy_t) :
+ *        STD_OVERFLOW_DROP_NEWEST      : the byte is dropped , Push returns STACK_FULL
+ *        STD_OVERFLOW_OVERWRITE_OLDEST : the oldest byte is replaced , Push returns DONE
+ *        STD_OVERFLOW_REJECT           : the byte is dropped , STACK_OVERFLOW_CALLBACK is called (interrupts disabled) , Push returns STACK_FULL
+ */
+#define  STACK_OVERFLOW_POLICY     STD_OVERFLOW_DROP_NEWEST
+#define  STACK_OVERFLOW_CALLBACK   NULL_PTR
+
 
 /*------------------------------------------------------------------------------*/
 /*                                                                              */
@@ -59,5 +77,37 @@ Stack_Status_Type Push(u8 data);
  */
 Stack_Status_Type Pop(u8 *Pdata);
 
+/**
+ * @brief  This function is used to push a block of bytes to the stack with one bound check
+ * 
+ * @param data the bytes , data[len - 1] becomes the top
+ * @param len the number of bytes
+ * @return Stack_Status_Type DONE if all the bytes are pushed
+ * 	       - STACK_FULL if there is no room for all of them (none is pushed , len is added to the drops)
+ */
+Stack_Status_Type PushN(const u8 data[], u8 len);
+
+/**
+ * @brief  This function is used to pop a block of bytes from the stack with one bound check
+ * 
+ * @param data where the bytes are copied in the order of the stack , data[len - 1] was the top
+ * @param len the number of bytes
+ * @return Stack_Status_Type DONE if the len bytes are popped
+ * 	       - STACK_EMPTY if the stack has less than len bytes (none is popped)
+ */
+Stack_Status_Type PopN(u8 data[], u8 len);
+
+/**
+ * @brief  This function returns the number of bytes in the stack
+ */
+u8 Stack_GetCount(void);
+
+/**
+ * @brief  This function reads the counters of the stack (without stopping the pushes)
+ * 
+ * @param stats where the counters are copied (drops , overwrites , peak , pushed and popped bytes)
+ */
+void Stack_GetStats(Std_BufferStats_t *stats);
+
 
 #endif /* UART_STACK_H_ */
\ No newline at end of file
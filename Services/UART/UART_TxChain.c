@@ -0,0 +1,293 @@
+/**
+ * @file UART_TxChain.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the zero-copy scatter-gather UART transmission.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/*
+ * LIB files
+ */
+#include "Std_Types.h"
+#include "Utils_interrupt.h"
+
+/*
+ * MCAL layer files
+ */
+#include "UART_Interface.h"
+
+/*
+ * the module files
+ */
+#include "UART_TxChain.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                          Static Global Vaiables                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static UART_TxDesc_t  TxDescPool[UART_TX_DESC_POOL_SIZE];
+static UART_TxDesc_t *volatile TxQueueHead = NULL_PTR; /**< descriptor being sent */
+static UART_TxDesc_t *volatile TxQueueTail = NULL_PTR; /**< last queued descriptor */
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Moves the cursor of the descriptor over the zero length fragments.
+ *
+ * @param desc the descriptor.
+ */
+static void UART_TxDescSkipEmptyFrags(UART_TxDesc_t *desc)
+{
+	while((desc->FragIdx < desc->FragCount) && (0 == desc->Frags[desc->FragIdx].Len))
+	{
+		desc->FragIdx++;
+	}
+}
+
+/**
+ * @brief This function is a callback function for the UART data register empty interrupt.
+ *        It sends the next byte of the descriptor at the head of the queue,
+ *        and when the last byte of the chain is sent it completes the descriptor and moves to the next one.
+ */
+static void UART_TxChainUdreCallBack(void)
+{
+	UART_TxDesc_t *desc = TxQueueHead;
+	const UART_TxFrag_t *frag;
+
+	if(NULL_PTR == desc)
+	{
+		UART_UDRE_InterruptDisable();
+		return;
+	}
+
+	frag = &desc->Frags[desc->FragIdx];
+	UART_SendByteNoBlock(frag->Data[desc->ByteIdx]);
+	desc->ByteIdx++;
+
+	if(desc->ByteIdx == frag->Len)
+	{
+		desc->ByteIdx = 0;
+		desc->FragIdx++;
+		UART_TxDescSkipEmptyFrags(desc);
+
+		if(desc->FragIdx == desc->FragCount)
+		{
+			// the whole chain is in the UART, the user buffers can be reused now
+			TxQueueHead = desc->Next;
+			if(NULL_PTR == TxQueueHead)
+			{
+				TxQueueTail = NULL_PTR;
+				UART_UDRE_InterruptDisable();
+			}
+			desc->Next   = NULL_PTR;
+			desc->Status = STD_DONE;
+			if(NULL_PTR != desc->pfDone)
+			{
+				desc->pfDone(desc);
+			}
+		}
+	}
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Takes a free descriptor from the pool.
+ *
+ * @return UART_TxDesc_t* the descriptor or NULL_PTR if all the descriptors are in use.
+ */
+UART_TxDesc_t* UART_TxDescAlloc(void)
+{
+	UART_TxDesc_t *desc = NULL_PTR;
+	u8 i, sregCopy;
+
+	Critical_Enter(sregCopy);
+	for(i=0; i<UART_TX_DESC_POOL_SIZE; i++)
+	{
+		if(0 == TxDescPool[i].InUse)
+		{
+			desc = &TxDescPool[i];
+			desc->InUse  = 1;
+			desc->Status = STD_IDLE;
+			desc->Next   = NULL_PTR;
+			break;
+		}
+	}
+	Critical_Exit(sregCopy);
+
+	return desc;
+}
+
+/**
+ * @brief Returns a descriptor to the pool.
+ *
+ * @param desc the descriptor to be freed.
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NULL_POINTER if desc is NULL_PTR
+ *                     - STD_BUSY if the descriptor is still queued
+ */
+Std_Error_t UART_TxDescFree(UART_TxDesc_t *desc)
+{
+	Std_Error_t errorStatus = STD_OK;
+
+	if(NULL_PTR == desc)
+	{
+		errorStatus = STD_NULL_POINTER;
+	}
+	else if(STD_PENDING == desc->Status)
+	{
+		errorStatus = STD_BUSY;
+	}
+	else
+	{
+		desc->Status = STD_IDLE;
+		desc->InUse  = 0;
+	}
+	return errorStatus;
+}
+
+/**
+ * @brief Queues a chain of fragments for transmission.
+ *
+ * The function returns immediately, the fragments are sent in order by the UDRE interrupt
+ * after all the descriptors submitted before this one.
+ * The global interrupt must be enabled.
+ *
+ * @param desc      a descriptor taken from UART_TxDescAlloc().
+ * @param frags     array of fragments (not copied).
+ * @param fragCount number of fragments in the array.
+ * @param pfDone    completion call back (may be NULL_PTR).
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NULL_POINTER if desc or frags is NULL_PTR
+ *                     - STD_BUSY if the descriptor is already queued
+ */
+Std_Error_t UART_TxDescSubmit(UART_TxDesc_t *desc, const UART_TxFrag_t frags[], u8 fragCount, UART_TxDoneCallBack_t pfDone)
+{
+	u8 sregCopy;
+
+	if((NULL_PTR == desc) || (NULL_PTR == frags))
+	{
+		return STD_NULL_POINTER;
+	}
+	if(STD_PENDING == desc->Status)
+	{
+		return STD_BUSY;
+	}
+
+	desc->Frags     = frags;
+	desc->FragCount = fragCount;
+	desc->FragIdx   = 0;
+	desc->ByteIdx   = 0;
+	desc->pfDone    = pfDone;
+	desc->Next      = NULL_PTR;
+	UART_TxDescSkipEmptyFrags(desc);
+
+	if(desc->FragIdx == desc->FragCount)
+	{
+		// nothing to send
+		desc->Status = STD_DONE;
+		if(NULL_PTR != pfDone)
+		{
+			pfDone(desc);
+		}
+		return STD_OK;
+	}
+
+	desc->Status = STD_PENDING;
+
+	Critical_Enter(sregCopy);
+	if(NULL_PTR == TxQueueTail)
+	{
+		TxQueueHead = desc;
+	}
+	else
+	{
+		TxQueueTail->Next = desc;
+	}
+	TxQueueTail = desc;
+	Critical_Exit(sregCopy);
+
+	// the UDRE interrupt fires as soon as it is enabled if the data register is empty
+	UART_UDRE_SetCallBack(UART_TxChainUdreCallBack);
+	UART_UDRE_InterruptEnable();
+
+	return STD_OK;
+}
+
+/**
+ * @brief Removes a descriptor from the transmission queue.
+ *
+ * If the descriptor is being sent the byte already in the UART is completed and the rest of the chain is dropped,
+ * the next queued descriptor starts on the next UDRE interrupt.
+ * The completion call back is not called.
+ *
+ * @param desc the descriptor to be removed.
+ * @return Std_Error_t - STD_OK (also if the descriptor is not queued)
+ *                     - STD_NULL_POINTER if desc is NULL_PTR
+ */
+Std_Error_t UART_TxDescAbort(UART_TxDesc_t *desc)
+{
+	UART_TxDesc_t *prev = NULL_PTR;
+	UART_TxDesc_t *curr;
+	u8 sregCopy;
+
+	if(NULL_PTR == desc)
+	{
+		return STD_NULL_POINTER;
+	}
+
+	Critical_Enter(sregCopy);
+	curr = TxQueueHead;
+	while((NULL_PTR != curr) && (desc != curr))
+	{
+		prev = curr;
+		curr = curr->Next;
+	}
+	if(NULL_PTR != curr)
+	{
+		if(NULL_PTR == prev)
+		{
+			TxQueueHead = desc->Next;
+		}
+		else
+		{
+			prev->Next = desc->Next;
+		}
+		if(TxQueueTail == desc)
+		{
+			TxQueueTail = prev;
+		}
+		if(NULL_PTR == TxQueueHead)
+		{
+			UART_UDRE_InterruptDisable();
+		}
+		desc->Next   = NULL_PTR;
+		desc->Status = STD_IDLE;
+	}
+	Critical_Exit(sregCopy);
+
+	return STD_OK;
+}
+
+/**
+ * @brief Checks if the transmission queue is empty.
+ *
+ * @return Std_Bool_t STD_TRUE if no descriptor is queued.
+ */
+Std_Bool_t UART_TxChainIsIdle(void)
+{
+	return (NULL_PTR == TxQueueHead) ? STD_TRUE : STD_FALSE;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file UART_TxChain.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  Zero-copy scatter-gather transmission over UART.
+ *         The user describes a transfer as a chain of (pointer, length) fragments (ex: header + payload + CRC)
+ *         and submits it on a descriptor taken from a fixed pool.
+ *         The descriptors are queued and sent in order by the UDRE interrupt without copying the data,
+ *         and the completion call back of each descriptor is called when its last byte is handed to the UART.
+ * @version 0.1
+ * @date 2024-04-01
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UART_TXCHAIN_H_
+#define UART_TXCHAIN_H_
+
+#include "Std_Types.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                           Configuration Macros                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define  UART_TX_DESC_POOL_SIZE   4   /**< number of descriptors that can be allocated (queued or idle) at the same time */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/**
+ * @brief one piece of the data to be sent.
+ * @warning the data is NOT copied, it must stay valid and unchanged until the completion call back is called.
+ */
+typedef struct
+{
+	const u8 *Data; /**< address of the first byte of the fragment */
+	u16       Len;  /**< number of bytes of the fragment (zero length fragments are skipped) */
+}UART_TxFrag_t;
+
+typedef struct UART_TxDesc_s UART_TxDesc_t;
+
+/**
+ * @brief Pointer to the completion call back of a descriptor.
+ *        It is called from the UDRE ISR (or from UART_TxDescSubmit for an empty chain) so it must be short.
+ *        The descriptor may be freed or submitted again from inside the call back.
+ */
+typedef void (*UART_TxDoneCallBack_t)(UART_TxDesc_t *desc);
+
+/**
+ * @brief transmission descriptor.
+ *        The user gets it from UART_TxDescAlloc() and must not change its members while it is queued.
+ */
+struct UART_TxDesc_s
+{
+	const UART_TxFrag_t   *Frags;     /**< array of the fragments of the chain (not copied) */
+	u8                     FragCount; /**< number of fragments in the array */
+	u8                     FragIdx;   /**< cursor : the fragment being sent */
+	u16                    ByteIdx;   /**< cursor : the byte being sent inside the current fragment */
+	volatile Std_Status_t  Status;    /**< STD_IDLE : not queued , STD_PENDING : queued or being sent , STD_DONE : sent */
+	UART_TxDoneCallBack_t  pfDone;    /**< completion call back (may be NULL_PTR) */
+	UART_TxDesc_t         *Next;      /**< next descriptor in the transmission queue */
+	u8                     InUse;     /**< 1 if the descriptor is allocated from the pool */
+};
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Takes a free descriptor from the pool.
+ *
+ * @return UART_TxDesc_t* the descriptor or NULL_PTR if all the descriptors are in use.
+ */
+UART_TxDesc_t* UART_TxDescAlloc(void);
+
+/**
+ * @brief Returns a descriptor to the pool.
+ *
+ * @param desc the descriptor to be freed.
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NULL_POINTER if desc is NULL_PTR
+ *                     - STD_BUSY if the descriptor is still queued
+ */
+Std_Error_t UART_TxDescFree(UART_TxDesc_t *desc);
+
+/**
+ * @brief Queues a chain of fragments for transmission.
+ *
+ * The function returns immediately, the fragments are sent in order by the UDRE interrupt
+ * after all the descriptors submitted before this one.
+ * The global interrupt must be enabled.
+ *
+ * @param desc      a descriptor taken from UART_TxDescAlloc().
+ * @param frags     array of fragments (not copied).
+ * @param fragCount number of fragments in the array.
+ * @param pfDone    completion call back (may be NULL_PTR).
+ * @return Std_Error_t - STD_OK
+ *                     - STD_NULL_POINTER if desc or frags is NULL_PTR
+ *                     - STD_BUSY if the descriptor is already queued
+ */
+Std_Error_t UART_TxDescSubmit(UART_TxDesc_t *desc, const UART_TxFrag_t frags[], u8 fragCount, UART_TxDoneCallBack_t pfDone);
+
+/**
+ * @brief Removes a descriptor from the transmission queue.
+ *
+ * If the descriptor is being sent the byte already in the UART is completed and the rest of the chain is dropped,
+ * the next queued descriptor starts on the next UDRE interrupt.
+ * The completion call back is not called.
+ *
+ * @param desc the descriptor to be removed.
+ * @return Std_Error_t - STD_OK (also if the descriptor is not queued)
+ *                     - STD_NULL_POINTER if desc is NULL_PTR
+ */
+Std_Error_t UART_TxDescAbort(UART_TxDesc_t *desc);
+
+/**
+ * @brief Checks if the transmission queue is empty.
+ *
+ * @return Std_Bool_t STD_TRUE if no descriptor is queued.
+ */
+Std_Bool_t UART_TxChainIsIdle(void);
+
+
+#endif /* UART_TXCHAIN_H_ */